@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/ccnx-consumer-window.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxConsumerWindow");
+
+/**
+ * The AIMD multiplicative decrease
+ */
+static const double _aimdBeta = 0.5;
+
+/**
+ * The CUBIC multiplicative decrease and scaling constant (RFC 8312)
+ */
+static const double _cubicBeta = 0.7;
+static const double _cubicC = 0.4;
+
+CCNxConsumerWindow::CCNxConsumerWindow (WindowControlType type, double initialWindow, double maxWindow,
+                                        Time minRto, Time maxRto)
+  : m_type (type), m_window (std::max (initialWindow, 1.0)), m_maxWindow (std::max (maxWindow, m_window)),
+  m_ssthresh (m_maxWindow), m_minRto (minRto), m_maxRto (std::max (minRto, maxRto)), m_hasRttSample (false),
+  m_hasLossEvent (false), m_hasDecreased (false), m_decreaseCount (0), m_cubicWindowMax (0), m_cubicK (0)
+{
+  // RFC 6298: the RTO is 1 second until the first RTT sample
+  m_rto = std::min (std::max (Seconds (1), m_minRto), m_maxRto);
+}
+
+CCNxConsumerWindow::~CCNxConsumerWindow ()
+{
+  // empty
+}
+
+CCNxConsumerWindow::WindowControlType
+CCNxConsumerWindow::GetWindowControl () const
+{
+  return m_type;
+}
+
+double
+CCNxConsumerWindow::GetWindow () const
+{
+  return m_window;
+}
+
+uint32_t
+CCNxConsumerWindow::GetWindowInPackets () const
+{
+  return std::max ((uint32_t) std::floor (m_window), (uint32_t) 1);
+}
+
+double
+CCNxConsumerWindow::GetSlowStartThreshold () const
+{
+  return m_ssthresh;
+}
+
+Time
+CCNxConsumerWindow::GetRto () const
+{
+  return m_rto;
+}
+
+Time
+CCNxConsumerWindow::GetSmoothedRtt () const
+{
+  return m_srtt;
+}
+
+uint64_t
+CCNxConsumerWindow::GetDecreaseCount () const
+{
+  return m_decreaseCount;
+}
+
+void
+CCNxConsumerWindow::SetWindow (double window)
+{
+  m_window = std::min (std::max (window, 1.0), m_maxWindow);
+}
+
+void
+CCNxConsumerWindow::OnResponse (Time now, Time rtt, bool sampleRtt)
+{
+  NS_LOG_FUNCTION (this << now << rtt << sampleRtt);
+
+  if (sampleRtt)
+    {
+      UpdateRto (rtt);
+    }
+
+  if (m_type == WindowControl_Fixed)
+    {
+      return;
+    }
+
+  if (m_window < m_ssthresh)
+    {
+      SetWindow (m_window + 1.0);
+    }
+  else if (m_type == WindowControl_Cubic)
+    {
+      IncreaseCubic (now);
+    }
+  else
+    {
+      IncreaseAimd ();
+    }
+}
+
+void
+CCNxConsumerWindow::IncreaseAimd ()
+{
+  SetWindow (m_window + 1.0 / m_window);
+}
+
+void
+CCNxConsumerWindow::IncreaseCubic (Time now)
+{
+  if (!m_hasDecreased)
+    {
+      // No loss yet, so there is no cubic epoch to grow from
+      IncreaseAimd ();
+      return;
+    }
+
+  double t = (now - m_cubicEpochStart).GetSeconds ();
+  double rtt = m_srtt.GetSeconds ();
+
+  // The window one RTT from now
+  double offset = t + rtt - m_cubicK;
+  double target = _cubicC * offset * offset * offset + m_cubicWindowMax;
+
+  // The TCP-friendly region: never grow slower than AIMD with the same beta would
+  if (rtt > 0)
+    {
+      double aimdWindow = m_cubicWindowMax * _cubicBeta + (3.0 * (1.0 - _cubicBeta) / (1.0 + _cubicBeta)) * (t / rtt);
+      target = std::max (target, aimdWindow);
+    }
+
+  if (target > m_window)
+    {
+      SetWindow (m_window + (target - m_window) / m_window);
+    }
+  else
+    {
+      SetWindow (m_window + 0.01 / m_window);
+    }
+}
+
+void
+CCNxConsumerWindow::OnTimeout (Time now, Time sentTime)
+{
+  NS_LOG_FUNCTION (this << now << sentTime);
+
+  if (m_hasLossEvent && sentTime < m_lastLossEvent)
+    {
+      // Already reacted to this loss event
+      return;
+    }
+
+  m_lastLossEvent = now;
+  m_hasLossEvent = true;
+  m_rto = std::min (m_rto + m_rto, m_maxRto);
+
+  if (m_type == WindowControl_Fixed)
+    {
+      return;
+    }
+
+  if (m_type == WindowControl_Cubic)
+    {
+      m_cubicWindowMax = m_window;
+      m_cubicEpochStart = now;
+      m_cubicK = std::pow (m_cubicWindowMax * (1.0 - _cubicBeta) / _cubicC, 1.0 / 3.0);
+      SetWindow (m_window * _cubicBeta);
+    }
+  else
+    {
+      SetWindow (m_window * _aimdBeta);
+    }
+  m_ssthresh = m_window;
+
+  m_hasDecreased = true;
+  m_decreaseCount++;
+
+  NS_LOG_DEBUG ("Window decreased to " << m_window << " rto " << m_rto);
+}
+
+void
+CCNxConsumerWindow::UpdateRto (Time rtt)
+{
+  int64_t r = rtt.GetNanoSeconds ();
+  int64_t srtt;
+  int64_t rttvar;
+
+  if (!m_hasRttSample)
+    {
+      srtt = r;
+      rttvar = r / 2;
+      m_hasRttSample = true;
+    }
+  else
+    {
+      srtt = m_srtt.GetNanoSeconds ();
+      rttvar = m_rttvar.GetNanoSeconds ();
+      int64_t delta = srtt > r ? srtt - r : r - srtt;
+      rttvar = (3 * rttvar + delta) / 4;
+      srtt = (7 * srtt + r) / 8;
+    }
+
+  m_srtt = NanoSeconds (srtt);
+  m_rttvar = NanoSeconds (rttvar);
+  m_rto = std::min (std::max (NanoSeconds (srtt + 4 * rttvar), m_minRto), m_maxRto);
+}
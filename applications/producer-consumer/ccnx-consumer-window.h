@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_CONSUMER_WINDOW_H_
+#define CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_CONSUMER_WINDOW_H_
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-apps-prod-cons
+ *
+ * The Interest window of a pipelined CCNxConsumer and the retransmission timeout (RTO)
+ * of its Interests.
+ *
+ * The consumer keeps up to GetWindow() Interests outstanding.  Each Content Object that
+ * answers an Interest calls OnResponse() and each Interest timeout calls OnTimeout().
+ *
+ * The window control is one of:
+ * - `WindowControl_Fixed`: the window never changes.
+ * - `WindowControl_Aimd`: slow start (+1 per response) up to the slow start threshold, then
+ *   +1/window per response.  A timeout halves the window.
+ * - `WindowControl_Cubic`: slow start as AIMD, then the window follows the CUBIC function
+ *   of the time since the last timeout (RFC 8312), but never grows slower than AIMD would.
+ *   A timeout multiplies the window by 0.7.
+ *
+ * A loss event starts with the first timeout after the previous one.  A timeout of an Interest
+ * sent before the loss event started is part of the same event and is ignored, so a window of
+ * lost Interests shrinks the window and doubles the RTO only once.
+ *
+ * The RTO follows RFC 6298.  Callers should only pass RTT samples of Interests that were not
+ * retransmitted (Karn's algorithm).
+ */
+class CCNxConsumerWindow : public SimpleRefCount<CCNxConsumerWindow>
+{
+public:
+  /**
+   * How the window reacts to responses and timeouts
+   */
+  enum WindowControlType
+  {
+    WindowControl_Fixed,    //!< Constant window
+    WindowControl_Aimd,     //!< Additive increase, multiplicative decrease (default)
+    WindowControl_Cubic     //!< CUBIC window growth
+  };
+
+  /**
+   * @param [in] type The window control algorithm
+   * @param [in] initialWindow The starting window (at least 1)
+   * @param [in] maxWindow The largest window (at least initialWindow)
+   * @param [in] minRto The smallest RTO
+   * @param [in] maxRto The largest RTO, also the limit of the exponential backoff
+   */
+  CCNxConsumerWindow (WindowControlType type, double initialWindow, double maxWindow,
+                      Time minRto = MilliSeconds (200), Time maxRto = Seconds (60));
+
+  virtual ~CCNxConsumerWindow ();
+
+  /**
+   * @return The window control algorithm
+   */
+  WindowControlType GetWindowControl () const;
+
+  /**
+   * @return The current window, possibly fractional
+   */
+  double GetWindow () const;
+
+  /**
+   * @return The number of Interests that may be outstanding (the window rounded down, at least 1)
+   */
+  uint32_t GetWindowInPackets () const;
+
+  /**
+   * @return The current slow start threshold
+   */
+  double GetSlowStartThreshold () const;
+
+  /**
+   * Called when a Content Object answers an outstanding Interest.  Grows the window.
+   *
+   * @param [in] now The current simulation time
+   * @param [in] rtt The round trip time of the Interest
+   * @param [in] sampleRtt If true, update the RTO with `rtt`.  Should be false if the Interest
+   *                       was retransmitted.
+   */
+  void OnResponse (Time now, Time rtt, bool sampleRtt);
+
+  /**
+   * Called when the retransmission timer of an Interest expires.  If the Interest was sent
+   * after the last loss event started, this starts a new loss event: the RTO doubles and the
+   * window shrinks.
+   *
+   * @param [in] now The current simulation time
+   * @param [in] sentTime When the Interest that timed out was (last) sent
+   */
+  void OnTimeout (Time now, Time sentTime);
+
+  /**
+   * @return The current retransmission timeout
+   */
+  Time GetRto () const;
+
+  /**
+   * @return The smoothed RTT, zero before the first sample
+   */
+  Time GetSmoothedRtt () const;
+
+  /**
+   * @return The number of times the window was decreased
+   */
+  uint64_t GetDecreaseCount () const;
+
+private:
+  void IncreaseAimd ();
+  void IncreaseCubic (Time now);
+  void UpdateRto (Time rtt);
+  void SetWindow (double window);
+
+  WindowControlType m_type;
+  double m_window;
+  double m_maxWindow;
+  double m_ssthresh;
+
+  Time m_minRto;
+  Time m_maxRto;
+  Time m_rto;
+  Time m_srtt;
+  Time m_rttvar;
+  bool m_hasRttSample;
+
+  /**
+   * The start of the last loss event.  Timeouts of Interests sent before it are
+   * part of the same loss event.
+   */
+  Time m_lastLossEvent;
+  bool m_hasLossEvent;
+
+  bool m_hasDecreased;
+  uint64_t m_decreaseCount;
+
+  /**
+   * CUBIC state: the window before the last decrease, the time it happened, and the
+   * time K (in seconds) for the cubic function to grow back to it.
+   */
+  double m_cubicWindowMax;
+  Time m_cubicEpochStart;
+  double m_cubicK;
+};
+
+}
+}
+
+#endif /* CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_CONSUMER_WINDOW_H_ */
@@ -55,7 +55,11 @@
 
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
 #include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/enum.h"
 #include "ns3/ccnx-consumer.h"
 
 using namespace ns3;
@@ -64,6 +68,12 @@ NS_LOG_COMPONENT_DEFINE ("CCNxConsumer");
 NS_OBJECT_ENSURE_REGISTERED (CCNxConsumer);
 
 static bool printConsStatsHeader = 1;
+
+/**
+ * The most RTT samples a consumer keeps for its percentiles
+ */
+static const size_t _rttReservoirSize = 4096;
+
 TypeId
 CCNxConsumer::GetTypeId (void)
 {
@@ -75,7 +85,34 @@ CCNxConsumer::GetTypeId (void)
                    "delay between successive Interests",
                    TimeValue (MilliSeconds (0)),
                    MakeTimeAccessor (&CCNxConsumer::m_requestInterval),
-                   MakeTimeChecker ());
+                   MakeTimeChecker ())
+    .AddAttribute ("Window",
+                   "initial number of outstanding Interests (0 = one Interest every RequestInterval)",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&CCNxConsumer::m_window),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("MaxWindow",
+                   "largest number of outstanding Interests in window mode",
+                   UintegerValue (1024),
+                   MakeUintegerAccessor (&CCNxConsumer::m_maxWindow),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("WindowControl",
+                   "how the window reacts to responses and timeouts in window mode",
+                   EnumValue (CCNxConsumerWindow::WindowControl_Aimd),
+                   MakeEnumAccessor (&CCNxConsumer::m_windowControlType),
+                   MakeEnumChecker (CCNxConsumerWindow::WindowControl_Fixed, "Fixed",
+                                    CCNxConsumerWindow::WindowControl_Aimd, "Aimd",
+                                    CCNxConsumerWindow::WindowControl_Cubic, "Cubic"))
+    .AddAttribute ("MinRto",
+                   "smallest Interest retransmission timeout in window mode",
+                   TimeValue (MilliSeconds (200)),
+                   MakeTimeAccessor (&CCNxConsumer::m_minRto),
+                   MakeTimeChecker ())
+    .AddAttribute ("MaxRetransmissions",
+                   "times an Interest is re-sent after a timeout before it counts as lost",
+                   UintegerValue (3),
+                   MakeUintegerAccessor (&CCNxConsumer::m_maxRetransmissions),
+                   MakeUintegerChecker<uint32_t> ());
   return tid;
 }
 
@@ -90,6 +127,18 @@ CCNxConsumer::CCNxConsumer ()
   m_count = 0;
   m_sum = 0;
   m_sumSquare = 0;
+  m_window = 0;
+  m_maxWindow = 1024;
+  m_windowControlType = CCNxConsumerWindow::WindowControl_Aimd;
+  m_minRto = MilliSeconds (200);
+  m_maxRetransmissions = 3;
+  m_payloadBytesReceived = 0;
+  m_timeouts = 0;
+  m_retransmissions = 0;
+  m_lostInterests = 0;
+  m_fillCursor = 0;
+  m_rttSampleCount = 0;
+  m_rttSampleRandom = CreateObject<UniformRandomVariable> ();
 }
 
 CCNxConsumer::~CCNxConsumer ()
@@ -110,7 +159,17 @@ CCNxConsumer::StartApplication (void)
   m_requestIntervalTimer = Timer (Timer::REMOVE_ON_DESTROY);
   m_requestIntervalTimer.SetFunction (&CCNxConsumer::GenerateTraffic, this);
   m_requestIntervalTimer.SetDelay (m_requestInterval);
-  m_requestIntervalTimer.Schedule ();
+
+  m_startTime = Simulator::Now ();
+  if (m_window > 0)
+    {
+      m_windowControl = Create<CCNxConsumerWindow> (m_windowControlType, m_window, std::max (m_maxWindow, m_window), m_minRto);
+      FillWindow ();
+    }
+  else
+    {
+      m_requestIntervalTimer.Schedule ();
+    }
 }
 
 void
@@ -121,6 +180,10 @@ CCNxConsumer::StopApplication (void)
     {
       m_requestIntervalTimer.Cancel ();
     }
+  for (OutstandingRequestType::iterator i = m_outstandingRequests.begin (); i != m_outstandingRequests.end (); ++i)
+    {
+      Simulator::Cancel (i->second.timeout);
+    }
   m_consumerPortal->Close ();
   if (m_outstandingRequests.size ())
     {
@@ -133,6 +196,10 @@ CCNxConsumer::StopApplication (void)
         "All interest expressed by consumer have been honored by the network");
     }
   CCNxConsumer::ShowStatistics ();
+  if (m_windowControl)
+    {
+      ShowFlowStatistics ();
+    }
 }
 
 void
@@ -150,7 +217,10 @@ CCNxConsumer::InsertOutStandingInterest (Ptr<const CCNxName> interest)
 #if 0
   m_outstandingRequests.insert (interest);
 #else
-  m_outstandingRequests[interest].txTime = (uint64_t) Simulator::Now ().GetMilliSeconds ();
+  OutstandingRequestEntryType &entry = m_outstandingRequests[interest];
+  entry.interestName = interest;
+  entry.txTime = (uint64_t) Simulator::Now ().GetMilliSeconds ();
+  entry.retransmissions = 0;
 #endif
 }
 
@@ -161,10 +231,24 @@ CCNxConsumer::RemoveOutStandingInterest (Ptr<const CCNxName> interest)
 #if 0
   m_outstandingRequests.erase (interest);
 #else
-  uint64_t packet_latency = (uint64_t) Simulator::Now ().GetMilliSeconds () - m_outstandingRequests[interest].txTime ;
+  OutstandingRequestType::iterator i = m_outstandingRequests.find (interest);
+  uint64_t packet_latency = (uint64_t) Simulator::Now ().GetMilliSeconds () - i->second.txTime ;
   m_sum += packet_latency;
   m_sumSquare += packet_latency * packet_latency;
-  m_outstandingRequests.erase (interest);
+
+  if (m_windowControl)
+    {
+      // Karn's algorithm: the RTT of a retransmitted Interest is ambiguous, so do not sample it
+      Simulator::Cancel (i->second.timeout);
+      Time rtt = Simulator::Now () - i->second.lastSent;
+      bool sampleRtt = (i->second.retransmissions == 0);
+      m_windowControl->OnResponse (Simulator::Now (), rtt, sampleRtt);
+      if (sampleRtt)
+        {
+          AddRttSample (rtt);
+        }
+    }
+  m_outstandingRequests.erase (i);
 #endif
 }
 
@@ -193,6 +277,7 @@ CCNxConsumer::ReceiveCallback (Ptr<CCNxPortal> portal)
             {
               NS_LOG_INFO (
                 "CCNxConsumer:Received content back for Node " << GetNode ()->GetId () << *name);
+              m_payloadBytesReceived += packet->GetMessage ()->GetPayloadSize ();
               RemoveOutStandingInterest (name);
             }
           else
@@ -208,6 +293,11 @@ CCNxConsumer::ReceiveCallback (Ptr<CCNxPortal> portal)
           NS_LOG_ERROR ("CCNxConsumer:Bad packet type received " << *packet);
         }
     }
+
+  if (m_windowControl)
+    {
+      FillWindow ();
+    }
 }
 
 void
@@ -218,13 +308,9 @@ CCNxConsumer::GenerateTraffic ()
   m_count++;
   if (name)
     {
-      Ptr<CCNxInterest> interest = Create<CCNxInterest> (name);
-      Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
-      m_consumerPortal->Send (packet);
+      SendInterest (name);
       InsertOutStandingInterest (name);
       m_requestIntervalTimer.Schedule (m_requestInterval);
-      NS_LOG_DEBUG (
-        "CCNxConsumer:Sending interest request" << *packet << " packet dump");
       m_goodInterestsSent++;
     }
   else
@@ -234,6 +320,155 @@ CCNxConsumer::GenerateTraffic ()
     }
 }
 
+void
+CCNxConsumer::FillWindow ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  uint32_t window = m_windowControl->GetWindowInPackets ();
+  while (m_outstandingRequests.size () < window)
+    {
+      // A second Interest for an outstanding name would only aggregate in the PIT, so draw again
+      Ptr<const CCNxName> name;
+      for (int tries = 0; tries < 8 && !name; tries++)
+        {
+          Ptr<const CCNxName> candidate = m_globalContentRepositoryPrefix->GetRandomName ();
+          if (!candidate)
+            {
+              NS_LOG_ERROR ("Bad Interest Generated");
+              m_interestProcessFails++;
+            }
+          else if (!FindOutStandingInterest (candidate))
+            {
+              name = candidate;
+            }
+        }
+
+      if (!name)
+        {
+          // The popular names are all outstanding, so take the next one that is not
+          uint32_t count = m_globalContentRepositoryPrefix->GetContentObjectCount ();
+          for (uint32_t scanned = 0; scanned < count && !name; scanned++)
+            {
+              Ptr<const CCNxName> candidate = m_globalContentRepositoryPrefix->GetNameAtIndex (m_fillCursor++);
+              if (!FindOutStandingInterest (candidate))
+                {
+                  name = candidate;
+                }
+            }
+        }
+
+      if (!name)
+        {
+          // The window is larger than the repository.  A response will free a name.
+          NS_LOG_DEBUG ("Every name is outstanding, " << m_outstandingRequests.size () << " outstanding");
+          break;
+        }
+
+      m_count++;
+      InsertOutStandingInterest (name);
+      SendInterest (name);
+      m_goodInterestsSent++;
+    }
+}
+
+void
+CCNxConsumer::SendInterest (Ptr<const CCNxName> name)
+{
+  NS_LOG_FUNCTION (this << name);
+
+  // Start the timer first, the response may come back before Send() returns
+  if (m_windowControl)
+    {
+      OutstandingRequestEntryType &entry = m_outstandingRequests[name];
+      entry.lastSent = Simulator::Now ();
+      Simulator::Cancel (entry.timeout);
+      entry.timeout = Simulator::Schedule (m_windowControl->GetRto (), &CCNxConsumer::InterestTimeout, this, name);
+    }
+
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (name);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
+  NS_LOG_DEBUG (
+    "CCNxConsumer:Sending interest request" << *packet << " packet dump");
+  m_consumerPortal->Send (packet);
+}
+
+void
+CCNxConsumer::InterestTimeout (Ptr<const CCNxName> name)
+{
+  NS_LOG_FUNCTION (this << name);
+  OutstandingRequestType::iterator i = m_outstandingRequests.find (name);
+  NS_ASSERT_MSG (i != m_outstandingRequests.end (), "Timeout for an Interest that is not outstanding");
+
+  m_timeouts++;
+  m_windowControl->OnTimeout (Simulator::Now (), i->second.lastSent);
+
+  if (i->second.retransmissions < m_maxRetransmissions)
+    {
+      i->second.retransmissions++;
+      m_retransmissions++;
+      NS_LOG_DEBUG ("CCNxConsumer:Retransmitting " << *name << " rto " << m_windowControl->GetRto ());
+      SendInterest (name);
+    }
+  else
+    {
+      NS_LOG_INFO ("CCNxConsumer:Giving up on " << *name << " after " << i->second.retransmissions << " retransmissions");
+      m_lostInterests++;
+      m_outstandingRequests.erase (i);
+      FillWindow ();
+    }
+}
+
+void
+CCNxConsumer::AddRttSample (Time rtt)
+{
+  // Reservoir sampling: the n-th sample replaces a random slot with probability size / n
+  m_rttSampleCount++;
+  if (m_rttSamples.size () < _rttReservoirSize)
+    {
+      m_rttSamples.push_back (rtt.GetMicroSeconds ());
+      return;
+    }
+
+  uint64_t slot = (uint64_t) (m_rttSampleRandom->GetValue () * m_rttSampleCount);
+  if (slot < _rttReservoirSize)
+    {
+      m_rttSamples[slot] = rtt.GetMicroSeconds ();
+    }
+}
+
+double
+CCNxConsumer::GetRttPercentile (double percentile)
+{
+  if (m_rttSamples.empty ())
+    {
+      return 0.0;
+    }
+
+  // nearest rank
+  size_t rank = (size_t) std::ceil (percentile / 100.0 * m_rttSamples.size ());
+  size_t index = rank > 0 ? rank - 1 : 0;
+  index = std::min (index, m_rttSamples.size () - 1);
+  std::nth_element (m_rttSamples.begin (), m_rttSamples.begin () + index, m_rttSamples.end ());
+  return m_rttSamples[index] / 1000.0;
+}
+
+void
+CCNxConsumer::ShowFlowStatistics ()
+{
+  Ptr <Node> node = CCNxConsumer::GetNode ();
+  double elapsed = (Simulator::Now () - m_startTime).GetSeconds ();
+  double goodput = elapsed > 0 ? m_payloadBytesReceived * 8.0 / elapsed : 0.0;
+  double loss = m_goodInterestsSent > 0 ? 100.0 * m_lostInterests / m_goodInterestsSent : 0.0;
+
+  std::cout << "Flow Node " << node->GetId () << " " << *m_globalContentRepositoryPrefix->GetRepositoryPrefix ()
+            << " Goodput(bps) " << goodput
+            << " Rtt(Ms) p50 " << GetRttPercentile (50) << " p95 " << GetRttPercentile (95) << " p99 " << GetRttPercentile (99)
+            << " Window " << m_windowControl->GetWindow ()
+            << " Timeouts " << m_timeouts
+            << " Retransmissions " << m_retransmissions
+            << " Lost " << m_lostInterests
+            << " Loss(%) " << loss << std::endl;
+}
 
 void
 CCNxConsumer::ShowStatistics ()
@@ -62,6 +62,7 @@
 #include "ns3/object.h"
 #include "ns3/nstime.h"
 #include "ns3/timer.h"
+#include "ns3/event-id.h"
 
 #include "ns3/string.h"
 
@@ -77,6 +78,7 @@
 #include "ns3/ccnx-application.h"
 #include "ns3/ccnx-portal.h"
 #include "ns3/ccnx-content-repository.h"
+#include "ns3/ccnx-consumer-window.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -89,6 +91,15 @@ namespace ccnx {
   * The consumer class is derived from the CCNxApplication class which in turn is derived from ns3::Application.
   * The interests generated are routed according FIB entry.
   *
+  * By default the consumer sends one interest every "RequestInterval", whether or not the
+  * previous ones were answered.  Setting the attribute "Window" to a positive value switches
+  * to a pipelined mode that keeps up to a window of interests outstanding and sends a new one
+  * as soon as one is answered.  The window is controlled by a CCNxConsumerWindow selected with
+  * "WindowControl" (Fixed, Aimd, or Cubic).  Each interest has a retransmission timer.  When it
+  * expires the interest is sent again, up to "MaxRetransmissions" times, after which it
+  * counts as lost.  At stop the consumer reports the goodput, the RTT percentiles and the
+  * loss of its flow.
+  *
   */
 
 class CCNxConsumer : public CCNxApplication
@@ -169,6 +180,34 @@ private:
    */
   void GenerateTraffic ();
 
+  /**
+   * In window mode, sends new interests until the window is full.  Names are drawn with
+   * CCNxContentRepository::GetRandomName().  If the draws keep hitting outstanding names (likely
+   * with a skewed popularity), it takes the next repository name that is not outstanding.  The
+   * window only stays short if every name in the repository is outstanding.
+   */
+  void FillWindow ();
+
+  /**
+   * Sends an interest for `name` and (re)starts its retransmission timer in window mode.
+   */
+  void SendInterest (Ptr<const CCNxName> name);
+
+  /**
+   * The retransmission timer of the interest for `name` expired
+   */
+  void InterestTimeout (Ptr<const CCNxName> name);
+
+  /**
+   * Adds an RTT sample to m_rttSamples
+   */
+  void AddRttSample (Time rtt);
+
+  /**
+   * The `percentile` (0 to 100) of the RTT samples, in milliseconds
+   */
+  double GetRttPercentile (double percentile);
+
   Ptr<CCNxPortal> m_consumerPortal;
   Time m_requestInterval;
   Timer m_requestIntervalTimer;
@@ -179,6 +218,9 @@ private:
   	typedef struct {
   		Ptr <const CCNxName> interestName;
   		uint64_t       txTime;
+  		Time           lastSent;          /* window mode: when last (re)transmitted */
+  		uint32_t       retransmissions;   /* window mode: times re-sent after a timeout */
+  		EventId        timeout;           /* window mode: the retransmission timer */
   	}OutstandingRequestEntryType;
 
   	typedef std::map < Ptr <const CCNxName> , OutstandingRequestEntryType , CCNxName::isLessPtrCCNxName > OutstandingRequestType;
@@ -197,6 +239,35 @@ private:
   uint64_t m_count;
   uint64_t m_sum;
   uint64_t m_sumSquare;
+
+  /**
+   * Window mode.  m_window is the attribute "Window" (0 = interval mode).
+   */
+  uint32_t m_window;
+  uint32_t m_maxWindow;
+  CCNxConsumerWindow::WindowControlType m_windowControlType;
+  Time m_minRto;
+  uint32_t m_maxRetransmissions;
+  Ptr<CCNxConsumerWindow> m_windowControl;
+  uint32_t m_fillCursor;                /* next repository index FillWindow() falls back to */
+
+  /**
+   * Per flow statistics of window mode
+   */
+  void ShowFlowStatistics ();
+  Time m_startTime;
+  uint64_t m_payloadBytesReceived;
+  uint64_t m_timeouts;
+  uint64_t m_retransmissions;
+  uint64_t m_lostInterests;
+
+  /**
+   * A uniform random sample (reservoir) of at most a fixed number of the RTTs, in microseconds,
+   * so a long run does not keep every RTT.  m_rttSampleCount is the number of RTTs offered.
+   */
+  std::vector<int64_t> m_rttSamples;
+  uint64_t m_rttSampleCount;
+  Ptr<UniformRandomVariable> m_rttSampleRandom;
 };
 }
 }
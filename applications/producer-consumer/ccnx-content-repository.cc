@@ -53,19 +53,42 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include <cstdlib>
 #include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/double.h"
 #include "ns3/ccnx-content-repository.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
 NS_LOG_COMPONENT_DEFINE ("CCNxContentRepository");
 
+static GlobalValue g_zipfAlpha ("CCNxContentRepositoryZipfAlpha",
+                                "The popularity exponent of CCNxContentRepository::GetRandomName()",
+                                DoubleValue (2.5),
+                                MakeDoubleChecker<double> (0.0));
+
 CCNxContentRepository::CCNxContentRepository (
   Ptr<const CCNxName> repositoryPrefix, uint32_t contentObjectSize,
   uint32_t contentObjectCount)
 {
   NS_LOG_FUNCTION (
     this << repositoryPrefix << contentObjectSize << contentObjectCount);
+  DoubleValue zipfAlpha;
+  g_zipfAlpha.GetValue (zipfAlpha);
+  m_zipfAlpha = zipfAlpha.Get ();
+  m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+  CreateRepository (repositoryPrefix, contentObjectSize, contentObjectCount);
+}
+
+CCNxContentRepository::CCNxContentRepository (
+  Ptr<const CCNxName> repositoryPrefix, uint32_t contentObjectSize,
+  uint32_t contentObjectCount, double zipfAlpha)
+{
+  NS_LOG_FUNCTION (
+    this << repositoryPrefix << contentObjectSize << contentObjectCount << zipfAlpha);
+  NS_ASSERT_MSG (zipfAlpha >= 0, "The Zipf alpha must not be negative, got " << zipfAlpha);
+  m_zipfAlpha = zipfAlpha;
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
   CreateRepository (repositoryPrefix, contentObjectSize, contentObjectCount);
 }
@@ -82,7 +105,7 @@ CCNxContentRepository::CreateRepository (Ptr<const CCNxName> repositoryPrefix,
 {
   NS_LOG_FUNCTION (
     this << repositoryPrefix << contentObjectSize << contentObjectCount);
-  char buffer[8];
+  char buffer[16];
 
   m_repositoryPrefix = repositoryPrefix;
   m_objectSize = contentObjectSize;
@@ -90,7 +113,7 @@ CCNxContentRepository::CreateRepository (Ptr<const CCNxName> repositoryPrefix,
   for (uint32_t ii = 0; ii < contentObjectCount; ii++)
     {
       CCNxNameBuilder nameBuilder (*repositoryPrefix);
-      snprintf (buffer, sizeof(buffer), "%d", ii);
+      snprintf (buffer, sizeof(buffer), "%u", ii);
       nameBuilder.Append (
         Create<CCNxNameSegment> (CCNxNameSegment_Chunk, buffer));
       Ptr<CCNxContentObject> contentObject = Create<CCNxContentObject> (
@@ -99,14 +122,92 @@ CCNxContentRepository::CreateRepository (Ptr<const CCNxName> repositoryPrefix,
       NS_LOG_DEBUG ("Added name " << *nameBuilder.CreateName () << "to repository " << *repositoryPrefix);
 
       // Bucketize the Zipf distribution
-      // (-)1.5 is alpha -- XXX: make that a parameter
-      double pop = std::pow((double)(contentObjectCount - ii), (double) 2.5);
+      double pop = std::pow((double)(contentObjectCount - ii), m_zipfAlpha);
       m_maxPopSize += pop;
       pop_vector.push_back(pop);
 
       // Initialize the hit count to 0
       m_hitCounts.push_back(0);
     }
+
+  CreateAliasTable ();
+}
+
+void
+CCNxContentRepository::CreateAliasTable ()
+{
+  size_t n = pop_vector.size ();
+  m_aliasProbability.assign (n, 1.0);
+  m_alias.resize (n);
+  for (size_t i = 0; i < n; i++)
+    {
+      m_alias[i] = i;
+    }
+
+  if (n == 0 || m_maxPopSize <= 0)
+    {
+      return;
+    }
+
+  // Scale the weights to a mean of 1, then pair each column below 1 with one above 1
+  std::vector<double> scaled (n);
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  for (size_t i = 0; i < n; i++)
+    {
+      scaled[i] = pop_vector[i] * n / m_maxPopSize;
+      if (scaled[i] < 1.0)
+        {
+          small.push_back (i);
+        }
+      else
+        {
+          large.push_back (i);
+        }
+    }
+
+  while (!small.empty () && !large.empty ())
+    {
+      uint32_t s = small.back ();
+      small.pop_back ();
+      uint32_t l = large.back ();
+
+      m_aliasProbability[s] = scaled[s];
+      m_alias[s] = l;
+
+      scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+      if (scaled[l] < 1.0)
+        {
+          large.pop_back ();
+          small.push_back (l);
+        }
+    }
+
+  // Any column left over is 1 up to rounding, so it keeps probability 1
+}
+
+int64_t
+CCNxContentRepository::FindIndex (Ptr<const CCNxName> name) const
+{
+  size_t prefixLength = m_repositoryPrefix->GetSegmentCount ();
+  if (name->GetSegmentCount () != prefixLength + 1)
+    {
+      return -1;
+    }
+
+  Ptr<const CCNxNameSegment> chunk = name->GetSegment (prefixLength);
+  if (chunk->GetType () != CCNxNameSegment_Chunk || chunk->GetValue ().empty ())
+    {
+      return -1;
+    }
+
+  char *end;
+  unsigned long index = strtoul (chunk->GetValue ().c_str (), &end, 10);
+  if (*end != '\0' || index >= m_contentObjects.size ())
+    {
+      return -1;
+    }
+  return index;
 }
 
 Ptr<CCNxContentObject>
@@ -116,9 +217,11 @@ CCNxContentRepository::GetContentObject (Ptr<const CCNxName> interestName)
 
   if (m_repositoryPrefix->IsPrefixOf (*interestName))
     {
-      for (ContentObjectList::iterator ii = m_contentObjects.begin (); ii != m_contentObjects.end (); ++ii)
+      int64_t index = FindIndex (interestName);
+      if (index >= 0)
         {
-          Ptr<CCNxContentObject> contentResponse  = *ii;
+          // The chunk number could be spelled differently (e.g. "007"), so compare the whole name
+          Ptr<CCNxContentObject> contentResponse  = m_contentObjects[index];
           if (interestName->Equals (*contentResponse->GetName ()))
             {
               return contentResponse;
@@ -129,6 +232,13 @@ CCNxContentRepository::GetContentObject (Ptr<const CCNxName> interestName)
   return Ptr <CCNxContentObject> (0);
 }
 
+double
+CCNxContentRepository::GetZipfAlpha () const
+{
+  NS_LOG_FUNCTION (this);
+  return m_zipfAlpha;
+}
+
 Ptr<const CCNxName>
 CCNxContentRepository::GetRepositoryPrefix () const
 {
@@ -154,17 +264,14 @@ Ptr<const CCNxName>
 CCNxContentRepository::GetRandomName ()
 {
   NS_LOG_FUNCTION (this);
-  uint32_t randIndex = m_uniformRandomVariable->GetInteger (0, ((long)m_maxPopSize - 1));
-  uint32_t index = 0;
-  long accPop = 0;
-  for (int i = 0; i < pop_vector.size(); i++) {
-      long pop = (long) pop_vector.at(i);
-      accPop += pop;
-      if (randIndex < accPop) {
-          index = i;
-          break;
-      }
-  }
+  NS_ASSERT_MSG (!m_alias.empty (), "Cannot pick a name from an empty repository");
+
+  uint32_t column = m_uniformRandomVariable->GetInteger (0, m_alias.size () - 1);
+  uint32_t index = column;
+  if (m_uniformRandomVariable->GetValue () >= m_aliasProbability[column])
+    {
+      index = m_alias[column];
+    }
 
   m_hitCounts[index]++;
 
@@ -80,6 +80,15 @@ namespace ccnx {
  * This is then used by the producer class to serve content objects from.
  * This is then used by the consumer class to generate random interest requests for the content objects.
  *
+ * Object `i` is named `repositoryPrefix/chunk=i`.  GetContentObject() parses the chunk number
+ * from the interest name, so a lookup does not depend on the number of objects.
+ *
+ * GetRandomName() picks object `i` with a probability proportional to `(contentObjectCount - i)^alpha`.
+ * It samples from an alias table built once by the constructor, so each draw takes constant time.
+ * The exponent comes from the constructor, or else from the global value
+ * "CCNxContentRepositoryZipfAlpha" (default 2.5), which can be set with
+ * `Config::SetGlobal()` or `--CCNxContentRepositoryZipfAlpha=` on the command line.
+ *
  */
 class CCNxContentRepository : public SimpleRefCount<CCNxContentRepository>
 {
@@ -97,6 +106,17 @@ public:
   CCNxContentRepository ( Ptr <const CCNxName> repositoryPrefix,
                           uint32_t contentObjectSize,
                           uint32_t contentObjectCount);
+
+  /**
+   * As above, but with an explicit popularity exponent instead of the global value
+   * "CCNxContentRepositoryZipfAlpha".
+   *
+   * @param [in] zipfAlpha The popularity exponent (non-negative, 0 is uniform)
+   */
+  CCNxContentRepository ( Ptr <const CCNxName> repositoryPrefix,
+                          uint32_t contentObjectSize,
+                          uint32_t contentObjectCount,
+                          double zipfAlpha);
 /**
  * Destroy the object instantiated
  */
@@ -128,6 +148,11 @@ public:
    */
    Ptr<const CCNxName> GetNameAtIndex (uint32_t index);
 
+  /**
+   * This method returns the popularity exponent of GetRandomName().
+   */
+  double GetZipfAlpha (void) const;
+
   /**
    * This method returns the prefix with which the repository was constructed.
    */
@@ -154,6 +179,16 @@ private:
                          uint32_t contentObjectSize,
                          uint32_t contentObjectCount);
 
+  /**
+   * Builds m_aliasProbability and m_alias from pop_vector (Vose's alias method)
+   */
+  void CreateAliasTable ();
+
+  /**
+   * Returns the index of the object named `name`, or -1 if it is not in the repository
+   */
+  int64_t FindIndex (Ptr <const CCNxName> name) const;
+
 
   Ptr <UniformRandomVariable> m_uniformRandomVariable;
 
@@ -167,6 +202,14 @@ private:
   std::vector<double> pop_vector;
   std::vector<double> m_hitCounts;
   double m_maxPopSize;
+  double m_zipfAlpha;
+
+  /**
+   * The alias table: column `i` is picked uniformly, then it is object `i` with probability
+   * m_aliasProbability[i] and object m_alias[i] otherwise.
+   */
+  std::vector<double> m_aliasProbability;
+  std::vector<uint32_t> m_alias;
 
 };
 }
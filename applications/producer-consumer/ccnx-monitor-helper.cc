@@ -55,6 +55,7 @@
 
 #include "ns3/log.h"
 #include "ns3/ccnx-monitor-helper.h"
+#include "ns3/ccnx-stack-helper.h"
 
 NS_LOG_COMPONENT_DEFINE ("CCNxMonitorHelper");
 
@@ -88,6 +89,11 @@ ApplicationContainer CCNxMonitorHelper::Install (NodeContainer c)
   for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
     {
       Ptr<Node> node = *i;
+      if (!CCNxStackHelper::IsLocalNode (node))
+        {
+          // owned by another partition of a distributed simulation
+          continue;
+        }
       Ptr<CCNxMonitor> consumer = m_consumerFactory.Create<CCNxMonitor> ();
       consumer->SetNode (node);
       consumer->SetContentRepository (m_contentRepository);
@@ -83,6 +83,7 @@ CCNxMonitor::CCNxMonitor ()
 {
   NS_LOG_FUNCTION_NOARGS ();
   m_consumerPortal = Ptr<CCNxPortal> (0);
+  m_random = CreateObject<UniformRandomVariable> ();
   m_goodInterestsSent = 0;
   m_goodContentReceived = 0;
   m_interestProcessFails = 0;
@@ -260,7 +261,7 @@ CCNxMonitor::ReceiveCallback (Ptr<CCNxPortal> portal)
 }
 
 std::string
-generateRandomString(const int len)
+CCNxMonitor::GenerateRandomString (int len)
 {
     std::string result;
     static const char alphanum[] =
@@ -268,8 +269,10 @@ generateRandomString(const int len)
         "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
         "abcdefghijklmnopqrstuvwxyz";
 
+    // Draw from the ns-3 RNG rather than rand() so the names follow the run's seed and stream
+    // assignment and do not depend on what else in the process consumed rand().
     for (int i = 0; i < len; ++i) {
-        result = result + (alphanum[rand() % (sizeof(alphanum) - 1)]);
+        result = result + alphanum[m_random->GetInteger (0, sizeof(alphanum) - 2)];
     }
 
     return result;
@@ -312,7 +315,7 @@ CCNxMonitor::GenerateTraffic ()
   if (name)
     {
       // Build the random segment
-      std::string suffix = generateRandomString(32);
+      std::string suffix = GenerateRandomString (32);
       Ptr<CCNxNameSegment> suffixSegment = Create<CCNxNameSegment>(CCNxNameSegment_Name, suffix);
 
       // Build the probe interest names
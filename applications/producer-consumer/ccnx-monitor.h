@@ -215,7 +215,13 @@ private:
 
   void ProbeTimerCallback (int index, bool hitInterest);
 
+  /**
+   * Returns a random alphanumeric string of `len` characters drawn from m_random.
+   */
+  std::string GenerateRandomString (int len);
+
   Ptr<CCNxPortal> m_consumerPortal;
+  Ptr<UniformRandomVariable> m_random;
   Time m_requestInterval;
   Timer m_requestIntervalTimer;
 #if 0
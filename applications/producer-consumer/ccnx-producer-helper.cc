@@ -55,6 +55,7 @@
 
 #include "ns3/log.h"
 #include "ns3/ccnx-producer-helper.h"
+#include "ns3/ccnx-stack-helper.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -82,6 +83,11 @@ ApplicationContainer CCNxProducerHelper::Install (NodeContainer c)
   for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
     {
       Ptr<Node> node = *i;
+      if (!CCNxStackHelper::IsLocalNode (node))
+        {
+          // owned by another partition of a distributed simulation
+          continue;
+        }
       Ptr<CCNxProducer> producer = m_producerFactory.Create<CCNxProducer> ();
       producer->SetNode (node);
       producer->SetContentRepository (m_contentRepository);
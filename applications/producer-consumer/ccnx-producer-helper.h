@@ -88,6 +88,8 @@ public:
    * @param[in] NodeContainer The nodeContainer on which the consumer has to be installed.
    *
    * @return An ApplicationContainer holding the Application created.
+   *
+   * Nodes that belong to another partition of a distributed simulation are skipped.
    */
   ApplicationContainer Install (NodeContainer c);
 
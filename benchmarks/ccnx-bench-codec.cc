@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * Name codec benchmarks: CCNxCodecName encode and decode.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ccnx-codec-name.h"
+#include "ccnx-benchmark.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace {
+
+/*
+ * `entries` distinct four-segment names (about 40 bytes on the wire), each encoded or decoded
+ * `s_passes` times per run.
+ */
+class NameCodecBenchmark : public CCNxBenchmark
+{
+public:
+  NameCodecBenchmark (const std::string &name, uint64_t entries) : CCNxBenchmark (name), m_entries (entries)
+  {
+    SetParameter ("entries", entries);
+    SetParameter ("passes", s_passes);
+  }
+
+  virtual void Setup ()
+  {
+    for (uint64_t i = 0; i < m_entries; i++)
+      {
+        Ptr<const CCNxName> name = CCNxBenchmarkName ("codec", i, "/name=benchmark/chunk=1");
+        m_names.push_back (name);
+
+        CCNxCodecName codec;
+        codec.SetHeader (name);
+        Buffer buffer (0);
+        buffer.AddAtStart (codec.GetSerializedSize ());
+        codec.Serialize (buffer.Begin ());
+        m_buffers.push_back (buffer);
+      }
+  }
+
+  virtual void Teardown ()
+  {
+    m_names.clear ();
+    m_buffers.clear ();
+  }
+
+protected:
+  static const unsigned s_passes = 10;
+
+  uint64_t m_entries;
+  std::vector<Ptr<const CCNxName> > m_names;
+  std::vector<Buffer> m_buffers;
+};
+
+/*
+ * Times SetHeader(), GetSerializedSize() and Serialize() into a new Buffer, as
+ * CCNxCodecInterest does for every Interest.
+ */
+class NameEncode : public NameCodecBenchmark
+{
+public:
+  NameEncode () : NameCodecBenchmark ("name-codec/encode", 1000)
+  {
+  }
+
+  virtual uint64_t Run ()
+  {
+    uint64_t bytes = 0;
+    for (unsigned pass = 0; pass < s_passes; pass++)
+      {
+        for (size_t i = 0; i < m_names.size (); i++)
+          {
+            CCNxCodecName codec;
+            codec.SetHeader (m_names[i]);
+            Buffer buffer (0);
+            buffer.AddAtStart (codec.GetSerializedSize ());
+            codec.Serialize (buffer.Begin ());
+            bytes += buffer.GetSize ();
+          }
+      }
+    NS_ABORT_MSG_UNLESS (bytes > 0, "Nothing encoded");
+    return s_passes * m_names.size ();
+  }
+};
+
+/*
+ * Times Deserialize() of an encoded name into a new CCNxName.
+ */
+class NameDecode : public NameCodecBenchmark
+{
+public:
+  NameDecode () : NameCodecBenchmark ("name-codec/decode", 1000)
+  {
+  }
+
+  virtual uint64_t Run ()
+  {
+    uint64_t segments = 0;
+    for (unsigned pass = 0; pass < s_passes; pass++)
+      {
+        for (size_t i = 0; i < m_buffers.size (); i++)
+          {
+            CCNxCodecName codec;
+            codec.Deserialize (m_buffers[i].Begin ());
+            segments += codec.GetHeader ()->GetSegmentCount ();
+          }
+      }
+    NS_ABORT_MSG_UNLESS (segments == 4 * s_passes * m_buffers.size (), "Wrong number of name segments decoded");
+    return s_passes * m_buffers.size ();
+  }
+};
+
+CCNxBenchmarkRegistration g_nameEncode (new NameEncode ());
+CCNxBenchmarkRegistration g_nameDecode (new NameDecode ());
+
+} // namespace
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * Content store benchmarks: MatchInterest() hits and misses against a full store.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ccnx-standard-content-store.h"
+#include "ns3/ccnx-standard-forwarder-work-item.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-contentobject.h"
+#include "ccnx-benchmark.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace {
+
+uint64_t g_csMatches = 0;
+uint64_t g_csCallbacks = 0;
+
+void
+MatchInterestCallback (Ptr<CCNxForwarderMessage> message)
+{
+  Ptr<CCNxStandardForwarderWorkItem> workItem = DynamicCast<CCNxStandardForwarderWorkItem, CCNxForwarderMessage> (message);
+  if (workItem->GetContentStorePacket ())
+    {
+      g_csMatches++;
+    }
+  g_csCallbacks++;
+}
+
+void
+AddContentObjectCallback (Ptr<CCNxForwarderMessage> message)
+{
+  g_csCallbacks++;
+}
+
+/*
+ * A content store filled to capacity with `entries` Content Objects.  Run() looks up
+ * `entries` Interests that all hit (names of stored objects) or all miss (names that were
+ * never stored).  The store has zero layer delay and InlineZeroDelay set, so it calls
+ * back before MatchInterest() returns.
+ */
+class ContentStoreMatch : public CCNxBenchmark
+{
+public:
+  ContentStoreMatch (const std::string &name, bool hit, uint64_t entries)
+    : CCNxBenchmark (name), m_hit (hit), m_entries (entries)
+  {
+    SetParameter ("entries", entries);
+  }
+
+  virtual void Setup ()
+  {
+    m_contentStore = CreateObject<CCNxStandardContentStore> ();
+    m_contentStore->SetAttribute ("ObjectCapacity", IntegerValue (m_entries));
+    m_contentStore->SetAttribute ("LayerDelayConstant", TimeValue (Seconds (0)));
+    m_contentStore->SetAttribute ("LayerDelaySlope", TimeValue (Seconds (0)));
+    m_contentStore->SetAttribute ("InlineZeroDelay", BooleanValue (true));
+    m_contentStore->SetMatchInterestCallback (MakeCallback (&MatchInterestCallback));
+    m_contentStore->SetAddContentObjectCallback (MakeCallback (&AddContentObjectCallback));
+    m_contentStore->Initialize ();
+
+    m_ingress = Create<CCNxBenchmarkConnection> ();
+    Ptr<CCNxConnection> nextHop = Create<CCNxBenchmarkConnection> ();
+    Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+    egress->push_back (m_ingress);
+
+    g_csCallbacks = 0;
+    for (uint64_t i = 0; i < m_entries; i++)
+      {
+        Ptr<CCNxPacket> content = CCNxPacket::CreateFromMessage (Create<CCNxContentObject> (CCNxBenchmarkName ("cs", i)));
+        m_contentStore->AddContentObject (Create<CCNxStandardForwarderWorkItem> (content, nextHop, Ptr<CCNxConnection> (0)), egress);
+      }
+    NS_ABORT_MSG_UNLESS (g_csCallbacks == m_entries, "Content store did not call back inline");
+    NS_ABORT_MSG_UNLESS (m_contentStore->GetObjectCount () == m_entries, "Content store is not full");
+
+    uint64_t seed = 2;
+    for (uint64_t i = 0; i < m_entries; i++)
+      {
+        uint64_t index = CCNxBenchmarkRunner::NextRandom (seed) % m_entries;
+        Ptr<CCNxName> name = CCNxBenchmarkName (m_hit ? "cs" : "cs-miss", index);
+        m_interests.push_back (CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name)));
+      }
+  }
+
+  virtual uint64_t Run ()
+  {
+    g_csMatches = 0;
+    for (size_t i = 0; i < m_interests.size (); i++)
+      {
+        m_contentStore->MatchInterest (Create<CCNxStandardForwarderWorkItem> (m_interests[i], m_ingress, Ptr<CCNxConnection> (0)));
+      }
+    NS_ABORT_MSG_UNLESS (g_csMatches == (m_hit ? m_interests.size () : 0), "Wrong number of content store hits");
+    return m_interests.size ();
+  }
+
+  virtual void Teardown ()
+  {
+    m_contentStore->Dispose ();
+    m_contentStore = 0;
+    m_interests.clear ();
+  }
+
+private:
+  bool m_hit;
+  uint64_t m_entries;
+  Ptr<CCNxStandardContentStore> m_contentStore;
+  Ptr<CCNxConnection> m_ingress;
+  std::vector<Ptr<CCNxPacket> > m_interests;
+};
+
+CCNxBenchmarkRegistration g_csHit (new ContentStoreMatch ("content-store/hit", true, 100000));
+CCNxBenchmarkRegistration g_csMiss (new ContentStoreMatch ("content-store/miss", false, 100000));
+
+} // namespace
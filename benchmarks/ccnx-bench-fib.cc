@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * FIB benchmark: longest prefix match over 1k, 100k and 1M routes.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ccnx-standard-fib.h"
+#include "ns3/ccnx-standard-forwarder-work-item.h"
+#include "ns3/ccnx-interest.h"
+#include "ccnx-benchmark.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace {
+
+uint64_t g_fibCallbacks = 0;
+
+void
+LookupCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egress)
+{
+  g_fibCallbacks++;
+}
+
+/*
+ * `entries` routes ccnx:/name=fib/name=N, each to one of 16 next hops.  Run() looks up
+ * Interests two segments longer than a route, picked in a fixed pseudo-random order, so
+ * the match is not the full name.  The FIB has zero layer delay and
+ * InlineZeroDelay set, so it calls back before Lookup() returns.
+ */
+class FibLpm : public CCNxBenchmark
+{
+public:
+  FibLpm (uint64_t entries) : CCNxBenchmark ("fib/lpm"), m_entries (entries)
+  {
+    SetParameter ("entries", entries);
+    SetParameter ("lookups", s_lookups);
+  }
+
+  virtual void Setup ()
+  {
+    m_fib = CreateObject<CCNxStandardFib> ();
+    m_fib->SetAttribute ("LayerDelayConstant", TimeValue (Seconds (0)));
+    m_fib->SetAttribute ("LayerDelaySlope", TimeValue (Seconds (0)));
+    m_fib->SetAttribute ("InlineZeroDelay", BooleanValue (true));
+    m_fib->SetLookupCallback (MakeCallback (&LookupCallback));
+    m_fib->Initialize ();
+
+    std::vector<Ptr<CCNxConnection> > nextHops;
+    for (unsigned i = 0; i < 16; i++)
+      {
+        nextHops.push_back (Create<CCNxBenchmarkConnection> ());
+      }
+    for (uint64_t i = 0; i < m_entries; i++)
+      {
+        m_fib->AddRoute (CCNxBenchmarkName ("fib", i), nextHops[i % nextHops.size ()]);
+      }
+
+    m_ingress = Create<CCNxBenchmarkConnection> ();
+    uint64_t seed = 1;
+    for (uint64_t i = 0; i < s_lookups; i++)
+      {
+        uint64_t route = CCNxBenchmarkRunner::NextRandom (seed) % m_entries;
+        Ptr<CCNxName> name = CCNxBenchmarkName ("fib", route, "/name=object/chunk=1");
+        m_interests.push_back (CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name)));
+      }
+  }
+
+  virtual uint64_t Run ()
+  {
+    g_fibCallbacks = 0;
+    for (size_t i = 0; i < m_interests.size (); i++)
+      {
+        m_fib->Lookup (Create<CCNxStandardForwarderWorkItem> (m_interests[i], m_ingress, Ptr<CCNxConnection> (0)));
+      }
+    NS_ABORT_MSG_UNLESS (g_fibCallbacks == m_interests.size (), "FIB did not call back inline");
+    return m_interests.size ();
+  }
+
+  virtual void Teardown ()
+  {
+    m_fib->Dispose ();
+    m_fib = 0;
+    m_interests.clear ();
+  }
+
+private:
+  static const uint64_t s_lookups = 100000;
+
+  uint64_t m_entries;
+  Ptr<CCNxStandardFib> m_fib;
+  Ptr<CCNxConnection> m_ingress;
+  std::vector<Ptr<CCNxPacket> > m_interests;
+};
+
+CCNxBenchmarkRegistration g_fib1k (new FibLpm (1000));
+CCNxBenchmarkRegistration g_fib100k (new FibLpm (100000));
+CCNxBenchmarkRegistration g_fib1m (new FibLpm (1000000));
+
+} // namespace
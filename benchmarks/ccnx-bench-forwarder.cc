@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * End-to-end forwarder benchmarks: packets per second through one CCNxStandardForwarder.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ccnx-standard-forwarder.h"
+#include "ns3/ccnx-standard-pit-factory.h"
+#include "ns3/ccnx-standard-fib-factory.h"
+#include "ns3/ccnx-standard-content-store-factory.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-contentobject.h"
+#include "ccnx-benchmark.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace {
+
+uint64_t g_routed = 0;
+
+void
+RouteCallback (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> ingress, enum CCNxRoutingError::RoutingErrno routingErrno,
+               Ptr<CCNxConnectionList> connections)
+{
+  if (routingErrno == CCNxRoutingError::CCNxRoutingError_NoError && connections->size () > 0)
+    {
+      g_routed++;
+    }
+}
+
+/*
+ * Routes `entries` Interests from a consumer to a producer (PIT miss, content store miss,
+ * FIB match), then the `entries` Content Objects back (PIT satisfy, content store add).
+ * Every packet is forwarded, so Run() returns 2 * `entries` packets.
+ *
+ * "fused" sets every layer delay to zero and turns on InlineZeroDelay, so the forwarder, PIT,
+ * FIB and content store run inline and this is the CPU cost of forwarding.  "staged" uses the default layer delays and
+ * runs the simulator, so it includes the delay queues and event scheduling a simulation pays.
+ * Prepare() makes a new forwarder, so each run starts with an empty PIT and content store.
+ */
+class ForwarderThroughput : public CCNxBenchmark
+{
+public:
+  ForwarderThroughput (const std::string &name, bool fused, uint64_t entries)
+    : CCNxBenchmark (name), m_fused (fused), m_entries (entries)
+  {
+    SetParameter ("entries", entries);
+  }
+
+  virtual void Setup ()
+  {
+    m_consumer = Create<CCNxBenchmarkConnection> ();
+    m_producer = Create<CCNxBenchmarkConnection> ();
+    for (uint64_t i = 0; i < m_entries; i++)
+      {
+        Ptr<CCNxName> name = CCNxBenchmarkName ("forwarder", i, "/chunk=1");
+        m_interests.push_back (CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name)));
+        m_contents.push_back (CCNxPacket::CreateFromMessage (Create<CCNxContentObject> (name, Create<CCNxBuffer> (1200, true))));
+      }
+  }
+
+  virtual void Prepare ()
+  {
+    Ptr<CCNxStandardForwarder> forwarder = CreateObject<CCNxStandardForwarder> ();
+    if (m_fused)
+      {
+        CCNxStandardPitFactory pitFactory;
+        pitFactory.SetLayerDelayConstant (Seconds (0));
+        pitFactory.SetLayerDelaySlope (Seconds (0));
+        pitFactory.SetInlineZeroDelay (true);
+
+        CCNxStandardFibFactory fibFactory;
+        fibFactory.SetLayerDelayConstant (Seconds (0));
+        fibFactory.SetLayerDelaySlope (Seconds (0));
+        fibFactory.SetInlineZeroDelay (true);
+
+        CCNxStandardContentStoreFactory contentStoreFactory;
+        contentStoreFactory.SetLayerDelayConstant (Seconds (0));
+        contentStoreFactory.SetLayerDelaySlope (Seconds (0));
+        contentStoreFactory.SetInlineZeroDelay (true);
+
+        forwarder->SetAttribute ("PitFactory", ObjectFactoryValue (pitFactory));
+        forwarder->SetAttribute ("FibFactory", ObjectFactoryValue (fibFactory));
+        forwarder->SetAttribute ("ContentStoreFactory", ObjectFactoryValue (contentStoreFactory));
+        forwarder->SetAttribute ("LayerDelayConstant", TimeValue (Seconds (0)));
+        forwarder->SetAttribute ("LayerDelaySlope", TimeValue (Seconds (0)));
+        forwarder->SetAttribute ("InlineZeroDelay", BooleanValue (true));
+      }
+    forwarder->SetRouteCallback (MakeCallback (&RouteCallback));
+    forwarder->Initialize ();
+    forwarder->AddRoute (m_producer, Create<CCNxName> ("ccnx:/name=forwarder"));
+
+    if (m_forwarder)
+      {
+        m_forwarder->Dispose ();
+      }
+    m_forwarder = forwarder;
+  }
+
+  virtual uint64_t Run ()
+  {
+    g_routed = 0;
+    for (size_t i = 0; i < m_interests.size (); i++)
+      {
+        m_forwarder->RouteInput (m_interests[i], m_consumer);
+      }
+    Drain ();
+    for (size_t i = 0; i < m_contents.size (); i++)
+      {
+        m_forwarder->RouteInput (m_contents[i], m_producer);
+      }
+    Drain ();
+    NS_ABORT_MSG_UNLESS (g_routed == m_interests.size () + m_contents.size (),
+                         GetName () << " forwarded " << g_routed << " packets");
+    return g_routed;
+  }
+
+  virtual void Teardown ()
+  {
+    m_forwarder->Dispose ();
+    m_forwarder = 0;
+    m_interests.clear ();
+    m_contents.clear ();
+    Simulator::Destroy ();
+  }
+
+private:
+  void Drain ()
+  {
+    if (!m_fused)
+      {
+        // Each layer serves a packet in a few us, so 10k packets drain well within this,
+        // and it is shorter than the 200 ms PIT lifetime the Interests wait out
+        Simulator::Stop (MilliSeconds (100));
+        Simulator::Run ();
+      }
+  }
+
+  bool m_fused;
+  uint64_t m_entries;
+  Ptr<CCNxStandardForwarder> m_forwarder;
+  Ptr<CCNxConnection> m_consumer;
+  Ptr<CCNxConnection> m_producer;
+  std::vector<Ptr<CCNxPacket> > m_interests;
+  std::vector<Ptr<CCNxPacket> > m_contents;
+};
+
+CCNxBenchmarkRegistration g_forwarderFused (new ForwarderThroughput ("forwarder/fused", true, 10000));
+CCNxBenchmarkRegistration g_forwarderStaged (new ForwarderThroughput ("forwarder/staged", false, 10000));
+
+} // namespace
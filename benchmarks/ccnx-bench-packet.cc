@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * Packet decode benchmarks: CCNxPacket::CreateFromNs3Packet() of Interests and Content Objects.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ccnx-packet.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-contentobject.h"
+#include "ccnx-benchmark.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace {
+
+/*
+ * Decodes `entries` distinct wire-format packets, `s_passes` times each, as the
+ * CCNxL3Protocol does for every received packet.  Content Objects carry `payload` bytes,
+ * so their decode includes the ContentObjectHash.
+ */
+class CreateFromNs3Packet : public CCNxBenchmark
+{
+public:
+  CreateFromNs3Packet (const std::string &name, bool content, uint64_t payload)
+    : CCNxBenchmark (name), m_content (content), m_payload (payload)
+  {
+    SetParameter ("entries", s_entries);
+    SetParameter ("passes", s_passes);
+    if (content)
+      {
+        SetParameter ("payload", payload);
+      }
+  }
+
+  virtual void Setup ()
+  {
+    for (uint64_t i = 0; i < s_entries; i++)
+      {
+        Ptr<CCNxName> name = CCNxBenchmarkName ("packet", i, "/chunk=1");
+        Ptr<CCNxMessage> message;
+        if (m_content)
+          {
+            message = Create<CCNxContentObject> (name, Create<CCNxBuffer> (m_payload, true));
+          }
+        else
+          {
+            message = Create<CCNxInterest> (name);
+          }
+        m_packets.push_back (CCNxPacket::CreateFromMessage (message)->CreateNs3Packet ());
+      }
+  }
+
+  virtual uint64_t Run ()
+  {
+    uint64_t decoded = 0;
+    for (unsigned pass = 0; pass < s_passes; pass++)
+      {
+        for (size_t i = 0; i < m_packets.size (); i++)
+          {
+            if (CCNxPacket::CreateFromNs3Packet (m_packets[i])->GetMessage ())
+              {
+                decoded++;
+              }
+          }
+      }
+    NS_ABORT_MSG_UNLESS (decoded == s_passes * m_packets.size (), "Wrong number of packets decoded");
+    return decoded;
+  }
+
+  virtual void Teardown ()
+  {
+    m_packets.clear ();
+  }
+
+private:
+  static const uint64_t s_entries = 1000;
+  static const unsigned s_passes = 10;
+
+  bool m_content;
+  uint64_t m_payload;
+  std::vector<Ptr<const Packet> > m_packets;
+};
+
+CCNxBenchmarkRegistration g_packetInterest (new CreateFromNs3Packet ("packet/decode-interest", false, 0));
+CCNxBenchmarkRegistration g_packetContent (new CreateFromNs3Packet ("packet/decode-content", true, 1200));
+
+} // namespace
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * PIT benchmarks: Interest insert and Content Object satisfy, for the standard and hash PITs.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ccnx-standard-pit.h"
+#include "ns3/ccnx-hash-pit.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-contentobject.h"
+#include "ccnx-benchmark.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace {
+
+uint64_t g_pitCallbacks = 0;
+
+void
+ReceiveInterestCallback (Ptr<CCNxForwarderMessage> message, enum CCNxPit::Verdict verdict)
+{
+  g_pitCallbacks++;
+}
+
+void
+SatisfyInterestCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egress)
+{
+  g_pitCallbacks++;
+}
+
+/*
+ * `entries` distinct Interests from one ingress, and a Content Object for each from one next hop.
+ * The PIT has zero layer delay and InlineZeroDelay set, so it calls back before ReceiveInterest()
+ * or SatisfyInterest() returns.
+ */
+class PitBenchmark : public CCNxBenchmark
+{
+public:
+  PitBenchmark (const std::string &name, const std::string &pitType, uint64_t entries)
+    : CCNxBenchmark (name), m_pitType (pitType), m_entries (entries), m_pending (false)
+  {
+    SetParameter ("entries", entries);
+  }
+
+  virtual void Setup ()
+  {
+    ObjectFactory factory;
+    factory.SetTypeId (m_pitType);
+    factory.Set ("LayerDelayConstant", TimeValue (Seconds (0)));
+    factory.Set ("LayerDelaySlope", TimeValue (Seconds (0)));
+    factory.Set ("InlineZeroDelay", BooleanValue (true));
+    m_pit = factory.Create<CCNxPit> ();
+    m_pit->SetReceiveInterestCallback (MakeCallback (&ReceiveInterestCallback));
+    m_pit->SetSatisfyInterestCallback (MakeCallback (&SatisfyInterestCallback));
+    m_pit->Initialize ();
+
+    m_ingress = Create<CCNxBenchmarkConnection> ();
+    m_nextHop = Create<CCNxBenchmarkConnection> ();
+    for (uint64_t i = 0; i < m_entries; i++)
+      {
+        Ptr<CCNxName> name = CCNxBenchmarkName ("pit", i, "/chunk=1");
+        m_interests.push_back (CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name)));
+        m_contents.push_back (CCNxPacket::CreateFromMessage (Create<CCNxContentObject> (name)));
+      }
+  }
+
+  virtual void Teardown ()
+  {
+    if (m_pending)
+      {
+        Satisfy ();
+      }
+    NS_ABORT_MSG_UNLESS (m_pit->CountEntries () == 0, GetName () << " left entries in the PIT");
+    m_pit->Dispose ();
+    m_pit = 0;
+    m_interests.clear ();
+    m_contents.clear ();
+  }
+
+protected:
+  uint64_t Insert ()
+  {
+    g_pitCallbacks = 0;
+    for (size_t i = 0; i < m_interests.size (); i++)
+      {
+        m_pit->ReceiveInterest (Create<CCNxForwarderMessage> (m_interests[i], m_ingress));
+      }
+    NS_ABORT_MSG_UNLESS (g_pitCallbacks == m_interests.size (), "PIT did not call back inline");
+    m_pending = true;
+    return m_interests.size ();
+  }
+
+  uint64_t Satisfy ()
+  {
+    g_pitCallbacks = 0;
+    for (size_t i = 0; i < m_contents.size (); i++)
+      {
+        m_pit->SatisfyInterest (Create<CCNxForwarderMessage> (m_contents[i], m_nextHop));
+      }
+    NS_ABORT_MSG_UNLESS (g_pitCallbacks == m_contents.size (), "PIT did not call back inline");
+    m_pending = false;
+    return m_contents.size ();
+  }
+
+  bool IsPending () const
+  {
+    return m_pending;
+  }
+
+private:
+  std::string m_pitType;
+  uint64_t m_entries;
+  bool m_pending;
+  Ptr<CCNxPit> m_pit;
+  Ptr<CCNxConnection> m_ingress;
+  Ptr<CCNxConnection> m_nextHop;
+  std::vector<Ptr<CCNxPacket> > m_interests;
+  std::vector<Ptr<CCNxPacket> > m_contents;
+};
+
+/*
+ * Times ReceiveInterest() of new Interests into an empty PIT.
+ */
+class PitInsert : public PitBenchmark
+{
+public:
+  PitInsert (const std::string &name, const std::string &pitType, uint64_t entries)
+    : PitBenchmark (name, pitType, entries)
+  {
+  }
+
+  virtual void Prepare ()
+  {
+    if (IsPending ())
+      {
+        Satisfy ();
+      }
+  }
+
+  virtual uint64_t Run ()
+  {
+    return Insert ();
+  }
+};
+
+/*
+ * Times SatisfyInterest() of a PIT holding one entry per Content Object.
+ */
+class PitSatisfy : public PitBenchmark
+{
+public:
+  PitSatisfy (const std::string &name, const std::string &pitType, uint64_t entries)
+    : PitBenchmark (name, pitType, entries)
+  {
+  }
+
+  virtual void Prepare ()
+  {
+    Insert ();
+  }
+
+  virtual uint64_t Run ()
+  {
+    return Satisfy ();
+  }
+};
+
+CCNxBenchmarkRegistration g_pitInsert (new PitInsert ("pit/insert", "ns3::ccnx::CCNxStandardPit", 100000));
+CCNxBenchmarkRegistration g_pitSatisfy (new PitSatisfy ("pit/satisfy", "ns3::ccnx::CCNxStandardPit", 100000));
+CCNxBenchmarkRegistration g_hashPitInsert (new PitInsert ("hash-pit/insert", "ns3::ccnx::CCNxHashPit", 100000));
+CCNxBenchmarkRegistration g_hashPitSatisfy (new PitSatisfy ("hash-pit/satisfy", "ns3::ccnx::CCNxHashPit", 100000));
+
+} // namespace
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * Driver for the forwarding-plane micro-benchmarks.
+ *
+ * Runs every registered CCNxBenchmark whose name contains --filter and writes the results to
+ * stdout and, as JSON, to --json.  Times are wall clock (steady_clock) in ns per operation;
+ * compare runs made with the same build profile on the same machine.
+ *
+ *   ./waf --run "ccnx-benchmarks --filter=fib --repetitions=10 --json=fib.json"
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "ns3/core-module.h"
+#include "ccnx-benchmark.h"
+
+using namespace ns3;
+
+typedef std::chrono::steady_clock Clock;
+
+namespace {
+
+/*
+ * Function-local so registration from other translation units' static objects
+ * does not depend on static initialization order.
+ */
+std::vector<CCNxBenchmark *> &
+Registry ()
+{
+  static std::vector<CCNxBenchmark *> benchmarks;
+  return benchmarks;
+}
+
+uint64_t g_maxEntries = 1000000;
+
+struct Result
+{
+  CCNxBenchmark *benchmark;
+  uint64_t operations;
+  std::vector<double> samples;   // ns per operation, one per repetition
+  double median;
+};
+
+std::string
+JsonString (const std::string &s)
+{
+  std::ostringstream os;
+  os << '"';
+  for (std::string::const_iterator c = s.begin (); c != s.end (); ++c)
+    {
+      if (*c == '"' || *c == '\\')
+        {
+          os << '\\';
+        }
+      os << *c;
+    }
+  os << '"';
+  return os.str ();
+}
+
+const char *
+BuildProfile ()
+{
+#if defined(NS3_BUILD_PROFILE_DEBUG)
+  return "debug";
+#elif defined(NS3_BUILD_PROFILE_RELEASE)
+  return "release";
+#elif defined(NS3_BUILD_PROFILE_OPTIMIZED)
+  return "optimized";
+#else
+  return "unknown";
+#endif
+}
+
+void
+WriteJson (std::ostream &os, const std::vector<Result> &results, unsigned repetitions)
+{
+  os << std::setprecision (6) << std::fixed;
+  os << "{\n";
+  os << "  \"schema\": \"ccnx-benchmarks/1\",\n";
+  os << "  \"build\": { \"profile\": " << JsonString (BuildProfile ())
+     << ", \"compiler\": " << JsonString (__VERSION__) << " },\n";
+  os << "  \"repetitions\": " << repetitions << ",\n";
+  os << "  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size (); i++)
+    {
+      const Result &r = results[i];
+      os << (i ? ",\n" : "\n");
+      os << "    {\n";
+      os << "      \"name\": " << JsonString (r.benchmark->GetName ()) << ",\n";
+      os << "      \"parameters\": {";
+      const CCNxBenchmark::ParameterMap &parameters = r.benchmark->GetParameters ();
+      for (CCNxBenchmark::ParameterMap::const_iterator p = parameters.begin (); p != parameters.end (); ++p)
+        {
+          os << (p == parameters.begin () ? " " : ", ") << JsonString (p->first) << ": " << p->second;
+        }
+      os << " },\n";
+      os << "      \"operations\": " << r.operations << ",\n";
+      os << "      \"ns_per_op\": { \"median\": " << r.median
+         << ", \"min\": " << *std::min_element (r.samples.begin (), r.samples.end ())
+         << ", \"max\": " << *std::max_element (r.samples.begin (), r.samples.end ()) << " },\n";
+      os << "      \"ops_per_sec\": " << (r.median > 0 ? 1e9 / r.median : 0) << ",\n";
+      os << "      \"samples\": [";
+      for (size_t s = 0; s < r.samples.size (); s++)
+        {
+          os << (s ? ", " : "") << r.samples[s];
+        }
+      os << "]\n";
+      os << "    }";
+    }
+  os << "\n  ]\n}\n";
+}
+
+} // namespace
+
+CCNxBenchmark::CCNxBenchmark (const std::string &name) : m_name (name)
+{
+}
+
+CCNxBenchmark::~CCNxBenchmark ()
+{
+}
+
+const std::string &
+CCNxBenchmark::GetName () const
+{
+  return m_name;
+}
+
+void
+CCNxBenchmark::SetParameter (const std::string &key, uint64_t value)
+{
+  m_parameters[key] = value;
+}
+
+const CCNxBenchmark::ParameterMap &
+CCNxBenchmark::GetParameters () const
+{
+  return m_parameters;
+}
+
+void
+CCNxBenchmark::Setup ()
+{
+}
+
+void
+CCNxBenchmark::Prepare ()
+{
+}
+
+void
+CCNxBenchmark::Teardown ()
+{
+}
+
+void
+CCNxBenchmarkRunner::Add (CCNxBenchmark *benchmark)
+{
+  Registry ().push_back (benchmark);
+}
+
+uint64_t
+CCNxBenchmarkRunner::NextRandom (uint64_t &state)
+{
+  // Knuth's MMIX constants
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return state >> 11;
+}
+
+Ptr<ccnx::CCNxName>
+CCNxBenchmarkName (const std::string &prefix, uint64_t index, const std::string &suffix)
+{
+  std::ostringstream uri;
+  uri << "ccnx:/name=" << prefix << "/name=" << index << suffix;
+  return Create<ccnx::CCNxName> (uri.str ());
+}
+
+int
+CCNxBenchmarkRunner::Main (int argc, char *argv[])
+{
+  std::string filter;
+  std::string jsonFile = "ccnx-benchmarks.json";
+  unsigned repetitions = 5;
+  bool list = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("filter", "Run only benchmarks whose name contains this string", filter);
+  cmd.AddValue ("repetitions", "Timed runs per benchmark (after one warm-up run)", repetitions);
+  cmd.AddValue ("json", "File for the JSON report (empty for none)", jsonFile);
+  cmd.AddValue ("maxEntries", "Skip benchmarks that build tables larger than this", g_maxEntries);
+  cmd.AddValue ("list", "List the benchmarks and exit", list);
+  cmd.Parse (argc, argv);
+
+  if (repetitions == 0)
+    {
+      repetitions = 1;
+    }
+
+  std::vector<CCNxBenchmark *> &benchmarks = Registry ();
+  std::vector<Result> results;
+
+  std::cout << std::left << std::setw (36) << "benchmark" << std::right
+            << std::setw (12) << "ops" << std::setw (14) << "ns/op" << std::setw (14) << "min"
+            << std::setw (14) << "max" << std::setw (16) << "ops/s" << std::endl;
+
+  for (std::vector<CCNxBenchmark *>::iterator i = benchmarks.begin (); i != benchmarks.end (); ++i)
+    {
+      CCNxBenchmark *benchmark = *i;
+      if (benchmark->GetName ().find (filter) == std::string::npos)
+        {
+          continue;
+        }
+
+      const CCNxBenchmark::ParameterMap &parameters = benchmark->GetParameters ();
+      CCNxBenchmark::ParameterMap::const_iterator entries = parameters.find ("entries");
+      if (entries != parameters.end () && entries->second > g_maxEntries)
+        {
+          continue;
+        }
+
+      std::ostringstream label;
+      label << benchmark->GetName ();
+      for (CCNxBenchmark::ParameterMap::const_iterator p = parameters.begin (); p != parameters.end (); ++p)
+        {
+          label << " " << p->first << "=" << p->second;
+        }
+
+      if (list)
+        {
+          std::cout << label.str () << std::endl;
+          continue;
+        }
+
+      Result result;
+      result.benchmark = benchmark;
+      result.operations = 0;
+
+      benchmark->Setup ();
+      for (unsigned rep = 0; rep <= repetitions; rep++)
+        {
+          benchmark->Prepare ();
+          Clock::time_point start = Clock::now ();
+          uint64_t operations = benchmark->Run ();
+          Clock::time_point stop = Clock::now ();
+
+          // Repetition 0 is the warm-up
+          if (rep > 0 && operations > 0)
+            {
+              double ns = std::chrono::duration_cast<std::chrono::nanoseconds> (stop - start).count ();
+              result.samples.push_back (ns / operations);
+              result.operations = operations;
+            }
+        }
+      benchmark->Teardown ();
+
+      if (result.samples.empty ())
+        {
+          std::cerr << "Benchmark " << benchmark->GetName () << " did no operations" << std::endl;
+          return 1;
+        }
+
+      std::vector<double> sorted (result.samples);
+      std::sort (sorted.begin (), sorted.end ());
+      size_t middle = sorted.size () / 2;
+      result.median = sorted.size () % 2 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2;
+      results.push_back (result);
+
+      std::cout << std::left << std::setw (36) << label.str () << std::right << std::fixed << std::setprecision (1)
+                << std::setw (12) << result.operations
+                << std::setw (14) << result.median
+                << std::setw (14) << sorted.front ()
+                << std::setw (14) << sorted.back ()
+                << std::setw (16) << std::setprecision (0) << (result.median > 0 ? 1e9 / result.median : 0)
+                << std::endl;
+    }
+
+  if (!list && !jsonFile.empty ())
+    {
+      std::ofstream json (jsonFile.c_str ());
+      if (!json)
+        {
+          std::cerr << "Could not open " << jsonFile << std::endl;
+          return 1;
+        }
+      WriteJson (json, results, repetitions);
+      std::cout << "Wrote " << jsonFile << std::endl;
+    }
+
+  for (std::vector<CCNxBenchmark *>::iterator i = benchmarks.begin (); i != benchmarks.end (); ++i)
+    {
+      delete *i;
+    }
+  benchmarks.clear ();
+  Simulator::Destroy ();
+  return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+  return CCNxBenchmarkRunner::Main (argc, argv);
+}
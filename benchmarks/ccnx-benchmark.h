@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_BENCHMARKS_CCNX_BENCHMARK_H_
+#define CCNS3SIM_BENCHMARKS_CCNX_BENCHMARK_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "ns3/ccnx-connection.h"
+#include "ns3/ccnx-name.h"
+
+/**
+ * @ingroup ccnx
+ *
+ * A forwarding-plane micro-benchmark.  It is like an ns3::TestCase: each benchmark is a class
+ * that registers itself with CCNxBenchmarkRunner from a static object, and the `ccnx-benchmarks`
+ * program runs the ones selected on the command line.
+ *
+ * The runner calls Setup() once, then Prepare() and Run() for one warm-up and `repetitions`
+ * timed runs, then Teardown().  Only Run() is timed.  Run() must leave the state as Prepare()
+ * expects it (e.g. a PIT benchmark satisfies every Interest it inserted) and returns the number
+ * of operations it did, so each repetition reports ns per operation.
+ *
+ * Benchmarks do not depend on the wall clock or on random seeds, so two runs of the same build
+ * do the same work.  The forwarding components run with zero layer delay, so their input
+ * queues service items inline and Run() measures only CPU time.
+ */
+class CCNxBenchmark
+{
+public:
+  /**
+   * @param name [in] The benchmark name, e.g. "fib/lpm".  Use '/' to group benchmarks.
+   */
+  CCNxBenchmark (const std::string &name);
+
+  virtual ~CCNxBenchmark ();
+
+  const std::string & GetName () const;
+
+  /**
+   * A parameter reported with the result, e.g. ("entries", 100000).  The name and
+   * parameters identify a result when comparing two runs.
+   *
+   * "entries" is the size of the table the benchmark builds; the runner skips benchmarks
+   * whose "entries" is more than --maxEntries.
+   */
+  void SetParameter (const std::string &key, uint64_t value);
+
+  typedef std::map<std::string, uint64_t> ParameterMap;
+
+  const ParameterMap & GetParameters () const;
+
+  /**
+   * Builds the state used by Run().  Not timed.
+   */
+  virtual void Setup ();
+
+  /**
+   * Resets state before each Run(), for benchmarks whose Run() cannot undo its own
+   * work cheaply.  Not timed.
+   */
+  virtual void Prepare ();
+
+  /**
+   * The timed part of the benchmark.
+   *
+   * @return The number of operations done
+   */
+  virtual uint64_t Run () = 0;
+
+  /**
+   * Releases the state built by Setup().  Not timed.
+   */
+  virtual void Teardown ();
+
+private:
+  std::string m_name;
+  ParameterMap m_parameters;
+};
+
+/**
+ * @ingroup ccnx
+ *
+ * Runs the registered CCNxBenchmarks and writes a text table and a JSON report.
+ */
+class CCNxBenchmarkRunner
+{
+public:
+  /**
+   * Registers a benchmark.  The runner takes ownership.
+   */
+  static void Add (CCNxBenchmark *benchmark);
+
+  /**
+   * Parses the command line, runs the benchmarks, and writes the report.
+   *
+   * @return The program exit code
+   */
+  static int Main (int argc, char *argv[]);
+
+  /**
+   * A deterministic pseudo-random sequence (64-bit LCG), so benchmarks can pick
+   * names or lookup order without depending on ns-3 RNG streams.
+   */
+  static uint64_t NextRandom (uint64_t &state);
+};
+
+/**
+ * Static objects of this type register a benchmark, in the style of the ns-3 test suites:
+ * @code
+ * static CCNxBenchmarkRegistration g_fib1k (new FibLpm (1000));
+ * @endcode
+ */
+class CCNxBenchmarkRegistration
+{
+public:
+  CCNxBenchmarkRegistration (CCNxBenchmark *benchmark)
+  {
+    CCNxBenchmarkRunner::Add (benchmark);
+  }
+};
+
+/**
+ * Returns ccnx:/name=`prefix`/name=`index`, followed by `suffix` (e.g. "/chunk=1") if given.
+ * Benchmarks build all of their names with this, so runs are reproducible.
+ */
+ns3::Ptr<ns3::ccnx::CCNxName> CCNxBenchmarkName (const std::string &prefix, uint64_t index,
+                                                 const std::string &suffix = "");
+
+/**
+ * @ingroup ccnx
+ *
+ * A connection that drops everything sent on it, used as the ingress and next hop
+ * of the benchmarked tables.
+ */
+class CCNxBenchmarkConnection : public ns3::ccnx::CCNxConnection
+{
+public:
+  virtual bool Send (ns3::Ptr<ns3::ccnx::CCNxPacket> packet, ns3::Ptr<ns3::ccnx::CCNxConnection> ingress)
+  {
+    return true;
+  }
+};
+
+#endif /* CCNS3SIM_BENCHMARKS_CCNX_BENCHMARK_H_ */
@@ -100,7 +100,9 @@
  *      structure delays are in each data structure.
  *
  *    - `CCNxStandardPit`: This module represents the Pending Interest Table.  The delay here
- *      is modeled as a linear function of the `CCNxName` length.
+ *      is modeled as a linear function of the `CCNxName` length.  `CCNxHashPit` is a drop-in
+ *      replacement (via `CCNxHashPitFactory`) with the same delay model and verdicts, but
+ *      uses open-addressing hash tables instead of std::map for large PITs.
  *
  *    - `CCNxStandardFib`: This module represents the Forwarding Information Base.  The delay here
  *      is modeled as a linear function of the number of name components.
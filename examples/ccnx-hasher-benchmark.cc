@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * Micro-benchmark of the CCNxHasher implementations.
+ *
+ * Hashes buffers of 64 bytes to 64 KB with each hasher and reports the throughput in GB/s.
+ * "SHA256 xN" is CCNxHasherSha256::DigestMultiBuffer() hashing N buffers per call.  It does
+ * not run a simulation; times are wall clock.
+ *
+ *   ./waf --run "ccnx-hasher-benchmark --bytes=268435456"
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <chrono>
+
+#include "ns3/core-module.h"
+#include "ns3/ccns3Sim-module.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+typedef std::chrono::steady_clock Clock;
+
+static double
+GigabytesPerSecond (uint64_t bytes, Clock::time_point start, Clock::time_point stop)
+{
+  double seconds = std::chrono::duration_cast<std::chrono::nanoseconds> (stop - start).count () * 1e-9;
+  return seconds > 0 ? bytes / seconds * 1e-9 : 0;
+}
+
+/*
+ * Time the streaming interface: Init(), one Update() of the whole buffer, Finalize().
+ */
+static double
+TimeHasher (Ptr<CCNxHasher> hasher, const std::vector<uint8_t> &data, size_t size, uint64_t totalBytes)
+{
+  uint64_t iterations = totalBytes / size + 1;
+  uint8_t sink = 0;
+
+  Clock::time_point start = Clock::now ();
+  for (uint64_t i = 0; i < iterations; i++)
+    {
+      hasher->Init ();
+      hasher->Update (&data[0], size);
+      sink ^= (*hasher->Finalize ()->GetValue ())[0];
+    }
+  Clock::time_point stop = Clock::now ();
+
+  // Keep the result alive so the loop is not optimized away
+  if (sink == 0x5A)
+    {
+      std::cerr << "";
+    }
+  return GigabytesPerSecond (iterations * size, start, stop);
+}
+
+static double
+TimeMultiBuffer (const std::vector<uint8_t> &data, size_t size, uint64_t totalBytes)
+{
+  size_t lanes = CCNxHasherSha256::GetMultiBufferLanes ();
+  std::vector<const uint8_t *> messages (lanes);
+  std::vector<size_t> lengths (lanes, size);
+  for (size_t i = 0; i < lanes; i++)
+    {
+      // Separate buffers, as separate content objects would be
+      messages[i] = &data[i * size];
+    }
+  std::vector<Ptr<CCNxHashValue> > digests;
+
+  uint64_t iterations = totalBytes / (size * lanes) + 1;
+  Clock::time_point start = Clock::now ();
+  for (uint64_t i = 0; i < iterations; i++)
+    {
+      CCNxHasherSha256::DigestMultiBuffer (messages, lengths, digests);
+    }
+  Clock::time_point stop = Clock::now ();
+  return GigabytesPerSecond (iterations * size * lanes, start, stop);
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint64_t bytes = 64 * 1024 * 1024;
+
+  CommandLine cmd;
+  cmd.AddValue ("bytes", "Number of bytes to hash per hasher and buffer size", bytes);
+  cmd.Parse (argc, argv);
+
+  const size_t maxSize = 64 * 1024;
+  size_t lanes = CCNxHasherSha256::GetMultiBufferLanes ();
+  std::vector<uint8_t> data (maxSize * lanes);
+  uint32_t state = 12345;
+  for (size_t i = 0; i < data.size (); i++)
+    {
+      state = state * 1103515245 + 12345;
+      data[i] = (uint8_t) (state >> 16);
+    }
+
+  std::ostringstream multiBuffer;
+  multiBuffer << "SHA256 x" << lanes;
+
+  std::cout << "SHA-256 compression: " << (CCNxHasherSha256::IsAccelerated () ? "SHA extensions" : "portable")
+            << ", multi-buffer lanes: " << lanes << std::endl;
+  std::cout << std::setw (8) << "bytes"
+            << std::setw (12) << "FNV1a"
+            << std::setw (12) << "XXH3"
+            << std::setw (12) << "SHA256"
+            << std::setw (12) << multiBuffer.str ()
+            << "   (GB/s)" << std::endl;
+
+  Ptr<CCNxHasher> fnv1a = CCNxHasher::CreateHasher (CCNxHashingAlgorithm_FNV1a);
+  Ptr<CCNxHasher> xxh3 = CCNxHasher::CreateHasher (CCNxHashingAlgorithm_XXH3);
+  Ptr<CCNxHasher> sha256 = CCNxHasher::CreateHasher (CCNxHashingAlgorithm_SHA256);
+
+  for (size_t size = 64; size <= maxSize; size *= 4)
+    {
+      std::cout << std::setw (8) << size << std::fixed << std::setprecision (3)
+                << std::setw (12) << TimeHasher (fnv1a, data, size, bytes)
+                << std::setw (12) << TimeHasher (xxh3, data, size, bytes)
+                << std::setw (12) << TimeHasher (sha256, data, size, bytes)
+                << std::setw (12) << TimeMultiBuffer (data, size, bytes)
+                << std::endl;
+    }
+
+  return 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * Micro-benchmark of the content store LRU hit path.
+ *
+ * A cache hit refreshes the entry to the front of the LRU.  This program times that refresh
+ * for the intrusive CCNxStandardContentStoreLruList and, as a reference, for the previous
+ * std::list + std::map design, at 10k, 100k and 1M cached objects.  It does not run a
+ * simulation; times are wall clock.
+ *
+ *   ./waf --run "ccnx-lru-benchmark --hits=2000000"
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <list>
+#include <map>
+#include <vector>
+#include <chrono>
+
+#include "ns3/core-module.h"
+#include "ns3/ccns3Sim-module.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+/**
+ * The LRU as it was before the entry carried its own hooks: a list of entries plus a
+ * map from entry to list position.
+ */
+class MapListLru
+{
+public:
+  void AddEntry (Ptr<CCNxStandardContentStoreEntry> entry)
+  {
+    MapType::iterator it = m_map.find (entry);
+    if (it != m_map.end ())
+      {
+        m_list.erase (it->second);
+        m_list.push_front (entry);
+        it->second = m_list.begin ();
+      }
+    else
+      {
+        m_list.push_front (entry);
+        m_map.insert (std::make_pair (entry, m_list.begin ()));
+      }
+  }
+
+private:
+  typedef std::list<Ptr<CCNxStandardContentStoreEntry> > ListType;
+  typedef std::map<Ptr<CCNxStandardContentStoreEntry>, ListType::iterator> MapType;
+  ListType m_list;
+  MapType m_map;
+};
+
+typedef std::vector<Ptr<CCNxStandardContentStoreEntry> > EntryVector;
+
+/*
+ * Pre-computed random hit sequence, so the timed loop measures only the LRU.
+ */
+static std::vector<uint32_t>
+CreateHitSequence (uint32_t objects, uint32_t hits)
+{
+  std::vector<uint32_t> sequence (hits);
+  uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (uint32_t i = 0; i < hits; i++)
+    {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      sequence[i] = (uint32_t) ((state >> 33) % objects);
+    }
+  return sequence;
+}
+
+template <class LRU>
+static double
+TimeHits (LRU &lru, const EntryVector &entries, const std::vector<uint32_t> &sequence)
+{
+  for (size_t i = 0; i < entries.size (); i++)
+    {
+      lru.AddEntry (entries[i]);
+    }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  for (size_t i = 0; i < sequence.size (); i++)
+    {
+      lru.AddEntry (entries[sequence[i]]);
+    }
+  std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now ();
+
+  double nanos = std::chrono::duration_cast<std::chrono::nanoseconds> (stop - start).count ();
+  return nanos / sequence.size ();
+}
+
+static void
+RunBenchmark (uint32_t objects, uint32_t hits)
+{
+  // The LRU never looks inside the packet, so every entry can share one.
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=benchmark/name=lru");
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, Create<CCNxBuffer> (128, true));
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (content);
+
+  EntryVector entries (objects);
+  for (uint32_t i = 0; i < objects; i++)
+    {
+      entries[i] = Create<CCNxStandardContentStoreEntry> (packet);
+    }
+
+  std::vector<uint32_t> sequence = CreateHitSequence (objects, hits);
+
+  double intrusive;
+  {
+    Ptr<CCNxStandardContentStoreLruList> lru = Create<CCNxStandardContentStoreLruList> ();
+    intrusive = TimeHits (*lru, entries, sequence);
+  }
+
+  double mapList;
+  {
+    MapListLru lru;
+    mapList = TimeHits (lru, entries, sequence);
+  }
+
+  std::cout << std::setw (10) << objects
+            << std::setw (16) << std::fixed << std::setprecision (1) << intrusive
+            << std::setw (16) << mapList
+            << std::setw (10) << std::setprecision (2) << (intrusive > 0 ? mapList / intrusive : 0)
+            << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t hits = 1000000;
+
+  CommandLine cmd;
+  cmd.AddValue ("hits", "Number of timed cache hits per table size", hits);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::setw (10) << "objects"
+            << std::setw (16) << "intrusive ns"
+            << std::setw (16) << "map+list ns"
+            << std::setw (10) << "speedup" << std::endl;
+
+  RunBenchmark (10000, hits);
+  RunBenchmark (100000, hits);
+  RunBenchmark (1000000, hits);
+
+  return 0;
+}
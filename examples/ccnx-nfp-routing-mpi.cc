@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * A partitioned NFP topology for the ns-3 distributed (MPI) simulator.
+ *
+ * The topology is `partitions` chains of `routers` nodes.  Neighbouring chains are
+ * joined in a ring by one point-to-point link, whose delay is the lookahead of the
+ * conservative synchronization between ranks:
+ *
+ *   partition 0                    partition 1
+ *   p0 -- r -- r -- ... -- c0 ==== p1 -- r -- r -- ... -- c1 ==== ... (back to p0)
+ *
+ * The first node of each chain runs a producer for ccnx:/name=partition<i>, the last node
+ * runs a consumer of its own partition's prefix and a consumer of the next partition's
+ * prefix, so most of the work stays inside a partition and some of it crosses a boundary.
+ *
+ * The topology does not depend on the number of ranks: partition i is simulated by rank
+ * (i % ranks), so the same run can be timed with one rank and with several to measure the
+ * speedup, e.g.
+ *
+ *   ./waf --run "ccnx-nfp-routing-mpi --partitions=8" --command-template="mpirun -np 1 %s"
+ *   ./waf --run "ccnx-nfp-routing-mpi --partitions=8" --command-template="mpirun -np 8 %s"
+ *
+ * Only CCNxStackHelper and the application helpers are needed to make the CCNx stack
+ * partition aware; they skip the nodes simulated by other ranks.
+ */
+
+#include <iostream>
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/mpi-interface.h"
+
+#include "ns3/ccns3Sim-module.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxNfpRoutingMpi");
+
+static Ptr<CCNxName>
+PartitionPrefix (uint32_t partition)
+{
+  std::ostringstream prefix;
+  prefix << "ccnx:/name=partition" << partition;
+  return Create<CCNxName> (prefix.str ());
+}
+
+static void
+RunSimulation (uint32_t partitions, uint32_t routers, Time simulationTime)
+{
+  Time::SetResolution (Time::NS);
+
+  uint32_t rank = MpiInterface::GetSystemId ();
+  uint32_t ranks = MpiInterface::GetSize ();
+
+  // ==== Nodes, each created in the system (rank) that simulates its partition
+  std::vector<NodeContainer> chains (partitions);
+  for (uint32_t i = 0; i < partitions; ++i)
+    {
+      chains[i].Create (routers, i % ranks);
+    }
+
+  // ==== Point To Point
+  PointToPointHelper pointToPoint;
+  pointToPoint.SetDeviceAttribute ("DataRate", StringValue ("100Mbps"));
+  pointToPoint.SetChannelAttribute ("Delay", StringValue ("1ms"));
+
+  PointToPointHelper boundary;
+  boundary.SetDeviceAttribute ("DataRate", StringValue ("100Mbps"));
+  boundary.SetChannelAttribute ("Delay", StringValue ("10ms"));
+
+  NetDeviceContainer devices;
+  for (uint32_t i = 0; i < partitions; ++i)
+    {
+      for (uint32_t j = 0; j + 1 < routers; ++j)
+        {
+          devices.Add (pointToPoint.Install (chains[i].Get (j), chains[i].Get (j + 1)));
+        }
+
+      if (partitions > 1)
+        {
+          uint32_t next = (i + 1) % partitions;
+          devices.Add (boundary.Install (chains[i].Get (routers - 1), chains[next].Get (0)));
+        }
+    }
+
+  // ==== CCNx stack with NFP.  Every rank installs on the whole topology, the helper
+  // only builds the nodes this rank simulates.
+  NfpRoutingHelper nfpHelper;
+  nfpHelper.Set ("HelloInterval", TimeValue (Seconds (1)));
+
+  CCNxStandardForwarderHelper standardHelper;
+
+  CCNxStackHelper ccnxStack;
+  ccnxStack.SetForwardingHelper (standardHelper);
+  ccnxStack.SetRoutingHelper (nfpHelper);
+
+  NodeContainer all;
+  for (uint32_t i = 0; i < partitions; ++i)
+    {
+      all.Add (chains[i]);
+    }
+  ccnxStack.Install (all);
+  ccnxStack.AddInterfaces (devices);
+
+  // ==== Applications.  The repositories are created identically on every rank.
+  std::vector< Ptr<CCNxContentRepository> > repositories (partitions);
+  for (uint32_t i = 0; i < partitions; ++i)
+    {
+      repositories[i] = Create<CCNxContentRepository> (PartitionPrefix (i), 124, 1000);
+    }
+
+  ApplicationContainer producerApps;
+  ApplicationContainer consumerApps;
+  for (uint32_t i = 0; i < partitions; ++i)
+    {
+      CCNxProducerHelper producerHelper (repositories[i]);
+      producerApps.Add (producerHelper.Install (NodeContainer (chains[i].Get (0))));
+
+      CCNxConsumerHelper localHelper (repositories[i]);
+      localHelper.SetAttribute ("RequestInterval", TimeValue (MilliSeconds (1)));
+      consumerApps.Add (localHelper.Install (NodeContainer (chains[i].Get (routers - 1))));
+
+      CCNxConsumerHelper remoteHelper (repositories[(i + 1) % partitions]);
+      remoteHelper.SetAttribute ("RequestInterval", TimeValue (MilliSeconds (10)));
+      consumerApps.Add (remoteHelper.Install (NodeContainer (chains[i].Get (routers - 1))));
+    }
+
+  // Give NFP time to converge over the longest chain before asking for content
+  producerApps.Start (Seconds (0.0));
+  consumerApps.Start (Seconds (5.0));
+  consumerApps.Stop (simulationTime - Seconds (2));
+  producerApps.Stop (simulationTime - Seconds (1));
+
+  SystemWallClockMs wallClock;
+  wallClock.Start ();
+
+  Simulator::Stop (simulationTime);
+  Simulator::Run ();
+
+  int64_t elapsed = wallClock.End ();
+  std::cout << "Rank " << rank << " of " << ranks << " simulated " << partitions << " partitions of "
+            << routers << " routers in " << elapsed << " ms" << std::endl;
+
+  Simulator::Destroy ();
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t partitions = 8;
+  uint32_t routers = 16;
+  double seconds = 20.0;
+
+  CommandLine cmd;
+  cmd.AddValue ("partitions", "Number of partitions in the topology (independent of the number of ranks)", partitions);
+  cmd.AddValue ("routers", "Number of routers in each partition", routers);
+  cmd.AddValue ("seconds", "Simulated time in seconds", seconds);
+  cmd.Parse (argc, argv);
+
+  NS_ABORT_MSG_IF (partitions == 0 || routers < 2, "Need at least one partition of two routers");
+  NS_ABORT_MSG_IF (seconds <= 7.0, "The consumers start at 5 seconds, simulate for longer than 7 seconds");
+
+  GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::DistributedSimulatorImpl"));
+  MpiInterface::Enable (&argc, &argv);
+
+  RunSimulation (partitions, routers, Seconds (seconds));
+
+  MpiInterface::Disable ();
+  return 0;
+}
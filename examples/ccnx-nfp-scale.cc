@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * NFP convergence at scale.
+ *
+ * Builds a large point-to-point topology, puts an anchor (a producer) on `anchors` nodes,
+ * and runs until every node has a route to every anchor prefix.  It reports the simulated
+ * convergence time, the wall clock time, and the peak resident memory of the process.
+ *
+ * Two topologies are generated:
+ *
+ *   random  - `nodes` routers.  Each router links to a random earlier router (so the graph is
+ *             connected), then random links are added until the average degree is `degree`.
+ *
+ *   fattree - the switches of a k-ary fat tree: (k/2)^2 core switches and k pods of k/2
+ *             aggregation and k/2 edge switches, 5k^2/4 switches in all.  k=40 gives 2000
+ *             switches, k=88 gives 9680.
+ *
+ * Use --scaleMode to compare NfpRoutingProtocol's "ScaleMode" data structures with the default ones:
+ *
+ *   ./waf --run "ccnx-nfp-scale --topology=random --nodes=5000 --scaleMode=1"
+ *   ./waf --run "ccnx-nfp-scale --topology=fattree --k=40 --scaleMode=0"
+ *
+ * Peak memory is the process high water mark (getrusage), so compare runs in separate processes.
+ */
+
+#include <iostream>
+#include <set>
+#include <vector>
+#include <sys/resource.h>
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+
+#include "ns3/ccns3Sim-module.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxNfpScale");
+
+typedef std::pair<uint32_t, uint32_t> EdgeType;
+typedef std::set<EdgeType> EdgeSetType;
+
+static void
+AddEdge (EdgeSetType &edges, uint32_t a, uint32_t b)
+{
+  if (a != b)
+    {
+      edges.insert (a < b ? EdgeType (a, b) : EdgeType (b, a));
+    }
+}
+
+static uint32_t
+CreateRandomTopology (uint32_t nodes, double degree, EdgeSetType &edges)
+{
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+
+  for (uint32_t i = 1; i < nodes; ++i)
+    {
+      AddEdge (edges, i, random->GetInteger (0, i - 1));
+    }
+
+  size_t target = (size_t) (nodes * degree / 2.0);
+  size_t maximum = (size_t) nodes * (nodes - 1) / 2;
+  while (edges.size () < target && edges.size () < maximum)
+    {
+      AddEdge (edges, random->GetInteger (0, nodes - 1), random->GetInteger (0, nodes - 1));
+    }
+  return nodes;
+}
+
+static uint32_t
+CreateFatTreeTopology (uint32_t k, EdgeSetType &edges)
+{
+  uint32_t half = k / 2;
+  uint32_t cores = half * half;
+
+  // node ids: cores, then for each pod its aggregation switches followed by its edge switches
+  for (uint32_t pod = 0; pod < k; ++pod)
+    {
+      uint32_t podBase = cores + pod * k;
+      for (uint32_t a = 0; a < half; ++a)
+        {
+          uint32_t aggregation = podBase + a;
+          for (uint32_t c = 0; c < half; ++c)
+            {
+              AddEdge (edges, aggregation, a * half + c);
+            }
+          for (uint32_t e = 0; e < half; ++e)
+            {
+              AddEdge (edges, aggregation, podBase + half + e);
+            }
+        }
+    }
+  return cores + k * k;
+}
+
+static uint64_t
+GetPeakMemoryKb (void)
+{
+  struct rusage usage;
+  getrusage (RUSAGE_SELF, &usage);
+  // ru_maxrss is in kilobytes on Linux
+  return (uint64_t) usage.ru_maxrss;
+}
+
+/*
+ * Samples the RIBs and stops the simulation once every node reaches every anchor.
+ *
+ * A check only looks at the nodes that have not yet reached every anchor, so checks get
+ * cheaper as routing converges instead of costing nodes * prefixes each time.  When no node
+ * is left, one pass over all nodes confirms that none lost a route in the meantime.
+ */
+class ConvergenceMonitor
+{
+public:
+  ConvergenceMonitor (NodeContainer nodes, size_t anchors, Time interval)
+    : m_anchors (anchors), m_interval (interval), m_converged (false), m_nodeChecks (0)
+  {
+    for (NodeContainer::Iterator i = nodes.Begin (); i != nodes.End (); ++i)
+      {
+        Ptr<NfpRoutingProtocol> nfp = DynamicCast<NfpRoutingProtocol> ((*i)->GetObject<CCNxRoutingProtocol> ());
+        NS_ABORT_MSG_IF (!nfp, "Node " << (*i)->GetId () << " does not run NFP");
+        m_all.push_back (nfp);
+      }
+    m_pending = m_all;
+  }
+
+  void Check (void)
+  {
+    RemoveConverged ();
+    if (m_pending.empty ())
+      {
+        m_pending = m_all;
+        RemoveConverged ();
+      }
+
+    NS_LOG_INFO ("Time " << Simulator::Now ().GetSeconds () << " converged nodes " << m_all.size () - m_pending.size ());
+    if (m_pending.empty ())
+      {
+        m_converged = true;
+        m_convergenceTime = Simulator::Now ();
+        Simulator::Stop ();
+      }
+    else
+      {
+        Simulator::Schedule (m_interval, &ConvergenceMonitor::Check, this);
+      }
+  }
+
+  bool IsConverged (void) const
+  {
+    return m_converged;
+  }
+
+  Time GetConvergenceTime (void) const
+  {
+    return m_convergenceTime;
+  }
+
+  /**
+   * The number of times a node's RIB was sampled, to show how much work the monitor added
+   */
+  uint64_t GetNodeChecks (void) const
+  {
+    return m_nodeChecks;
+  }
+
+private:
+  typedef std::vector< Ptr<NfpRoutingProtocol> > ProtocolVectorType;
+
+  void RemoveConverged (void)
+  {
+    size_t i = 0;
+    while (i < m_pending.size ())
+      {
+        m_nodeChecks++;
+        if (m_pending[i]->GetReachablePrefixCount () >= m_anchors)
+          {
+            m_pending[i] = m_pending.back ();
+            m_pending.pop_back ();
+          }
+        else
+          {
+            i++;
+          }
+      }
+  }
+
+  ProtocolVectorType m_all;
+  ProtocolVectorType m_pending;
+  size_t m_anchors;
+  Time m_interval;
+  bool m_converged;
+  Time m_convergenceTime;
+  uint64_t m_nodeChecks;
+};
+
+int
+main (int argc, char *argv[])
+{
+  std::string topology = "random";
+  uint32_t nodeCount = 1000;
+  double degree = 4.0;
+  uint32_t k = 16;
+  uint32_t anchorCount = 8;
+  bool scaleMode = true;
+  double maxSeconds = 120.0;
+
+  CommandLine cmd;
+  cmd.AddValue ("topology", "random or fattree", topology);
+  cmd.AddValue ("nodes", "Number of routers in the random topology", nodeCount);
+  cmd.AddValue ("degree", "Average degree of the random topology", degree);
+  cmd.AddValue ("k", "Fat tree arity (even)", k);
+  cmd.AddValue ("anchors", "Number of nodes that anchor a prefix", anchorCount);
+  cmd.AddValue ("scaleMode", "Set the NfpRoutingProtocol ScaleMode attribute", scaleMode);
+  cmd.AddValue ("maxSeconds", "Give up if not converged by this simulated time", maxSeconds);
+  cmd.Parse (argc, argv);
+
+  Time::SetResolution (Time::NS);
+
+  EdgeSetType edges;
+  if (topology == "random")
+    {
+      NS_ABORT_MSG_IF (nodeCount < 2, "Need at least 2 nodes");
+      nodeCount = CreateRandomTopology (nodeCount, degree, edges);
+    }
+  else if (topology == "fattree")
+    {
+      NS_ABORT_MSG_IF (k < 2 || k % 2 != 0, "k must be even and at least 2");
+      nodeCount = CreateFatTreeTopology (k, edges);
+    }
+  else
+    {
+      NS_ABORT_MSG ("Unknown topology " << topology);
+    }
+  NS_ABORT_MSG_IF (anchorCount == 0 || anchorCount > nodeCount, "anchors must be between 1 and the number of nodes");
+
+  SystemWallClockMs wallClock;
+  wallClock.Start ();
+
+  NodeContainer nodes;
+  nodes.Create (nodeCount);
+
+  PointToPointHelper pointToPoint;
+  pointToPoint.SetDeviceAttribute ("DataRate", StringValue ("1Gbps"));
+  pointToPoint.SetChannelAttribute ("Delay", StringValue ("1ms"));
+
+  NetDeviceContainer devices;
+  for (EdgeSetType::const_iterator i = edges.begin (); i != edges.end (); ++i)
+    {
+      devices.Add (pointToPoint.Install (nodes.Get (i->first), nodes.Get (i->second)));
+    }
+
+  NfpRoutingHelper nfpHelper;
+  nfpHelper.Set ("HelloInterval", TimeValue (Seconds (1)));
+  nfpHelper.Set ("ScaleMode", BooleanValue (scaleMode));
+
+  CCNxStandardForwarderHelper standardHelper;
+
+  CCNxStackHelper ccnxStack;
+  ccnxStack.SetForwardingHelper (standardHelper);
+  ccnxStack.SetRoutingHelper (nfpHelper);
+  ccnxStack.Install (nodes);
+  ccnxStack.AddInterfaces (devices);
+
+  // Spread the anchors evenly over the node ids
+  ApplicationContainer producerApps;
+  for (uint32_t i = 0; i < anchorCount; ++i)
+    {
+      std::ostringstream prefix;
+      prefix << "ccnx:/name=anchor" << i;
+      Ptr<CCNxContentRepository> repository = Create<CCNxContentRepository> (Create<CCNxName> (prefix.str ()), 124, 10);
+      CCNxProducerHelper producerHelper (repository);
+      producerApps.Add (producerHelper.Install (NodeContainer (nodes.Get ((uint64_t) i * nodeCount / anchorCount))));
+    }
+  producerApps.Start (Seconds (0.0));
+
+  int64_t setupMs = wallClock.End ();
+  wallClock.Start ();
+
+  ConvergenceMonitor monitor (nodes, anchorCount, MilliSeconds (100));
+  Simulator::Schedule (MilliSeconds (100), &ConvergenceMonitor::Check, &monitor);
+
+  Simulator::Stop (Seconds (maxSeconds));
+  Simulator::Run ();
+
+  int64_t runMs = wallClock.End ();
+
+  std::cout << "topology " << topology << " nodes " << nodeCount << " links " << edges.size ()
+            << " anchors " << anchorCount << " scaleMode " << scaleMode << std::endl;
+  if (monitor.IsConverged ())
+    {
+      std::cout << "converged at " << monitor.GetConvergenceTime ().GetSeconds () << " seconds" << std::endl;
+    }
+  else
+    {
+      std::cout << "not converged after " << maxSeconds << " seconds" << std::endl;
+    }
+  std::cout << "setup wall clock " << setupMs << " ms, simulation wall clock " << runMs << " ms" << std::endl;
+  std::cout << "convergence monitor node checks " << monitor.GetNodeChecks () << std::endl;
+  std::cout << "peak resident memory " << GetPeakMemoryKb () << " KB" << std::endl;
+  std::cout << "NfpAdvertise allocations " << NfpAdvertise::GetAllocationCount ()
+            << " heap fallbacks " << NfpAdvertise::GetHeapFallbackCount () << std::endl;
+
+  Simulator::Destroy ();
+  return 0;
+}
@@ -59,6 +59,7 @@
 #include "ns3/ccnx-forwarder.h"
 #include "ns3/node-list.h"
 #include "ns3/config.h"
+#include "ns3/simulator.h"
 
 #include "ns3/ccnx-standard-layer3-helper.h"
 #include "ns3/ccnx-standard-forwarder-helper.h"
@@ -161,6 +162,12 @@ CCNxStackHelper::Install (Ptr<Node> node) const
 {
   NS_LOG_FUNCTION (this << node);
 
+  if (!IsLocalNode (node))
+    {
+      NS_LOG_DEBUG ("Node " << node->GetId () << " belongs to partition " << node->GetSystemId () << ", skipping");
+      return;
+    }
+
   m_layer3Helper->Install (node);
   m_forwardingHelper->Install (node);
 
@@ -181,6 +188,12 @@ CCNxStackHelper::Install (Ptr<Node> node) const
     }
 }
 
+bool
+CCNxStackHelper::IsLocalNode (Ptr<Node> node)
+{
+  return node->GetSystemId () == Simulator::GetSystemId ();
+}
+
 void
 CCNxStackHelper::CreateAndAggregateObjectFromTypeId (Ptr<Node> node, const std::string typeId)
 {
@@ -203,6 +216,11 @@ CCNxStackHelper::AddInterfaces (const NetDeviceContainer &c)
       Ptr<Node> node = device->GetNode ();
       NS_ASSERT_MSG (node, "NetDevice is not not associated with any node");
 
+      if (!IsLocalNode (node))
+        {
+          continue;
+        }
+
       Ptr<CCNxL3Protocol> ccnx = node->GetObject<CCNxL3Protocol> ();
       NS_ASSERT_MSG (ccnx, "CCNxL3Protocol not found on node " << node->GetSystemId ());
 
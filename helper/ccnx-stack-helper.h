@@ -135,6 +135,10 @@ public:
   void Install (std::string nodeName) const;
 
   /**
+   * In a distributed (MPI) simulation, a node whose system id is not this
+   * process's partition is skipped, so every rank may call Install on the
+   * whole topology and only build the stacks it simulates.
+   *
    * @param node The node on which to install the stack.
    */
   void Install (Ptr<Node> node) const;
@@ -163,10 +167,16 @@ public:
 
   /**
    * Assign all the devices in the device container to the CCNxL3Protocol in
-   * on the respective nodes.
+   * on the respective nodes.  Devices on nodes of other partitions are skipped.
    */
   void AddInterfaces (const NetDeviceContainer &c);
 
+  /**
+   * True if the node is simulated by this process, i.e. its system id matches
+   * Simulator::GetSystemId ().  Always true in a non-distributed simulation.
+   */
+  static bool IsLocalNode (Ptr<Node> node);
+
   /**
    * Set a routing helper and this routing protocol will be installed on nodes
    * when Install is called.  You should set all attributes of the routing protocol
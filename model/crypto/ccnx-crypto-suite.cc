@@ -55,3 +55,42 @@
 
 #include "ns3/ccnx-crypto-suite.h"
 
+using namespace ns3;
+using namespace ns3::ccnx;
+
+std::ostream &
+ns3::ccnx::operator << (std::ostream &os, CCNxCryptoSuite suite)
+{
+  switch (suite)
+    {
+    case CCNxCryptoSuite_None:
+      os << "None";
+      break;
+    case CCNxCryptoSuite_RsaSha256:
+      os << "RsaSha256";
+      break;
+    case CCNxCryptoSuite_HmacSha256:
+      os << "HmacSha256";
+      break;
+    case CCNxCryptoSuite_CRC32C:
+      os << "CRC32C";
+      break;
+    default:
+      os << "Unknown (" << (int) suite << ")";
+      break;
+    }
+  return os;
+}
+
+CCNxHashingAlgorithm
+ns3::ccnx::GetCryptoSuiteHashingAlgorithm (CCNxCryptoSuite suite)
+{
+  switch (suite)
+    {
+    case CCNxCryptoSuite_RsaSha256:
+    case CCNxCryptoSuite_HmacSha256:
+      return CCNxHashingAlgorithm_SHA256;
+    default:
+      return CCNxHashingAlgorithm_None;
+    }
+}
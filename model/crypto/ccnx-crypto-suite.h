@@ -57,6 +57,7 @@
 #define CCNS3SIM_MODEL_CRYPTO_CCNX_CRYPTO_SUITE_H_
 
 #include <ostream>
+#include "ns3/ccnx-hashing-algorithm.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -75,6 +76,16 @@ typedef enum
 
 std::ostream & operator << (std::ostream &os, CCNxCryptoSuite suite);
 
+/**
+ * @ingroup ccnx-crypto
+ *
+ * The hashing algorithm a crypto suite uses over the signed bytes.
+ *
+ * @param [in] suite The crypto suite
+ * @return The hashing algorithm, CCNxHashingAlgorithm_None if the suite does not use one (e.g. CRC32C)
+ */
+CCNxHashingAlgorithm GetCryptoSuiteHashingAlgorithm (CCNxCryptoSuite suite);
+
 }   /* namespace ccnx */
 } /* namespace ns3 */
 
@@ -54,6 +54,9 @@
  */
 
 #include "ns3/ccnx-hasher.h"
+#include "ns3/ccnx-hasher-fnv1a.h"
+#include "ns3/ccnx-hasher-sha256.h"
+#include "ns3/ccnx-hasher-xxh3.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -84,3 +87,57 @@ CCNxHasher::~CCNxHasher ()
 {
   // empty
 }
+
+size_t
+CCNxHasher::Update (Buffer::Iterator start)
+{
+  uint8_t chunk[m_chunkLength];
+  size_t length = 0;
+  while (!start.IsEnd ())
+    {
+      size_t used = 0;
+      while (used < m_chunkLength && !start.IsEnd ())
+        {
+          chunk[used++] = start.ReadU8 ();
+        }
+      length += Update (chunk, used);
+    }
+  return length;
+}
+
+size_t
+CCNxHasher::Update (Buffer::Iterator start, uint32_t length)
+{
+  uint8_t chunk[m_chunkLength];
+  uint32_t remaining = length;
+  while (remaining > 0)
+    {
+      uint32_t used = remaining < m_chunkLength ? remaining : (uint32_t) m_chunkLength;
+      start.Read (chunk, used);
+      Update (chunk, used);
+      remaining -= used;
+    }
+  return length;
+}
+
+Ptr<CCNxHasher>
+CCNxHasher::CreateHasher (CCNxHashingAlgorithm algorithm)
+{
+  switch (algorithm)
+    {
+    case CCNxHashingAlgorithm_SHA256:
+      return CreateObject<CCNxHasherSha256> ();
+    case CCNxHashingAlgorithm_FNV1a:
+      return CreateObject<CCNxHasherFnv1a> ();
+    case CCNxHashingAlgorithm_XXH3:
+      return CreateObject<CCNxHasherXxh3> ();
+    default:
+      return Ptr<CCNxHasher> (0);
+    }
+}
+
+Ptr<CCNxHasher>
+CCNxHasher::CreateHasher (CCNxCryptoSuite suite)
+{
+  return CreateHasher (GetCryptoSuiteHashingAlgorithm (suite));
+}
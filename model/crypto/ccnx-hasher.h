@@ -59,6 +59,8 @@
 #include "ns3/object.h"
 #include "ns3/buffer.h"
 #include "ns3/ccnx-hash-value.h"
+#include "ns3/ccnx-hashing-algorithm.h"
+#include "ns3/ccnx-crypto-suite.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -95,13 +97,50 @@ public:
   /**
    * Update the hash with the bytes pointed to by the ns3::Buffer::Iterator
    *
+   * The default implementation copies the bytes in chunks and passes them to
+   * Update (const uint8_t *, size_t), which suits hashers that work on blocks.
+   *
+   * @param [in] start
+   * @return The number of bytes read
+   */
+  virtual size_t Update (Buffer::Iterator start);
+
+  /**
+   * Update the hash with `length` bytes starting at the ns3::Buffer::Iterator.  Use this
+   * to hash part of a buffer, such as one TLV, while it is being decoded.
+   *
+   * The default implementation copies the bytes in chunks and passes them to
+   * Update (const uint8_t *, size_t).
+   *
    * @param [in] start
+   * @param [in] length
    * @return The number of bytes read
    */
-  virtual size_t Update (Buffer::Iterator start) = 0;
+  virtual size_t Update (Buffer::Iterator start, uint32_t length);
 
   virtual Ptr<CCNxHashValue> Finalize () = 0;
 
+  /**
+   * Create the hasher for a hashing algorithm.
+   *
+   * @param [in] algorithm The hashing algorithm
+   * @return The hasher, or null if there is no hasher for the algorithm
+   */
+  static Ptr<CCNxHasher> CreateHasher (CCNxHashingAlgorithm algorithm);
+
+  /**
+   * Create the hasher used by a crypto suite (e.g. SHA-256 for CCNxCryptoSuite_RsaSha256).
+   *
+   * @param [in] suite The crypto suite
+   * @return The hasher, or null if the suite does not use one we have
+   */
+  static Ptr<CCNxHasher> CreateHasher (CCNxCryptoSuite suite);
+
+private:
+  /**
+   * The stack buffer used by the ns3::Buffer::Iterator updates
+   */
+  static const size_t m_chunkLength = 256;
 };
 
 }   /* namespace ccnx */
@@ -58,3 +58,26 @@
 using namespace ns3;
 using namespace ns3::ccnx;
 
+std::ostream &
+ns3::ccnx::operator << (std::ostream &s, const CCNxHashingAlgorithm &alg)
+{
+  switch (alg)
+    {
+    case CCNxHashingAlgorithm_None:
+      s << "None";
+      break;
+    case CCNxHashingAlgorithm_SHA256:
+      s << "SHA256";
+      break;
+    case CCNxHashingAlgorithm_FNV1a:
+      s << "FNV1a";
+      break;
+    case CCNxHashingAlgorithm_XXH3:
+      s << "XXH3";
+      break;
+    default:
+      s << "Unknown (" << (int) alg << ")";
+      break;
+    }
+  return s;
+}
@@ -64,11 +64,15 @@ namespace ccnx {
 /**
  * @ingroup ccnx-crypto
  *
+ * CCNxHashingAlgorithm_FNV1a and CCNxHashingAlgorithm_XXH3 are not CCNx wire format
+ * algorithms.  They are fast 64-bit hashes for simulations that do not need a real digest.
  */
 typedef enum
 {
   CCNxHashingAlgorithm_None,
-  CCNxHashingAlgorithm_SHA256
+  CCNxHashingAlgorithm_SHA256,
+  CCNxHashingAlgorithm_FNV1a,
+  CCNxHashingAlgorithm_XXH3
 } CCNxHashingAlgorithm;
 
 std::ostream & operator << (std::ostream &s, const CCNxHashingAlgorithm &alg);
@@ -116,6 +116,17 @@ CCNxHasherFnv1a::Update (Buffer::Iterator start)
   return length;
 }
 
+size_t
+CCNxHasherFnv1a::Update (Buffer::Iterator start, uint32_t length)
+{
+  for (uint32_t i = 0; i < length; i++)
+    {
+      m_value = m_value ^ start.ReadU8 ();
+      m_value = m_value * m_prime;
+    }
+  return length;
+}
+
 Ptr<CCNxHashValue>
 CCNxHasherFnv1a::Finalize ()
 {
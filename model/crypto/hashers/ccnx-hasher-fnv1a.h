@@ -97,6 +97,15 @@ public:
    */
   virtual size_t Update (Buffer::Iterator start);
 
+  /**
+   * Update the hash with `length` bytes starting at the ns3::Buffer::Iterator
+   *
+   * @param [in] start
+   * @param [in] length
+   * @return The number of bytes read
+   */
+  virtual size_t Update (Buffer::Iterator start, uint32_t length);
+
   /**
    * Finalize the hash and return the final result.
    *
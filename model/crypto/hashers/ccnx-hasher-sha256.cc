@@ -0,0 +1,565 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cstring>
+#include "ccnx-hasher-sha256.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CCNX_SHA256_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_OBJECT_ENSURE_REGISTERED (CCNxHasherSha256);
+
+namespace {
+
+const uint32_t g_initialState[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+const uint32_t g_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/**
+ * Runs the compression function over `blocks` 64 byte blocks.
+ */
+typedef void (*CompressFunction) (uint32_t state[8], const uint8_t *data, size_t blocks);
+
+inline uint32_t
+ReadBigEndian32 (const uint8_t *p)
+{
+  return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+inline void
+WriteBigEndian32 (uint8_t *p, uint32_t value)
+{
+  p[0] = (uint8_t) (value >> 24);
+  p[1] = (uint8_t) (value >> 16);
+  p[2] = (uint8_t) (value >> 8);
+  p[3] = (uint8_t) value;
+}
+
+inline uint32_t
+Rotr (uint32_t x, int n)
+{
+  return (x >> n) | (x << (32 - n));
+}
+
+void
+CompressPortable (uint32_t state[8], const uint8_t *data, size_t blocks)
+{
+  uint32_t w[64];
+  for (; blocks > 0; blocks--, data += 64)
+    {
+      for (int t = 0; t < 16; t++)
+        {
+          w[t] = ReadBigEndian32 (data + 4 * t);
+        }
+      for (int t = 16; t < 64; t++)
+        {
+          uint32_t s0 = Rotr (w[t - 15], 7) ^ Rotr (w[t - 15], 18) ^ (w[t - 15] >> 3);
+          uint32_t s1 = Rotr (w[t - 2], 17) ^ Rotr (w[t - 2], 19) ^ (w[t - 2] >> 10);
+          w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+
+      uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+      uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+      for (int t = 0; t < 64; t++)
+        {
+          uint32_t t1 = h + (Rotr (e, 6) ^ Rotr (e, 11) ^ Rotr (e, 25)) + ((e & f) ^ (~e & g)) + g_k[t] + w[t];
+          uint32_t t2 = (Rotr (a, 2) ^ Rotr (a, 13) ^ Rotr (a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+          h = g;
+          g = f;
+          f = e;
+          e = d + t1;
+          d = c;
+          c = b;
+          b = a;
+          a = t1 + t2;
+        }
+
+      state[0] += a;
+      state[1] += b;
+      state[2] += c;
+      state[3] += d;
+      state[4] += e;
+      state[5] += f;
+      state[6] += g;
+      state[7] += h;
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 8
+#define CCNX_SHA256_UNROLL _Pragma ("GCC unroll 16")
+#else
+#define CCNX_SHA256_UNROLL
+#endif
+
+#ifdef CCNX_SHA256_X86
+/*
+ * The SHA extensions keep the state as {ABEF, CDGH} and do two rounds per
+ * _mm_sha256rnds2_epu32, so each group of four rounds is two instructions.
+ */
+__attribute__ ((target ("sha,sse4.1"))) void
+CompressShaNi (uint32_t state[8], const uint8_t *data, size_t blocks)
+{
+  const __m128i byteSwap = _mm_set_epi64x (0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+  __m128i tmp = _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *) &state[0]), 0xB1);  // CDAB
+  __m128i state1 = _mm_shuffle_epi32 (_mm_loadu_si128 ((const __m128i *) &state[4]), 0x1B); // EFGH
+  __m128i state0 = _mm_alignr_epi8 (tmp, state1, 8);                                     // ABEF
+  state1 = _mm_blend_epi16 (state1, tmp, 0xF0);                                          // CDGH
+
+  for (; blocks > 0; blocks--, data += 64)
+    {
+      __m128i abefSave = state0;
+      __m128i cdghSave = state1;
+      __m128i w[4];
+
+      CCNX_SHA256_UNROLL
+      for (int group = 0; group < 16; group++)
+        {
+          __m128i &msg = w[group & 3];
+          if (group < 4)
+            {
+              msg = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *) (data + 16 * group)), byteSwap);
+            }
+          else
+            {
+              // msg holds W[t-16..t-13], the others W[t-12..t-1]
+              const __m128i &w12 = w[(group + 1) & 3];
+              const __m128i &w8 = w[(group + 2) & 3];
+              const __m128i &w4 = w[(group + 3) & 3];
+              msg = _mm_sha256msg1_epu32 (msg, w12);
+              msg = _mm_add_epi32 (msg, _mm_alignr_epi8 (w4, w8, 4));
+              msg = _mm_sha256msg2_epu32 (msg, w4);
+            }
+
+          __m128i rounds = _mm_add_epi32 (msg, _mm_loadu_si128 ((const __m128i *) &g_k[4 * group]));
+          state1 = _mm_sha256rnds2_epu32 (state1, state0, rounds);
+          state0 = _mm_sha256rnds2_epu32 (state0, state1, _mm_shuffle_epi32 (rounds, 0x0E));
+        }
+
+      state0 = _mm_add_epi32 (state0, abefSave);
+      state1 = _mm_add_epi32 (state1, cdghSave);
+    }
+
+  tmp = _mm_shuffle_epi32 (state0, 0x1B);                // FEBA
+  state1 = _mm_shuffle_epi32 (state1, 0xB1);             // DCHG
+  state0 = _mm_blend_epi16 (tmp, state1, 0xF0);          // DCBA
+  state1 = _mm_alignr_epi8 (state1, tmp, 8);             // ABEF
+  _mm_storeu_si128 ((__m128i *) &state[0], state0);
+  _mm_storeu_si128 ((__m128i *) &state[4], state1);
+}
+
+bool
+HasShaExtensions ()
+{
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid (1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1))
+    {
+      return false;
+    }
+  if (__get_cpuid_max (0, 0) < 7)
+    {
+      return false;
+    }
+  __cpuid_count (7, 0, eax, ebx, ecx, edx);
+  return (ebx & (1u << 29)) != 0;
+}
+
+bool
+HasAvx2 ()
+{
+  __builtin_cpu_init ();
+  return __builtin_cpu_supports ("avx2");
+}
+#endif
+
+CompressFunction
+GetCompressFunction ()
+{
+#ifdef CCNX_SHA256_X86
+  // The processor does not change, so detect it once
+  static const CompressFunction compress = HasShaExtensions () ? CompressShaNi : CompressPortable;
+  return compress;
+#else
+  return CompressPortable;
+#endif
+}
+
+/**
+ * Fill in the padding: the message tail, 0x80, zeros, and the bit length.
+ * `last` points to the final length % 64 bytes of the message.
+ *
+ * @return The number of padded blocks (1 or 2)
+ */
+size_t
+PadTail (uint8_t tail[128], const uint8_t *last, size_t length)
+{
+  size_t remainder = length % 64;
+  size_t padded = remainder < 56 ? 64 : 128;
+  memcpy (tail, last, remainder);
+  tail[remainder] = 0x80;
+  memset (tail + remainder + 1, 0, padded - remainder - 1 - 8);
+  uint64_t bits = (uint64_t) length * 8;
+  WriteBigEndian32 (tail + padded - 8, (uint32_t) (bits >> 32));
+  WriteBigEndian32 (tail + padded - 4, (uint32_t) bits);
+  return padded / 64;
+}
+
+#ifdef __GNUC__
+/*
+ * Multi-buffer SHA-256 with the GCC vector extensions: each element of a vector is one
+ * message's value of a state or schedule word, so one vector instruction does the same
+ * step for every message.  With vector_size (32) and AVX2 enabled that is 8 messages.
+ */
+#define CCNX_SHA256_LANES 1
+
+typedef uint32_t Lanes4 __attribute__ ((vector_size (16)));
+typedef uint32_t Lanes8 __attribute__ ((vector_size (32)));
+
+// A macro, not a function, so the vector type is never passed by value between ISAs
+#define LANE_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+template <typename V, size_t N>
+inline __attribute__ ((always_inline)) void
+CompressLanes (V state[8], const uint8_t *const blocks[N])
+{
+  V w[64];
+  for (int t = 0; t < 16; t++)
+    {
+      for (size_t i = 0; i < N; i++)
+        {
+          w[t][i] = ReadBigEndian32 (blocks[i] + 4 * t);
+        }
+    }
+  for (int t = 16; t < 64; t++)
+    {
+      V s0 = LANE_ROTR (w[t - 15], 7) ^ LANE_ROTR (w[t - 15], 18) ^ (w[t - 15] >> 3);
+      V s1 = LANE_ROTR (w[t - 2], 17) ^ LANE_ROTR (w[t - 2], 19) ^ (w[t - 2] >> 10);
+      w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+
+  V a = state[0], b = state[1], c = state[2], d = state[3];
+  V e = state[4], f = state[5], g = state[6], h = state[7];
+  for (int t = 0; t < 64; t++)
+    {
+      V t1 = h + (LANE_ROTR (e, 6) ^ LANE_ROTR (e, 11) ^ LANE_ROTR (e, 25)) + ((e & f) ^ (~e & g)) + g_k[t] + w[t];
+      V t2 = (LANE_ROTR (a, 2) ^ LANE_ROTR (a, 13) ^ LANE_ROTR (a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h;
+}
+
+/*
+ * Hash up to N messages, one per lane.  Messages of different lengths finish at different
+ * blocks; a finished lane hashes a zero block and its state is masked back afterwards.
+ */
+template <typename V, size_t N>
+inline __attribute__ ((always_inline)) void
+DigestLanes (const uint8_t *const messages[], const size_t lengths[], size_t count, uint8_t digests[][32])
+{
+  const uint8_t zeroBlock[64] = { 0 };
+  uint8_t tails[N][128];
+  size_t fullBlocks[N];
+  size_t totalBlocks[N];
+  size_t maxBlocks = 0;
+  for (size_t i = 0; i < N; i++)
+    {
+      fullBlocks[i] = 0;
+      totalBlocks[i] = 0;
+      if (i < count)
+        {
+          fullBlocks[i] = lengths[i] / 64;
+          totalBlocks[i] = fullBlocks[i] + PadTail (tails[i], messages[i] + 64 * fullBlocks[i], lengths[i]);
+          maxBlocks = totalBlocks[i] > maxBlocks ? totalBlocks[i] : maxBlocks;
+        }
+    }
+
+  const V zero = { 0 };
+  V state[8];
+  for (int k = 0; k < 8; k++)
+    {
+      state[k] = zero + g_initialState[k];
+    }
+
+  for (size_t j = 0; j < maxBlocks; j++)
+    {
+      const uint8_t *blocks[N];
+      V active = zero;
+      for (size_t i = 0; i < N; i++)
+        {
+          if (j < fullBlocks[i])
+            {
+              blocks[i] = messages[i] + 64 * j;
+            }
+          else if (j < totalBlocks[i])
+            {
+              blocks[i] = tails[i] + 64 * (j - fullBlocks[i]);
+            }
+          else
+            {
+              blocks[i] = zeroBlock;
+            }
+          active[i] = j < totalBlocks[i] ? 0xFFFFFFFF : 0;
+        }
+
+      V saved[8];
+      for (int k = 0; k < 8; k++)
+        {
+          saved[k] = state[k];
+        }
+      CompressLanes<V, N> (state, blocks);
+      for (int k = 0; k < 8; k++)
+        {
+          state[k] = (state[k] & active) | (saved[k] & ~active);
+        }
+    }
+
+  for (size_t i = 0; i < count; i++)
+    {
+      for (int k = 0; k < 8; k++)
+        {
+          WriteBigEndian32 (digests[i] + 4 * k, state[k][i]);
+        }
+    }
+}
+
+void
+DigestLanes4 (const uint8_t *const messages[], const size_t lengths[], size_t count, uint8_t digests[][32])
+{
+  DigestLanes<Lanes4, 4> (messages, lengths, count, digests);
+}
+
+#ifdef CCNX_SHA256_X86
+__attribute__ ((target ("avx2"))) void
+DigestLanes8 (const uint8_t *const messages[], const size_t lengths[], size_t count, uint8_t digests[][32])
+{
+  DigestLanes<Lanes8, 8> (messages, lengths, count, digests);
+}
+#endif
+#endif
+
+} // namespace
+
+TypeId
+CCNxHasherSha256::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxHasherSha256")
+    .SetParent<CCNxHasher> ()
+    .SetGroupName ("CCNx");
+  return tid;
+}
+
+CCNxHasherSha256::CCNxHasherSha256 ()
+{
+  Init ();
+}
+
+CCNxHasherSha256::~CCNxHasherSha256 ()
+{
+  // empty
+}
+
+bool
+CCNxHasherSha256::Init ()
+{
+  memcpy (m_state, g_initialState, sizeof(m_state));
+  m_blockUsed = 0;
+  m_totalLength = 0;
+  return true;
+}
+
+size_t
+CCNxHasherSha256::Update (const uint8_t *buffer, size_t length)
+{
+  CompressFunction compress = GetCompressFunction ();
+  size_t remaining = length;
+  m_totalLength += length;
+
+  if (m_blockUsed > 0)
+    {
+      size_t take = m_blockLength - m_blockUsed;
+      take = remaining < take ? remaining : take;
+      memcpy (m_block + m_blockUsed, buffer, take);
+      m_blockUsed += take;
+      buffer += take;
+      remaining -= take;
+      if (m_blockUsed < m_blockLength)
+        {
+          return length;
+        }
+      compress (m_state, m_block, 1);
+      m_blockUsed = 0;
+    }
+
+  // Whole blocks straight from the caller's buffer
+  size_t blocks = remaining / m_blockLength;
+  if (blocks > 0)
+    {
+      compress (m_state, buffer, blocks);
+      buffer += blocks * m_blockLength;
+      remaining -= blocks * m_blockLength;
+    }
+
+  memcpy (m_block, buffer, remaining);
+  m_blockUsed = remaining;
+  return length;
+}
+
+Ptr<CCNxHashValue>
+CCNxHasherSha256::Finalize ()
+{
+  uint8_t tail[128];
+  size_t blocks = PadTail (tail, m_block, m_totalLength);
+  GetCompressFunction () (m_state, tail, blocks);
+
+  std::vector<uint8_t> digest (m_digestLength);
+  for (int k = 0; k < 8; k++)
+    {
+      WriteBigEndian32 (&digest[4 * k], m_state[k]);
+    }
+  return Create<CCNxHashValue> (Create<CCNxByteArray> (digest));
+}
+
+bool
+CCNxHasherSha256::IsAccelerated ()
+{
+  return GetCompressFunction () != CompressPortable;
+}
+
+size_t
+CCNxHasherSha256::GetMultiBufferLanes ()
+{
+#if defined(CCNX_SHA256_LANES) && defined(CCNX_SHA256_X86)
+  static const size_t lanes = HasAvx2 () ? 8 : 4;
+  return lanes;
+#elif defined(CCNX_SHA256_LANES)
+  return 4;
+#else
+  return 1;
+#endif
+}
+
+void
+CCNxHasherSha256::DigestMultiBuffer (const std::vector<const uint8_t *> &messages,
+                                     const std::vector<size_t> &lengths,
+                                     std::vector<Ptr<CCNxHashValue> > &digests)
+{
+  NS_ASSERT_MSG (messages.size () == lengths.size (), "Need one length per message");
+  digests.resize (messages.size ());
+
+#ifdef CCNX_SHA256_LANES
+  const size_t lanes = GetMultiBufferLanes ();
+  uint8_t batch[8][m_digestLength];
+  for (size_t first = 0; first < messages.size (); first += lanes)
+    {
+      size_t count = messages.size () - first < lanes ? messages.size () - first : lanes;
+#ifdef CCNX_SHA256_X86
+      if (lanes == 8)
+        {
+          DigestLanes8 (&messages[first], &lengths[first], count, batch);
+        }
+      else
+#endif
+        {
+          DigestLanes4 (&messages[first], &lengths[first], count, batch);
+        }
+
+      for (size_t i = 0; i < count; i++)
+        {
+          std::vector<uint8_t> digest (batch[i], batch[i] + m_digestLength);
+          digests[first + i] = Create<CCNxHashValue> (Create<CCNxByteArray> (digest));
+        }
+    }
+#else
+  Ptr<CCNxHasherSha256> hasher = CreateObject<CCNxHasherSha256> ();
+  for (size_t i = 0; i < messages.size (); i++)
+    {
+      hasher->Init ();
+      hasher->Update (messages[i], lengths[i]);
+      digests[i] = hasher->Finalize ();
+    }
+#endif
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_CRYPTO_HASHERS_CCNX_HASHER_SHA256_H_
+#define CCNS3SIM_MODEL_CRYPTO_HASHERS_CCNX_HASHER_SHA256_H_
+
+#include <vector>
+#include "ns3/ccnx-hasher.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-crypto
+ *
+ * SHA-256 (FIPS 180-4).  On x86 processors with the SHA extensions (SHA-NI) the compression
+ * function uses them, otherwise it uses a portable implementation.  Both give the same digest.
+ *
+ * DigestMultiBuffer() hashes several independent messages at once, one message per SIMD lane:
+ * 8 lanes with AVX2, otherwise 4 lanes.  Use it when a batch of content objects needs hashing.
+ *
+ * Unlike the other simulation hashers, Finalize() returns the full 32 byte digest.
+ */
+class CCNxHasherSha256 : public CCNxHasher
+{
+public:
+  static TypeId GetTypeId ();
+
+  CCNxHasherSha256 ();
+  virtual ~CCNxHasherSha256 ();
+
+  /**
+   * Reset the internal state to start a new hash.
+   * @return true success
+   * @return false failure
+   */
+  virtual bool Init ();
+
+  /**
+   * Update the hash with some bytes
+   *
+   * @param [in] buffer
+   * @param [in] length
+   * @return The number of bytes read
+   */
+  virtual size_t Update (const uint8_t *buffer, size_t length);
+
+  using CCNxHasher::Update;
+
+  /**
+   * Finalize the hash and return the final result.
+   *
+   * @return The 32 byte hash value
+   */
+  virtual Ptr<CCNxHashValue> Finalize ();
+
+  /**
+   * @return true if the compression function uses the x86 SHA extensions
+   */
+  static bool IsAccelerated ();
+
+  /**
+   * The number of messages DigestMultiBuffer() hashes in parallel on this processor.
+   */
+  static size_t GetMultiBufferLanes ();
+
+  /**
+   * Compute the SHA-256 of each message.  The messages are hashed GetMultiBufferLanes() at a
+   * time.  The digests are the same as hashing each message with its own CCNxHasherSha256.
+   *
+   * @param [in] messages Pointers to the message bytes
+   * @param [in] lengths The byte length of each message
+   * @param [out] digests Resized to the number of messages, one hash value per message
+   */
+  static void DigestMultiBuffer (const std::vector<const uint8_t *> &messages,
+                                 const std::vector<size_t> &lengths,
+                                 std::vector<Ptr<CCNxHashValue> > &digests);
+
+  static const size_t m_digestLength = 32;
+
+private:
+  static const size_t m_blockLength = 64;
+
+  uint32_t m_state[8];
+  uint8_t m_block[m_blockLength];
+  size_t m_blockUsed;
+  uint64_t m_totalLength;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_CRYPTO_HASHERS_CCNX_HASHER_SHA256_H_ */
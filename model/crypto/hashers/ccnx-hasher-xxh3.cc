@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cstring>
+#include "ccnx-hasher-xxh3.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_OBJECT_ENSURE_REGISTERED (CCNxHasherXxh3);
+
+namespace {
+
+const uint32_t g_prime32_1 = 0x9E3779B1U;
+const uint32_t g_prime32_2 = 0x85EBCA77U;
+const uint32_t g_prime32_3 = 0xC2B2AE3DU;
+const uint64_t g_prime64_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t g_prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t g_prime64_3 = 0x165667B19E3779F9ULL;
+const uint64_t g_prime64_4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t g_prime64_5 = 0x27D4EB2F165667C5ULL;
+const uint64_t g_primeMx1 = 0x165667919E3779F9ULL;
+const uint64_t g_primeMx2 = 0x9FB21C651E98DF25ULL;
+
+/**
+ * The default XXH3 secret
+ */
+const uint8_t g_secret[192] = {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+const size_t g_stripeLength = 64;
+const size_t g_secretConsumeRate = 8;
+const size_t g_stripesPerBlock = (sizeof(g_secret) - g_stripeLength) / g_secretConsumeRate;
+const size_t g_blockLength = g_stripeLength * g_stripesPerBlock;
+const size_t g_scrambleSecret = sizeof(g_secret) - g_stripeLength;
+const size_t g_lastStripeSecret = sizeof(g_secret) - g_stripeLength - 7;
+const size_t g_mergeSecret = 11;
+
+inline uint32_t
+Read32 (const uint8_t *p)
+{
+  return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+inline uint64_t
+Read64 (const uint8_t *p)
+{
+  return (uint64_t) Read32 (p) | ((uint64_t) Read32 (p + 4) << 32);
+}
+
+inline uint64_t
+Rotl64 (uint64_t x, int n)
+{
+  return (x << n) | (x >> (64 - n));
+}
+
+inline uint64_t
+Swap64 (uint64_t x)
+{
+  x = ((x << 8) & 0xFF00FF00FF00FF00ULL) | ((x >> 8) & 0x00FF00FF00FF00FFULL);
+  x = ((x << 16) & 0xFFFF0000FFFF0000ULL) | ((x >> 16) & 0x0000FFFF0000FFFFULL);
+  return (x << 32) | (x >> 32);
+}
+
+/**
+ * The 128-bit product of a and b, with the high and low halves xor'ed together.
+ */
+inline uint64_t
+Mul128Fold64 (uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 product = (unsigned __int128) a * b;
+  return (uint64_t) product ^ (uint64_t) (product >> 64);
+#else
+  uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+  uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+  uint64_t loLo = aLo * bLo;
+  uint64_t hiLo = aHi * bLo;
+  uint64_t loHi = aLo * bHi;
+  uint64_t hiHi = aHi * bHi;
+  uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+  uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+  uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFF);
+  return lower ^ upper;
+#endif
+}
+
+inline uint64_t
+Xxh64Avalanche (uint64_t h)
+{
+  h ^= h >> 33;
+  h *= g_prime64_2;
+  h ^= h >> 29;
+  h *= g_prime64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+inline uint64_t
+Avalanche (uint64_t h)
+{
+  h ^= h >> 37;
+  h *= g_primeMx1;
+  h ^= h >> 32;
+  return h;
+}
+
+inline uint64_t
+Rrmxmx (uint64_t h, uint64_t length)
+{
+  h ^= Rotl64 (h, 49) ^ Rotl64 (h, 24);
+  h *= g_primeMx2;
+  h ^= (h >> 35) + length;
+  h *= g_primeMx2;
+  return h ^ (h >> 28);
+}
+
+inline uint64_t
+Mix16 (const uint8_t *input, const uint8_t *secret)
+{
+  return Mul128Fold64 (Read64 (input) ^ Read64 (secret), Read64 (input + 8) ^ Read64 (secret + 8));
+}
+
+/**
+ * XXH3 for 0 to 240 bytes.  Each length range has its own mixing.
+ */
+uint64_t
+HashShort (const uint8_t *input, size_t length)
+{
+  if (length == 0)
+    {
+      return Xxh64Avalanche (Read64 (g_secret + 56) ^ Read64 (g_secret + 64));
+    }
+
+  if (length <= 3)
+    {
+      uint32_t combined = ((uint32_t) input[0] << 16) | ((uint32_t) input[length >> 1] << 24)
+        | (uint32_t) input[length - 1] | ((uint32_t) length << 8);
+      uint64_t bitflip = Read32 (g_secret) ^ Read32 (g_secret + 4);
+      return Xxh64Avalanche ((uint64_t) combined ^ bitflip);
+    }
+
+  if (length <= 8)
+    {
+      uint64_t bitflip = Read64 (g_secret + 8) ^ Read64 (g_secret + 16);
+      uint64_t input64 = Read32 (input + length - 4) + ((uint64_t) Read32 (input) << 32);
+      return Rrmxmx (input64 ^ bitflip, length);
+    }
+
+  if (length <= 16)
+    {
+      uint64_t lo = Read64 (input) ^ (Read64 (g_secret + 24) ^ Read64 (g_secret + 32));
+      uint64_t hi = Read64 (input + length - 8) ^ (Read64 (g_secret + 40) ^ Read64 (g_secret + 48));
+      uint64_t acc = length + Swap64 (lo) + hi + Mul128Fold64 (lo, hi);
+      return Avalanche (acc);
+    }
+
+  uint64_t acc = length * g_prime64_1;
+  if (length <= 128)
+    {
+      if (length > 32)
+        {
+          if (length > 64)
+            {
+              if (length > 96)
+                {
+                  acc += Mix16 (input + 48, g_secret + 96);
+                  acc += Mix16 (input + length - 64, g_secret + 112);
+                }
+              acc += Mix16 (input + 32, g_secret + 64);
+              acc += Mix16 (input + length - 48, g_secret + 80);
+            }
+          acc += Mix16 (input + 16, g_secret + 32);
+          acc += Mix16 (input + length - 32, g_secret + 48);
+        }
+      acc += Mix16 (input, g_secret);
+      acc += Mix16 (input + length - 16, g_secret + 16);
+      return Avalanche (acc);
+    }
+
+  // 129 to 240 bytes
+  size_t rounds = length / 16;
+  for (size_t i = 0; i < 8; i++)
+    {
+      acc += Mix16 (input + 16 * i, g_secret + 16 * i);
+    }
+  acc = Avalanche (acc);
+  for (size_t i = 8; i < rounds; i++)
+    {
+      acc += Mix16 (input + 16 * i, g_secret + 16 * (i - 8) + 3);
+    }
+  acc += Mix16 (input + length - 16, g_secret + 136 - 17);
+  return Avalanche (acc);
+}
+
+const uint64_t g_initialAcc[8] = {
+  g_prime32_3, g_prime64_1, g_prime64_2, g_prime64_3, g_prime64_4, g_prime32_2, g_prime64_5, g_prime32_1
+};
+
+/*
+ * The long input loop.  These are written as plain loops over the 8 lanes so the
+ * compiler can vectorize them.
+ */
+inline void
+Accumulate512 (uint64_t acc[8], const uint8_t *input, const uint8_t *secret)
+{
+  for (int i = 0; i < 8; i++)
+    {
+      uint64_t data = Read64 (input + 8 * i);
+      uint64_t key = data ^ Read64 (secret + 8 * i);
+      acc[i ^ 1] += data;
+      acc[i] += (uint64_t) (uint32_t) key * (key >> 32);
+    }
+}
+
+inline void
+Accumulate (uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t stripes)
+{
+  for (size_t n = 0; n < stripes; n++)
+    {
+      Accumulate512 (acc, input + n * g_stripeLength, secret + n * g_secretConsumeRate);
+    }
+}
+
+inline void
+Scramble (uint64_t acc[8], const uint8_t *secret)
+{
+  for (int i = 0; i < 8; i++)
+    {
+      uint64_t a = acc[i];
+      a ^= a >> 47;
+      a ^= Read64 (secret + 8 * i);
+      a *= g_prime32_1;
+      acc[i] = a;
+    }
+}
+
+/**
+ * Run whole stripes through the accumulators, scrambling at the end of each block.
+ */
+void
+ConsumeStripes (uint64_t acc[8], size_t &stripesSoFar, const uint8_t *input, size_t stripes)
+{
+  if (g_stripesPerBlock - stripesSoFar <= stripes)
+    {
+      // Finish the block, scramble, and start the next one
+      size_t toEnd = g_stripesPerBlock - stripesSoFar;
+      Accumulate (acc, input, g_secret + stripesSoFar * g_secretConsumeRate, toEnd);
+      Scramble (acc, g_secret + g_scrambleSecret);
+      Accumulate (acc, input + toEnd * g_stripeLength, g_secret, stripes - toEnd);
+      stripesSoFar = stripes - toEnd;
+    }
+  else
+    {
+      Accumulate (acc, input, g_secret + stripesSoFar * g_secretConsumeRate, stripes);
+      stripesSoFar += stripes;
+    }
+}
+
+uint64_t
+MergeAccumulators (const uint64_t acc[8], uint64_t length)
+{
+  uint64_t result = length * g_prime64_1;
+  for (int i = 0; i < 4; i++)
+    {
+      const uint8_t *secret = g_secret + g_mergeSecret + 16 * i;
+      result += Mul128Fold64 (acc[2 * i] ^ Read64 (secret), acc[2 * i + 1] ^ Read64 (secret + 8));
+    }
+  return Avalanche (result);
+}
+
+uint64_t
+HashLong (const uint8_t *input, size_t length)
+{
+  uint64_t acc[8];
+  memcpy (acc, g_initialAcc, sizeof(acc));
+
+  size_t blocks = (length - 1) / g_blockLength;
+  for (size_t n = 0; n < blocks; n++)
+    {
+      Accumulate (acc, input + n * g_blockLength, g_secret, g_stripesPerBlock);
+      Scramble (acc, g_secret + g_scrambleSecret);
+    }
+
+  size_t stripes = ((length - 1) - g_blockLength * blocks) / g_stripeLength;
+  Accumulate (acc, input + blocks * g_blockLength, g_secret, stripes);
+  Accumulate512 (acc, input + length - g_stripeLength, g_secret + g_lastStripeSecret);
+
+  return MergeAccumulators (acc, length);
+}
+
+} // namespace
+
+TypeId
+CCNxHasherXxh3::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxHasherXxh3")
+    .SetParent<CCNxHasher> ()
+    .SetGroupName ("CCNx");
+  return tid;
+}
+
+CCNxHasherXxh3::CCNxHasherXxh3 ()
+{
+  Init ();
+}
+
+CCNxHasherXxh3::~CCNxHasherXxh3 ()
+{
+  // empty
+}
+
+bool
+CCNxHasherXxh3::Init ()
+{
+  memcpy (m_acc, g_initialAcc, sizeof(m_acc));
+  m_bufferUsed = 0;
+  m_stripesSoFar = 0;
+  m_totalLength = 0;
+  return true;
+}
+
+size_t
+CCNxHasherXxh3::Update (const uint8_t *buffer, size_t length)
+{
+  m_totalLength += length;
+
+  if (m_bufferUsed + length <= m_bufferLength)
+    {
+      memcpy (m_buffer + m_bufferUsed, buffer, length);
+      m_bufferUsed += length;
+      return length;
+    }
+
+  const uint8_t *input = buffer;
+  const uint8_t *end = buffer + length;
+  const size_t bufferStripes = m_bufferLength / m_stripeLength;
+
+  if (m_bufferUsed > 0)
+    {
+      size_t load = m_bufferLength - m_bufferUsed;
+      memcpy (m_buffer + m_bufferUsed, input, load);
+      input += load;
+      ConsumeStripes (m_acc, m_stripesSoFar, m_buffer, bufferStripes);
+      m_bufferUsed = 0;
+    }
+
+  /*
+   * Always keep some input in m_buffer: the last stripe is hashed differently by Finalize().
+   * The last stripe of the consumed input is saved at the end of m_buffer in case Finalize()
+   * needs bytes from before the ones buffered.
+   */
+  if ((size_t) (end - input) > m_bufferLength)
+    {
+      do
+        {
+          ConsumeStripes (m_acc, m_stripesSoFar, input, bufferStripes);
+          input += m_bufferLength;
+        }
+      while ((size_t) (end - input) > m_bufferLength);
+      memcpy (m_buffer + m_bufferLength - m_stripeLength, input - m_stripeLength, m_stripeLength);
+    }
+
+  memcpy (m_buffer, input, end - input);
+  m_bufferUsed = end - input;
+  return length;
+}
+
+Ptr<CCNxHashValue>
+CCNxHasherXxh3::Finalize ()
+{
+  uint64_t hash;
+  if (m_totalLength <= 240)
+    {
+      hash = HashShort (m_buffer, m_totalLength);
+    }
+  else
+    {
+      uint64_t acc[8];
+      memcpy (acc, m_acc, sizeof(acc));
+      uint8_t lastStripe[m_stripeLength];
+      const uint8_t *last;
+      if (m_bufferUsed >= m_stripeLength)
+        {
+          // Work on copies so more bytes can still be added
+          size_t stripesSoFar = m_stripesSoFar;
+          ConsumeStripes (acc, stripesSoFar, m_buffer, (m_bufferUsed - 1) / m_stripeLength);
+          last = m_buffer + m_bufferUsed - m_stripeLength;
+        }
+      else
+        {
+          // The last stripe starts in the bytes consumed before the buffered ones
+          size_t catchup = m_stripeLength - m_bufferUsed;
+          memcpy (lastStripe, m_buffer + m_bufferLength - catchup, catchup);
+          memcpy (lastStripe + catchup, m_buffer, m_bufferUsed);
+          last = lastStripe;
+        }
+      Accumulate512 (acc, last, g_secret + g_lastStripeSecret);
+      hash = MergeAccumulators (acc, m_totalLength);
+    }
+
+  return Create<CCNxHashValue> (hash, sizeof(uint64_t));
+}
+
+uint64_t
+CCNxHasherXxh3::Hash (const uint8_t *buffer, size_t length)
+{
+  return length <= 240 ? HashShort (buffer, length) : HashLong (buffer, length);
+}
@@ -105,3 +105,14 @@ CCNxForwarder::SetRouteCallback (RouteCallback callback)
 {
   m_routeCallback = callback;
 }
+
+void
+CCNxForwarder::RouteOutputBatch (const PacketBatchType &packets,
+                                 Ptr<CCNxConnection> ingressConnection,
+                                 Ptr<CCNxConnection> egressConnection)
+{
+  for (PacketBatchType::const_iterator i = packets.begin (); i != packets.end (); ++i)
+    {
+      RouteOutput (*i, ingressConnection, egressConnection);
+    }
+}
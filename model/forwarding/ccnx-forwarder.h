@@ -56,6 +56,8 @@
 #ifndef CCNS3_FORWARDER_H
 #define CCNS3_FORWARDER_H
 
+#include <vector>
+
 #include "ns3/object.h"
 #include "ns3/net-device.h"
 #include "ns3/traced-callback.h"
@@ -145,6 +147,26 @@ public:
                             Ptr<CCNxConnection> ingressConnection,
                             Ptr<CCNxConnection> egressConnection) = 0;
 
+  /**
+   * Typedef for a batch of packets passed to `RouteOutputBatch()`
+   */
+  typedef std::vector< Ptr<CCNxPacket> > PacketBatchType;
+
+  /**
+   * Query for list of next hops for several outbound packets (from L4) that share the
+   * same ingress and egress connections.  Each packet gets its own call to the RouteCallback.
+   *
+   * The default implementation calls `RouteOutput()` once per packet.  A forwarder with
+   * an input queue should override it to enqueue the whole batch at once.
+   *
+   * @param packets [in] The CCNxPackets to route for output, in order
+   * @param ingressConnection [in] The source CCNxConnection
+   * @param egressConnection [in] The CCNxConnection to send them out on (may be Ptr<CCNxConnection>(0))
+   */
+  virtual void RouteOutputBatch (const PacketBatchType &packets,
+                                 Ptr<CCNxConnection> ingressConnection,
+                                 Ptr<CCNxConnection> egressConnection);
+
   /**
    *  Query for list of next hops  - inbound packet (from L2)
    *
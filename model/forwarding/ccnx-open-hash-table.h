@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_CCNX_OPEN_HASH_TABLE_H_
+#define CCNS3SIM_MODEL_FORWARDING_CCNX_OPEN_HASH_TABLE_H_
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+#include "ns3/assert.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-forwarder-base
+ *
+ * An open-addressing (linear probing) hash table keyed by a caller-supplied 64-bit hash.
+ *
+ * The table never computes a hash itself.  The caller computes the hash of a key once
+ * (e.g. from the name segments) and passes it to every `Find()`, `Insert()` and `Erase()`.
+ * A probe compares the stored 64-bit hash first and only calls `KeyEqual` when the hashes
+ * are equal, so a mismatch never touches the key storage.
+ *
+ * The capacity is always a power of 2.  The table doubles when the load factor would
+ * exceed 3/4.  Erase uses backward-shift deletion, so there are no tombstones and
+ * the probe sequences stay short after many insert/erase cycles (such as in a PIT).
+ *
+ * N.B.: Because this is a class template, all implementation must be in the header
+ * file so the compiler can generate the template specializations from user code.
+ *
+ * @tparam K The key type (e.g. `Ptr<const CCNxName>`)
+ * @tparam V The value type.  A default constructed V is returned when a key is not found.
+ * @tparam KeyEqual A functor `bool operator() (const K &a, const K &b) const`
+ */
+template <class K, class V, class KeyEqual>
+class CCNxOpenHashTable
+{
+public:
+  /**
+   * @param initialCapacity The starting number of slots, rounded up to a power of 2.
+   */
+  CCNxOpenHashTable (size_t initialCapacity = 64)
+    : m_count (0)
+  {
+    size_t capacity = 8;
+    while (capacity < initialCapacity)
+      {
+        capacity <<= 1;
+      }
+    m_slots = SlotArrayType (capacity);
+  }
+
+  /**
+   * Lookup the key.
+   *
+   * @param hash [in] The hash of `key`
+   * @param key [in] The key to lookup
+   * @return The stored value or a default constructed V if not found
+   */
+  V Find (uint64_t hash, const K &key) const
+  {
+    size_t index;
+    if (Locate (hash, key, index))
+      {
+        return m_slots[index].m_value;
+      }
+    return V ();
+  }
+
+  /**
+   * Insert or replace the value of `key`.
+   *
+   * @param hash [in] The hash of `key`
+   * @param key [in] The key
+   * @param value [in] The value to store
+   * @return true if a new slot was used, false if an existing value was replaced
+   */
+  bool Insert (uint64_t hash, const K &key, const V &value)
+  {
+    size_t index;
+    if (Locate (hash, key, index))
+      {
+        m_slots[index].m_value = value;
+        return false;
+      }
+
+    if ((m_count + 1) * 4 > m_slots.size () * 3)
+      {
+        Resize (m_slots.size () * 2);
+      }
+
+    Place (hash, key, value);
+    m_count++;
+    return true;
+  }
+
+  /**
+   * Remove `key` from the table.
+   *
+   * @param hash [in] The hash of `key`
+   * @param key [in] The key to remove
+   * @return true if the key was in the table
+   */
+  bool Erase (uint64_t hash, const K &key)
+  {
+    size_t index;
+    if (!Locate (hash, key, index))
+      {
+        return false;
+      }
+
+    // Backward-shift deletion: pull later members of the cluster in to the hole
+    // if their home slot is at or before the hole.
+    const size_t mask = m_slots.size () - 1;
+    size_t hole = index;
+    size_t next = (hole + 1) & mask;
+    while (m_slots[next].m_used)
+      {
+        size_t home = m_slots[next].m_hash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask))
+          {
+            m_slots[hole] = m_slots[next];
+            hole = next;
+          }
+        next = (next + 1) & mask;
+      }
+
+    m_slots[hole] = SlotType ();
+    m_count--;
+    return true;
+  }
+
+  /**
+   * Remove all entries, keeping the current capacity.
+   */
+  void clear ()
+  {
+    for (size_t i = 0; i < m_slots.size (); ++i)
+      {
+        m_slots[i] = SlotType ();
+      }
+    m_count = 0;
+  }
+
+  /**
+   * @return The number of keys in the table
+   */
+  size_t size () const
+  {
+    return m_count;
+  }
+
+  /**
+   * @return The number of slots in the table (used and free)
+   */
+  size_t capacity () const
+  {
+    return m_slots.size ();
+  }
+
+  /**
+   * Slot-level access for walking the table (e.g. to print it).  Use with
+   * `capacity()`, `IsOccupied()`, `KeyAt()` and `ValueAt()`.
+   *
+   * @param slot [in] 0 <= slot < capacity()
+   * @return true if the slot holds a key
+   */
+  bool IsOccupied (size_t slot) const
+  {
+    return m_slots[slot].m_used;
+  }
+
+  /**
+   * @param slot [in] An occupied slot
+   * @return The key stored in the slot
+   */
+  const K & KeyAt (size_t slot) const
+  {
+    NS_ASSERT_MSG (m_slots[slot].m_used, "KeyAt called on an empty slot");
+    return m_slots[slot].m_key;
+  }
+
+  /**
+   * @param slot [in] An occupied slot
+   * @return The value stored in the slot
+   */
+  const V & ValueAt (size_t slot) const
+  {
+    NS_ASSERT_MSG (m_slots[slot].m_used, "ValueAt called on an empty slot");
+    return m_slots[slot].m_value;
+  }
+
+private:
+  struct SlotType
+  {
+    SlotType () : m_hash (0), m_key (), m_value (), m_used (false)
+    {
+    }
+
+    uint64_t m_hash;
+    K m_key;
+    V m_value;
+    bool m_used;
+  };
+
+  typedef std::vector<SlotType> SlotArrayType;
+
+  /**
+   * Find the slot of `key`.
+   *
+   * @param index [out] The slot index, only valid if the return value is true
+   * @return true if found
+   */
+  bool Locate (uint64_t hash, const K &key, size_t &index) const
+  {
+    const size_t mask = m_slots.size () - 1;
+    size_t i = hash & mask;
+    while (m_slots[i].m_used)
+      {
+        if (m_slots[i].m_hash == hash && m_equal (m_slots[i].m_key, key))
+          {
+            index = i;
+            return true;
+          }
+        i = (i + 1) & mask;
+      }
+    return false;
+  }
+
+  /**
+   * Put a key known not to be in the table in the first free slot of its probe sequence.
+   */
+  void Place (uint64_t hash, const K &key, const V &value)
+  {
+    const size_t mask = m_slots.size () - 1;
+    size_t i = hash & mask;
+    while (m_slots[i].m_used)
+      {
+        i = (i + 1) & mask;
+      }
+    m_slots[i].m_hash = hash;
+    m_slots[i].m_key = key;
+    m_slots[i].m_value = value;
+    m_slots[i].m_used = true;
+  }
+
+  void Resize (size_t capacity)
+  {
+    SlotArrayType old (capacity);
+    old.swap (m_slots);
+    for (size_t i = 0; i < old.size (); ++i)
+      {
+        if (old[i].m_used)
+          {
+            Place (old[i].m_hash, old[i].m_key, old[i].m_value);
+          }
+      }
+  }
+
+  /**
+   * The number of used slots
+   */
+  size_t m_count;
+
+  /**
+   * The slot array, size is a power of 2
+   */
+  SlotArrayType m_slots;
+
+  KeyEqual m_equal;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_CCNX_OPEN_HASH_TABLE_H_ */
@@ -0,0 +1,608 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/integer.h"
+#include "ns3/boolean.h"
+#include "ns3/ccnx-interestlifetime.h"
+#include "ns3/ccnx-name-intern-pool.h"
+#include "ccnx-hash-pit.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxHashPit");
+NS_OBJECT_ENSURE_REGISTERED (CCNxHashPit);
+
+static const Time _defaultLifetime = Seconds (0.2f);  //default interest lifetime  after arrival at a node
+
+static const Time _defaultLayerDelayConstant = MicroSeconds (1);
+static const Time _defaultLayerDelaySlope = NanoSeconds (1);
+static const unsigned _defaultLayerDelayServers = 1;
+static const bool _defaultInlineZeroDelay = false;
+static const unsigned _defaultLayerDelayBatchSize = 1;
+static const unsigned _defaultInitialCapacity = 1024;
+static const Time _defaultExpiryTick = MilliSeconds (10);
+
+static const uint64_t _fnvPrime = 0x00000100000001B3ULL;
+static const uint64_t _fnvOffset = 0xCBF29CE484222325ULL;
+
+/**
+ * Used as a default callback for m_recieveInterestCallback in case the user does not set it.
+ */
+static void
+NullReceiveInterestCallback (Ptr<CCNxForwarderMessage>, enum CCNxPit::Verdict)
+{
+  NS_ASSERT_MSG (false, "You must set the ReceiveInterest Callback via SetReceiveInterestCallback()");
+}
+
+/**
+ * Used as a default callback for m_satisfyInterestCallback in case the user does not set it.
+ */
+static void
+NullSatisfyInterestCallback (Ptr<CCNxForwarderMessage>, Ptr<CCNxConnectionList>)
+{
+  NS_ASSERT_MSG (false, "You must set the SatisfyInterest Callback via SetSatisfyInterestCallback()");
+}
+
+TypeId
+CCNxHashPit::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxHashPit")
+    .SetParent<CCNxPit> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxHashPit> ()
+    .AddAttribute ("DefaultLifetime", "The PIT Lifetime of an Interest without a lifetime header.",
+                   TimeValue (_defaultLifetime),
+                   MakeTimeAccessor (&CCNxHashPit::m_defaultLifetime),
+                   MakeTimeChecker ())
+    .AddAttribute ("LayerDelayConstant", "The amount of constant layer delay",
+                   TimeValue (_defaultLayerDelayConstant),
+                   MakeTimeAccessor (&CCNxHashPit::m_layerDelayConstant),
+                   MakeTimeChecker ())
+    .AddAttribute ("LayerDelaySlope", "The slope of the layer delay (in terms of name bytes)",
+                   TimeValue (_defaultLayerDelaySlope),
+                   MakeTimeAccessor (&CCNxHashPit::m_layerDelaySlope),
+                   MakeTimeChecker ())
+    .AddAttribute ("LayerDelayServers", "The number of servers for the layer delay input queue",
+                   IntegerValue (_defaultLayerDelayServers),
+                   MakeIntegerAccessor (&CCNxHashPit::m_layerDelayServers),
+                   MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("InlineZeroDelay", "If true and both layer delays are zero, service the input queue inline",
+                   BooleanValue (_defaultInlineZeroDelay),
+                   MakeBooleanAccessor (&CCNxHashPit::m_inlineZeroDelay),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LayerDelayBatchSize", "The maximum number of packets a layer delay server processes together",
+                   IntegerValue (_defaultLayerDelayBatchSize),
+                   MakeIntegerAccessor (&CCNxHashPit::m_layerDelayBatchSize),
+                   MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("InitialCapacity", "The initial number of slots in each PIT hash table",
+                   IntegerValue (_defaultInitialCapacity),
+                   MakeIntegerAccessor (&CCNxHashPit::m_initialCapacity),
+                   MakeIntegerChecker<unsigned> (1))
+    .AddAttribute ("ExpiryTick", "The resolution of the timing wheel that removes expired entries",
+                   TimeValue (_defaultExpiryTick),
+                   MakeTimeAccessor (&CCNxHashPit::m_expiryTick),
+                   MakeTimeChecker ())
+    .AddTraceSource ("Expire",
+                     "A PIT entry was removed because its lifetime expired.",
+                     MakeTraceSourceAccessor (&CCNxHashPit::m_expireTrace),
+                     "ns3::ccnx::CCNxHashPit::ExpireTracedCallback")
+  ;
+
+  return tid;
+}
+
+CCNxHashPit::CCNxHashPit () : m_expiryTick (_defaultExpiryTick),
+  m_initialCapacity (_defaultInitialCapacity),
+  m_defaultLifetime (_defaultLifetime),
+  m_receiveInterestCallback (MakeCallback (&NullReceiveInterestCallback)),
+  m_satisfyInterestCallback (MakeCallback (&NullSatisfyInterestCallback)),
+  m_layerDelayConstant (_defaultLayerDelayConstant),
+  m_layerDelaySlope (_defaultLayerDelaySlope),
+  m_layerDelayServers (_defaultLayerDelayServers),
+  m_inlineZeroDelay (_defaultInlineZeroDelay),
+  m_layerDelayBatchSize (_defaultLayerDelayBatchSize)
+{
+}
+
+CCNxHashPit::~CCNxHashPit ()
+{
+}
+
+void
+CCNxHashPit::DoInitialize ()
+{
+  // The attributes are set after the constructor, so size the tables here
+  m_tableByName = PitByNameType (m_initialCapacity);
+  m_tableByNameAndKeyId = PitByNameAndKeyIdType (m_initialCapacity);
+  m_tableByHash = PitByHashType (m_initialCapacity);
+
+  m_inputQueue = Create<DelayQueueType> (m_layerDelayServers,
+                                         MakeCallback (&CCNxHashPit::GetServiceTime, this),
+                                         MakeCallback (&CCNxHashPit::ServiceInputQueue, this));
+
+  if (m_inlineZeroDelay && m_layerDelayConstant.IsZero () && m_layerDelaySlope.IsZero ())
+    {
+      // There is no processing time to model, so skip the timer and service inline
+      m_inputQueue->SetSynchronous (true);
+    }
+  else if (m_layerDelayBatchSize > 1)
+    {
+      m_inputQueue->SetBatchMode (m_layerDelayBatchSize, MakeCallback (&CCNxHashPit::GetBatchServiceTime, this));
+    }
+
+  m_expiryWheel = Create< CCNxTimingWheel<ExpiryRecord> > (m_expiryTick, MakeCallback (&CCNxHashPit::ExpireEntry, this));
+}
+
+void
+CCNxHashPit::DoDispose ()
+{
+  if (m_expiryWheel)
+    {
+      m_expiryWheel->Clear ();
+    }
+  m_expiryWheel = 0;
+  m_tableByName.clear ();
+  m_tableByNameAndKeyId.clear ();
+  m_tableByHash.clear ();
+  CCNxPit::DoDispose ();
+}
+
+void
+CCNxHashPit::SetReceiveInterestCallback (ReceiveInterestCallback receiveInterestCallback)
+{
+  m_receiveInterestCallback = receiveInterestCallback;
+}
+
+void
+CCNxHashPit::SetSatisfyInterestCallback (SatisfyInterestCallback satisfyInterestCallback)
+{
+  m_satisfyInterestCallback = satisfyInterestCallback;
+}
+
+uint64_t
+CCNxHashPit::HashName (Ptr<const CCNxName> name)
+{
+  // The name caches its hash, so a name is only hashed once no matter how many
+  // tables it goes in.
+  return name ? name->GetHash () : _fnvOffset;
+}
+
+uint64_t
+CCNxHashPit::HashHashValue (Ptr<const CCNxHashValue> hashValue)
+{
+  uint64_t hash = _fnvOffset;
+  if (hashValue)
+    {
+      Ptr<const CCNxByteArray> bytes = hashValue->GetValue ();
+      for (size_t i = 0; i < bytes->size (); ++i)
+        {
+          hash = (hash ^ (*bytes)[i]) * _fnvPrime;
+        }
+    }
+  return hash;
+}
+
+uint64_t
+CCNxHashPit::HashNameAndKeyId (uint64_t nameHash, Ptr<const CCNxHashValue> keyId)
+{
+  return (nameHash ^ HashHashValue (keyId)) * _fnvPrime;
+}
+
+Time
+CCNxHashPit::GetServiceTime (Ptr<CCNxForwarderMessage> item)
+{
+  Time delay = m_layerDelayConstant;
+
+  Ptr<const CCNxName> name = item->GetPacket ()->GetMessage ()->GetName ();
+  if (name)
+    {
+      size_t nameBytes = 0;
+      for (int i = 0; i < name->GetSegmentCount (); ++i)
+        {
+          Ptr<const CCNxNameSegment> segment = name->GetSegment (i);
+          nameBytes += segment->GetValue ().size ();
+        }
+
+      delay += m_layerDelaySlope * nameBytes;
+    }
+
+  return delay;
+}
+
+/*
+ * The constant delay is paid once per batch, the slope for every item in it.
+ */
+Time
+CCNxHashPit::GetBatchServiceTime (const DelayQueueType::BatchType &items)
+{
+  Time delay = m_layerDelayConstant;
+  for (DelayQueueType::BatchType::const_iterator i = items.begin (); i != items.end (); ++i)
+    {
+      delay += GetServiceTime (*i) - m_layerDelayConstant;
+    }
+  return delay;
+}
+
+void
+CCNxHashPit::ServiceInputQueue (Ptr<CCNxForwarderMessage> item)
+{
+  switch (item->GetPacket ()->GetFixedHeader ()->GetPacketType () )
+    {
+    case CCNxFixedHeaderType_Interest:
+      ServiceReceiveInterest (item);
+      break;
+
+    case CCNxFixedHeaderType_Object:
+      ServiceSatisfyInterest (item);
+      break;
+
+    default:
+      NS_ASSERT_MSG (false, "ServiceInputQueue got unsupported packet type: " << *item->GetPacket ());
+      break;
+    }
+}
+
+Time
+CCNxHashPit::CalculateInterestExpiryTime (Ptr<CCNxPacket> interestPacket)
+{
+  Ptr<CCNxPerHopHeaderEntry> entry = interestPacket->GetPerhopHeaders ()->GetHeaderByType (CCNxInterestLifetime::GetTLVType ());
+  if (entry)
+    {
+      Ptr<CCNxInterestLifetime> lifetime = StaticCast<CCNxInterestLifetime, CCNxPerHopHeaderEntry > (entry);
+      Time expiryTime (lifetime->GetInterestLifetime ()->getTime ());
+      return expiryTime + Simulator::Now ();
+    }
+  return m_defaultLifetime + Simulator::Now (); // If no InterestLifetime header use default lifetime
+}
+
+void
+CCNxHashPit::ServiceReceiveInterest (Ptr<CCNxForwarderMessage> item)
+{
+  Ptr<CCNxInterest> interest = DynamicCast<CCNxInterest, CCNxMessage> (item->GetPacket ()->GetMessage ());
+
+  NS_LOG_DEBUG ("ServiceReceiveInterest for " << item->GetPacket ()->GetMessage ()->GetName ());
+
+  uint64_t nameHash = HashName (interest->GetName ());
+
+  Ptr<CCNxStandardPitEntry> pitEntry = LookupPitEntry (interest, nameHash);
+  bool isNewEntry = false;
+  if (!pitEntry)
+    {
+      pitEntry = AddPitEntry (interest, nameHash);
+      NS_ASSERT_MSG ( (pitEntry), "Failed to add a PIT entry");
+      isNewEntry = true;
+    }
+
+  Time interestExpiryTime = CalculateInterestExpiryTime (item->GetPacket ());
+  CCNxPit::Verdict verdict = pitEntry->ReceiveInterest (interest, item->GetIngressConnection (), interestExpiryTime);
+
+  if (isNewEntry)
+    {
+      ScheduleExpiry (pitEntry, interest);
+    }
+
+  NS_LOG_DEBUG ("at end of ReceiveInterest - name,hash pit sizes =[" << m_tableByName.size () << "," << m_tableByHash.size () << "]");
+
+  m_receiveInterestCallback (item, verdict);
+}
+
+void
+CCNxHashPit::ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item)
+{
+  NS_ASSERT_MSG (item->GetPacket ()->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Object,
+                 "Packet is not a content object: " << *item->GetPacket ()->GetFixedHeader ());
+
+  NS_LOG_DEBUG ("ServiceSatisfyInterest for " << item->GetPacket ()->GetMessage ()->GetName ());
+
+  Ptr<CCNxContentObject> contentObject = DynamicCast<CCNxContentObject, CCNxMessage> (item->GetPacket ()->GetMessage ());
+
+  /*
+   * Lookup the content object in the name and hash tables and use the union of the returned values.
+   */
+  CCNxStandardPitEntry::ReverseRouteType reverseRouteSet;
+
+  Ptr<const CCNxName> name = contentObject->GetName ();
+  if (name)
+    {
+      uint64_t nameHash = HashName (name);
+      Ptr<CCNxStandardPitEntry> entry = m_tableByName.Find (nameHash, name);
+      if (entry)
+        {
+          CCNxStandardPitEntry::ReverseRouteType aSet = entry->SatisfyInterest (item->GetIngressConnection ());
+          reverseRouteSet.insert (aSet.begin (), aSet.end ());
+
+          if (entry->size () == 0)
+            {
+              m_tableByName.Erase (nameHash, name);
+            }
+        }
+      else
+        {
+          NS_LOG_DEBUG ("Content object has name, but did not match the name table");
+        }
+
+      // TODO CCN: If it has a ValidationAlgorithm and that has a KeyId do a NameAndKeyId lookup here
+    }
+
+  Ptr<const CCNxHashValue> hash = item->GetPacket ()->GetContentObjectHash ();
+  if (hash)
+    {
+      uint64_t hashHash = HashHashValue (hash);
+      Ptr<CCNxStandardPitEntry> entry = m_tableByHash.Find (hashHash, hash);
+      if (entry)
+        {
+          CCNxStandardPitEntry::ReverseRouteType aSet = entry->SatisfyInterest (item->GetIngressConnection ());
+          // because it's a set, this insert will make a union
+          reverseRouteSet.insert (aSet.begin (), aSet.end ());
+
+          if (entry->size () == 0)
+            {
+              m_tableByHash.Erase (hashHash, hash);
+            }
+        }
+      else
+        {
+          NS_LOG_DEBUG ("Content object did not match the hash table");
+        }
+    }
+
+  Ptr<CCNxConnectionList> satisfiedConnections = Create<CCNxConnectionList> ();
+  for (CCNxStandardPitEntry::ReverseRouteType::iterator i = reverseRouteSet.begin (); i != reverseRouteSet.end (); ++i)
+    {
+      satisfiedConnections->push_back (*i);
+    }
+
+  NS_LOG_DEBUG ( __func__ << " returning conn list of size = " << satisfiedConnections->size () );
+
+  m_satisfyInterestCallback (item, satisfiedConnections);
+}
+
+void
+CCNxHashPit::ReceiveInterest (Ptr<CCNxForwarderMessage> item)
+{
+  NS_ASSERT_MSG (item->GetPacket ()->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Interest,
+                 "ReceiveInterest given a non-Interest packet: " << *item->GetPacket ());
+
+  m_inputQueue->push_back (item);
+}
+
+void
+CCNxHashPit::SatisfyInterest (Ptr<CCNxForwarderMessage> item)
+{
+  NS_ASSERT_MSG (item->GetPacket ()->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Object,
+                 "SatisfyInterest given a non-ContentObject packet: " << *item->GetPacket ());
+
+  m_inputQueue->push_back (item);
+}
+
+// ============= LOAD AND STORE ROUTINES
+
+Ptr<CCNxStandardPitEntry>
+CCNxHashPit::LookupPitEntry (Ptr<CCNxInterest> interest, uint64_t nameHash)
+{
+  Ptr<CCNxStandardPitEntry> entry = Ptr<CCNxStandardPitEntry> (0);
+
+  if (interest->HasHashRestriction ())
+    {
+      Ptr<const CCNxHashValue> hash = interest->GetHashRestriction ();
+      entry = m_tableByHash.Find (HashHashValue (hash), hash);
+    }
+  else if (interest->GetName ())
+    {
+      if (interest->HasKeyidRestriction ())
+        {
+          // Same as CCNxStandardPit: the keyid table is keyed with a null keyid until
+          // content objects carry a KeyId to match against.
+          // TODO CCN: Fill in the keyid instead of NULL
+          NameAndKeyIdType key (interest->GetName (), Ptr<const CCNxHashValue> (0));
+          entry = m_tableByNameAndKeyId.Find (HashNameAndKeyId (nameHash, key.second), key);
+        }
+      else
+        {
+          entry = m_tableByName.Find (nameHash, interest->GetName ());
+        }
+    }
+
+  return entry;
+}
+
+Ptr<CCNxStandardPitEntry>
+CCNxHashPit::AddPitEntry (Ptr<CCNxInterest> interest, uint64_t nameHash)
+{
+  Ptr<CCNxStandardPitEntry> entry = Ptr<CCNxStandardPitEntry> (0);
+
+  if (interest->HasHashRestriction ())
+    {
+      entry = Create<CCNxStandardPitEntry> ();
+      Ptr<const CCNxHashValue> hash = interest->GetHashRestriction ();
+      m_tableByHash.Insert (HashHashValue (hash), hash, entry);
+    }
+  else if (interest->GetName ())
+    {
+      entry = Create<CCNxStandardPitEntry> ();
+      m_tableByName.Insert (nameHash, CCNxNameInternPool::Intern (interest->GetName ()), entry);
+    }
+  else
+    {
+      NS_ASSERT_MSG (false, "Trying to add an interest without a hash restriction or a name");
+    }
+
+  return entry;
+}
+
+void
+CCNxHashPit::RemoveEntry (Ptr<CCNxInterest> interest)
+{
+  if (interest->HasHashRestriction ())
+    {
+      Ptr<const CCNxHashValue> hash = interest->GetHashRestriction ();
+      m_tableByHash.Erase (HashHashValue (hash), hash);
+    }
+  else if (interest->GetName ())
+    {
+      m_tableByName.Erase (HashName (interest->GetName ()), interest->GetName ());
+    }
+}
+
+// ============== EXPIRY
+
+void
+CCNxHashPit::ScheduleExpiry (Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxInterest> interest)
+{
+  // Mirrors AddPitEntry() for which table the entry is in
+  ExpiryRecord record;
+  record.m_entry = entry;
+  if (interest->HasHashRestriction ())
+    {
+      record.m_hashRestriction = interest->GetHashRestriction ();
+    }
+  else
+    {
+      record.m_name = interest->GetName ();
+    }
+
+  m_expiryWheel->Insert (entry->GetExpiryTime (), record);
+}
+
+void
+CCNxHashPit::ExpireEntry (ExpiryRecord record)
+{
+  Ptr<CCNxStandardPitEntry> current;
+  if (record.m_hashRestriction)
+    {
+      current = m_tableByHash.Find (HashHashValue (record.m_hashRestriction), record.m_hashRestriction);
+    }
+  else
+    {
+      current = m_tableByName.Find (HashName (record.m_name), record.m_name);
+    }
+
+  if (current != record.m_entry)
+    {
+      // The entry was satisfied or replaced, nothing to do
+      return;
+    }
+
+  if (!current->isExpired ())
+    {
+      // The lifetime was extended by a later Interest
+      m_expiryWheel->Insert (current->GetExpiryTime (), record);
+      return;
+    }
+
+  if (record.m_hashRestriction)
+    {
+      m_tableByHash.Erase (HashHashValue (record.m_hashRestriction), record.m_hashRestriction);
+    }
+  else
+    {
+      m_tableByName.Erase (HashName (record.m_name), record.m_name);
+    }
+
+  NS_LOG_DEBUG ("Expired PIT entry removed, pit size = " << CountEntries ());
+  m_expireTrace (record.m_name, record.m_hashRestriction);
+}
+
+int
+CCNxHashPit::CountEntries ()
+{
+  return m_tableByName.size () + m_tableByHash.size () + m_tableByNameAndKeyId.size ();
+}
+
+void
+CCNxHashPit::Print (std::ostream &os) const
+{
+  os << "----------------------------------------m_tableByName Table----------------------------------------" << std::endl;
+
+  int i = 0;
+  for (size_t slot = 0; slot < m_tableByName.capacity (); ++slot)
+    {
+      if (m_tableByName.IsOccupied (slot))
+        {
+          os << "TableEntry[" << i++ << "] = " << *m_tableByName.KeyAt (slot) << std::endl;
+          os << m_tableByName.ValueAt (slot)->PrintPitEntry (os) << std::endl;
+        }
+    }
+
+  os << "------------------------------------m_tableByNameAndKeyId Table----------------------------------------" << std::endl;
+
+  i = 0;
+  for (size_t slot = 0; slot < m_tableByNameAndKeyId.capacity (); ++slot)
+    {
+      if (m_tableByNameAndKeyId.IsOccupied (slot))
+        {
+          os << "TableEntry[" << i++ << "] = " << *m_tableByNameAndKeyId.KeyAt (slot).first << std::endl;
+          os << m_tableByNameAndKeyId.ValueAt (slot)->PrintPitEntry (os) << std::endl;
+        }
+    }
+
+  os << "----------------------------------------m_tableByHash Table----------------------------------------" << std::endl;
+
+  i = 0;
+  for (size_t slot = 0; slot < m_tableByHash.capacity (); ++slot)
+    {
+      if (m_tableByHash.IsOccupied (slot))
+        {
+          os << "TableEntry[" << i++ << "] = " << *m_tableByHash.KeyAt (slot)->GetValue () << std::endl;
+          os << m_tableByHash.ValueAt (slot)->PrintPitEntry (os) << std::endl;
+        }
+    }
+
+  os << std::endl;
+  os << std::endl;
+}
@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_HASH_PIT_H_
+#define CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_HASH_PIT_H_
+
+#include "ns3/ccnx-pit.h"
+
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+#include "ns3/ccnx-standard-pitEntry.h"
+#include "ns3/ccnx-delay-queue.h"
+#include "ns3/ccnx-open-hash-table.h"
+#include "ns3/ccnx-timing-wheel.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-standard-forwarder
+ *
+ * A PIT with the same structure and verdicts as `CCNxStandardPit`, but each of the three
+ * tables is an open-addressing hash table (`CCNxOpenHashTable`) instead of a std::map.
+ *
+ * 1. m_tableByName          { hash(Name), PitEntry}
+ * 2. m_tableByNameAndKeyId  { hash(Name, KeyIdRestriction), PitEntry}
+ * 3. m_tableByHash          { hash(ContentObjectHashRestriction), PitEntry }
+ *
+ * The hash of a name is computed once per Interest or Content Object, then a lookup is
+ * an expected O(1) probe sequence.  Full key comparison (e.g. `CCNxName::Equals`) only happens
+ * when the 64-bit hashes are equal.  With std::map, a lookup does O(log n) name comparisons,
+ * each of which walks the name segments.
+ *
+ * The Interest aggregation strategy, expiry and layer delay model are exactly those of
+ * `CCNxStandardPit` (the PIT entries are `CCNxStandardPitEntry`).  Like `CCNxStandardPit`, expired
+ * entries are swept out by a `CCNxTimingWheel` with a resolution of the attribute "ExpiryTick"
+ * (default 10 msec), and each removal fires the "Expire" trace source.
+ *
+ * To use it in a forwarder:
+ * @code
+ * {
+ *     CCNxHashPitFactory pitFactory;
+ *     pitFactory.SetInitialCapacity (1 << 17);
+ *
+ *     CCNxStandardForwarderHelper forwarderHelper;
+ *     forwarderHelper.SetPitFactory (pitFactory);
+ * }
+ * @endcode
+ */
+class CCNxHashPit : public CCNxPit
+{
+public:
+  /**
+   * Create a hash pit.  It is configured via the NS attribute system.
+   */
+  CCNxHashPit ();
+
+  /**
+   * Virtual destructor for inheritance
+   */
+  virtual ~CCNxHashPit ();
+
+  /**
+   *  Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * @copydoc CCNxPit::ReceiveInterest()
+   */
+  virtual void ReceiveInterest (Ptr<CCNxForwarderMessage> message);
+  /**
+    * @copydoc CCNxPit::SetReceiveInterestCallback()
+    */
+  virtual void SetReceiveInterestCallback (ReceiveInterestCallback receiveInterestCallback);
+  /**
+    * @copydoc CCNxPit::SatisfyInterest()
+    */
+  virtual void SatisfyInterest (Ptr<CCNxForwarderMessage> message);
+  /**
+    * @copydoc CCNxPit::SetSatisfyInterestCallback()
+    */
+  virtual void SetSatisfyInterestCallback (SatisfyInterestCallback satisfyInterestCallback);
+  /**
+    * @copydoc CCNxPit::RemoveEntry()
+    */
+  virtual void RemoveEntry (Ptr<CCNxInterest> interest);
+  /**
+    * @copydoc CCNxPit::CountEntries()
+    */
+  int CountEntries ();
+  /**
+    * @copydoc CCNxPit::Print()
+    */
+  virtual void Print (std::ostream &os) const;
+
+  /**
+   * The 64-bit table hash of a name.  This is `CCNxName::GetHash()`, or a constant for a null name.
+   *
+   * @param name [in] The name to hash (may be null)
+   * @return The hash of the name
+   */
+  static uint64_t HashName (Ptr<const CCNxName> name);
+
+  /**
+   * Computes the 64-bit table hash of a hash value or keyid (FNV-1a over its bytes).
+   *
+   * @param hashValue [in] The value to hash (may be null)
+   * @return The hash of the value
+   */
+  static uint64_t HashHashValue (Ptr<const CCNxHashValue> hashValue);
+
+  /**
+   * TracedCallback signature for PIT entries removed by the expiry timing wheel.
+   *
+   * @param [in] name The name of the expired entry (null if the entry was in the hash table)
+   * @param [in] hashRestriction The hash restriction of the expired entry (null if the entry was in the name table)
+   */
+  typedef void (* ExpireTracedCallback) (Ptr<const CCNxName> name, Ptr<const CCNxHashValue> hashRestriction);
+
+protected:
+
+  /**
+   * DoInitialize - called in Object Initialize()
+   */
+  virtual void DoInitialize ();
+
+  /**
+   * DoDispose - called in Object Dispose()
+   */
+  virtual void DoDispose ();
+
+private:
+  //Name and keyid restriction pair
+  typedef std::pair < Ptr<const CCNxName>, Ptr<const CCNxHashValue> > NameAndKeyIdType;
+
+  struct isEqualPtrCCNxName
+  {
+    bool operator() (Ptr<const CCNxName> a, Ptr<const CCNxName> b) const
+    {
+      return PeekPointer (a) == PeekPointer (b) || (a && b && a->Equals (*b));
+    }
+  };
+
+  struct isEqualPtrCCNxHashValue
+  {
+    bool operator() (Ptr<const CCNxHashValue> a, Ptr<const CCNxHashValue> b) const
+    {
+      return PeekPointer (a) == PeekPointer (b) || (a && b && *a == *b);
+    }
+  };
+
+  struct isEqualNameAndKeyIdType
+  {
+    bool operator() (const NameAndKeyIdType &a, const NameAndKeyIdType &b) const
+    {
+      return isEqualPtrCCNxName () (a.first, b.first) && isEqualPtrCCNxHashValue () (a.second, b.second);
+    }
+  };
+
+  typedef CCNxOpenHashTable < Ptr<const CCNxName>, Ptr<CCNxStandardPitEntry>, isEqualPtrCCNxName > PitByNameType;
+  typedef CCNxOpenHashTable < NameAndKeyIdType, Ptr<CCNxStandardPitEntry>, isEqualNameAndKeyIdType > PitByNameAndKeyIdType;
+  typedef CCNxOpenHashTable < Ptr<const CCNxHashValue>, Ptr<CCNxStandardPitEntry>, isEqualPtrCCNxHashValue > PitByHashType;
+
+  /**
+   * Combine the name hash and keyid hash in to the hash of the NameAndKeyId table.
+   */
+  static uint64_t HashNameAndKeyId (uint64_t nameHash, Ptr<const CCNxHashValue> keyId);
+
+  /**
+   * Given an Interest packet, calculate it's expiry time.
+   *
+   * @see CCNxStandardPit::CalculateInterestExpiryTime
+   */
+  Time CalculateInterestExpiryTime (Ptr<CCNxPacket> interestPacket);
+
+  /**
+   * Find the PIT entry that corresponds to the Interest.  It will match against the most
+   * restrictive table (e.g. by hash, by keyid & name, by name).
+   *
+   * @param interest [in] The Interest to lookup
+   * @param nameHash [in] The value of HashName(interest->GetName())
+   * @return Ptr<CCNxStandardPitEntry>(0) if not found (NULL)
+   * @return Non-null if matched
+   */
+  Ptr<CCNxStandardPitEntry> LookupPitEntry (Ptr<CCNxInterest> interest, uint64_t nameHash);
+
+  /**
+   * Create a new PitEntry and save it in the appropriate tables
+   *
+   * @param interest [in] The interest being processed
+   * @param nameHash [in] The value of HashName(interest->GetName())
+   * @return non-null The new pitEntry, which has been saved in the appropriate tables
+   */
+  Ptr<CCNxStandardPitEntry> AddPitEntry (Ptr<CCNxInterest> interest, uint64_t nameHash);
+
+  /**
+   * After input delay, service a ReceiveInterest request and send the
+   * result to the ReceiveInterestCallback.
+   *
+   * @param item [in] The work item being serviced
+   */
+  void ServiceReceiveInterest (Ptr<CCNxForwarderMessage> item);
+
+  /**
+   * After input delay, service a SatisfyInterest request and send the
+   * result to the SatisfyInterestCallback.
+   *
+   * @param item [in] The work item being serviced
+   */
+  void ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item);
+
+  /**
+   * The item stored in the expiry timing wheel.  It has the table key of the
+   * entry, so the entry can be found and removed, and the entry itself to detect that
+   * the entry was satisfied (and maybe re-created) before the record came due.
+   */
+  struct ExpiryRecord
+  {
+    Ptr<CCNxStandardPitEntry> m_entry;
+    Ptr<const CCNxName> m_name;                 //<! non-null if the entry is in m_tableByName
+    Ptr<const CCNxHashValue> m_hashRestriction; //<! non-null if the entry is in m_tableByHash
+  };
+
+  /**
+   * Put an expiry record in the timing wheel for a new PIT entry.
+   *
+   * @param entry [in] The new entry, already primed with an expiry time
+   * @param interest [in] The interest that created the entry (gives the table key)
+   */
+  void ScheduleExpiry (Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxInterest> interest);
+
+  /**
+   * Callback from the expiry timing wheel.  Removes the entry if it is still in the
+   * table and expired, or re-inserts the record if the entry's expiry time was extended.
+   *
+   * @param record [in] The due record
+   */
+  void ExpireEntry (ExpiryRecord record);
+
+  /**
+   * The timing wheel for expired entries
+   */
+  Ptr< CCNxTimingWheel<ExpiryRecord> > m_expiryWheel;
+
+  /**
+   * The resolution of the expiry timing wheel, set via the attribute "ExpiryTick".
+   * The default is 10 msec.
+   */
+  Time m_expiryTick;
+
+  /**
+   * Trace source for entries removed by the expiry timing wheel
+   */
+  TracedCallback<Ptr<const CCNxName>, Ptr<const CCNxHashValue> > m_expireTrace;
+
+  //Map Names to PitEntrys
+  PitByNameType m_tableByName;
+
+  // Map Name and Key to PitEntrys
+  PitByNameAndKeyIdType m_tableByNameAndKeyId;
+
+  //Map Hash values to PitEntrys
+  PitByHashType m_tableByHash;
+
+  /**
+   * The number of slots each table starts with (rounded up to a power of 2).  Set
+   * via the attribute "InitialCapacity".  Tables grow by doubling, so this only avoids
+   * early rehashing.
+   */
+  unsigned m_initialCapacity;
+
+  /*
+   * The default interest lifetime - how long an interest will be valid after arrival at a node.
+   */
+  Time m_defaultLifetime;
+
+  /*
+   * @copydoc CCNxPit::ReceiveInterestCallback
+   */
+  ReceiveInterestCallback m_receiveInterestCallback;
+
+  /*
+   * @copydoc CCNxPit::SatisfyInterestCallback
+   */
+  SatisfyInterestCallback m_satisfyInterestCallback;
+
+  /**
+   * The storage type of the CCNxDelayQueue
+   */
+  typedef CCNxDelayQueue<CCNxForwarderMessage> DelayQueueType;
+
+  /**
+   * Input queue used to simulate processing delay
+   */
+  Ptr<DelayQueueType> m_inputQueue;
+
+  /**
+   * Callback from delay queue to compute the service time of a work item
+   *
+   * @param item [in] The work item being serviced
+   * @return The service time of the work item
+   */
+  Time GetServiceTime (Ptr<CCNxForwarderMessage> item);
+
+  /**
+   * Callback from delay queue to compute the service time of a batch of work items
+   * when "LayerDelayBatchSize" is more than 1.  The constant delay is paid once per batch.
+   *
+   * @param items [in] The work items being serviced together
+   * @return The service time of the batch
+   */
+  Time GetBatchServiceTime (const DelayQueueType::BatchType &items);
+
+  /**
+   * Callback from delay queue after a work item has waited its service time
+   *
+   * @param item [in] The work item to service
+   */
+  void ServiceInputQueue (Ptr<CCNxForwarderMessage> item);
+
+  /**
+   * The layer delay is:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * nameBytes\f$
+   *
+   * It is set via the attribute "LayerDelayConstant".  The default is 1 usec.
+   */
+  Time m_layerDelayConstant;
+
+  /**
+   * The layer delay is:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * nameBytes\f$
+   *
+   * It is set via the attribute "LayerDelaySlope".  The default is 1 nsec.
+   */
+  Time m_layerDelaySlope;
+
+  /**
+   * The number of parallel servers processing the input delay queue.
+   *
+   * This value is set via the attribute "LayerDelayServers".  The default is 1.
+   */
+  unsigned m_layerDelayServers;
+
+  /**
+   * If true and both m_layerDelayConstant and m_layerDelaySlope are zero, the input queue
+   * services each item before returning instead of scheduling a zero-delay event.
+   *
+   * This value is set via the attribute "InlineZeroDelay".  The default is false.
+   */
+  bool m_inlineZeroDelay;
+
+  /**
+   * The maximum number of work items an input queue server processes together.
+   * A batch pays the layer delay constant once:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * \sum nameBytes\f$
+   *
+   * This value is set via the attribute "LayerDelayBatchSize".  The default is 1 (no batching).
+   */
+  unsigned m_layerDelayBatchSize;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_HASH_PIT_H_ */
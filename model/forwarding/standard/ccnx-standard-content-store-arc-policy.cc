@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "ccnx-standard-content-store-arc-policy.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxStandardContentStoreArcPolicy");
+
+CCNxStandardContentStoreArcPolicy::CCNxStandardContentStoreArcPolicy ()
+  : m_t1 (Create<CCNxStandardContentStoreLruList> ()),
+    m_t2 (Create<CCNxStandardContentStoreLruList> ()),
+    m_target (0)
+{
+  // empty
+}
+
+CCNxStandardContentStoreArcPolicy::~CCNxStandardContentStoreArcPolicy ()
+{
+  // empty
+}
+
+std::string
+CCNxStandardContentStoreArcPolicy::GetName () const
+{
+  return "Arc";
+}
+
+uint64_t
+CCNxStandardContentStoreArcPolicy::GetSize () const
+{
+  return m_t1->GetSize () + m_t2->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreArcPolicy::GetTarget () const
+{
+  return m_target;
+}
+
+uint64_t
+CCNxStandardContentStoreArcPolicy::GetRecentSize () const
+{
+  return m_t1->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreArcPolicy::GetFrequentSize () const
+{
+  return m_t2->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreArcPolicy::GetRecentGhostSize () const
+{
+  return m_b1.GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreArcPolicy::GetFrequentGhostSize () const
+{
+  return m_b2.GetSize ();
+}
+
+void
+CCNxStandardContentStoreArcPolicy::Replace (bool inB2, uint64_t capacity, EntryVectorType &evicted)
+{
+  uint64_t t1Size = m_t1->GetSize ();
+  bool fromT1 = t1Size > 0 && (t1Size > m_target || (inB2 && t1Size == m_target));
+  if (m_t2->GetSize () == 0)
+    {
+      fromT1 = true;
+    }
+
+  Ptr<CCNxStandardContentStoreEntry> victim;
+  if (fromT1)
+    {
+      victim = m_t1->GetBackEntry ();
+      m_t1->DeleteEntry (victim);
+      m_b1.Insert (GetKey (victim), capacity);
+    }
+  else
+    {
+      victim = m_t2->GetBackEntry ();
+      m_t2->DeleteEntry (victim);
+      m_b2.Insert (GetKey (victim), capacity);
+    }
+  SetQueue (victim, 0);
+  evicted.push_back (victim);
+}
+
+void
+CCNxStandardContentStoreArcPolicy::DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted)
+{
+  if (capacity == 0)
+    {
+      evicted.push_back (entry);
+      return;
+    }
+
+  // The capacity may have shrunk since the last insert
+  while (GetSize () > capacity)
+    {
+      Replace (false, capacity, evicted);
+    }
+  m_target = std::min (m_target, capacity);
+
+  uint64_t key = GetKey (entry);
+  uint64_t b1Size = m_b1.GetSize ();
+  uint64_t b2Size = m_b2.GetSize ();
+
+  if (m_b1.Contains (key))
+    {
+      // Case II: recency would have kept it, grow T1
+      uint64_t delta = std::max<uint64_t> (b1Size ? b2Size / b1Size : 1, 1);
+      m_target = std::min (capacity, m_target + delta);
+      if (GetSize () >= capacity)
+        {
+          Replace (false, capacity, evicted);
+        }
+      m_b1.Erase (key);
+      SetQueue (entry, Queue_T2);
+      m_t2->AddEntry (entry);
+      return;
+    }
+
+  if (m_b2.Contains (key))
+    {
+      // Case III: frequency would have kept it, shrink T1
+      uint64_t delta = std::max<uint64_t> (b2Size ? b1Size / b2Size : 1, 1);
+      m_target = m_target > delta ? m_target - delta : 0;
+      if (GetSize () >= capacity)
+        {
+          Replace (true, capacity, evicted);
+        }
+      m_b2.Erase (key);
+      SetQueue (entry, Queue_T2);
+      m_t2->AddEntry (entry);
+      return;
+    }
+
+  // Case IV: a new object
+  uint64_t l1Size = m_t1->GetSize () + m_b1.GetSize ();
+  if (l1Size >= capacity)
+    {
+      if (m_t1->GetSize () < capacity)
+        {
+          m_b1.PopBack ();
+          if (GetSize () >= capacity)
+            {
+              Replace (false, capacity, evicted);
+            }
+        }
+      else
+        {
+          // B1 is empty and T1 fills the cache, drop the LRU of T1 outright
+          Ptr<CCNxStandardContentStoreEntry> victim = m_t1->GetBackEntry ();
+          m_t1->DeleteEntry (victim);
+          SetQueue (victim, 0);
+          evicted.push_back (victim);
+        }
+    }
+  else
+    {
+      uint64_t total = l1Size + m_t2->GetSize () + m_b2.GetSize ();
+      if (total >= capacity)
+        {
+          if (total >= 2 * capacity)
+            {
+              m_b2.PopBack ();
+            }
+          if (GetSize () >= capacity)
+            {
+              Replace (false, capacity, evicted);
+            }
+        }
+    }
+
+  SetQueue (entry, Queue_T1);
+  m_t1->AddEntry (entry);
+}
+
+void
+CCNxStandardContentStoreArcPolicy::DoHit (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  // Case I: a hit in T1 or T2 moves the entry to the MRU end of T2
+  switch (GetQueue (entry))
+    {
+    case Queue_T1:
+      m_t1->DeleteEntry (entry);
+      SetQueue (entry, Queue_T2);
+      m_t2->AddEntry (entry);
+      break;
+    case Queue_T2:
+      m_t2->AddEntry (entry);
+      break;
+    default:
+      NS_LOG_ERROR ("Hit on an entry that is not in the policy");
+      break;
+    }
+}
+
+bool
+CCNxStandardContentStoreArcPolicy::DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  bool result = false;
+  switch (GetQueue (entry))
+    {
+    case Queue_T1:
+      result = m_t1->DeleteEntry (entry);
+      break;
+    case Queue_T2:
+      result = m_t2->DeleteEntry (entry);
+      break;
+    default:
+      break;
+    }
+  SetQueue (entry, 0);
+  return result;
+}
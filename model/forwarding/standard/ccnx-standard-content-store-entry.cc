@@ -64,14 +64,16 @@ using namespace ns3::ccnx;
 
 NS_LOG_COMPONENT_DEFINE ("CCNxStandardContentStoreEntry");
 
-CCNxStandardContentStoreEntry::CCNxStandardContentStoreEntry (Ptr<CCNxPacket> contentObject) : m_contentObject (contentObject), m_useCount (0)
+CCNxStandardContentStoreEntry::CCNxStandardContentStoreEntry (Ptr<CCNxPacket> contentObject) : m_contentObject (contentObject), m_useCount (0),
+  m_lruPrev (0), m_lruNext (0), m_lruOwner (0),
+  m_policyKey (0), m_policyFrequency (0), m_policyQueue (0)
 {
   // empty
 }
 
 CCNxStandardContentStoreEntry::~CCNxStandardContentStoreEntry ()
 {
-  // empty
+  NS_ASSERT_MSG (m_lruOwner == 0, "Content store entry destroyed while still in an LRU list");
 }
 
 Ptr<CCNxPacket> CCNxStandardContentStoreEntry::GetPacket () const
@@ -99,22 +101,17 @@ bool CCNxStandardContentStoreEntry::IsStale () const
 {
 
   bool stale=false;
-  Ptr<CCNxPerHopHeader> perHopHeader = m_contentObject->GetPerhopHeaders();
-  for (size_t i=0;i<perHopHeader->size();i++)
+  Ptr<CCNxPerHopHeaderEntry> entry = m_contentObject->GetPerhopHeaders()->GetHeaderByType(CCNxCachetime::GetTLVType());
+  if (entry)
     {
-      Ptr<CCNxPerHopHeaderEntry> entry = perHopHeader->GetHeader(i);
-      if (entry->GetInstanceTLVType() == 2) //TODO - why aren't we using an enum for TLV types?
+      Ptr<CCNxCachetime> rct = StaticCast<CCNxCachetime,CCNxPerHopHeaderEntry >(entry);
+      if (rct->GetCachetime()->getTime() != 0) //Ignore null  time
 	{
-	  Ptr<CCNxCachetime> rct = DynamicCast<CCNxCachetime,CCNxPerHopHeaderEntry >(entry);
-	  if (rct->GetCachetime()->getTime() != 0) //Ignore null  time
+	  Time expiryTime(rct->GetCachetime()->getTime());
+	  if (expiryTime < Simulator::Now())
 	    {
-	    Time expiryTime(rct->GetCachetime()->getTime());
-	    if (expiryTime < Simulator::Now())
-	      {
-		stale = true;
-		NS_LOG_DEBUG("content packet " << *m_contentObject << " in store is stale!");
-		break;
-	      }
+	      stale = true;
+	      NS_LOG_DEBUG("content packet " << *m_contentObject << " in store is stale!");
 	    }
 	}
     }
@@ -131,3 +128,8 @@ uint64_t CCNxStandardContentStoreEntry::GetUseCount ()
 {
   return m_useCount;
 }
+
+bool CCNxStandardContentStoreEntry::IsInLruList () const
+{
+  return m_lruOwner != 0;
+}
@@ -63,10 +63,18 @@
 namespace ns3 {
 namespace ccnx {
 
+class CCNxStandardContentStoreLruList;
+class CCNxStandardContentStorePolicy;
+
 /**
  * @ingroup ccnx-standard-forwarder
  *
  * Standard Content Store Entry Class.
+ *
+ * The entry carries the hooks of the intrusive LRU list (`CCNxStandardContentStoreLruList`),
+ * so moving an entry within the list never needs a lookup or an allocation.  An entry
+ * can be a member of at most one LRU list at a time.  It also carries the small amount of
+ * per-entry state the replacement policies need (`CCNxStandardContentStorePolicy`).
  */
 class CCNxStandardContentStoreEntry : public SimpleRefCount<CCNxStandardContentStoreEntry>
 {
@@ -125,13 +133,37 @@ public:
    */
   uint64_t GetUseCount ();
 
-
-
+  /**
+   * Checks if this entry is linked into an LRU list.
+   *
+   * @return true if the entry is a member of a `CCNxStandardContentStoreLruList`
+   */
+  bool IsInLruList () const;
 
 private:
+  friend class CCNxStandardContentStoreLruList;
+  friend class CCNxStandardContentStorePolicy;
+
   Ptr<CCNxPacket> m_contentObject;
   uint64_t m_useCount;
 
+  /**
+   * Intrusive LRU hooks, owned by `CCNxStandardContentStoreLruList`.  The list holds
+   * one reference on each linked entry, so plain pointers are safe here.
+   */
+  CCNxStandardContentStoreEntry *m_lruPrev;
+  CCNxStandardContentStoreEntry *m_lruNext;
+  const CCNxStandardContentStoreLruList *m_lruOwner;
+
+  /**
+   * Replacement policy state, owned by `CCNxStandardContentStorePolicy`: the key used
+   * for ghost lists and frequency sketches, a small access counter, and the policy queue
+   * the entry is in.
+   */
+  uint64_t m_policyKey;
+  uint32_t m_policyFrequency;
+  uint8_t m_policyQueue;
+
 
 };
 
@@ -56,6 +56,8 @@
 #include "ns3/ccnx-standard-content-store-factory.h"
 #include "ns3/ccnx-standard-content-store.h"
 #include "ns3/integer.h"
+#include "ns3/boolean.h"
+#include "ns3/enum.h"
 #include "ns3/object.h"
 
 
@@ -101,3 +103,21 @@ CCNxStandardContentStoreFactory::SetLayerDelayServers (unsigned serverCount)
 {
   Set ("LayerDelayServers", IntegerValue (serverCount));
 }
+
+void
+CCNxStandardContentStoreFactory::SetInlineZeroDelay (bool inlineZeroDelay)
+{
+  Set ("InlineZeroDelay", BooleanValue (inlineZeroDelay));
+}
+
+void
+CCNxStandardContentStoreFactory::SetLayerDelayBatchSize (unsigned batchSize)
+{
+  Set ("LayerDelayBatchSize", IntegerValue (batchSize));
+}
+
+void
+CCNxStandardContentStoreFactory::SetReplacementPolicy (CCNxStandardContentStore::ReplacementPolicyType type)
+{
+  Set ("ReplacementPolicy", EnumValue (type));
+}
@@ -58,6 +58,7 @@
 
 #include "ns3/object-factory.h"
 #include "ns3/nstime.h"
+#include "ns3/ccnx-standard-content-store.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -114,6 +115,31 @@ public:
    * This value is set via the attribute "LayerDelayServers".  The default is 1.
    */
   void SetLayerDelayServers (unsigned serverCount);
+
+  /**
+   * If true and both layer delays are zero, the input queue is serviced inline
+   * instead of through zero-delay simulator events.
+   *
+   * This value is set via the attribute "InlineZeroDelay".  The default is false.
+   */
+  void SetInlineZeroDelay (bool inlineZeroDelay);
+
+  /**
+   * The maximum number of work items an input queue server processes together.
+   * A batch pays the layer delay constant once:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * \sum payloadBytes\f$
+   *
+   * This value is set via the attribute "LayerDelayBatchSize".  The default is 1 (no batching).
+   */
+  void SetLayerDelayBatchSize (unsigned batchSize);
+
+  /**
+   * The cache replacement policy of the content store.
+   *
+   * This value is set via the attribute "ReplacementPolicy".  The default is LRU.
+   */
+  void SetReplacementPolicy (CCNxStandardContentStore::ReplacementPolicyType type);
 };
 
 }   /* namespace ccnx */
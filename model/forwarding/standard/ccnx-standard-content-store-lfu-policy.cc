@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ccnx-standard-content-store-lfu-policy.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxStandardContentStoreLfuPolicy");
+
+CCNxStandardContentStoreLfuPolicy::CCNxStandardContentStoreLfuPolicy () : m_size (0)
+{
+  // empty
+}
+
+CCNxStandardContentStoreLfuPolicy::~CCNxStandardContentStoreLfuPolicy ()
+{
+  // empty
+}
+
+std::string
+CCNxStandardContentStoreLfuPolicy::GetName () const
+{
+  return "Lfu";
+}
+
+uint64_t
+CCNxStandardContentStoreLfuPolicy::GetSize () const
+{
+  return m_size;
+}
+
+Ptr<CCNxStandardContentStoreEntry>
+CCNxStandardContentStoreLfuPolicy::GetVictim () const
+{
+  if (m_buckets.empty ())
+    {
+      return Ptr<CCNxStandardContentStoreEntry> (0);
+    }
+  return m_buckets.begin ()->second->GetBackEntry ();
+}
+
+void
+CCNxStandardContentStoreLfuPolicy::Link (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  Ptr<CCNxStandardContentStoreLruList> &bucket = m_buckets[GetFrequency (entry)];
+  if (!bucket)
+    {
+      bucket = Create<CCNxStandardContentStoreLruList> ();
+    }
+  bucket->AddEntry (entry);
+}
+
+bool
+CCNxStandardContentStoreLfuPolicy::Unlink (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  BucketMapType::iterator it = m_buckets.find (GetFrequency (entry));
+  if (it == m_buckets.end () || !it->second->DeleteEntry (entry))
+    {
+      return false;
+    }
+
+  if (it->second->GetSize () == 0)
+    {
+      m_buckets.erase (it);
+    }
+  return true;
+}
+
+void
+CCNxStandardContentStoreLfuPolicy::DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted)
+{
+  while (m_size > 0 && m_size >= capacity)
+    {
+      Ptr<CCNxStandardContentStoreEntry> victim = GetVictim ();
+      Unlink (victim);
+      m_size--;
+      evicted.push_back (victim);
+    }
+
+  if (capacity > 0)
+    {
+      SetFrequency (entry, 1);
+      Link (entry);
+      m_size++;
+    }
+  else
+    {
+      evicted.push_back (entry);
+    }
+}
+
+void
+CCNxStandardContentStoreLfuPolicy::DoHit (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  if (Unlink (entry))
+    {
+      SetFrequency (entry, GetFrequency (entry) + 1);
+      Link (entry);
+    }
+}
+
+bool
+CCNxStandardContentStoreLfuPolicy::DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  if (Unlink (entry))
+    {
+      m_size--;
+      return true;
+    }
+  return false;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_LFU_POLICY_H_
+#define CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_LFU_POLICY_H_
+
+#include <map>
+#include "ns3/ccnx-standard-content-store-policy.h"
+#include "ns3/ccnx-standard-content-store-lruList.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-standard-forwarder
+ *
+ * Least frequently used replacement.  Entries are kept in one `CCNxStandardContentStoreLruList`
+ * per access count; the victim is the least recently used entry of the lowest count.  A hit
+ * moves the entry to the next bucket, which costs one lookup in the (small) bucket map.
+ *
+ * Counts are only kept while an object is in the store, so a new object always starts at one.
+ */
+class CCNxStandardContentStoreLfuPolicy : public CCNxStandardContentStorePolicy
+{
+public:
+  CCNxStandardContentStoreLfuPolicy ();
+
+  virtual ~CCNxStandardContentStoreLfuPolicy ();
+
+  virtual std::string GetName () const;
+
+  virtual uint64_t GetSize () const;
+
+  /**
+   * The entry that would be evicted next, or null if empty.
+   */
+  Ptr<CCNxStandardContentStoreEntry> GetVictim () const;
+
+protected:
+  virtual void DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted);
+  virtual void DoHit (Ptr<CCNxStandardContentStoreEntry> entry);
+  virtual bool DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry);
+
+private:
+  /*
+   * Put the entry in the bucket of its current frequency.
+   */
+  void Link (Ptr<CCNxStandardContentStoreEntry> entry);
+
+  /*
+   * Take the entry out of its bucket, dropping the bucket if it becomes empty.
+   */
+  bool Unlink (Ptr<CCNxStandardContentStoreEntry> entry);
+
+  typedef std::map<uint32_t, Ptr<CCNxStandardContentStoreLruList> > BucketMapType;
+  BucketMapType m_buckets;
+  uint64_t m_size;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_LFU_POLICY_H_ */
@@ -57,9 +57,6 @@
 #include "ns3/log.h"
 #include "ccnx-standard-content-store-lruList.h"
 #include "ns3/ccnx-standard-content-store-entry.h"
-#include <list>
-
-#include <assert.h>
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -68,39 +65,93 @@ using namespace ns3::ccnx;
 NS_LOG_COMPONENT_DEFINE ("CCNxStandardContentStoreLruList");
 
 
-CCNxStandardContentStoreLruList::CCNxStandardContentStoreLruList ()
+CCNxStandardContentStoreLruList::CCNxStandardContentStoreLruList () : m_head (0), m_tail (0), m_size (0)
 {
 
 }
 
 CCNxStandardContentStoreLruList::~CCNxStandardContentStoreLruList ()
 {
+  while (m_head)
+    {
+      CCNxStandardContentStoreEntry *entry = m_head;
+      Unlink (entry);
+      entry->Unref ();
+    }
+}
 
+void
+CCNxStandardContentStoreLruList::LinkFront (CCNxStandardContentStoreEntry *entry)
+{
+  entry->m_lruOwner = this;
+  entry->m_lruPrev = 0;
+  entry->m_lruNext = m_head;
+  if (m_head)
+    {
+      m_head->m_lruPrev = entry;
+    }
+  else
+    {
+      m_tail = entry;
+    }
+  m_head = entry;
+  m_size++;
 }
 
+void
+CCNxStandardContentStoreLruList::Unlink (CCNxStandardContentStoreEntry *entry)
+{
+  if (entry->m_lruPrev)
+    {
+      entry->m_lruPrev->m_lruNext = entry->m_lruNext;
+    }
+  else
+    {
+      m_head = entry->m_lruNext;
+    }
+
+  if (entry->m_lruNext)
+    {
+      entry->m_lruNext->m_lruPrev = entry->m_lruPrev;
+    }
+  else
+    {
+      m_tail = entry->m_lruPrev;
+    }
 
+  entry->m_lruPrev = 0;
+  entry->m_lruNext = 0;
+  entry->m_lruOwner = 0;
+  m_size--;
+}
 
 bool
 CCNxStandardContentStoreLruList::AddEntry(Ptr<CCNxStandardContentStoreEntry> entry)
 {
+  NS_ASSERT_MSG (entry, "AddEntry given a null entry");
 
-      LruMapType::iterator it = m_lruMap.find(entry); //search map
-
-      if(it != m_lruMap.end())
-	{ // already exists
-	      m_lruList.erase(it->second); //remove  from list. should be fast
-	      m_lruList.push_front(entry); //add entry to the front of the list
-	      it->second = m_lruList.begin(); //update map
-	}
-      else
-	{  //not in map
-	      m_lruList.push_front(entry); //add entry to the front of the list
-	      m_lruMap.insert(make_pair(entry, m_lruList.begin())); //add it to the map
-	}
-
+  CCNxStandardContentStoreEntry *raw = PeekPointer (entry);
 
-      return true;
+  if (raw->m_lruOwner == this)
+    { // already exists, move it to the front
+      if (raw != m_head)
+        {
+          Unlink (raw);
+          LinkFront (raw);
+        }
+    }
+  else if (raw->m_lruOwner == 0)
+    { // not in list, the list keeps a reference while linked
+      raw->Ref ();
+      LinkFront (raw);
+    }
+  else
+    {
+      NS_LOG_ERROR("Can't add Entry - entry is in another LRU list.");
+      return false;
+    }
 
+  return true;
 }
 
 bool
@@ -108,49 +159,35 @@ CCNxStandardContentStoreLruList::DeleteEntry(Ptr<CCNxStandardContentStoreEntry>
 {
   bool result=false;
 
-  LruMapType::iterator it = m_lruMap.find(entry);
-
-  if(it != m_lruMap.end())
-    { // already exists, remove it from list and map (quicker to update map entry?)
-      m_lruList.erase(it->second);
-      m_lruMap.erase(it);
-      result=true; 	//TODO CCN - should only return true if erasures successful
+  if (entry && entry->m_lruOwner == this)
+    {
+      CCNxStandardContentStoreEntry *raw = PeekPointer (entry);
+      Unlink (raw);
+      raw->Unref ();
+      result=true;
     }
   else
     {
-      NS_LOG_ERROR("Can't delete Entry - entry not found in m_lruMap.");
+      NS_LOG_ERROR("Can't delete Entry - entry not found in LRU list.");
     }
   return result;
-
-
 }
 
 uint64_t
 CCNxStandardContentStoreLruList::GetSize() const
 {
-
-  NS_ASSERT_MSG(m_lruList.size()==m_lruMap.size(), "LRU list and map sizes differ" );
-  return m_lruList.size();
-
-
+  return m_size;
 }
 
 Ptr<CCNxStandardContentStoreEntry>
 CCNxStandardContentStoreLruList::GetBackEntry()
 {
-  return m_lruList.back();
+  return Ptr<CCNxStandardContentStoreEntry> (m_tail);
 }
 
 
 Ptr<CCNxStandardContentStoreEntry>
 CCNxStandardContentStoreLruList::GetFrontEntry()
 {
-  return m_lruList.front();
+  return Ptr<CCNxStandardContentStoreEntry> (m_head);
 }
-
-
-
-
-
-
-
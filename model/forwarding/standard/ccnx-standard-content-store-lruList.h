@@ -56,7 +56,6 @@
 #ifndef CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_LRU_LIST_H_
 #define CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_LRU_LIST_H_
 
-#include <unordered_map>
 #include "ns3/simple-ref-count.h"
 #include "ns3/ccnx-standard-content-store-entry.h"
 
@@ -78,9 +77,9 @@ namespace ccnx {
    * 3. Delete the least recently used entry.  occurs every new content once the CS has filled.
    * 4. Refresh an entry (move it to front of list). occurs every content reuse.
    *
-   * This approach uses an unordered map < Ptr<entry>, listIterator> and a list < entry >. The map delivers quick
-   * scalable find(1) while the list provides quick add(2),refresh(4),delete(3).
-    *
+   * The list is intrusive: the prev/next hooks live inside `CCNxStandardContentStoreEntry`, so
+   * finding an entry's position is free and add(2), delete(3) and refresh(4) are O(1) pointer
+   * updates with no allocation.  The list holds one reference on every linked entry.
    */
 
 class CCNxStandardContentStoreLruList : public ns3::SimpleRefCount<CCNxStandardContentStoreLruList>
@@ -90,12 +89,15 @@ public:
 
   CCNxStandardContentStoreLruList ();
 
+  /**
+   * Unlinks (and releases) every entry still in the list.
+   */
   virtual ~CCNxStandardContentStoreLruList ();
 
 
   /*
    * AddEntry - Add/Refresh an Entry to/in the LRU.
-   * returns - true
+   * returns - true, or false if the entry is a member of a different LRU list.
    *
    */
    bool AddEntry(Ptr<CCNxStandardContentStoreEntry> entry);
@@ -129,12 +131,23 @@ protected:
 
 
 private:
+  // The list owns its hooks, it cannot be copied
+  CCNxStandardContentStoreLruList (const CCNxStandardContentStoreLruList &);
+  CCNxStandardContentStoreLruList &operator= (const CCNxStandardContentStoreLruList &);
 
-  typedef std::list<Ptr<CCNxStandardContentStoreEntry> > LruListType;
-  LruListType m_lruList;
+  /*
+   * Link an unlinked entry at the head of the list.  Does not touch the reference count.
+   */
+  void LinkFront (CCNxStandardContentStoreEntry *entry);
+
+  /*
+   * Unlink a linked entry.  Does not touch the reference count.
+   */
+  void Unlink (CCNxStandardContentStoreEntry *entry);
 
-  typedef std::map <Ptr<CCNxStandardContentStoreEntry>,  LruListType::iterator > LruMapType;
-  LruMapType m_lruMap;
+  CCNxStandardContentStoreEntry *m_head;
+  CCNxStandardContentStoreEntry *m_tail;
+  uint64_t m_size;
 };
 
 }   /* namespace ccnx */
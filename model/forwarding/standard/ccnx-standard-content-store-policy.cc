@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ccnx-standard-content-store-policy.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxStandardContentStorePolicy");
+
+CCNxStandardContentStorePolicy::CCNxStandardContentStorePolicy ()
+  : m_hits (0), m_misses (0), m_inserts (0), m_evictions (0)
+{
+  // empty
+}
+
+CCNxStandardContentStorePolicy::~CCNxStandardContentStorePolicy ()
+{
+  // empty
+}
+
+void
+CCNxStandardContentStorePolicy::AddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t key, uint64_t capacity, EntryVectorType &evicted)
+{
+  NS_ASSERT_MSG (entry, "AddEntry given a null entry");
+  entry->m_policyKey = key;
+  entry->m_policyFrequency = 0;
+  entry->m_policyQueue = 0;
+
+  size_t before = evicted.size ();
+  DoAddEntry (entry, capacity, evicted);
+
+  m_inserts++;
+  m_evictions += evicted.size () - before;
+  NS_LOG_DEBUG (GetName () << " add key " << key << " size " << GetSize () << " evicted " << evicted.size () - before);
+}
+
+void
+CCNxStandardContentStorePolicy::Hit (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  m_hits++;
+  DoHit (entry);
+}
+
+void
+CCNxStandardContentStorePolicy::Miss (uint64_t key)
+{
+  m_misses++;
+  DoMiss (key);
+}
+
+bool
+CCNxStandardContentStorePolicy::DeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  return DoDeleteEntry (entry);
+}
+
+void
+CCNxStandardContentStorePolicy::DoMiss (uint64_t key)
+{
+  // most policies only learn from hits
+}
+
+uint64_t
+CCNxStandardContentStorePolicy::GetHitCount () const
+{
+  return m_hits;
+}
+
+uint64_t
+CCNxStandardContentStorePolicy::GetMissCount () const
+{
+  return m_misses;
+}
+
+uint64_t
+CCNxStandardContentStorePolicy::GetInsertCount () const
+{
+  return m_inserts;
+}
+
+uint64_t
+CCNxStandardContentStorePolicy::GetEvictionCount () const
+{
+  return m_evictions;
+}
+
+double
+CCNxStandardContentStorePolicy::GetHitRatio () const
+{
+  uint64_t lookups = m_hits + m_misses;
+  return lookups ? (double) m_hits / lookups : 0.0;
+}
+
+void
+CCNxStandardContentStorePolicy::ResetCounters ()
+{
+  m_hits = 0;
+  m_misses = 0;
+  m_inserts = 0;
+  m_evictions = 0;
+}
+
+uint64_t
+CCNxStandardContentStorePolicy::GetKey (Ptr<const CCNxStandardContentStoreEntry> entry)
+{
+  return entry->m_policyKey;
+}
+
+uint32_t
+CCNxStandardContentStorePolicy::GetFrequency (Ptr<const CCNxStandardContentStoreEntry> entry)
+{
+  return entry->m_policyFrequency;
+}
+
+void
+CCNxStandardContentStorePolicy::SetFrequency (Ptr<CCNxStandardContentStoreEntry> entry, uint32_t frequency)
+{
+  entry->m_policyFrequency = frequency;
+}
+
+uint8_t
+CCNxStandardContentStorePolicy::GetQueue (Ptr<const CCNxStandardContentStoreEntry> entry)
+{
+  return entry->m_policyQueue;
+}
+
+void
+CCNxStandardContentStorePolicy::SetQueue (Ptr<CCNxStandardContentStoreEntry> entry, uint8_t queue)
+{
+  entry->m_policyQueue = queue;
+}
+
+// ==========================
+
+CCNxStandardContentStorePolicy::GhostList::GhostList ()
+{
+  // empty
+}
+
+bool
+CCNxStandardContentStorePolicy::GhostList::Contains (uint64_t key) const
+{
+  return m_index.find (key) != m_index.end ();
+}
+
+void
+CCNxStandardContentStorePolicy::GhostList::Insert (uint64_t key, uint64_t capacity)
+{
+  Erase (key);
+  if (capacity == 0)
+    {
+      return;
+    }
+
+  while (m_keys.size () >= capacity)
+    {
+      PopBack ();
+    }
+
+  m_keys.push_front (key);
+  m_index[key] = m_keys.begin ();
+}
+
+bool
+CCNxStandardContentStorePolicy::GhostList::Erase (uint64_t key)
+{
+  KeyMapType::iterator it = m_index.find (key);
+  if (it == m_index.end ())
+    {
+      return false;
+    }
+  m_keys.erase (it->second);
+  m_index.erase (it);
+  return true;
+}
+
+bool
+CCNxStandardContentStorePolicy::GhostList::PopBack ()
+{
+  if (m_keys.empty ())
+    {
+      return false;
+    }
+  m_index.erase (m_keys.back ());
+  m_keys.pop_back ();
+  return true;
+}
+
+uint64_t
+CCNxStandardContentStorePolicy::GhostList::GetSize () const
+{
+  return m_keys.size ();
+}
+
+void
+CCNxStandardContentStorePolicy::GhostList::Clear ()
+{
+  m_keys.clear ();
+  m_index.clear ();
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_POLICY_H_
+#define CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_POLICY_H_
+
+#include <list>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "ns3/simple-ref-count.h"
+#include "ns3/ccnx-standard-content-store-entry.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-standard-forwarder
+ *
+ * Cache replacement policy of the standard content store.
+ *
+ * The content store owns the lookup maps; the policy owns the ordering of the entries and
+ * decides what to evict.  The content store calls `AddEntry()` for every new content object,
+ * `Hit()` for every interest it satisfies, `Miss()` for every interest it does not, and
+ * `DeleteEntry()` when it removes an object for its own reasons (expired, stale, or an explicit
+ * delete).  Entries evicted to make room are returned from `AddEntry()` so the content store
+ * can drop them from its maps.
+ *
+ * Each entry is identified to the policy by a 64-bit key (the name hash, or the content object
+ * hash for nameless objects).  Policies with ghost lists or frequency sketches use the key to
+ * remember objects that are no longer in the store.
+ *
+ * The base class keeps the hit, miss, insert and eviction counters.  Implementations override
+ * the `Do` methods.
+ */
+class CCNxStandardContentStorePolicy : public SimpleRefCount<CCNxStandardContentStorePolicy>
+{
+public:
+  typedef std::vector<Ptr<CCNxStandardContentStoreEntry> > EntryVectorType;
+
+  CCNxStandardContentStorePolicy ();
+
+  /**
+   * Virtual destructor for inheritance
+   */
+  virtual ~CCNxStandardContentStorePolicy ();
+
+  /**
+   * The short name of the policy, e.g. "Lru".
+   */
+  virtual std::string GetName () const = 0;
+
+  /**
+   * Add a new entry to the policy.
+   *
+   * The policy may evict entries so that no more than `capacity` entries remain.  The
+   * evicted entries (which may include `entry` itself if the policy does not admit it)
+   * are appended to `evicted`.
+   *
+   * @param entry [in] The new entry, which must not already be in the policy
+   * @param key [in] The key of the entry's content object
+   * @param capacity [in] The object capacity of the content store
+   * @param evicted [out] Entries removed from the policy
+   */
+  void AddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t key, uint64_t capacity, EntryVectorType &evicted);
+
+  /**
+   * An interest was satisfied by `entry`.
+   */
+  void Hit (Ptr<CCNxStandardContentStoreEntry> entry);
+
+  /**
+   * An interest for `key` was not satisfied.
+   */
+  void Miss (uint64_t key);
+
+  /**
+   * Remove an entry without recording it as an eviction.
+   *
+   * @return true if the entry was in the policy
+   */
+  bool DeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry);
+
+  /**
+   * The number of entries held by the policy
+   */
+  virtual uint64_t GetSize () const = 0;
+
+  uint64_t GetHitCount () const;
+  uint64_t GetMissCount () const;
+  uint64_t GetInsertCount () const;
+  uint64_t GetEvictionCount () const;
+
+  /**
+   * Hits / (hits + misses), or 0 before the first lookup.
+   */
+  double GetHitRatio () const;
+
+  /**
+   * Zero the hit, miss, insert and eviction counters.
+   */
+  void ResetCounters ();
+
+protected:
+  virtual void DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted) = 0;
+  virtual void DoHit (Ptr<CCNxStandardContentStoreEntry> entry) = 0;
+  virtual void DoMiss (uint64_t key);
+  virtual bool DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry) = 0;
+
+  /*
+   * Accessors for the policy state stored in the entry.
+   */
+  static uint64_t GetKey (Ptr<const CCNxStandardContentStoreEntry> entry);
+  static uint32_t GetFrequency (Ptr<const CCNxStandardContentStoreEntry> entry);
+  static void SetFrequency (Ptr<CCNxStandardContentStoreEntry> entry, uint32_t frequency);
+  static uint8_t GetQueue (Ptr<const CCNxStandardContentStoreEntry> entry);
+  static void SetQueue (Ptr<CCNxStandardContentStoreEntry> entry, uint8_t queue);
+
+  /**
+   * A bounded list of keys of recently evicted objects.  Insert puts a key at the head;
+   * once the list holds `capacity` keys the oldest is dropped.
+   */
+  class GhostList
+  {
+public:
+    GhostList ();
+    bool Contains (uint64_t key) const;
+    void Insert (uint64_t key, uint64_t capacity);
+    bool Erase (uint64_t key);
+    /**
+     * Drop the oldest key.  Returns false if the list is empty.
+     */
+    bool PopBack ();
+    uint64_t GetSize () const;
+    void Clear ();
+
+private:
+    typedef std::list<uint64_t> KeyListType;
+    typedef std::unordered_map<uint64_t, KeyListType::iterator> KeyMapType;
+    KeyListType m_keys;
+    KeyMapType m_index;
+  };
+
+private:
+  uint64_t m_hits;
+  uint64_t m_misses;
+  uint64_t m_inserts;
+  uint64_t m_evictions;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_POLICY_H_ */
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ccnx-standard-content-store-s3fifo-policy.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxStandardContentStoreS3FifoPolicy");
+
+/**
+ * The small FIFO is 1/_smallFraction of the capacity
+ */
+static const uint64_t _smallFraction = 10;
+
+/**
+ * Saturation value of the per-entry access counter (2 bits)
+ */
+static const uint32_t _maxFrequency = 3;
+
+CCNxStandardContentStoreS3FifoPolicy::CCNxStandardContentStoreS3FifoPolicy ()
+  : m_small (Create<CCNxStandardContentStoreLruList> ()),
+    m_main (Create<CCNxStandardContentStoreLruList> ())
+{
+  // empty
+}
+
+CCNxStandardContentStoreS3FifoPolicy::~CCNxStandardContentStoreS3FifoPolicy ()
+{
+  // empty
+}
+
+std::string
+CCNxStandardContentStoreS3FifoPolicy::GetName () const
+{
+  return "S3Fifo";
+}
+
+uint64_t
+CCNxStandardContentStoreS3FifoPolicy::GetSize () const
+{
+  return m_small->GetSize () + m_main->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreS3FifoPolicy::GetSmallSize () const
+{
+  return m_small->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreS3FifoPolicy::GetMainSize () const
+{
+  return m_main->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreS3FifoPolicy::GetGhostSize () const
+{
+  return m_ghost.GetSize ();
+}
+
+void
+CCNxStandardContentStoreS3FifoPolicy::EvictSmall (uint64_t capacity, EntryVectorType &evicted)
+{
+  while (m_small->GetSize () > 0)
+    {
+      Ptr<CCNxStandardContentStoreEntry> tail = m_small->GetBackEntry ();
+      m_small->DeleteEntry (tail);
+      if (GetFrequency (tail) > 0)
+        {
+          SetFrequency (tail, 0);
+          SetQueue (tail, Queue_Main);
+          m_main->AddEntry (tail);
+        }
+      else
+        {
+          m_ghost.Insert (GetKey (tail), capacity);
+          SetQueue (tail, 0);
+          evicted.push_back (tail);
+          return;
+        }
+    }
+}
+
+void
+CCNxStandardContentStoreS3FifoPolicy::EvictMain (EntryVectorType &evicted)
+{
+  while (m_main->GetSize () > 0)
+    {
+      Ptr<CCNxStandardContentStoreEntry> tail = m_main->GetBackEntry ();
+      uint32_t frequency = GetFrequency (tail);
+      if (frequency > 0)
+        {
+          SetFrequency (tail, frequency - 1);
+          m_main->AddEntry (tail); // reinsert at the head
+        }
+      else
+        {
+          m_main->DeleteEntry (tail);
+          SetQueue (tail, 0);
+          evicted.push_back (tail);
+          return;
+        }
+    }
+}
+
+void
+CCNxStandardContentStoreS3FifoPolicy::Evict (uint64_t capacity, EntryVectorType &evicted)
+{
+  uint64_t smallTarget = capacity / _smallFraction;
+  if (m_small->GetSize () > smallTarget || m_main->GetSize () == 0)
+    {
+      EvictSmall (capacity, evicted);
+    }
+  else
+    {
+      EvictMain (evicted);
+    }
+}
+
+void
+CCNxStandardContentStoreS3FifoPolicy::DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted)
+{
+  if (capacity == 0)
+    {
+      evicted.push_back (entry);
+      return;
+    }
+
+  while (GetSize () >= capacity)
+    {
+      Evict (capacity, evicted);
+    }
+
+  if (m_ghost.Erase (GetKey (entry)))
+    {
+      SetQueue (entry, Queue_Main);
+      m_main->AddEntry (entry);
+    }
+  else
+    {
+      SetQueue (entry, Queue_Small);
+      m_small->AddEntry (entry);
+    }
+}
+
+void
+CCNxStandardContentStoreS3FifoPolicy::DoHit (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  uint32_t frequency = GetFrequency (entry);
+  if (frequency < _maxFrequency)
+    {
+      SetFrequency (entry, frequency + 1);
+    }
+}
+
+bool
+CCNxStandardContentStoreS3FifoPolicy::DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  bool result = false;
+  switch (GetQueue (entry))
+    {
+    case Queue_Small:
+      result = m_small->DeleteEntry (entry);
+      break;
+    case Queue_Main:
+      result = m_main->DeleteEntry (entry);
+      break;
+    default:
+      break;
+    }
+  SetQueue (entry, 0);
+  return result;
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "ccnx-standard-content-store-wtinylfu-policy.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxStandardContentStoreWTinyLfuPolicy");
+
+/**
+ * The window is 1/_windowFraction of the capacity (at least one entry)
+ */
+static const uint64_t _windowFraction = 100;
+
+/**
+ * The protected segment is _protectedPercent of the main cache
+ */
+static const uint64_t _protectedPercent = 80;
+
+static const unsigned _sketchDepth = 4;
+static const uint8_t _sketchMaxCount = 15;
+static const uint64_t _sketchMinWidth = 64;
+static const uint64_t _sketchSampleFactor = 10;
+
+/**
+ * Per-row seeds for deriving the sketch column from the key
+ */
+static const uint64_t _sketchSeeds[_sketchDepth] = {
+  0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL
+};
+
+static inline uint64_t
+SketchIndex (uint64_t key, unsigned row, uint64_t width)
+{
+  uint64_t h = (key + _sketchSeeds[row]) * 0x9E3779B97F4A7C15ULL;
+  h ^= h >> 32;
+  return h & (width - 1);
+}
+
+CCNxStandardContentStoreWTinyLfuPolicy::CCNxStandardContentStoreWTinyLfuPolicy ()
+  : m_window (Create<CCNxStandardContentStoreLruList> ()),
+    m_probation (Create<CCNxStandardContentStoreLruList> ()),
+    m_protected (Create<CCNxStandardContentStoreLruList> ()),
+    m_capacity (0), m_rejections (0),
+    m_sketchWidth (0), m_sketchSamples (0), m_sketchResetAt (0)
+{
+  ResizeSketch (_sketchMinWidth);
+}
+
+CCNxStandardContentStoreWTinyLfuPolicy::~CCNxStandardContentStoreWTinyLfuPolicy ()
+{
+  // empty
+}
+
+std::string
+CCNxStandardContentStoreWTinyLfuPolicy::GetName () const
+{
+  return "WTinyLfu";
+}
+
+uint64_t
+CCNxStandardContentStoreWTinyLfuPolicy::GetSize () const
+{
+  return m_window->GetSize () + m_probation->GetSize () + m_protected->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreWTinyLfuPolicy::GetWindowSize () const
+{
+  return m_window->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreWTinyLfuPolicy::GetProbationSize () const
+{
+  return m_probation->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreWTinyLfuPolicy::GetProtectedSize () const
+{
+  return m_protected->GetSize ();
+}
+
+uint64_t
+CCNxStandardContentStoreWTinyLfuPolicy::GetRejectionCount () const
+{
+  return m_rejections;
+}
+
+void
+CCNxStandardContentStoreWTinyLfuPolicy::ResizeSketch (uint64_t capacity)
+{
+  uint64_t width = _sketchMinWidth;
+  while (width < capacity)
+    {
+      width <<= 1;
+    }
+
+  if (width != m_sketchWidth)
+    {
+      m_sketchWidth = width;
+      m_sketch.assign (_sketchDepth * width, 0);
+      m_sketchSamples = 0;
+    }
+  m_sketchResetAt = _sketchSampleFactor * std::max (capacity, _sketchMinWidth);
+}
+
+uint32_t
+CCNxStandardContentStoreWTinyLfuPolicy::EstimateFrequency (uint64_t key) const
+{
+  uint8_t estimate = _sketchMaxCount;
+  for (unsigned row = 0; row < _sketchDepth; row++)
+    {
+      estimate = std::min (estimate, m_sketch[row * m_sketchWidth + SketchIndex (key, row, m_sketchWidth)]);
+    }
+  return estimate;
+}
+
+void
+CCNxStandardContentStoreWTinyLfuPolicy::RecordAccess (uint64_t key)
+{
+  for (unsigned row = 0; row < _sketchDepth; row++)
+    {
+      uint8_t &counter = m_sketch[row * m_sketchWidth + SketchIndex (key, row, m_sketchWidth)];
+      if (counter < _sketchMaxCount)
+        {
+          counter++;
+        }
+    }
+
+  if (++m_sketchSamples >= m_sketchResetAt)
+    {
+      // Aging: halve every counter
+      for (size_t i = 0; i < m_sketch.size (); i++)
+        {
+          m_sketch[i] >>= 1;
+        }
+      m_sketchSamples /= 2;
+    }
+}
+
+Ptr<CCNxStandardContentStoreLruList>
+CCNxStandardContentStoreWTinyLfuPolicy::GetQueueList (uint8_t queue) const
+{
+  switch (queue)
+    {
+    case Queue_Window:
+      return m_window;
+    case Queue_Probation:
+      return m_probation;
+    case Queue_Protected:
+      return m_protected;
+    default:
+      return Ptr<CCNxStandardContentStoreLruList> (0);
+    }
+}
+
+void
+CCNxStandardContentStoreWTinyLfuPolicy::MoveTo (Ptr<CCNxStandardContentStoreEntry> entry, QueueType queue)
+{
+  Ptr<CCNxStandardContentStoreLruList> from = GetQueueList (GetQueue (entry));
+  if (from)
+    {
+      from->DeleteEntry (entry);
+    }
+  SetQueue (entry, queue);
+  GetQueueList (queue)->AddEntry (entry);
+}
+
+Ptr<CCNxStandardContentStoreEntry>
+CCNxStandardContentStoreWTinyLfuPolicy::EvictMain ()
+{
+  Ptr<CCNxStandardContentStoreLruList> list = m_probation->GetSize () ? m_probation : m_protected;
+  Ptr<CCNxStandardContentStoreEntry> victim = list->GetBackEntry ();
+  if (victim)
+    {
+      list->DeleteEntry (victim);
+      SetQueue (victim, 0);
+    }
+  return victim;
+}
+
+void
+CCNxStandardContentStoreWTinyLfuPolicy::DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted)
+{
+  if (capacity == 0)
+    {
+      evicted.push_back (entry);
+      return;
+    }
+
+  if (capacity != m_capacity)
+    {
+      m_capacity = capacity;
+      ResizeSketch (capacity);
+    }
+
+  uint64_t windowCapacity = std::max<uint64_t> (1, capacity / _windowFraction);
+  uint64_t mainCapacity = capacity - windowCapacity;
+
+  MoveTo (entry, Queue_Window);
+
+  while (m_window->GetSize () > windowCapacity)
+    {
+      Ptr<CCNxStandardContentStoreEntry> candidate = m_window->GetBackEntry ();
+      m_window->DeleteEntry (candidate);
+      SetQueue (candidate, 0);
+
+      if (m_probation->GetSize () + m_protected->GetSize () < mainCapacity)
+        {
+          MoveTo (candidate, Queue_Probation);
+          continue;
+        }
+
+      Ptr<CCNxStandardContentStoreLruList> list = m_probation->GetSize () ? m_probation : m_protected;
+      Ptr<CCNxStandardContentStoreEntry> victim = list->GetBackEntry ();
+      if (victim && EstimateFrequency (GetKey (candidate)) > EstimateFrequency (GetKey (victim)))
+        {
+          EvictMain ();
+          evicted.push_back (victim);
+          MoveTo (candidate, Queue_Probation);
+        }
+      else
+        {
+          m_rejections++;
+          evicted.push_back (candidate);
+        }
+    }
+
+  // The capacity may have shrunk since the last insert
+  while (m_probation->GetSize () + m_protected->GetSize () > mainCapacity)
+    {
+      evicted.push_back (EvictMain ());
+    }
+}
+
+void
+CCNxStandardContentStoreWTinyLfuPolicy::DoHit (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  RecordAccess (GetKey (entry));
+
+  switch (GetQueue (entry))
+    {
+    case Queue_Window:
+      m_window->AddEntry (entry);
+      break;
+
+    case Queue_Probation:
+      {
+        MoveTo (entry, Queue_Protected);
+        uint64_t windowCapacity = std::max<uint64_t> (1, m_capacity / _windowFraction);
+        uint64_t protectedCapacity = (m_capacity - std::min (m_capacity, windowCapacity)) * _protectedPercent / 100;
+        while (m_protected->GetSize () > protectedCapacity && m_protected->GetSize () > 0)
+          {
+            MoveTo (m_protected->GetBackEntry (), Queue_Probation);
+          }
+        break;
+      }
+
+    case Queue_Protected:
+      m_protected->AddEntry (entry);
+      break;
+
+    default:
+      NS_LOG_ERROR ("Hit on an entry that is not in the policy");
+      break;
+    }
+}
+
+void
+CCNxStandardContentStoreWTinyLfuPolicy::DoMiss (uint64_t key)
+{
+  RecordAccess (key);
+}
+
+bool
+CCNxStandardContentStoreWTinyLfuPolicy::DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  Ptr<CCNxStandardContentStoreLruList> list = GetQueueList (GetQueue (entry));
+  SetQueue (entry, 0);
+  return list ? list->DeleteEntry (entry) : false;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_WTINYLFU_POLICY_H_
+#define CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_WTINYLFU_POLICY_H_
+
+#include <vector>
+#include "ns3/ccnx-standard-content-store-policy.h"
+#include "ns3/ccnx-standard-content-store-lruList.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-standard-forwarder
+ *
+ * W-TinyLFU replacement (Einziger, Friedman and Manes, ACM ToS 2017).
+ *
+ * New objects enter a small LRU window (1% of the capacity).  An object leaving the window
+ * competes for a place in the main cache with the main cache's victim; the one with the
+ * higher estimated access frequency stays.  The main cache is a segmented LRU: objects hit
+ * in the probation segment are promoted to the protected segment (80% of the main cache).
+ *
+ * Frequencies come from a 4-bit count-min sketch over the keys of every lookup, hits and
+ * misses alike, so an object can build up frequency before it is cached.  All counters are
+ * halved after 10 * capacity samples so old popularity fades.
+ */
+class CCNxStandardContentStoreWTinyLfuPolicy : public CCNxStandardContentStorePolicy
+{
+public:
+  CCNxStandardContentStoreWTinyLfuPolicy ();
+
+  virtual ~CCNxStandardContentStoreWTinyLfuPolicy ();
+
+  virtual std::string GetName () const;
+
+  virtual uint64_t GetSize () const;
+
+  uint64_t GetWindowSize () const;
+  uint64_t GetProbationSize () const;
+  uint64_t GetProtectedSize () const;
+
+  /**
+   * The number of window victims that lost to the main cache victim.
+   */
+  uint64_t GetRejectionCount () const;
+
+  /**
+   * The sketch's frequency estimate of a key.
+   */
+  uint32_t EstimateFrequency (uint64_t key) const;
+
+protected:
+  virtual void DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted);
+  virtual void DoHit (Ptr<CCNxStandardContentStoreEntry> entry);
+  virtual void DoMiss (uint64_t key);
+  virtual bool DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry);
+
+private:
+  enum QueueType
+  {
+    Queue_Window = 1,
+    Queue_Probation = 2,
+    Queue_Protected = 3
+  };
+
+  /*
+   * Count an access in the sketch, sizing it for `capacity` first if needed.
+   */
+  void RecordAccess (uint64_t key);
+  void ResizeSketch (uint64_t capacity);
+
+  /*
+   * Move an entry between segments.
+   */
+  void MoveTo (Ptr<CCNxStandardContentStoreEntry> entry, QueueType queue);
+  Ptr<CCNxStandardContentStoreLruList> GetQueueList (uint8_t queue) const;
+
+  /*
+   * Drop the LRU of the main cache (probation first).
+   */
+  Ptr<CCNxStandardContentStoreEntry> EvictMain ();
+
+  Ptr<CCNxStandardContentStoreLruList> m_window;
+  Ptr<CCNxStandardContentStoreLruList> m_probation;
+  Ptr<CCNxStandardContentStoreLruList> m_protected;
+
+  uint64_t m_capacity;
+  uint64_t m_rejections;
+
+  /*
+   * Count-min sketch: _sketchDepth rows of m_sketchWidth 4-bit counters, one counter per byte
+   */
+  std::vector<uint8_t> m_sketch;
+  uint64_t m_sketchWidth;
+  uint64_t m_sketchSamples;
+  uint64_t m_sketchResetAt;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_CONTENT_STORE_WTINYLFU_POLICY_H_ */
@@ -56,9 +56,16 @@
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/integer.h"
+#include "ns3/boolean.h"
+#include "ns3/enum.h"
 #include "ns3/ccnx-delay-queue.h"
 #include "ns3/object.h"
 #include "ccnx-standard-content-store.h"
+#include "ns3/ccnx-standard-content-store-lru-policy.h"
+#include "ns3/ccnx-standard-content-store-lfu-policy.h"
+#include "ns3/ccnx-standard-content-store-arc-policy.h"
+#include "ns3/ccnx-standard-content-store-s3fifo-policy.h"
+#include "ns3/ccnx-standard-content-store-wtinylfu-policy.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -74,8 +81,9 @@ static const long long _defaultObjectCapacity = 10000;  //size_t and uint64_t do
 
 static const Time _defaultLayerDelayConstant = MicroSeconds (1);
 static const Time _defaultLayerDelaySlope = NanoSeconds (10);
-static unsigned _defaultLayerDelayServers = 1;
-Ptr<CCNxHashValue> CCNxStandardContentStore::nullHashValue = Create<CCNxHashValue> (0);
+static const unsigned _defaultLayerDelayServers = 1;
+static const bool _defaultInlineZeroDelay = false;
+static const unsigned _defaultLayerDelayBatchSize = 1;
 
 /**
  * Used as a default callback for m_recieveInterestCallback in case the user does not set it.
@@ -119,7 +127,24 @@ CCNxStandardContentStore::GetTypeId ()
     .AddAttribute ("LayerDelayServers", "The number of servers for the layer delay input queue",
 		  IntegerValue (_defaultLayerDelayServers),
 		  MakeIntegerAccessor (&CCNxStandardContentStore::m_layerDelayServers),
-		  MakeIntegerChecker<unsigned> ());
+		  MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("InlineZeroDelay", "If true and both layer delays are zero, service the input queue inline",
+		  BooleanValue (_defaultInlineZeroDelay),
+		  MakeBooleanAccessor (&CCNxStandardContentStore::m_inlineZeroDelay),
+		  MakeBooleanChecker ())
+    .AddAttribute ("LayerDelayBatchSize", "The maximum number of packets a layer delay server processes together",
+		  IntegerValue (_defaultLayerDelayBatchSize),
+		  MakeIntegerAccessor (&CCNxStandardContentStore::m_layerDelayBatchSize),
+		  MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("ReplacementPolicy", "The cache replacement policy (default = Lru)",
+		  EnumValue (ReplacementPolicy_Lru),
+		  MakeEnumAccessor (&CCNxStandardContentStore::SetReplacementPolicy,
+				    &CCNxStandardContentStore::GetReplacementPolicyType),
+		  MakeEnumChecker (ReplacementPolicy_Lru, "Lru",
+				   ReplacementPolicy_Lfu, "Lfu",
+				   ReplacementPolicy_Arc, "Arc",
+				   ReplacementPolicy_S3Fifo, "S3Fifo",
+				   ReplacementPolicy_WTinyLfu, "WTinyLfu"));
     return tid;
 }
 
@@ -128,9 +153,12 @@ CCNxStandardContentStore::CCNxStandardContentStore () : m_objectCapacity (_defau
       m_matchInterestCallback (MakeCallback (&NullMatchInterestCallback)),
       m_addContentObjectCallback (MakeCallback (&NullAddContentObjectCallback)),
       m_layerDelayConstant (_defaultLayerDelayConstant), m_layerDelaySlope (_defaultLayerDelaySlope),
-      m_layerDelayServers (_defaultLayerDelayServers)
+      m_layerDelayServers (_defaultLayerDelayServers), m_inlineZeroDelay (_defaultInlineZeroDelay),
+      m_layerDelayBatchSize (_defaultLayerDelayBatchSize),
+      m_nullHashValue (Create<CCNxHashValue> (0))
 {
-    m_lruList = Create<CCNxStandardContentStoreLruList> ();
+    m_policyType = ReplacementPolicy_Lru;
+    m_policy = Create<CCNxStandardContentStoreLruPolicy> ();
 }
 
 CCNxStandardContentStore::~CCNxStandardContentStore ()
@@ -139,6 +167,48 @@ CCNxStandardContentStore::~CCNxStandardContentStore ()
 }
 
 
+void
+CCNxStandardContentStore::SetReplacementPolicy (ReplacementPolicyType type)
+{
+  NS_LOG_FUNCTION (this << type);
+  NS_ASSERT_MSG (!m_policy || m_policy->GetSize () == 0, "The replacement policy can only be changed while the content store is empty");
+
+  switch (type)
+    {
+    case ReplacementPolicy_Lru:
+      m_policy = Create<CCNxStandardContentStoreLruPolicy> ();
+      break;
+    case ReplacementPolicy_Lfu:
+      m_policy = Create<CCNxStandardContentStoreLfuPolicy> ();
+      break;
+    case ReplacementPolicy_Arc:
+      m_policy = Create<CCNxStandardContentStoreArcPolicy> ();
+      break;
+    case ReplacementPolicy_S3Fifo:
+      m_policy = Create<CCNxStandardContentStoreS3FifoPolicy> ();
+      break;
+    case ReplacementPolicy_WTinyLfu:
+      m_policy = Create<CCNxStandardContentStoreWTinyLfuPolicy> ();
+      break;
+    default:
+      NS_ASSERT_MSG (false, "Unsupported replacement policy: " << type);
+      return;
+    }
+  m_policyType = type;
+}
+
+CCNxStandardContentStore::ReplacementPolicyType
+CCNxStandardContentStore::GetReplacementPolicyType () const
+{
+  return m_policyType;
+}
+
+Ptr<const CCNxStandardContentStorePolicy>
+CCNxStandardContentStore::GetReplacementPolicy () const
+{
+  return m_policy;
+}
+
 void
 CCNxStandardContentStore::DoInitialize ()
 {
@@ -147,6 +217,16 @@ CCNxStandardContentStore::DoInitialize ()
   m_inputQueue = Create<DelayQueueType> (m_layerDelayServers,
                                          MakeCallback (&CCNxStandardContentStore::GetServiceTime, this),
                                          MakeCallback (&CCNxStandardContentStore::DequeueCallback, this));
+
+  if (m_inlineZeroDelay && m_layerDelayConstant.IsZero () && m_layerDelaySlope.IsZero ())
+    {
+      // There is no processing time to model, so skip the timer and service inline
+      m_inputQueue->SetSynchronous (true);
+    }
+  else if (m_layerDelayBatchSize > 1)
+    {
+      m_inputQueue->SetBatchMode (m_layerDelayBatchSize, MakeCallback (&CCNxStandardContentStore::GetBatchServiceTime, this));
+    }
 }
 
 void
@@ -201,6 +281,21 @@ CCNxStandardContentStore::GetServiceTime (Ptr<CCNxStandardForwarderWorkItem> wor
   return delay;
 }
 
+/*
+ * GetServiceTime() does the work of each item (the match or add), so call it for every item
+ * in the batch, but charge the constant delay only once.
+ */
+Time
+CCNxStandardContentStore::GetBatchServiceTime (const DelayQueueType::BatchType &items)
+{
+  Time delay = m_layerDelayConstant;
+  for (DelayQueueType::BatchType::const_iterator i = items.begin (); i != items.end (); ++i)
+    {
+      delay += GetServiceTime (*i) - m_layerDelayConstant;
+    }
+  return delay;
+}
+
 
 void
 CCNxStandardContentStore::MatchInterest (Ptr<CCNxForwarderMessage> message)
@@ -316,7 +411,7 @@ CCNxStandardContentStore::ServiceMatchInterest (Ptr<CCNxStandardForwarderWorkIte
 	//increment it's use count
 	 entry->IncrementUseCount();
 
-	 m_lruList->AddEntry(entry); //This is a Refresh which has same logic as Add
+	 m_policy->Hit(entry);
 
 	 workItem->SetContentStorePacket(entry->GetPacket());
 	 NS_LOG_INFO ("found content for this interest in CS");
@@ -325,12 +420,14 @@ CCNxStandardContentStore::ServiceMatchInterest (Ptr<CCNxStandardForwarderWorkIte
        { //entry not valid, remove it and dont add a content store packet
 	NS_LOG_INFO ("removing expired or stale content in CS matching this interest - no content returned");
 	DeleteContentObject(entry->GetPacket());
+	m_policy->Miss(GetPolicyKey(workItem->GetPacket()));
        }
     }
  else
    {
      //no entry found
      NS_LOG_INFO ("unable to find content matching interest=" << *workItem->GetPacket() << " in CS");
+     m_policy->Miss(GetPolicyKey(workItem->GetPacket()));
    }
 
  return match;
@@ -349,25 +446,34 @@ CCNxStandardContentStore::ServiceAddContentObject (Ptr<CCNxStandardForwarderWork
   //if (m_csByHash.find(cPacket) == m_csByHash.end() )
   if (GetEntryFromPacket(cPacket))
     {
-      NS_LOG_INFO ("content object already present in CS packet with hash=" << *workItem->GetPacket()->GetContentObjectHash()->GetValue() << " and name=" << *workItem->GetPacket()->GetMessage()->GetName() );
+      NS_LOG_INFO ("content object already present in CS packet with name=" << *workItem->GetPacket()->GetMessage()->GetName() );
     }
   else
     {
-      if (GetObjectCount()>=GetObjectCapacity())
-	{
-	  Ptr<CCNxStandardContentStoreEntry> oldestEntry = m_lruList->GetBackEntry();
-	  DeleteContentObject(oldestEntry->GetPacket());
-	}
-      //create new entry
+      //create new entry, the policy evicts whatever it needs to make room
       Ptr<CCNxStandardContentStoreEntry> newEntry = Create<CCNxStandardContentStoreEntry> (cPacket);
 
-      result = m_lruList->AddEntry(newEntry);
-
-      if (result)
+      result = AddMapEntry(cPacket,newEntry);
+      if (!result)
 	{
-	  result = AddMapEntry(cPacket,newEntry);
+	  // No map can find it, so do not give it to the policy either
+	  NS_LOG_INFO ("content object has neither a name nor a hash");
 	}
+      else
+	{
+	  CCNxStandardContentStorePolicy::EntryVectorType evicted;
+	  m_policy->AddEntry(newEntry, GetPolicyKey(cPacket), GetObjectCapacity(), evicted);
 
+	  for (size_t i = 0; i < evicted.size(); i++)
+	    {
+	      if (evicted[i] == newEntry)
+		{
+		  NS_LOG_INFO ("replacement policy did not admit content object");
+		  result = false;
+		}
+	      RemoveMapEntry(evicted[i]);
+	    }
+	}
   }
 
   workItem->SetContentAddedFlag(result);
@@ -402,10 +508,17 @@ CCNxStandardContentStore::IsEntryValid(Ptr<CCNxStandardContentStoreEntry> entry)
     return (not dead);
 }
 
+bool
+CCNxStandardContentStore::HasContentObjectHash (Ptr<const CCNxPacket> cPacket) const
+{
+  Ptr<const CCNxHashValue> hash = cPacket->GetContentObjectHash ();
+  return hash && *hash->GetValue () != *m_nullHashValue->GetValue ();
+}
+
 Ptr<CCNxStandardContentStoreEntry>
 CCNxStandardContentStore::GetEntryFromPacket(Ptr<CCNxPacket> cPacket)
 {
-  if (*cPacket->GetContentObjectHash()->GetValue() != *nullHashValue->GetValue())
+  if (HasContentObjectHash (cPacket))
     {
 	  NS_LOG_INFO("cPacket has non-zero hash =" << *cPacket->GetContentObjectHash()->GetValue() << ". looking in hash map");
 	  return(FindEntryInHashMap(cPacket));
@@ -446,7 +559,7 @@ CCNxStandardContentStore::FindEntryInNameMap(Ptr<CCNxPacket> cPacket)
 bool
 CCNxStandardContentStore::DeleteContentObject(Ptr<CCNxPacket> cPacket)
 {
-  //remove packet from all maps and Lru
+  //remove packet from all maps and the replacement policy
   NS_LOG_FUNCTION (this);
 
   Ptr<CCNxStandardContentStoreEntry> entry =   GetEntryFromPacket(cPacket);
@@ -454,15 +567,47 @@ CCNxStandardContentStore::DeleteContentObject(Ptr<CCNxPacket> cPacket)
 
   if (result)
     {
-      if (!m_lruList->DeleteEntry(entry))
+      if (!m_policy->DeleteEntry(entry))
+	{
+	      NS_LOG_ERROR("could not delete Entry from replacement policy.");
+	}
+
+      result = RemoveMapEntry(entry);
+    } // found packet
+  else
 	{
-	      NS_LOG_ERROR("could not delete Entry from m_lruList.");
+	      NS_LOG_ERROR("could not find cPacket in Content Store.");
 	}
 
+  return result;
+}
+
+/*
+ * Erase the map slot for key if it holds entry
+ */
+template <class MapType>
+static bool
+EraseIfEntry (MapType &map, Ptr<const CCNxPacket> key, Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  typename MapType::iterator it = map.find (key);
+  if (it != map.end () && it->second == entry)
+    {
+      map.erase (it);
+      return true;
+    }
+  return false;
+}
+
+bool
+CCNxStandardContentStore::RemoveMapEntry(Ptr<CCNxStandardContentStoreEntry> entry)
+{
+  NS_LOG_FUNCTION (this);
+  Ptr<const CCNxPacket> cPacket = entry->GetPacket();
+  bool result = true;
 
-      if (*cPacket->GetContentObjectHash()->GetValue() != *nullHashValue->GetValue())
+      if (HasContentObjectHash (cPacket))
 	{
-	    result&=m_csByHash.erase(cPacket);
+	    result&=EraseIfEntry(m_csByHash, cPacket, entry);
 	    if (!result)
 	      {
 		NS_LOG_ERROR("could not erase cPacket from m_csByHash.");
@@ -473,7 +618,7 @@ CCNxStandardContentStore::DeleteContentObject(Ptr<CCNxPacket> cPacket)
 	        if (cPacket->m_message->HasKeyid())
 	    #endif
 		{
-		    result&=m_csByHashKeyid.erase(cPacket);
+		    result&=EraseIfEntry(m_csByHashKeyid, cPacket, entry);
 		    if (!result)
 		      {
 			NS_LOG_ERROR("could not erase cPacket from m_csByHashKeyid.");
@@ -483,7 +628,7 @@ CCNxStandardContentStore::DeleteContentObject(Ptr<CCNxPacket> cPacket)
 
       if (cPacket->GetMessage()->GetName()->GetSegmentCount())
       {
-	  result&=m_csByName.erase(cPacket);
+	  result&=EraseIfEntry(m_csByName, cPacket, entry);
 	  if (!result)
 	    {
 	      NS_LOG_ERROR("could not erase cPacket from m_csByName.");
@@ -494,23 +639,39 @@ CCNxStandardContentStore::DeleteContentObject(Ptr<CCNxPacket> cPacket)
 	      if (cPacket->m_message->HasKeyid())
 	  #endif
 	  {
-	      result&=m_csByNameKeyid.erase(cPacket);
+	      result&=EraseIfEntry(m_csByNameKeyid, cPacket, entry);
 	      if (!result)
 		{
 		  NS_LOG_ERROR("could not erase cPacket from m_csByNameKeyid.");
 		}
 	  }
       }   //name  maps
-    } // found packet
-  else
-	{
-	      NS_LOG_ERROR("could not find cPacket in Content Store.");
-	}
 
   return result;
 }
 
+uint64_t
+CCNxStandardContentStore::GetPolicyKey (Ptr<const CCNxPacket> packet)
+{
+  Ptr<const CCNxName> name = packet->GetMessage()->GetName();
+  if (name && name->GetSegmentCount())
+    {
+      return name->GetHash();
+    }
 
+  // FNV-1a over the content object hash or hash restriction
+  uint64_t key = 0xcbf29ce484222325ULL;
+  Ptr<const CCNxByteArray> hash = GetHashOrRestriction(packet);
+  if (hash)
+    {
+      for (size_t i = 0; i < hash->size(); i++)
+	{
+	  key ^= (*hash)[i];
+	  key *= 0x100000001b3ULL;
+	}
+    }
+  return key;
+}
 
 bool
 CCNxStandardContentStore::AddMapEntry(Ptr<CCNxPacket> cPacket, Ptr<CCNxStandardContentStoreEntry> newEntry)
@@ -521,8 +682,10 @@ CCNxStandardContentStore::AddMapEntry(Ptr<CCNxPacket> cPacket, Ptr<CCNxStandardC
   NS_ASSERT_MSG (newEntry->GetPacket()->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Object,
                  "AddMapEntry given a non-Content Object packet: " << *newEntry->GetPacket ());
 
-  if (*cPacket->GetContentObjectHash()->GetValue() != *nullHashValue->GetValue())
+  bool added = false;
+  if (HasContentObjectHash (cPacket))
     {
+      added = true;
       m_csByHash[cPacket] = newEntry;
       #ifdef KEYIDHACK
 	 if (1)  //for now, all content will treated as if it has a keyid
@@ -536,6 +699,7 @@ CCNxStandardContentStore::AddMapEntry(Ptr<CCNxPacket> cPacket, Ptr<CCNxStandardC
 
   if (content->GetName()->GetSegmentCount())
     {
+      added = true;
       m_csByName[cPacket] = newEntry;
       #ifdef KEYIDHACK
 	if (1)  //for now, all content will treated as if it has a keyid
@@ -548,7 +712,7 @@ CCNxStandardContentStore::AddMapEntry(Ptr<CCNxPacket> cPacket, Ptr<CCNxStandardC
     } //name
 
 
-  return true;
+  return added;
 }
 
 
@@ -561,8 +725,8 @@ size_t
 CCNxStandardContentStore::GetObjectCount () const
 {
   NS_LOG_FUNCTION (this);
-// since we have other methods to check the map sizes, we will do this count using the LRU list
-  return m_lruList->GetSize ();
+// since we have other methods to check the map sizes, we will do this count using the replacement policy
+  return m_policy->GetSize ();
 }
 
 size_t
@@ -618,6 +782,7 @@ CCNxStandardContentStore::GetHashOrRestriction(Ptr<const CCNxPacket> z)
 	  return(zInterest->GetHashRestriction()->GetValue());
 	  break;
       case CCNxMessage::ContentObject :
+	  NS_ASSERT_MSG (z->GetContentObjectHash (), "Content object in the hash map without a hash");
 	  return(z->GetContentObjectHash()->GetValue());
 	  break;
       default:
@@ -59,7 +59,7 @@
 #include <map>
 #include "ns3/ccnx-content-store.h"
 #include "ns3/ccnx-standard-content-store-entry.h"
-#include "ns3/ccnx-standard-content-store-lruList.h"
+#include "ns3/ccnx-standard-content-store-policy.h"
 #include "ns3/ccnx-standard-forwarder-work-item.h"
 #include "ns3/ccnx-delay-queue.h"
 #include "ns3/ccnx-name.h"
@@ -73,8 +73,9 @@ namespace ccnx {
 /**
  * @ingroup ccnx-standard-forwarder
  *
- * The Standard ContentStore Class. The standard content store implements a map based content cache
- * with least recently used eviction algorithm.
+ * The Standard ContentStore Class. The standard content store implements a map based content cache.
+ * Eviction is done by a `CCNxStandardContentStorePolicy`, selected with the attribute "ReplacementPolicy"
+ * (least recently used by default).
  *
  */
 
@@ -87,6 +88,18 @@ public:
    */
   static TypeId GetTypeId ();
 
+  /**
+   * The cache replacement policies, set via the attribute "ReplacementPolicy".
+   */
+  enum ReplacementPolicyType
+  {
+    ReplacementPolicy_Lru,      //!< Least recently used (default)
+    ReplacementPolicy_Lfu,      //!< Least frequently used
+    ReplacementPolicy_Arc,      //!< Adaptive Replacement Cache
+    ReplacementPolicy_S3Fifo,   //!< S3-FIFO
+    ReplacementPolicy_WTinyLfu  //!< W-TinyLFU
+  };
+
   /**
    * Create a standard content store.  It is configured via the NS attribute system.
    */
@@ -165,6 +178,27 @@ public:
    */
   virtual size_t GetObjectCapacity () const;
 
+  /**
+   * Selects the replacement policy.  This is the setter of the attribute "ReplacementPolicy".
+   *
+   * The policy can only be changed while the content store is empty.
+   *
+   * @param type The replacement policy to use
+   */
+  void SetReplacementPolicy (ReplacementPolicyType type);
+
+  /**
+   * @return The replacement policy type
+   */
+  ReplacementPolicyType GetReplacementPolicyType () const;
+
+  /**
+   * The replacement policy, for its hit ratio and eviction counters.
+   *
+   * @return The replacement policy in use
+   */
+  Ptr<const CCNxStandardContentStorePolicy> GetReplacementPolicy () const;
+
   /**
    * FindEntryInNameMap
    * @param cPacket - content packet
@@ -198,11 +232,23 @@ public:
    * @param cPacket - content packet to be added
    * @param newEntry - entry for this packet
    *
-   * @return true
+   * @return true if the entry was added to at least one map
+   * @return false if the packet has neither a hash nor a name, so nothing was added
    *
    */
   virtual bool AddMapEntry(Ptr<CCNxPacket> cPacket, Ptr<CCNxStandardContentStoreEntry> newEntry);
 
+  /**
+   * RemoveMapEntry - remove an entry from every map in which it is indexed.  A map slot that
+   * now holds a different entry for the same key is left alone.
+   *
+   * @param entry - entry to remove
+   *
+   * @return true if the entry was removed from every map it should be in
+   *
+   */
+  virtual bool RemoveMapEntry(Ptr<CCNxStandardContentStoreEntry> entry);
+
 
 
 protected:
@@ -240,10 +286,15 @@ protected:
   Ptr<CCNxStandardContentStoreEntry> GetEntryFromPacket(Ptr<CCNxPacket> cPacket);
 
   /**
-   * nullHashValue - Static Null Hash Value - used for internal comparisons.
-   *
+   * True if the packet has a ContentObjectHash other than the null hash (m_nullHashValue)
    */
-  static  Ptr<CCNxHashValue> nullHashValue;
+  bool HasContentObjectHash (Ptr<const CCNxPacket> cPacket) const;
+
+  /**
+   * The key by which the replacement policy knows a content object or the interest for it:
+   * the name hash, or for nameless packets a hash of the content object hash (restriction).
+   */
+  static uint64_t GetPolicyKey (Ptr<const CCNxPacket> packet);
 
   /**
      * Function to compare two smart pointers to CCNx packets based on Hash and Keyid.
@@ -382,13 +433,17 @@ protected:
         CSByHashKeyidType m_csByHashKeyid;
 
         /**
-          * The Least Recently Used (lru) list is a class which has the least recently used packet at the end of the list,
-          * and the most recently used at the beginning. The list allows the LRU algorithm to be used when
-          * to evict packets when the content store has reached maximum size.
+          * The replacement policy orders the entries and chooses which to evict when the
+          * content store has reached maximum size.
 	  * Protected rather than private so it can be accessed by test methods in a derived class used for unit testing.
           */
 
-        Ptr<CCNxStandardContentStoreLruList> m_lruList;
+        Ptr<CCNxStandardContentStorePolicy> m_policy;
+
+        /**
+         * The type of m_policy, set via the attribute "ReplacementPolicy".
+         */
+        ReplacementPolicyType m_policyType;
 
 private:
 
@@ -454,6 +509,15 @@ private:
     */
    Time GetServiceTime (Ptr<CCNxStandardForwarderWorkItem> workItem);
 
+   /**
+    * Callback from delay queue to compute the service time of a batch of work items
+    * when "LayerDelayBatchSize" is more than 1.  The constant delay is paid once per batch.
+    *
+    * @param items [in] The work items being serviced together
+    * @return The service time of the batch
+    */
+   Time GetBatchServiceTime (const DelayQueueType::BatchType &items);
+
    /**
     * Callback from delay queue after a work item has waited its service time
     *
@@ -487,6 +551,30 @@ private:
    * This value is set via the attribute "LayerDelayServers".  The default is 1.
    */
   unsigned m_layerDelayServers;
+
+  /**
+   * If true and both m_layerDelayConstant and m_layerDelaySlope are zero, the input queue
+   * services each item before returning instead of scheduling a zero-delay event.
+   *
+   * This value is set via the attribute "InlineZeroDelay".  The default is false.
+   */
+  bool m_inlineZeroDelay;
+
+  /**
+   * The maximum number of work items an input queue server processes together.
+   * A batch pays the layer delay constant once:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * \sum payloadBytes\f$
+   *
+   * This value is set via the attribute "LayerDelayBatchSize".  The default is 1 (no batching).
+   */
+  unsigned m_layerDelayBatchSize;
+
+  /**
+   * The null hash value.  A packet with no ContentObjectHash, or with this value as a virtual
+   * hash, is looked up by name instead of by hash.
+   */
+  Ptr<CCNxHashValue> m_nullHashValue;
 };
 
 }   /* namespace ccnx */
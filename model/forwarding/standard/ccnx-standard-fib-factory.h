@@ -111,6 +111,24 @@ public:
    * This value is set via the attribute "LayerDelayServers".  The default is 1.
    */
   void SetLayerDelayServers (unsigned serverCount);
+
+  /**
+   * If true and both layer delays are zero, the input queue is serviced inline
+   * instead of through zero-delay simulator events.
+   *
+   * This value is set via the attribute "InlineZeroDelay".  The default is false.
+   */
+  void SetInlineZeroDelay (bool inlineZeroDelay);
+
+  /**
+   * The maximum number of work items an input queue server processes together.
+   * A batch pays the layer delay constant once:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * \sum nameComponents\f$
+   *
+   * This value is set via the attribute "LayerDelayBatchSize".  The default is 1 (no batching).
+   */
+  void SetLayerDelayBatchSize (unsigned batchSize);
 };
 
 }   /* namespace ccnx */
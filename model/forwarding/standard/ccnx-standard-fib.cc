@@ -56,12 +56,13 @@
 
 
 #include "ccnx-standard-fib.h"
-#include "ns3/ccnx-name-builder.h"
 #include "ns3/simple-ref-count.h"
+#include "ns3/ccnx-name-intern-pool.h"
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/object.h"
 #include "ns3/integer.h"
+#include "ns3/boolean.h"
 #include "ns3/ccnx-standard-forwarder-work-item.h"
 
 using namespace ns3;
@@ -73,7 +74,9 @@ NS_OBJECT_ENSURE_REGISTERED (CCNxStandardFib);
 
 static const Time _defaultLayerDelayConstant = MicroSeconds (1);
 static const Time _defaultLayerDelaySlope = NanoSeconds (10);
-static unsigned _defaultLayerDelayServers = 1;
+static const unsigned _defaultLayerDelayServers = 1;
+static const bool _defaultInlineZeroDelay = false;
+static const unsigned _defaultLayerDelayBatchSize = 1;
 
 /**
  * Used as a default callback for m_recieveInterestCallback in case the user does not set it.
@@ -103,6 +106,14 @@ CCNxStandardFib::GetTypeId (void)
                    IntegerValue (_defaultLayerDelayServers),
                    MakeIntegerAccessor (&CCNxStandardFib::m_layerDelayServers),
                    MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("InlineZeroDelay", "If true and both layer delays are zero, service the input queue inline",
+                   BooleanValue (_defaultInlineZeroDelay),
+                   MakeBooleanAccessor (&CCNxStandardFib::m_inlineZeroDelay),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LayerDelayBatchSize", "The maximum number of lookups a layer delay server processes together",
+                   IntegerValue (_defaultLayerDelayBatchSize),
+                   MakeIntegerAccessor (&CCNxStandardFib::m_layerDelayBatchSize),
+                   MakeIntegerChecker<unsigned> ())
   ;
 
   return tid;
@@ -112,9 +123,10 @@ CCNxStandardFib::GetTypeId (void)
 CCNxStandardFib::CCNxStandardFib ()
   :   m_LookupCallback (MakeCallback (&NullLookupCallback)),
   m_layerDelayConstant (_defaultLayerDelayConstant), m_layerDelaySlope (_defaultLayerDelaySlope),
-  m_layerDelayServers (_defaultLayerDelayServers)
+  m_layerDelayServers (_defaultLayerDelayServers), m_inlineZeroDelay (_defaultInlineZeroDelay),
+  m_layerDelayBatchSize (_defaultLayerDelayBatchSize)
 {
-
+  m_trieRoot = Create<TrieNode> ();
 }
 
 CCNxStandardFib::~CCNxStandardFib ()
@@ -128,6 +140,16 @@ CCNxStandardFib::DoInitialize ()
   m_inputQueue = Create<DelayQueueType> (m_layerDelayServers,
                                          MakeCallback (&CCNxStandardFib::GetServiceTime, this),
                                          MakeCallback (&CCNxStandardFib::DequeueCallback, this));
+
+  if (m_inlineZeroDelay && m_layerDelayConstant.IsZero () && m_layerDelaySlope.IsZero ())
+    {
+      // There is no processing time to model, so skip the timer and service inline
+      m_inputQueue->SetSynchronous (true);
+    }
+  else if (m_layerDelayBatchSize > 1)
+    {
+      m_inputQueue->SetBatchMode (m_layerDelayBatchSize, MakeCallback (&CCNxStandardFib::GetBatchServiceTime, this));
+    }
 }
 
 void
@@ -155,6 +177,7 @@ CCNxStandardFib::RemoveConnection (  Ptr<CCNxConnection>  connection)
         {
           FibType::iterator itlast = it;
           ++it;   //erase invalidates ptr, so must inc it first
+          TrieRemove (itlast->first);
           fib.erase (itlast);
         }
       else
@@ -168,53 +191,106 @@ CCNxStandardFib::RemoveConnection (  Ptr<CCNxConnection>  connection)
 }
 
 
-unsigned
-CCNxStandardFib::PerformLookup (Ptr<CCNxStandardForwarderWorkItem> workItem)
+void
+CCNxStandardFib::TrieInsert (Ptr<const CCNxName> name, Ptr<CCNxStandardFibEntry> entry)
 {
-  unsigned nameCompoentsUsed = 0; //TODO CCN - is nameCompoentsUsed being properly incremented?
-
-  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
-  workItem->SetConnectionsList (egress);
+  Ptr<TrieNode> node = m_trieRoot;
+  for (size_t i = 0; i < name->GetSegmentCount (); i++)
+    {
+      Ptr<TrieNode> &child = node->m_children[name->GetSegment (i)];
+      if (!child)
+        {
+          child = Create<TrieNode> ();
+        }
+      node = child;
+    }
+  node->m_entry = entry;
+}
 
-  Ptr<const CCNxName> ccnxName = workItem->GetPacket ()->GetMessage ()->GetName ();
-  Ptr<CCNxConnection> ingress = workItem->GetIngressConnection ();
+void
+CCNxStandardFib::TrieRemove (Ptr<const CCNxName> name)
+{
+  // Remember the path so we can prune from the bottom up
+  std::vector< Ptr<TrieNode> > path;
+  path.reserve (name->GetSegmentCount () + 1);
 
-  CCNxNameBuilder builder;
+  Ptr<TrieNode> node = m_trieRoot;
+  path.push_back (node);
+  for (size_t i = 0; i < name->GetSegmentCount (); i++)
+    {
+      TrieNode::ChildrenType::iterator it = node->m_children.find (name->GetSegment (i));
+      if (it == node->m_children.end ())
+        {
+          return;
+        }
+      node = it->second;
+      path.push_back (node);
+    }
 
-  FibType::iterator bestMatch = fib.end ();
-  NS_LOG_INFO ( __func__ << " fib size =" << fib.size ());
+  node->m_entry = 0;
 
-  //copy first segment of name to name copy and lookup in fib.
-  //if match, add next name segment and look again until no match or name ends
-  //if no match, try again until end of name
-  int i = 0;
-  while (i < ccnxName->GetSegmentCount () )
+  for (size_t i = name->GetSegmentCount (); i > 0; i--)
     {
-      builder.Append (ccnxName->GetSegment (i));
-      i++;
-      FibType::iterator it = fib.find (builder.CreateName ());
+      Ptr<TrieNode> child = path[i];
+      if (child->m_entry || !child->m_children.empty ())
+        {
+          break;
+        }
+      path[i - 1]->m_children.erase (name->GetSegment (i - 1));
+    }
+}
+
+Ptr<CCNxStandardFibEntry>
+CCNxStandardFib::TrieLongestMatch (Ptr<const CCNxName> name, unsigned &componentsUsed) const
+{
+  componentsUsed = 0;
+
+  // A route on the root prefix (no segments) is not a default route, it never matches
+  const TrieNode *node = PeekPointer (m_trieRoot);
+  Ptr<CCNxStandardFibEntry> bestMatch = Ptr<CCNxStandardFibEntry> (0);
 
-      if ( it != fib.end () )
+  // Walk down the trie until we run out of name or out of trie.  Every node on the
+  // way with an entry is a longer matching prefix than the one before.
+  for (size_t i = 0; i < name->GetSegmentCount (); i++)
+    {
+      componentsUsed++;
+      TrieNode::ChildrenType::const_iterator it = node->m_children.find (name->GetSegment (i));
+      if (it == node->m_children.end ())
         {
-          bestMatch = it;
+          break;
         }
-      else
+      node = PeekPointer (it->second);
+      if (node->m_entry)
         {
-          if (bestMatch != fib.end ())
-            {
-              break;       //name was matching but stopped
-            }
+          bestMatch = node->m_entry;
         }
     }
 
+  return bestMatch;
+}
+
+unsigned
+CCNxStandardFib::PerformLookup (Ptr<CCNxStandardForwarderWorkItem> workItem)
+{
+  unsigned nameComponentsUsed = 0;
+
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  workItem->SetConnectionsList (egress);
+
+  Ptr<const CCNxName> ccnxName = workItem->GetPacket ()->GetMessage ()->GetName ();
+  Ptr<CCNxConnection> ingress = workItem->GetIngressConnection ();
+
+  NS_LOG_INFO ( __func__ << " fib size =" << fib.size ());
+
+  Ptr<CCNxStandardFibEntry> bestMatch = TrieLongestMatch (ccnxName, nameComponentsUsed);
 
-  if (bestMatch == fib.end ())
+  if (!bestMatch)
     {
       NS_LOG_INFO ( __func__ << " No fib match!");
     }
   else         //get vector and translate  into list, removing ingress connection
     {
-      CCNxStandardFibEntry::ConnectionsVecType connectionsVec = bestMatch->second->GetConnections ();
+      CCNxStandardFibEntry::ConnectionsVecType connectionsVec = bestMatch->GetConnections ();
       for (CCNxStandardFibEntry::ConnectionsVecType::iterator it = connectionsVec.begin (); it != connectionsVec.end (); it++)
         {
           Ptr<CCNxConnection> conn = *it;
@@ -225,10 +301,10 @@ CCNxStandardFib::PerformLookup (Ptr<CCNxStandardForwarderWorkItem> workItem)
         }
     }
 
-  NS_LOG_DEBUG ("Lookup match count: " << egress->size ());
+  NS_LOG_DEBUG ("Lookup match count: " << egress->size () << " name components used: " << nameComponentsUsed);
 
   //TODO CCN - if connections is empty, best match was same as ingress, so need to recurse until different connection found or no result
-  return nameCompoentsUsed;
+  return nameComponentsUsed;
 }
 
 /*
@@ -250,6 +326,21 @@ CCNxStandardFib::GetServiceTime (Ptr<CCNxForwarderMessage> message)
   return delay;
 }
 
+/*
+ * GetServiceTime() does the work of each item (the route lookup), so call it for every item
+ * in the batch, but charge the constant delay only once.
+ */
+Time
+CCNxStandardFib::GetBatchServiceTime (const DelayQueueType::BatchType &items)
+{
+  Time delay = m_layerDelayConstant;
+  for (DelayQueueType::BatchType::const_iterator i = items.begin (); i != items.end (); ++i)
+    {
+      delay += GetServiceTime (*i) - m_layerDelayConstant;
+    }
+  return delay;
+}
+
 void
 CCNxStandardFib::DequeueCallback (Ptr<CCNxForwarderMessage> message) //TODO CCN _this is after lookup
 {
@@ -278,6 +369,9 @@ CCNxStandardFib::AddRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  c
 
   std::pair< FibType::iterator, bool > fibRvPair;
 
+  // Routes share the interned copy of the name
+  ccnxName = CCNxNameInternPool::Intern (ccnxName);
+
   //find this name in fib. if already present, it's fibEntry ptr is returned.
   //if not present, a new location is added to the map and a null ptr is returned.
   Ptr<CCNxStandardFibEntry> fibEntry = fib[ccnxName];
@@ -292,9 +386,11 @@ CCNxStandardFib::AddRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  c
     {
       NS_LOG_DEBUG ( __func__ << " adding new route[" << *ccnxName << "] = [" << connection->GetConnectionId () << "]");
 
-      fib[ccnxName] = Create<CCNxStandardFibEntry> ();
+      fibEntry = Create<CCNxStandardFibEntry> ();
+      fibEntry->AddConnection (connection);
 
-      fib[ccnxName]->AddConnection (connection);
+      fib[ccnxName] = fibEntry;
+      TrieInsert (ccnxName, fibEntry);
 
     }
 
@@ -318,6 +414,7 @@ CCNxStandardFib::DeleteRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>
       rvPair = it->second->RemoveConnection (connection);
       if (rvPair.second == 0)          //erase fib entry
         {
+          TrieRemove (ccnxName);
           fib.erase (ccnxName);
         }
       NS_LOG_INFO ( __func__ << " successful.");
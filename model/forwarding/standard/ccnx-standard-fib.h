@@ -76,6 +76,12 @@ namespace ccnx {
  * The CCNx standard Fib class is the top level of the  Fib object hierarchy.
  * CCNx standard fib is derived from `CCNxFib` base class.
  * This fib should work for all implementations but may be replaced if desired.
+ *
+ * Longest prefix match is done on a name trie (one node per name segment) that indexes the
+ * same fib entries as the map.  A lookup walks the trie with the segments of the Interest name,
+ * so it does not build any prefix names, and it returns the longest prefix with a route even
+ * if shorter prefixes have no route.  The number of segments walked is the number of name
+ * components used in the layer delay.
  */
 
 class CCNxStandardFib : public CCNxFib
@@ -98,6 +104,56 @@ protected:
 
   FibType fib;
 
+  /**
+   * A node in the name trie.  The edge to a child is labeled with one name segment.  A node
+   * has a fib entry if the name spelled by the path from the root has a route.
+   */
+  class TrieNode : public SimpleRefCount<TrieNode>
+  {
+public:
+    /**
+     * Orders name segments by type and value in the children map
+     */
+    struct isLessPtrCCNxNameSegment
+    {
+      bool operator() (Ptr<const CCNxNameSegment> a, Ptr<const CCNxNameSegment> b) const
+      {
+        return a->Compare (*b) < 0;
+      }
+    };
+
+    typedef std::map<Ptr<const CCNxNameSegment>, Ptr<TrieNode>, isLessPtrCCNxNameSegment> ChildrenType;
+
+    ChildrenType m_children;
+    Ptr<CCNxStandardFibEntry> m_entry;
+  };
+
+  /**
+   * The root of the name trie.  Its entry (if any) is the route for the 0-segment name.
+   */
+  Ptr<TrieNode> m_trieRoot;
+
+  /**
+   * Put the fib entry for `name` in the name trie, creating nodes as needed.
+   */
+  void TrieInsert (Ptr<const CCNxName> name, Ptr<CCNxStandardFibEntry> entry);
+
+  /**
+   * Remove the fib entry for `name` from the name trie and prune nodes that no
+   * longer lead to an entry.
+   */
+  void TrieRemove (Ptr<const CCNxName> name);
+
+  /**
+   * Longest prefix match of `name` in the name trie.  Only prefixes with at least
+   * one segment match, so a route on the root prefix is never returned.
+   *
+   * @param name [in] The name to look up
+   * @param componentsUsed [out] The number of name segments looked up in the trie
+   * @return The fib entry of the longest matching prefix, or null
+   */
+  Ptr<CCNxStandardFibEntry> TrieLongestMatch (Ptr<const CCNxName> name, unsigned &componentsUsed) const;
+
 public:
   CCNxStandardFib ();
 
@@ -184,6 +240,15 @@ private:
    */
   Time GetServiceTime (Ptr<CCNxForwarderMessage> item);
 
+  /**
+   * Callback from delay queue to compute the service time of a batch of work items
+   * when "LayerDelayBatchSize" is more than 1.  The constant delay is paid once per batch.
+   *
+   * @param items [in] The work items being serviced together
+   * @return The service time of the batch
+   */
+  Time GetBatchServiceTime (const DelayQueueType::BatchType &items);
+
   /**
    * Callback from delay queue after a work item has waited its service time
    *
@@ -217,6 +282,24 @@ private:
    */
   unsigned m_layerDelayServers;
 
+  /**
+   * If true and both m_layerDelayConstant and m_layerDelaySlope are zero, the input queue
+   * services each item before returning instead of scheduling a zero-delay event.
+   *
+   * This value is set via the attribute "InlineZeroDelay".  The default is false.
+   */
+  bool m_inlineZeroDelay;
+
+  /**
+   * The maximum number of work items an input queue server processes together.
+   * A batch pays the layer delay constant once:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * \sum nameComponents\f$
+   *
+   * This value is set via the attribute "LayerDelayBatchSize".  The default is 1 (no batching).
+   */
+  unsigned m_layerDelayBatchSize;
+
 
 };          //class
 }    //namespace
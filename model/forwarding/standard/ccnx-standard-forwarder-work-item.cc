@@ -74,6 +74,30 @@ CCNxStandardForwarderWorkItem::~CCNxStandardForwarderWorkItem ()
   // empty
 }
 
+void *
+CCNxStandardForwarderWorkItem::operator new (size_t size)
+{
+  return CCNxFreeList<CCNxStandardForwarderWorkItem>::Allocate (size);
+}
+
+void
+CCNxStandardForwarderWorkItem::operator delete (void *p, size_t size)
+{
+  CCNxFreeList<CCNxStandardForwarderWorkItem>::Release (p, size);
+}
+
+uint64_t
+CCNxStandardForwarderWorkItem::GetAllocationCount ()
+{
+  return CCNxFreeList<CCNxStandardForwarderWorkItem>::GetAllocationCount ();
+}
+
+uint64_t
+CCNxStandardForwarderWorkItem::GetHeapFallbackCount ()
+{
+  return CCNxFreeList<CCNxStandardForwarderWorkItem>::GetHeapFallbackCount ();
+}
+
 Ptr<CCNxConnection> CCNxStandardForwarderWorkItem::GetEgressConnection () const
 {
   return m_egressConnection;
@@ -58,6 +58,7 @@
 
 #include "ns3/ccnx-forwarder-message.h"
 #include "ns3/ccnx-forwarder.h"
+#include "ns3/ccnx-free-list.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -72,6 +73,9 @@ namespace ccnx {
  * It encapsulates things like the CCNxPacket, and the ingressConnection.
  *
  * This is the class that gets stored in all the `CCNxDelayQueue`s.
+ *
+ * One work item is made for every packet the forwarder routes, so work items are
+ * allocated from a CCNxFreeList rather than the heap.
  */
 class CCNxStandardForwarderWorkItem : public CCNxForwarderMessage
 {
@@ -82,6 +86,19 @@ public:
 
   virtual ~CCNxStandardForwarderWorkItem ();
 
+  static void *operator new (size_t size);
+  static void operator delete (void *p, size_t size);
+
+  /**
+   * @return The number of work items made
+   */
+  static uint64_t GetAllocationCount ();
+
+  /**
+   * @return The number of work items that were allocated from the heap because the
+   *         free list was empty
+   */
+  static uint64_t GetHeapFallbackCount ();
 
 
   Ptr<CCNxConnection> GetEgressConnection () const;
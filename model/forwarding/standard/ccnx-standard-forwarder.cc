@@ -70,6 +70,7 @@
 #include "ns3/ccnx-standard-fib-factory.h"
 
 #include "ns3/integer.h"
+#include "ns3/boolean.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -79,7 +80,9 @@ NS_OBJECT_ENSURE_REGISTERED (CCNxStandardForwarder);
 
 static const Time _defaultLayerDelayConstant = MicroSeconds (1);
 static const Time _defaultLayerDelaySlope = Seconds (0);
-static unsigned _defaultLayerDelayServers = 1;
+static const unsigned _defaultLayerDelayServers = 1;
+static const bool _defaultInlineZeroDelay = false;
+static const unsigned _defaultLayerDelayBatchSize = 1;
 
 static ObjectFactory
 GetDefaultPitFactory ()
@@ -135,6 +138,14 @@ CCNxStandardForwarder::GetTypeId ()
                    IntegerValue (_defaultLayerDelayServers),
                    MakeIntegerAccessor (&CCNxStandardForwarder::m_layerDelayServers),
                    MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("InlineZeroDelay", "If true and both layer delays are zero, service the input queue inline",
+                   BooleanValue (_defaultInlineZeroDelay),
+                   MakeBooleanAccessor (&CCNxStandardForwarder::m_inlineZeroDelay),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LayerDelayBatchSize", "The maximum number of packets a layer delay server processes together",
+                   IntegerValue (_defaultLayerDelayBatchSize),
+                   MakeIntegerAccessor (&CCNxStandardForwarder::m_layerDelayBatchSize),
+                   MakeIntegerChecker<unsigned> (1))
   ;
   return tid;
 }
@@ -144,7 +155,8 @@ CCNxStandardForwarder::CCNxStandardForwarder ()
   : m_pitFactory (GetDefaultPitFactory ()), m_fibFactory (GetDefaultFibFactory ()),
     m_contentStoreFactory (GetDefaultContentStoreFactory ()),
   m_layerDelayConstant (_defaultLayerDelayConstant), m_layerDelaySlope (_defaultLayerDelaySlope),
-  m_layerDelayServers (_defaultLayerDelayServers)
+  m_layerDelayServers (_defaultLayerDelayServers), m_inlineZeroDelay (_defaultInlineZeroDelay),
+  m_layerDelayBatchSize (_defaultLayerDelayBatchSize)
 {
   memset(&m_forwarderStats, 0, sizeof(m_forwarderStats));
 }
@@ -188,6 +200,17 @@ CCNxStandardForwarder::DoInitialize (void)
   m_inputQueue = Create<DelayQueueType> (m_layerDelayServers,
                                          MakeCallback (&CCNxStandardForwarder::GetServiceTime, this),
                                          MakeCallback (&CCNxStandardForwarder::ServiceInputQueue, this));
+  if (m_inlineZeroDelay && m_layerDelayConstant.IsZero () && m_layerDelaySlope.IsZero ())
+    {
+      // There is no processing time to model, so skip the timer and service inline.  If the
+      // PIT, content store, and FIB are also set up this way, a packet goes through the whole
+      // pipeline in one call chain.
+      m_inputQueue->SetSynchronous (true);
+    }
+  else if (m_layerDelayBatchSize > 1)
+    {
+      m_inputQueue->SetBatchMode (m_layerDelayBatchSize, MakeCallback (&CCNxStandardForwarder::GetBatchServiceTime, this));
+    }
 }
 
 Time
@@ -197,6 +220,18 @@ CCNxStandardForwarder::GetServiceTime (Ptr<CCNxStandardForwarderWorkItem> item)
   return delay;
 }
 
+Time
+CCNxStandardForwarder::GetBatchServiceTime (const DelayQueueType::BatchType &items)
+{
+  uint64_t bytes = 0;
+  for (DelayQueueType::BatchType::const_iterator i = items.begin (); i != items.end (); ++i)
+    {
+      bytes += (*i)->GetPacket ()->GetFixedHeader ()->GetPacketLength ();
+    }
+  Time delay = m_layerDelayConstant + m_layerDelaySlope * bytes;
+  return delay;
+}
+
 /*
  * Called after the input queue delay from RouteInput() and RouteOutput().
  *
@@ -298,6 +333,23 @@ CCNxStandardForwarder::RouteOutput (Ptr<CCNxPacket> packet,
   m_inputQueue->push_back (item);
 }
 
+void
+CCNxStandardForwarder::RouteOutputBatch (const PacketBatchType &packets,
+                                         Ptr<CCNxConnection> ingressConnection,
+                                         Ptr<CCNxConnection> egressConnection)
+{
+  NS_LOG_FUNCTION (this << packets.size () << ingressConnection);
+  m_forwarderStats.RouteOutputPacketsIn += packets.size ();
+
+  DelayQueueType::BatchType items;
+  items.reserve (packets.size ());
+  for (PacketBatchType::const_iterator i = packets.begin (); i != packets.end (); ++i)
+    {
+      items.push_back (Create<CCNxStandardForwarderWorkItem> (*i, ingressConnection, egressConnection));
+    }
+  m_inputQueue->push_back (items);
+}
+
 void
 CCNxStandardForwarder::RouteInput (Ptr<CCNxPacket> packet,
                                    Ptr<CCNxConnection> ingressConnection)
@@ -622,7 +674,27 @@ CCNxStandardForwarder::PrintForwardingStatistics (Ptr<OutputStreamWrapper> strea
   *stream << " ToContentStore " << m_forwarderStats.contentObjectsToContentStore;
   *stream << " Added " << m_forwarderStats.contentObjectsAddedToContentStore;
   *stream << " NotAdded " << m_forwarderStats.contentObjectsNotAddedToContentStore << std::endl;
+}
 
+/*
+ * Example output:
+ * (time)   all StandardForwarder      Pools process-wide WorkItems 1200 WorkItemHeap 64 ConnectionLists 900 ConnectionListHeap 3
+ */
+void
+CCNxStandardForwarder::PrintPoolStatistics (Ptr<OutputStreamWrapper> streamWrapper)
+{
+  std::ostream *stream = streamWrapper->GetStream ();
+  ns3::LogTimePrinter timePrinter = ns3::LogGetTimePrinter ();
+
+  *stream << std::right;
+
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << "all" << std::setw (0) << " StandardForwarder ";
+  *stream << std::setw(10) << "Pools" << std::setw(0) << " process-wide";
+  *stream << " WorkItems " << CCNxStandardForwarderWorkItem::GetAllocationCount ();
+  *stream << " WorkItemHeap " << CCNxStandardForwarderWorkItem::GetHeapFallbackCount ();
+  *stream << " ConnectionLists " << CCNxConnectionList::GetAllocationCount ();
+  *stream << " ConnectionListHeap " << CCNxConnectionList::GetHeapFallbackCount () << std::endl;
 }
 
 // ================
@@ -102,6 +102,16 @@ public:
                             Ptr<CCNxConnection> ingressConnection,
                             Ptr<CCNxConnection> egressConnection);
 
+  /**
+   * Enqueues all the packets in the input queue in one call, so with batch service
+   * (attribute "LayerDelayBatchSize") they are gathered in to as few batches as possible.
+   *
+   * @copydoc CCNxForwarder::RouteOutputBatch()
+   */
+  virtual void RouteOutputBatch (const PacketBatchType &packets,
+                                 Ptr<CCNxConnection> ingressConnection,
+                                 Ptr<CCNxConnection> egressConnection);
+
   /**
    * @copydoc CCNxForwarder::RouteInput()
    */
@@ -137,6 +147,15 @@ public:
    */
   virtual void PrintForwardingStatistics (Ptr<OutputStreamWrapper> stream) const;
 
+  /**
+   * Prints the allocation counts of the work item and connection list pools.  The pools are
+   * process-wide, shared by every forwarder in the simulation, so they are printed once here
+   * rather than in each forwarder's PrintForwardingStatistics().
+   *
+   * @param [in] stream The stream to write to
+   */
+  static void PrintPoolStatistics (Ptr<OutputStreamWrapper> stream);
+
   /**
    * Types of tables to count entries in
    */
@@ -300,6 +319,15 @@ private:
    */
   Time GetServiceTime (Ptr<CCNxStandardForwarderWorkItem> item);
 
+  /**
+   * Callback from delay queue to compute the service time of a batch of work items
+   * when "LayerDelayBatchSize" is more than 1.  The constant delay is paid once per batch.
+   *
+   * @param items [in] The work items being serviced together
+   * @return The service time of the batch
+   */
+  Time GetBatchServiceTime (const DelayQueueType::BatchType &items);
+
   /**
    * Callback from delay queue after a work item has waited its service time
    *
@@ -335,6 +363,23 @@ private:
    */
   unsigned m_layerDelayServers;
 
+  /**
+   * If true and both m_layerDelayConstant and m_layerDelaySlope are zero, the input queue
+   * services each item before returning instead of scheduling a zero-delay event.
+   *
+   * This value is set via the attribute "InlineZeroDelay".  The default is false.
+   */
+  bool m_inlineZeroDelay;
+
+  /**
+   * The maximum number of work items an input queue server processes together.
+   * A batch pays the layer delay constant once:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * \sum packetBytes\f$
+   *
+   * This value is set via the attribute "LayerDelayBatchSize".  The default is 1 (no batching).
+   */
+  unsigned m_layerDelayBatchSize;
 
   /**
    * Asynchronous callback from the Content Store after servicing a MatchInterest call.
@@ -56,6 +56,7 @@
 #include "ccnx-standard-pit-factory.h"
 #include "ns3/ccnx-standard-pit.h"
 #include "ns3/integer.h"
+#include "ns3/boolean.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -104,3 +105,15 @@ CCNxStandardPitFactory::SetLayerDelayServers (unsigned serverCount)
 {
   Set ("LayerDelayServers", IntegerValue (serverCount));
 }
+
+void
+CCNxStandardPitFactory::SetInlineZeroDelay (bool inlineZeroDelay)
+{
+  Set ("InlineZeroDelay", BooleanValue (inlineZeroDelay));
+}
+
+void
+CCNxStandardPitFactory::SetLayerDelayBatchSize (unsigned batchSize)
+{
+  Set ("LayerDelayBatchSize", IntegerValue (batchSize));
+}
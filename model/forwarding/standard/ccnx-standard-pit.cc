@@ -59,7 +59,9 @@
 #include "ns3/ptr.h"
 #include "ns3/object.h"
 #include "ns3/integer.h"
+#include "ns3/boolean.h"
 #include "ns3/ccnx-interestlifetime.h"
+#include "ns3/ccnx-name-intern-pool.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -71,7 +73,10 @@ static const Time _defaultLifetime = Seconds (0.2f);  //default interest lifetim
 
 static const Time _defaultLayerDelayConstant = MicroSeconds (1);
 static const Time _defaultLayerDelaySlope = NanoSeconds (1);
-static unsigned _defaultLayerDelayServers = 1;
+static const unsigned _defaultLayerDelayServers = 1;
+static const bool _defaultInlineZeroDelay = false;
+static const unsigned _defaultLayerDelayBatchSize = 1;
+static const Time _defaultExpiryTick = MilliSeconds (10);
 
 /**
  * Used as a default callback for m_recieveInterestCallback in case the user does not set it.
@@ -114,18 +119,37 @@ CCNxStandardPit::GetTypeId (void)
                    IntegerValue (_defaultLayerDelayServers),
                    MakeIntegerAccessor (&CCNxStandardPit::m_layerDelayServers),
                    MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("InlineZeroDelay", "If true and both layer delays are zero, service the input queue inline",
+                   BooleanValue (_defaultInlineZeroDelay),
+                   MakeBooleanAccessor (&CCNxStandardPit::m_inlineZeroDelay),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LayerDelayBatchSize", "The maximum number of packets a layer delay server processes together",
+                   IntegerValue (_defaultLayerDelayBatchSize),
+                   MakeIntegerAccessor (&CCNxStandardPit::m_layerDelayBatchSize),
+                   MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("ExpiryTick", "The resolution of the timing wheel that removes expired entries",
+                   TimeValue (_defaultExpiryTick),
+                   MakeTimeAccessor (&CCNxStandardPit::m_expiryTick),
+                   MakeTimeChecker ())
+    .AddTraceSource ("Expire",
+                     "A PIT entry was removed because its lifetime expired.",
+                     MakeTraceSourceAccessor (&CCNxStandardPit::m_expireTrace),
+                     "ns3::ccnx::CCNxStandardPit::ExpireTracedCallback")
   ;
 
   return tid;
 }
 
 
-CCNxStandardPit::CCNxStandardPit () : m_defaultLifetime (_defaultLifetime),
+CCNxStandardPit::CCNxStandardPit () : m_expiryTick (_defaultExpiryTick),
+  m_defaultLifetime (_defaultLifetime),
   m_receiveInterestCallback (MakeCallback (&NullReceiveInterestCallback)),
   m_satisfyInterestCallback (MakeCallback (&NullSatisfyInterestCallback)),
   m_layerDelayConstant (_defaultLayerDelayConstant),
   m_layerDelaySlope (_defaultLayerDelaySlope),
-  m_layerDelayServers (_defaultLayerDelayServers)
+  m_layerDelayServers (_defaultLayerDelayServers),
+  m_inlineZeroDelay (_defaultInlineZeroDelay),
+  m_layerDelayBatchSize (_defaultLayerDelayBatchSize)
 {
   NS_LOG_DEBUG ("at end of ctor, m_defaultLifetime =" << m_defaultLifetime.As(Time::MS));
 }
@@ -140,6 +164,32 @@ CCNxStandardPit::DoInitialize ()
   m_inputQueue = Create<DelayQueueType> (m_layerDelayServers,
                                          MakeCallback (&CCNxStandardPit::GetServiceTime, this),
                                          MakeCallback (&CCNxStandardPit::ServiceInputQueue, this));
+
+  if (m_inlineZeroDelay && m_layerDelayConstant.IsZero () && m_layerDelaySlope.IsZero ())
+    {
+      // There is no processing time to model, so skip the timer and service inline
+      m_inputQueue->SetSynchronous (true);
+    }
+  else if (m_layerDelayBatchSize > 1)
+    {
+      m_inputQueue->SetBatchMode (m_layerDelayBatchSize, MakeCallback (&CCNxStandardPit::GetBatchServiceTime, this));
+    }
+
+  m_expiryWheel = Create< CCNxTimingWheel<ExpiryRecord> > (m_expiryTick, MakeCallback (&CCNxStandardPit::ExpireEntry, this));
+}
+
+void
+CCNxStandardPit::DoDispose ()
+{
+  if (m_expiryWheel)
+    {
+      m_expiryWheel->Clear ();
+    }
+  m_expiryWheel = 0;
+  m_tableByName.clear ();
+  m_tableByNameAndKeyId.clear ();
+  m_tableByHash.clear ();
+  CCNxPit::DoDispose ();
 }
 
 void
@@ -178,6 +228,20 @@ CCNxStandardPit::GetServiceTime (Ptr<CCNxForwarderMessage> item)
   return delay;
 }
 
+/*
+ * The constant delay is paid once per batch, the slope for every item in it.
+ */
+Time
+CCNxStandardPit::GetBatchServiceTime (const DelayQueueType::BatchType &items)
+{
+  Time delay = m_layerDelayConstant;
+  for (DelayQueueType::BatchType::const_iterator i = items.begin (); i != items.end (); ++i)
+    {
+      delay += GetServiceTime (*i) - m_layerDelayConstant;
+    }
+  return delay;
+}
+
 /**
  * Callback from delay queue after a work item has waited its service time
  *
@@ -210,16 +274,12 @@ Time
 CCNxStandardPit::CalculateInterestExpiryTime(Ptr<CCNxPacket> interestPacket)
 {
 
-  Ptr<CCNxPerHopHeader> perHopHeader = interestPacket->GetPerhopHeaders();
-  for (size_t i=0;i<perHopHeader->size();i++)
+  Ptr<CCNxPerHopHeaderEntry> entry = interestPacket->GetPerhopHeaders()->GetHeaderByType(CCNxInterestLifetime::GetTLVType());
+  if (entry)
     {
-      Ptr<CCNxPerHopHeaderEntry> entry = perHopHeader->GetHeader(i);
-      if (entry->GetInstanceTLVType() == 1) //TODO - why aren't we using an enum for TLV types?
-	{
-	  Ptr<CCNxInterestLifetime> lifetime = DynamicCast<CCNxInterestLifetime,CCNxPerHopHeaderEntry >(entry);
-	  Time expiryTime(lifetime->GetInterestLifetime()->getTime());
-	  return(expiryTime+Simulator::Now());
-	}
+      Ptr<CCNxInterestLifetime> lifetime = StaticCast<CCNxInterestLifetime,CCNxPerHopHeaderEntry >(entry);
+      Time expiryTime(lifetime->GetInterestLifetime()->getTime());
+      return(expiryTime+Simulator::Now());
     }
   return(_defaultLifetime + Simulator::Now()); // If no InterestLifetime header use default lifetime
 
@@ -239,15 +299,21 @@ CCNxStandardPit::ServiceReceiveInterest (Ptr<CCNxForwarderMessage> item)
   NS_LOG_DEBUG("ServiceReceiveInterest for " << item->GetPacket()->GetMessage()->GetName());
 
   Ptr<CCNxStandardPitEntry> pitEntry = LookupPitEntry(interest);
+  bool isNewEntry = false;
 
   if ( !pitEntry ) {
       pitEntry = AddPitEntry(interest);
       NS_ASSERT_MSG ( (pitEntry), "Failed to add a PIT entry");
+      isNewEntry = true;
   }
 
   Time interestExpiryTime = CalculateInterestExpiryTime(item->GetPacket());
   CCNxPit::Verdict verdict = pitEntry->ReceiveInterest(interest, item->GetIngressConnection(), interestExpiryTime);
 
+  if (isNewEntry) {
+      ScheduleExpiry (pitEntry, interest);
+  }
+
   NS_LOG_DEBUG ("at end of ReceiveInterest - name,hash pit sizes =[" << m_tableByName.size () << "," << m_tableByHash.size () << "]");
   NS_LOG_DEBUG ("and the interestExpiryTime=" << interestExpiryTime.As(Time::MS) );
 
@@ -291,8 +357,8 @@ CCNxStandardPit::ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item)
   }
 
   {
-    Ptr<CCNxHashValue> hash = Create<CCNxHashValue>(item->GetPacket()->GetContentObjectHash()->GetValue());
-    Ptr<CCNxStandardPitEntry> entry = LookupPitEntryByHash (hash);
+    Ptr<CCNxHashValue> hash = item->GetPacket()->GetContentObjectHash();
+    Ptr<CCNxStandardPitEntry> entry = hash ? LookupPitEntryByHash (hash) : Ptr<CCNxStandardPitEntry> (0);
     if (entry) {
         CCNxStandardPitEntry::ReverseRouteType aSet = entry->SatisfyInterest(item->GetIngressConnection());
         // because it's a set, this insert will make a union
@@ -441,7 +507,7 @@ Ptr<CCNxStandardPitEntry>
 CCNxStandardPit::AddPitEntryByName(Ptr<CCNxInterest> interest)
 {
   Ptr<CCNxStandardPitEntry> entry = Create<CCNxStandardPitEntry>();
-  Ptr<const CCNxName> key = interest->GetName();
+  Ptr<const CCNxName> key = CCNxNameInternPool::Intern (interest->GetName());
   m_tableByName[key] = entry;
   return entry;
 }
@@ -484,13 +550,65 @@ CCNxStandardPit::RemovePitEntryByName(Ptr<const CCNxName> name)
 // ==============
 
 /**
- * Removes all Pit entries that corresponds to the given Interest
+ * Removes the Pit entry that corresponds to the given Interest.  The entry's
+ * record in the expiry wheel is discarded when it comes due.
  */
 void
 CCNxStandardPit::RemoveEntry (Ptr<CCNxInterest> interest)
 {
-//TODO CCN write RemoveEntry function
+  if (interest->HasHashRestriction ()) {
+      RemovePitEntryByHash (interest->GetHashRestriction ());
+  } else if (interest->GetName ()) {
+      RemovePitEntryByName (interest->GetName ());
+  }
+}
+
+// ============== EXPIRY
+
+void
+CCNxStandardPit::ScheduleExpiry (Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxInterest> interest)
+{
+  // Mirrors AddPitEntry() for which table the entry is in
+  ExpiryRecord record;
+  record.m_entry = entry;
+  if (interest->HasHashRestriction ()) {
+      record.m_hashRestriction = interest->GetHashRestriction ();
+  } else {
+      record.m_name = interest->GetName ();
+  }
+
+  m_expiryWheel->Insert (entry->GetExpiryTime (), record);
+}
+
+void
+CCNxStandardPit::ExpireEntry (ExpiryRecord record)
+{
+  Ptr<CCNxStandardPitEntry> current;
+  if (record.m_hashRestriction) {
+      current = LookupPitEntryByHash (record.m_hashRestriction);
+  } else {
+      current = LookupPitEntryByName (record.m_name);
+  }
+
+  if (current != record.m_entry) {
+      // The entry was satisfied or replaced, nothing to do
+      return;
+  }
+
+  if (!current->isExpired ()) {
+      // The lifetime was extended by a later Interest
+      m_expiryWheel->Insert (current->GetExpiryTime (), record);
+      return;
+  }
+
+  if (record.m_hashRestriction) {
+      RemovePitEntryByHash (record.m_hashRestriction);
+  } else {
+      RemovePitEntryByName (record.m_name);
+  }
 
+  NS_LOG_DEBUG ("Expired PIT entry removed, pit size = " << CountEntries ());
+  m_expireTrace (record.m_name, record.m_hashRestriction);
 }
 
 int
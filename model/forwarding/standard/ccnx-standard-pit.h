@@ -59,8 +59,10 @@
 #include "ns3/ccnx-pit.h"
 
 #include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
 #include "ccnx-standard-pitEntry.h"
 #include "ns3/ccnx-delay-queue.h"
+#include "ns3/ccnx-timing-wheel.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -94,6 +96,12 @@ namespace ccnx {
  * Expiration: When an interest is added, it's expiryTime is set = Now()+InterestTimeout. This interest is discarded
  * when a related interest or contentObject is being processed  if Now > expiryTime.
  *
+ * Expired entries are also swept out of the tables by a `CCNxTimingWheel` with a resolution of
+ * the attribute "ExpiryTick" (default 10 msec).  Each new PIT entry puts one record in the wheel.
+ * When the record comes due, the entry is removed if it is still expired (and the "Expire" trace
+ * source fires) or the record is re-inserted at the entry's extended expiry time.  The wheel uses
+ * one ns-3 event per busy tick, not one per Interest.
+ *
  * There are three primary methods (see  @see Parent::Method for detailed description):
  *      ReceiveInterest, which processes a new interest and returns a verdict on whether it should be forwarded.
  *	SatisfyInterest, which processes a new content and returns a list of connector ids to which it should be forwarded.
@@ -202,6 +210,14 @@ public:
    */
   friend std::ostream &operator<< (std::ostream& os, Ptr<CCNxStandardPit> ccnxStandardPit);
 
+  /**
+   * TracedCallback signature for PIT entries removed by the expiry timing wheel.
+   *
+   * @param [in] name The name of the expired entry (null if the entry was in the hash table)
+   * @param [in] hashRestriction The hash restriction of the expired entry (null if the entry was in the name table)
+   */
+  typedef void (* ExpireTracedCallback) (Ptr<const CCNxName> name, Ptr<const CCNxHashValue> hashRestriction);
+
 protected:
 
   /**
@@ -209,6 +225,11 @@ protected:
    */
   virtual void DoInitialize ();
 
+  /**
+   * DoDispose - called in Object Dispose()
+   */
+  virtual void DoDispose ();
+
 
 private:
 
@@ -345,6 +366,50 @@ private:
    */
   void ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item);
 
+  /**
+   * The item stored in the expiry timing wheel.  It has the table key of the
+   * entry, so the entry can be found and removed, and the entry itself to detect that
+   * the entry was satisfied (and maybe re-created) before the record came due.
+   */
+  struct ExpiryRecord
+  {
+    Ptr<CCNxStandardPitEntry> m_entry;
+    Ptr<const CCNxName> m_name;           //<! non-null if the entry is in m_tableByName
+    Ptr<CCNxHashValue> m_hashRestriction; //<! non-null if the entry is in m_tableByHash
+  };
+
+  /**
+   * Put an expiry record in the timing wheel for a new PIT entry.
+   *
+   * @param entry [in] The new entry, already primed with an expiry time
+   * @param interest [in] The interest that created the entry (gives the table key)
+   */
+  void ScheduleExpiry (Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxInterest> interest);
+
+  /**
+   * Callback from the expiry timing wheel.  Removes the entry if it is still in the
+   * table and expired, or re-inserts the record if the entry's expiry time was extended.
+   *
+   * @param record [in] The due record
+   */
+  void ExpireEntry (ExpiryRecord record);
+
+  /**
+   * The timing wheel for expired entries
+   */
+  Ptr< CCNxTimingWheel<ExpiryRecord> > m_expiryWheel;
+
+  /**
+   * The resolution of the expiry timing wheel, set via the attribute "ExpiryTick".
+   * The default is 10 msec.
+   */
+  Time m_expiryTick;
+
+  /**
+   * Trace source for entries removed by the expiry timing wheel
+   */
+  TracedCallback<Ptr<const CCNxName>, Ptr<const CCNxHashValue> > m_expireTrace;
+
 
    //Map Names to PitEntrys
   PitByNameType m_tableByName;
@@ -389,6 +454,15 @@ private:
    */
   Time GetServiceTime (Ptr<CCNxForwarderMessage> item);
 
+  /**
+   * Callback from delay queue to compute the service time of a batch of work items
+   * when "LayerDelayBatchSize" is more than 1.  The constant delay is paid once per batch.
+   *
+   * @param items [in] The work items being serviced together
+   * @return The service time of the batch
+   */
+  Time GetBatchServiceTime (const DelayQueueType::BatchType &items);
+
   /**
    * Callback from delay queue after a work item has waited its service time
    *
@@ -421,6 +495,24 @@ private:
    * This value is set via the attribute "LayerDelayServers".  The default is 1.
    */
   unsigned m_layerDelayServers;
+
+  /**
+   * If true and both m_layerDelayConstant and m_layerDelaySlope are zero, the input queue
+   * services each item before returning instead of scheduling a zero-delay event.
+   *
+   * This value is set via the attribute "InlineZeroDelay".  The default is false.
+   */
+  bool m_inlineZeroDelay;
+
+  /**
+   * The maximum number of work items an input queue server processes together.
+   * A batch pays the layer delay constant once:
+   *
+   * \f$time = m\_layerDelayConstant + m\_layerDelaySlope * \sum nameBytes\f$
+   *
+   * This value is set via the attribute "LayerDelayBatchSize".  The default is 1 (no batching).
+   */
+  unsigned m_layerDelayBatchSize;
 };
 
 }
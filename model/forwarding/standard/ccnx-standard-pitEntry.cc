@@ -92,6 +92,12 @@ CCNxStandardPitEntry::isExpired() const
   return isExpired;
 }
 
+Time
+CCNxStandardPitEntry::GetExpiryTime () const
+{
+  return m_expiryTime;
+}
+
 CCNxPit::Verdict
 CCNxStandardPitEntry::ReceiveInterest (Ptr<CCNxInterest> interest, Ptr<CCNxConnection> ingress, Time expiryTime)
 {
@@ -144,6 +144,14 @@ public:
    */
   bool isExpired() const;
 
+  /**
+   * The time at which the PitEntry expires.  Used by the PIT to schedule removal
+   * of expired entries.
+   *
+   * @return The current expiry time (negative if the entry has never been primed)
+   */
+  Time GetExpiryTime () const;
+
   /*
    *  Two methods to display this pit entry
    */
@@ -89,15 +89,29 @@ CCNxContentObject::CCNxContentObject ( Ptr<const CCNxName> name)
   // empty
 }
 
+CCNxContentObject::CCNxContentObject (Ptr<CCNxMessageFieldDecoder> decoder)
+  : CCNxMessage (decoder), m_payloadType (CCNxContentObjectPayloadType_Data), m_expiryTime (0)
+{
+  // empty
+}
+
 Ptr<CCNxTime>
 CCNxContentObject::GetExpiryTime () const
 {
+  if (NeedsDecode (CCNxMessageFieldDecoder::ExpiryTime))
+    {
+      m_expiryTime = Create<CCNxTime> (m_decoder->DecodeNumber (CCNxMessageFieldDecoder::ExpiryTime));
+    }
   return m_expiryTime;
 }
 
 CCNxContentObjectPayloadType
 CCNxContentObject::GetPayloadType () const
 {
+  if (NeedsDecode (CCNxMessageFieldDecoder::PayloadType))
+    {
+      m_payloadType = (CCNxContentObjectPayloadType) m_decoder->DecodeNumber (CCNxMessageFieldDecoder::PayloadType);
+    }
   return m_payloadType;
 }
 
@@ -118,10 +132,10 @@ bool
 CCNxContentObject::Equals (CCNxContentObject const &other) const
 {
   bool result = false;
-  if (m_payload->Equals (*other.m_payload)
-      && m_name->Equals (*other.m_name)
-      && m_expiryTime->Equals (*other.m_expiryTime)
-      && m_payloadType == other.m_payloadType)
+  if (GetPayload ()->Equals (*other.GetPayload ())
+      && GetName ()->Equals (*other.GetName ())
+      && GetExpiryTime ()->Equals (*other.GetExpiryTime ())
+      && GetPayloadType () == other.GetPayloadType ())
     {
       result = true;
     }
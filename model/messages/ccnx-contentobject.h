@@ -109,6 +109,12 @@ public:
    */
   CCNxContentObject (Ptr<const CCNxName> name);
 
+  /**
+   * Create a Content Object whose fields are decoded on first access.  Used by
+   * CCNxCodecContentObject in lazy decode mode.
+   */
+  CCNxContentObject (Ptr<CCNxMessageFieldDecoder> decoder);
+
   /**
    * Returns the expiry time associated with the payload of this Content Object.
    *
@@ -162,8 +168,8 @@ public:
   friend std::ostream &operator<< (std::ostream &os, CCNxContentObject const &content);
 
 protected:
-  CCNxContentObjectPayloadType m_payloadType;
-  Ptr<CCNxTime>   m_expiryTime;
+  mutable CCNxContentObjectPayloadType m_payloadType;
+  mutable Ptr<CCNxTime>   m_expiryTime;
 };
 
 }
@@ -60,7 +60,7 @@ using namespace ns3::ccnx;
 CCNxFixedHeader::CCNxFixedHeader (uint8_t ver, CCNxFixedHeaderType packetType, uint16_t packetLength,
                                   uint8_t hopLimit, uint8_t returnCode, uint8_t headerLength) :
   m_version (ver), m_packetType (packetType), m_packetLength (packetLength),
-  m_hopLimit (hopLimit), m_returnCode (returnCode), m_headerLength (headerLength)
+  m_hopLimit (hopLimit), m_returnCode (returnCode), m_headerLength (headerLength), m_generation (0)
 {
 }
 
@@ -104,18 +104,27 @@ void
 CCNxFixedHeader::SetPacketLength (uint16_t length)
 {
   m_packetLength = length;
+  m_generation++;
 }
 
 void
 CCNxFixedHeader::SetHeaderLength (uint16_t length)
 {
   m_headerLength = length;
+  m_generation++;
 }
 
 void
 CCNxFixedHeader::SetHopLimit (uint8_t limit)
 {
   m_hopLimit = limit;
+  m_generation++;
+}
+
+uint32_t
+CCNxFixedHeader::GetGeneration () const
+{
+  return m_generation;
 }
 
 bool
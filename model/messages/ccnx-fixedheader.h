@@ -163,6 +163,12 @@ public:
    */
   void SetHopLimit (uint8_t limit);
 
+  /**
+   * A counter that changes every time a field is set.  Used by CCNxPacket to know if
+   * its cached wire format is still current.
+   */
+  uint32_t GetGeneration () const;
+
   /**
    * Determines if two FixedHeaders are equal.  All fields must be identical.
    */
@@ -195,6 +201,7 @@ protected:
   uint8_t m_hopLimit;
   uint8_t m_returnCode;
   uint8_t m_headerLength;
+  uint32_t m_generation;
 };
 std::ostream & operator << (std::ostream & os, CCNxFixedHeader const & header);
 
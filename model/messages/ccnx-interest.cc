@@ -89,22 +89,36 @@ CCNxInterest::CCNxInterest (Ptr<const CCNxName> name)
   // empty
 }
 
+CCNxInterest::CCNxInterest (Ptr<CCNxMessageFieldDecoder> decoder)
+  : CCNxMessage (decoder), m_keyidRestriction (0), m_hashRestriction (0)
+{
+  // empty
+}
+
 Ptr<CCNxHashValue>
 CCNxInterest::GetKeyidRestriction () const
 {
+  if (NeedsDecode (CCNxMessageFieldDecoder::KeyIdRestriction))
+    {
+      m_keyidRestriction = Create<CCNxHashValue> (m_decoder->DecodeNumber (CCNxMessageFieldDecoder::KeyIdRestriction));
+    }
   return m_keyidRestriction;
 }
 
 Ptr<CCNxHashValue>
 CCNxInterest::GetHashRestriction () const
 {
+  if (NeedsDecode (CCNxMessageFieldDecoder::HashRestriction))
+    {
+      m_hashRestriction = Create<CCNxHashValue> (m_decoder->DecodeNumber (CCNxMessageFieldDecoder::HashRestriction));
+    }
   return m_hashRestriction;
 }
 
 bool
 CCNxInterest::HasKeyidRestriction () const
 {
-  if (m_keyidRestriction == 0)
+  if (GetKeyidRestriction () == 0)
     {
       return false;
     }
@@ -117,7 +131,7 @@ CCNxInterest::HasKeyidRestriction () const
 bool
 CCNxInterest::HasHashRestriction () const
 {
-  if (m_hashRestriction == 0)
+  if (GetHashRestriction () == 0)
     {
       return false;
     }
@@ -144,10 +158,10 @@ bool
 CCNxInterest::Equals (CCNxInterest const &other) const
 {
   bool result = false;
-  if (m_payload->Equals (*other.m_payload)
-      && *m_keyidRestriction == *other.m_keyidRestriction
-      && *m_hashRestriction == *other.m_hashRestriction
-      && m_name->Equals (*other.m_name) )
+  if (GetPayload ()->Equals (*other.GetPayload ())
+      && *GetKeyidRestriction () == *other.GetKeyidRestriction ()
+      && *GetHashRestriction () == *other.GetHashRestriction ()
+      && GetName ()->Equals (*other.GetName ()) )
     {
       result = true;
     }
@@ -107,6 +107,12 @@ public:
    */
   CCNxInterest (Ptr<const CCNxName> name);
 
+  /**
+   * Create an Interest whose fields are decoded on first access.  Used by
+   * CCNxCodecInterest in lazy decode mode.
+   */
+  CCNxInterest (Ptr<CCNxMessageFieldDecoder> decoder);
+
   /**
    * Returns the KeyId Restriction associated with this Interest.
    *
@@ -176,8 +182,8 @@ public:
   friend std::ostream &operator<< (std::ostream &os, CCNxInterest const &interest);
 
 protected:
-  Ptr<CCNxHashValue> m_keyidRestriction;
-  Ptr<CCNxHashValue> m_hashRestriction;
+  mutable Ptr<CCNxHashValue> m_keyidRestriction;
+  mutable Ptr<CCNxHashValue> m_hashRestriction;
 };
 
 } // namespace ccnx
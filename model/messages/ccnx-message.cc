@@ -69,20 +69,31 @@ CCNxMessage::GetTypeId (void)
   return tid;
 }
 
+CCNxMessageFieldDecoder::~CCNxMessageFieldDecoder ()
+{
+  // empty
+}
+
 CCNxMessage::CCNxMessage (Ptr<const CCNxName> name) :
-  m_name (name), m_payload (Ptr<CCNxBuffer> (0)), m_virtualPayloadLength (0)
+  m_name (name), m_payload (Ptr<CCNxBuffer> (0)), m_virtualPayloadLength (0), m_decodedFields (0)
 {
 
 }
 
 CCNxMessage::CCNxMessage (Ptr<const CCNxName> name, Ptr<CCNxBuffer> payload) :
-  m_name (name), m_payload (payload), m_virtualPayloadLength (0)
+  m_name (name), m_payload (payload), m_virtualPayloadLength (0), m_decodedFields (0)
+{
+  // empty
+}
+
+CCNxMessage::CCNxMessage (Ptr<CCNxMessageFieldDecoder> decoder) :
+  m_name (0), m_payload (0), m_virtualPayloadLength (0), m_decoder (decoder), m_decodedFields (0)
 {
   // empty
 }
 
 CCNxMessage::CCNxMessage (Ptr<const CCNxName> name, size_t virtualPayloadLength) :
-  m_name (name), m_payload (Ptr<CCNxBuffer> (0)), m_virtualPayloadLength (virtualPayloadLength)
+  m_name (name), m_payload (Ptr<CCNxBuffer> (0)), m_virtualPayloadLength (virtualPayloadLength), m_decodedFields (0)
 {
   NS_ASSERT_MSG (false, "Virtual payload size not implemented yet.");
   std::terminate ();
@@ -94,15 +105,42 @@ CCNxMessage::~CCNxMessage ()
   // empty
 }
 
+bool
+CCNxMessage::NeedsDecode (CCNxMessageFieldDecoder::Field field) const
+{
+  if (IsDecoded (field))
+    {
+      return false;
+    }
+  m_decodedFields |= 1 << field;
+  return m_decoder->HasField (field);
+}
+
+bool
+CCNxMessage::IsDecoded (CCNxMessageFieldDecoder::Field field) const
+{
+  return !m_decoder || (m_decodedFields & (1 << field));
+}
+
 Ptr<const CCNxName>
 CCNxMessage::GetName () const
 {
+  if (NeedsDecode (CCNxMessageFieldDecoder::Name))
+    {
+      m_name = m_decoder->DecodeName ();
+    }
   return m_name;
 }
 
 size_t
 CCNxMessage::GetPayloadSize () const
 {
+  if (!IsDecoded (CCNxMessageFieldDecoder::Payload))
+    {
+      // The length is on the wire, no need to copy the payload
+      return m_decoder->GetPayloadSize ();
+    }
+
   if (HasPayload ())
     {
       return m_payload->GetSize ();
@@ -116,12 +154,21 @@ CCNxMessage::GetPayloadSize () const
 Ptr<CCNxBuffer>
 CCNxMessage::GetPayload () const
 {
+  if (NeedsDecode (CCNxMessageFieldDecoder::Payload))
+    {
+      m_payload = m_decoder->DecodePayload ();
+    }
   return m_payload;
 }
 
 bool
 CCNxMessage::HasPayload () const
 {
+  if (!IsDecoded (CCNxMessageFieldDecoder::Payload))
+    {
+      return m_decoder->HasField (CCNxMessageFieldDecoder::Payload);
+    }
+
   bool result = false;
   if (m_payload || m_virtualPayloadLength > 0)
     {
@@ -64,6 +64,53 @@
 namespace ns3  {
 namespace ccnx {
 
+/**
+ * @ingroup ccnx-messages
+ *
+ * Decodes the fields of a received message on first access.
+ *
+ * A codec in lazy decode mode (see CCNxPacket::GetDecodeMode()) does not build the name,
+ * payload, and other fields of a message.  It records where each field is in the wire buffer
+ * and creates the message with one of these.  The message calls it the first time a field is
+ * read, so a field nobody reads (e.g. the payload at a transit node) is never copied.
+ */
+class CCNxMessageFieldDecoder : public SimpleRefCount<CCNxMessageFieldDecoder>
+{
+public:
+  enum Field
+  {
+    Name,
+    Payload,
+    PayloadType,
+    ExpiryTime,
+    KeyIdRestriction,
+    HashRestriction,
+    FieldCount
+  };
+
+  virtual ~CCNxMessageFieldDecoder ();
+
+  /**
+   * True if the field is in the message.  Does not decode it.
+   */
+  virtual bool HasField (Field field) const = 0;
+
+  /**
+   * The length of the payload field.  Does not decode it.
+   */
+  virtual size_t GetPayloadSize () const = 0;
+
+  virtual Ptr<const CCNxName> DecodeName () const = 0;
+
+  virtual Ptr<CCNxBuffer> DecodePayload () const = 0;
+
+  /**
+   * Decodes a numeric field: PayloadType (as a CCNxContentObjectPayloadType), ExpiryTime
+   * (milliseconds), KeyIdRestriction or HashRestriction (the hash value).
+   */
+  virtual uint64_t DecodeNumber (Field field) const = 0;
+};
+
 /**
  * @ingroup ccnx-messages
  *
@@ -111,6 +158,11 @@ public:
    */
   ~CCNxMessage ();
 
+  /**
+   * Create a message whose fields are decoded on first access.  Used by the codecs.
+   */
+  CCNxMessage (Ptr<CCNxMessageFieldDecoder> decoder);
+
   /**
    * Returns the name the message was created with.
    */
@@ -142,6 +194,12 @@ public:
    */
   bool HasPayload () const;
 
+  /**
+   * True if the field has its value.  Always true, except for a field of a lazily
+   * decoded message that has not been read yet.
+   */
+  bool IsDecoded (CCNxMessageFieldDecoder::Field field) const;
+
   enum MessageType
   {
     Interest,
@@ -170,9 +228,18 @@ public:
   friend std::ostream &operator<< (std::ostream &os, CCNxMessage const &message);
 
 protected:
-  Ptr<const CCNxName> m_name;
-  Ptr<CCNxBuffer> m_payload;
+  /**
+   * True the first time a field of a lazily decoded message is read and it is on the wire,
+   * so the caller should decode it into its member.  After that, and for other messages,
+   * the member already has the value.
+   */
+  bool NeedsDecode (CCNxMessageFieldDecoder::Field field) const;
+
+  mutable Ptr<const CCNxName> m_name;
+  mutable Ptr<CCNxBuffer> m_payload;
   size_t m_virtualPayloadLength;
+  Ptr<CCNxMessageFieldDecoder> m_decoder;   //<! null unless lazily decoded
+  mutable uint8_t m_decodedFields;          //<! bit per CCNxMessageFieldDecoder::Field
 };
 
 }  // namespace ccnx
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include <unordered_map>
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ccnx-name-intern-pool.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxNameInternPool");
+
+static const size_t _minimumPurgeSize = 1024;
+
+namespace {
+
+/**
+ * The state of the pool.  Kept in a function static so it is constructed on first use.
+ */
+struct PoolState
+{
+  typedef std::unordered_map<std::string, Ptr<const CCNxName> > MapType;
+
+  PoolState () : m_purgeSize (_minimumPurgeSize), m_hits (0), m_misses (0)
+  {
+  }
+
+  MapType m_map;
+  size_t m_purgeSize;
+  uint64_t m_hits;
+  uint64_t m_misses;
+};
+
+PoolState &
+GetPool ()
+{
+  static PoolState pool;
+  return pool;
+}
+
+} // namespace
+
+void
+CCNxNameInternPool::AppendFlatSegment (std::string &flat, CCNxNameSegmentType type, const uint8_t *value, size_t length)
+{
+  NS_ASSERT_MSG (length <= 0xFFFF, "Name segment length too large");
+  uint8_t tl[4] = { (uint8_t) (type >> 8), (uint8_t) type, (uint8_t) (length >> 8), (uint8_t) length };
+  flat.append ((const char *) tl, sizeof(tl));
+  flat.append ((const char *) value, length);
+}
+
+std::string
+CCNxNameInternPool::GetFlat (const CCNxName &name)
+{
+  std::string flat;
+  for (size_t i = 0; i < name.GetSegmentCount (); i++)
+    {
+      Ptr<const CCNxNameSegment> segment = name.GetSegment (i);
+      const std::string &value = segment->GetValue ();
+      AppendFlatSegment (flat, segment->GetType (), (const uint8_t *) value.data (), value.size ());
+    }
+  return flat;
+}
+
+Ptr<const CCNxName>
+CCNxNameInternPool::Intern (Ptr<const CCNxName> name)
+{
+  if (!name)
+    {
+      return name;
+    }
+
+  if (name->m_interned)
+    {
+      return name;
+    }
+
+  PoolState &pool = GetPool ();
+  std::string flat = GetFlat (*name);
+  PoolState::MapType::iterator it = pool.m_map.find (flat);
+  if (it != pool.m_map.end ())
+    {
+      pool.m_hits++;
+      return it->second;
+    }
+
+  // Share the (immutable) segments of the given name, but not the name itself
+  // because the caller might still append to it.
+  Ptr<CCNxName> interned = Ptr<CCNxName> (new CCNxName (), false);
+  interned->m_segments = name->m_segments;
+  return Insert (flat, interned);
+}
+
+Ptr<const CCNxName>
+CCNxNameInternPool::InternFlat (const std::string &flat)
+{
+  PoolState &pool = GetPool ();
+  PoolState::MapType::iterator it = pool.m_map.find (flat);
+  if (it != pool.m_map.end ())
+    {
+      pool.m_hits++;
+      return it->second;
+    }
+
+  Ptr<CCNxName> interned = Ptr<CCNxName> (new CCNxName (), false);
+  size_t offset = 0;
+  while (offset < flat.size ())
+    {
+      NS_ASSERT_MSG (offset + 4 <= flat.size (), "Truncated flat name");
+      const uint8_t *tl = (const uint8_t *) flat.data () + offset;
+      CCNxNameSegmentType type = (CCNxNameSegmentType) ((tl[0] << 8) | tl[1]);
+      size_t length = (tl[2] << 8) | tl[3];
+      offset += 4;
+
+      NS_ASSERT_MSG (offset + length <= flat.size (), "Truncated flat name segment");
+      interned->m_segments.push_back (Create<const CCNxNameSegment> (type, flat.substr (offset, length)));
+      offset += length;
+    }
+
+  return Insert (flat, interned);
+}
+
+Ptr<const CCNxName>
+CCNxNameInternPool::Insert (const std::string &flat, Ptr<CCNxName> name)
+{
+  PoolState &pool = GetPool ();
+  pool.m_misses++;
+
+  name->ComputePrefixHashes ();
+  name->m_interned = true;
+  pool.m_map[flat] = name;
+
+  if (pool.m_map.size () >= pool.m_purgeSize)
+    {
+      Purge ();
+      pool.m_purgeSize = std::max (_minimumPurgeSize, 2 * pool.m_map.size ());
+    }
+
+  return name;
+}
+
+void
+CCNxNameInternPool::Purge ()
+{
+  PoolState &pool = GetPool ();
+
+  for (PoolState::MapType::iterator it = pool.m_map.begin (); it != pool.m_map.end (); )
+    {
+      if (it->second->GetReferenceCount () == 1)
+        {
+          it = pool.m_map.erase (it);
+        }
+      else
+        {
+          ++it;
+        }
+    }
+
+  NS_LOG_DEBUG ("Purge done, " << pool.m_map.size () << " names remain");
+}
+
+size_t
+CCNxNameInternPool::GetSize ()
+{
+  return GetPool ().m_map.size ();
+}
+
+uint64_t
+CCNxNameInternPool::GetHitCount ()
+{
+  return GetPool ().m_hits;
+}
+
+uint64_t
+CCNxNameInternPool::GetMissCount ()
+{
+  return GetPool ().m_misses;
+}
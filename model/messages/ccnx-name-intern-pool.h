@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_MESSAGES_CCNX_NAME_INTERN_POOL_H_
+#define CCNS3SIM_MODEL_MESSAGES_CCNX_NAME_INTERN_POOL_H_
+
+#include <string>
+#include <stdint.h>
+#include "ns3/ptr.h"
+#include "ns3/ccnx-name.h"
+#include "ns3/ccnx-namesegment.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-messages
+ *
+ * A pool of interned (canonical) names.  There is at most one interned CCNxName for each
+ * distinct name, so the PIT, FIB, and content store can share one copy of a name and
+ * two interned names are equal if and only if they are the same object.  CCNxName::Equals()
+ * uses the pointer compare when both names are interned.
+ *
+ * The pool is keyed by the flat encoding of a name: one contiguous buffer with, for each
+ * segment, a 2-byte type, a 2-byte length, and the value (like the TLV wire format, but
+ * using CCNxNameSegmentType for the type).  The codec builds the flat encoding directly from
+ * the packet, so decoding a name that is already in the pool makes no name segments.
+ *
+ * Names only referenced by the pool are released by Purge(), which the pool calls itself
+ * each time it doubles in size.
+ *
+ * Example:
+ * @code
+ * Ptr<const CCNxName> a = CCNxNameInternPool::Intern (Create<CCNxName> ("ccnx:/name=foo"));
+ * Ptr<const CCNxName> b = CCNxNameInternPool::Intern (Create<CCNxName> ("ccnx:/name=foo"));
+ * // PeekPointer (a) == PeekPointer (b)
+ * @endcode
+ */
+class CCNxNameInternPool
+{
+public:
+  /**
+   * Returns the interned name equal to `name`.  If there is not one, a new interned
+   * name is made that shares the segments of `name`.
+   *
+   * @param name [in] The name to intern (may be null, which returns null)
+   * @return The interned name
+   */
+  static Ptr<const CCNxName> Intern (Ptr<const CCNxName> name);
+
+  /**
+   * Returns the interned name with the given flat encoding.  If there is not one, a new
+   * interned name is made from the flat encoding.
+   *
+   * @param flat [in] The flat encoding of the name (see AppendFlatSegment())
+   * @return The interned name
+   */
+  static Ptr<const CCNxName> InternFlat (const std::string &flat);
+
+  /**
+   * Appends one segment to the flat encoding of a name.
+   *
+   * @param flat [in/out] The flat encoding
+   * @param type [in] The segment type
+   * @param value [in] The segment value
+   * @param length [in] The length of value (at most 0xFFFF)
+   */
+  static void AppendFlatSegment (std::string &flat, CCNxNameSegmentType type, const uint8_t *value, size_t length);
+
+  /**
+   * Computes the flat encoding of a name
+   *
+   * @param name [in] The name
+   * @return The flat encoding
+   */
+  static std::string GetFlat (const CCNxName &name);
+
+  /**
+   * Releases all interned names that are only referenced by the pool.
+   */
+  static void Purge ();
+
+  /**
+   * @return The number of interned names
+   */
+  static size_t GetSize ();
+
+  /**
+   * @return The number of Intern() or InternFlat() calls that found the name in the pool
+   */
+  static uint64_t GetHitCount ();
+
+  /**
+   * @return The number of Intern() or InternFlat() calls that added a name to the pool
+   */
+  static uint64_t GetMissCount ();
+
+private:
+  /**
+   * Makes `name` the interned name for `flat` and purges the pool if it has doubled
+   */
+  static Ptr<const CCNxName> Insert (const std::string &flat, Ptr<CCNxName> name);
+};
+
+} // namespace ccnx
+} // namespace ns3
+
+#endif /* CCNS3SIM_MODEL_MESSAGES_CCNX_NAME_INTERN_POOL_H_ */
@@ -65,16 +65,48 @@ using namespace ns3::ccnx;
 
 NS_LOG_COMPONENT_DEFINE ("CCNxName");
 
-CCNxName::CCNxName ()
+static const uint64_t _fnvPrime = 0x00000100000001B3ULL;
+static const uint64_t _fnvOffset = 0xCBF29CE484222325ULL;
+
+static inline uint64_t
+FnvUpdate (uint64_t hash, const uint8_t *p, size_t length)
+{
+  for (size_t i = 0; i < length; ++i)
+    {
+      hash = (hash ^ p[i]) * _fnvPrime;
+    }
+  return hash;
+}
+
+static inline uint64_t
+FnvUpdateU32 (uint64_t hash, uint32_t value)
+{
+  uint8_t bytes[4] = { (uint8_t) (value >> 24), (uint8_t) (value >> 16), (uint8_t) (value >> 8), (uint8_t) value };
+  return FnvUpdate (hash, bytes, sizeof(bytes));
+}
+
+/**
+ * Extends the hash of a prefix by one segment
+ */
+static inline uint64_t
+HashSegment (uint64_t hash, const CCNxNameSegment &segment)
 {
+  const std::string &value = segment.GetValue ();
+  hash = FnvUpdateU32 (hash, segment.GetType ());
+  hash = FnvUpdateU32 (hash, value.size ());
+  return FnvUpdate (hash, (const uint8_t *) value.data (), value.size ());
 }
 
-CCNxName::CCNxName (const std::string &uri)
+CCNxName::CCNxName () : m_interned (false)
+{
+}
+
+CCNxName::CCNxName (const std::string &uri) : m_interned (false)
 {
   m_segments = parse_uri (uri);
 }
 
-CCNxName::CCNxName (const CCNxName &copy)
+CCNxName::CCNxName (const CCNxName &copy) : m_interned (false)
 {
   // allocates a new vector, but uses the same Ptr<NameSegment> inside the vector.
   for (int i = 0; i < copy.m_segments.size(); i++) {
@@ -82,6 +114,7 @@ CCNxName::CCNxName (const CCNxName &copy)
     m_segments.push_back(copySegment);
   }
   // m_segments = copy.m_segments;
+  m_prefixHashes = copy.m_prefixHashes;
 }
 
 CCNxName::~CCNxName ()
@@ -106,16 +139,69 @@ CCNxName::GetSegment (size_t index) const
 int
 CCNxName::AppendSegment (Ptr<const CCNxNameSegment> segment)
 {
+    NS_ASSERT_MSG (!m_interned, "Cannot append to an interned name");
     m_segments.push_back (segment);
+    if (!m_prefixHashes.empty ())
+      {
+        m_prefixHashes.push_back (HashSegment (m_prefixHashes.back (), *segment));
+      }
     return m_segments.size ();
 }
 
+void
+CCNxName::ComputePrefixHashes () const
+{
+  if (m_prefixHashes.empty ())
+    {
+      m_prefixHashes.reserve (m_segments.size () + 1);
+      uint64_t hash = _fnvOffset;
+      m_prefixHashes.push_back (hash);
+      for (size_t i = 0; i < m_segments.size (); i++)
+        {
+          hash = HashSegment (hash, *m_segments[i]);
+          m_prefixHashes.push_back (hash);
+        }
+    }
+}
+
+bool
+CCNxName::IsInterned () const
+{
+  return m_interned;
+}
+
+uint64_t
+CCNxName::GetHash () const
+{
+  ComputePrefixHashes ();
+  return m_prefixHashes.back ();
+}
+
+uint64_t
+CCNxName::GetPrefixHash (size_t length) const
+{
+  NS_ASSERT_MSG (length <= GetSegmentCount (), "Length must be at most GetSegmentCount()");
+  ComputePrefixHashes ();
+  return m_prefixHashes[length];
+}
+
 
 bool
 CCNxName::Equals (const CCNxName &other) const
 {
+  if (this == &other)
+    {
+      return true;
+    }
+
+  if (m_interned && other.m_interned)
+    {
+      // The pool has one interned name per distinct name
+      return false;
+    }
+
   bool result = false;
-  if (m_segments.size () == other.m_segments.size ())
+  if (m_segments.size () == other.m_segments.size () && GetHash () == other.GetHash ())
     {
       result = true;
       for (int i = 0; i < m_segments.size (); i++)
@@ -138,6 +224,11 @@ CCNxName::operator < (const CCNxName &other) const
 {
   bool isLess = false;
 
+  if (this == &other)
+    {
+      return false;
+    }
+
   if (GetSegmentCount () < other.GetSegmentCount ())
     {
       isLess = true;
@@ -175,7 +266,7 @@ bool
 CCNxName::IsPrefixOf (const CCNxName &other) const
 {
   bool result = false;
-  if (m_segments.size () <= other.m_segments.size ())
+  if (m_segments.size () <= other.m_segments.size () && GetHash () == other.GetPrefixHash (m_segments.size ()))
     {
       // assume its true and look for a negative
       result = true;
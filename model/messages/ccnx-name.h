@@ -60,6 +60,8 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <functional>
+#include <stdint.h>
 
 #include "ns3/simple-ref-count.h"
 #include "ns3/output-stream-wrapper.h"
@@ -78,11 +80,24 @@ namespace ccnx {
  * Names are constructed using the class CCNxNameBuilder.  Once built, a name is immutable.
  *
  * Each name segment has a type and a value.
+ *
+ * A name caches a 64-bit hash of each of its prefixes (FNV-1a over the type, length, and
+ * value of each segment).  The hashes are computed the first time they are needed.
+ * Equals() and IsPrefixOf() compare the hashes first, so names that differ are rejected
+ * without comparing segment values.  Use `hashPtrCCNxName` and `isEqualPtrCCNxName` to key
+ * unordered containers by Ptr<const CCNxName>, or std::hash<CCNxName> for names by value.
+ *
+ * A name may be interned in the `CCNxNameInternPool`.  Two interned names are equal only if
+ * they are the same object, so Equals() of two interned names is a pointer compare.
+ *
+ * operator< does not use the hashes, because the ordering of names in a std::map is visible
+ * (e.g. when printing a FIB), and a hash does not give that order.
  */
 class CCNxName : public SimpleRefCount<CCNxName>
 {
 public:
   friend class CCNxNameBuilder;
+  friend class CCNxNameInternPool;
 
   /**
    * Function to compare two smart pointers to CCNx names.  May be used in std::map as the
@@ -103,6 +118,36 @@ public:
     }
   };
 
+  /**
+   * Hash function for Ptr<const CCNxName>.  May be used in std::unordered_map with
+   * `isEqualPtrCCNxName`.
+   *
+   * Example:
+   * @code
+   * {
+   *   typedef std::unordered_map< Ptr<const CCNxName>, Ptr<Foo>, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName > FooMapType;
+   * }
+   * @endcode
+   */
+  struct hashPtrCCNxName
+  {
+    size_t operator() (Ptr<const CCNxName> a) const
+    {
+      return (size_t) a->GetHash ();
+    }
+  };
+
+  /**
+   * Function to test two smart pointers to CCNx names for equality by value.
+   */
+  struct isEqualPtrCCNxName
+  {
+    bool operator() (Ptr<const CCNxName> a, Ptr<const CCNxName> b) const
+    {
+      return a->Equals (*b);
+    }
+  };
+
   /**
    * Creates a name from the URI representation.
    * uri = "ccnx:/NAME=foo/VER=bar"
@@ -129,12 +174,14 @@ public:
 
   /**
    * Append the given segment to this name and return the new number of segments.
+   * If the prefix hashes were already computed, the hash of the new name is added to them.
    */
   int AppendSegment (Ptr<const CCNxNameSegment> segment);
 
   /**
    * Determines if the name is equal to the other name.  For two names to be equal, they
    * must be the same length and each name segment must be of the same type and value.
+   * If both names are interned, this is a pointer compare.
    */
   bool Equals (const CCNxName &other) const;
 
@@ -158,6 +205,28 @@ public:
    */
   bool IsPrefixOf (const CCNxName &other) const;
 
+  /**
+   * The hash of the whole name.  It is the same as `GetPrefixHash (GetSegmentCount ())`.
+   *
+   * Equal names have equal hashes.
+   */
+  uint64_t GetHash () const;
+
+  /**
+   * The hash of the first `length` segments of the name.  The hash of a prefix of
+   * this name is equal to the GetHash() of that prefix as a name, so it may be
+   * used to look up the prefix in a hash table without building the prefix name.
+   *
+   * @param length [in] The number of segments in the prefix (at most GetSegmentCount())
+   * @return The hash of the prefix
+   */
+  uint64_t GetPrefixHash (size_t length) const;
+
+  /**
+   * @return true if this is the interned name from `CCNxNameInternPool`
+   */
+  bool IsInterned () const;
+
 protected:
   /**
    * Creates a name with zero name segments.
@@ -178,6 +247,22 @@ protected:
    * Internal storage of name segments.
    */
   CCNxNameStorageType m_segments;
+
+  /**
+   * Computes m_prefixHashes if it is empty.
+   */
+  void ComputePrefixHashes () const;
+
+  /**
+   * Cache of prefix hashes, m_prefixHashes[i] is the hash of the first i segments.  It
+   * is empty until first used, otherwise it has GetSegmentCount() + 1 elements.
+   */
+  mutable std::vector<uint64_t> m_prefixHashes;
+
+  /**
+   * Set by `CCNxNameInternPool` on the interned name
+   */
+  bool m_interned;
 };
 
 std::ostream &operator<< (std::ostream &os, const CCNxName &name);
@@ -185,4 +270,18 @@ std::ostream &operator<< (std::ostream &os, const CCNxName &name);
 }
 }
 
+namespace std {
+/**
+ * std::hash of a CCNxName uses the cached name hash.
+ */
+template<>
+struct hash<ns3::ccnx::CCNxName>
+{
+  size_t operator() (const ns3::ccnx::CCNxName &name) const
+  {
+    return (size_t) name.GetHash ();
+  }
+};
+}
+
 #endif //CCNS3_CCNXNAME_H
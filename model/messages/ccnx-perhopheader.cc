@@ -53,13 +53,16 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include <cstring>
+
 #include "ccnx-perhopheader.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
 
-CCNxPerHopHeader::CCNxPerHopHeader ()
+CCNxPerHopHeader::CCNxPerHopHeader () : m_generation (0)
 {
+  memset (m_typeIndex, 0, sizeof (m_typeIndex));
 }
 
 CCNxPerHopHeader::~CCNxPerHopHeader ()
@@ -71,6 +74,13 @@ void
 CCNxPerHopHeader::AddHeader(Ptr<CCNxPerHopHeaderEntry> header)
 {
   m_perhopheaders.push_back(header);
+  m_generation++;
+
+  uint16_t type = header->GetInstanceTLVType ();
+  if (type < m_typeIndexSize && m_typeIndex[type] == 0 && m_perhopheaders.size () <= 0xFF)
+    {
+      m_typeIndex[type] = m_perhopheaders.size ();
+    }
 }
 
 size_t
@@ -83,6 +93,8 @@ void
 CCNxPerHopHeader::clear (void)
 {
   m_perhopheaders.clear ();
+  m_generation++;
+  memset (m_typeIndex, 0, sizeof (m_typeIndex));
 }
 
 Ptr<CCNxPerHopHeaderEntry>
@@ -95,6 +107,47 @@ void
 CCNxPerHopHeader::RemoveHeader(size_t index)
 {
   m_perhopheaders.erase (m_perhopheaders.begin() + index);
+  m_generation++;
+  IndexHeaders ();
+}
+
+void
+CCNxPerHopHeader::IndexHeaders (void)
+{
+  memset (m_typeIndex, 0, sizeof (m_typeIndex));
+  for (size_t i = 0; i < m_perhopheaders.size () && i < 0xFF; ++i)
+    {
+      uint16_t type = m_perhopheaders[i]->GetInstanceTLVType ();
+      if (type < m_typeIndexSize && m_typeIndex[type] == 0)
+        {
+          m_typeIndex[type] = i + 1;
+        }
+    }
+}
+
+Ptr<CCNxPerHopHeaderEntry>
+CCNxPerHopHeader::GetHeaderByType (uint16_t tlvType) const
+{
+  if (tlvType < m_typeIndexSize && m_perhopheaders.size () <= 0xFF)
+    {
+      uint8_t position = m_typeIndex[tlvType];
+      return position ? m_perhopheaders[position - 1] : Ptr<CCNxPerHopHeaderEntry> (0);
+    }
+
+  for (size_t i = 0; i < m_perhopheaders.size (); ++i)
+    {
+      if (m_perhopheaders[i]->GetInstanceTLVType () == tlvType)
+        {
+          return m_perhopheaders[i];
+        }
+    }
+  return Ptr<CCNxPerHopHeaderEntry> (0);
+}
+
+uint32_t
+CCNxPerHopHeader::GetGeneration (void) const
+{
+  return m_generation;
 }
 
 bool
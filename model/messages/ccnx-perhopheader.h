@@ -65,6 +65,10 @@ namespace ccnx {
  * @ingroup ccnx-messages
  *
  * Class representation of the entire block of per hop header entries
+ *
+ * It keeps an index of the entries by TLV type, a small array built as entries are added
+ * (so, while the packet is decoded).  GetHeaderByType() uses it to find an entry without
+ * scanning the list.
  */
 class CCNxPerHopHeader : public SimpleRefCount<CCNxPerHopHeader>
 {
@@ -105,6 +109,19 @@ public:
    */
   Ptr<CCNxPerHopHeaderEntry> GetHeader(size_t index) const;
 
+  /**
+   * Returns the first CCNxPerHopHeaderEntry with the given TLV type (see
+   * CCNxPerHopHeaderEntry::GetInstanceTLVType()).  This is O(1) for the TLV types in
+   * CCNxSchemaV1.
+   *
+   * The entry is an instance of the class of that TLV type, so the caller may use
+   * StaticCast, e.g. StaticCast<CCNxInterestLifetime> for CCNxInterestLifetime::GetTLVType().
+   *
+   * @param [in] tlvType The per hop header TLV type
+   * @return The entry, or null if there is none of that type
+   */
+  Ptr<CCNxPerHopHeaderEntry> GetHeaderByType (uint16_t tlvType) const;
+
   /**
    * Removes the CCNxPerHopHeaderEntry at the given index
    *
@@ -112,6 +129,12 @@ public:
    */
   void RemoveHeader(size_t index);
 
+  /**
+   * A counter that changes every time an entry is added or removed.  Used by CCNxPacket
+   * to know if its cached wire format is still current.
+   */
+  uint32_t GetGeneration (void) const;
+
   /**
    * Determines if all perhopheaders are equivalent to the given perhopheaders.
    *
@@ -136,8 +159,19 @@ public:
   friend std::ostream &operator<< (std::ostream &os, CCNxPerHopHeader const &headerlist);
 
 private:
+  /**
+   * Rebuilds m_typeIndex after an entry was removed.
+   */
+  void IndexHeaders (void);
+
+  /**
+   * TLV types below this are in m_typeIndex, others are found by a scan.
+   */
+  static const size_t m_typeIndexSize = 16;
 
   HdrListType m_perhopheaders;
+  uint32_t m_generation;
+  uint8_t m_typeIndex[m_typeIndexSize];     //<! 1 + the index in m_perhopheaders, 0 if none
 };
 
 }
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ccnx-unknownperhopheaderentry.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxUnknownPerHopHeaderEntry");
+
+NS_OBJECT_ENSURE_REGISTERED(CCNxUnknownPerHopHeaderEntry);
+
+TypeId
+CCNxUnknownPerHopHeaderEntry::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxUnknownPerHopHeaderEntry")
+    .SetParent<CCNxPerHopHeaderEntry> ()
+    .SetGroupName ("CCNx");
+  return tid;
+}
+
+TypeId
+CCNxUnknownPerHopHeaderEntry::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+CCNxUnknownPerHopHeaderEntry::CCNxUnknownPerHopHeaderEntry (uint16_t tlvType, const Buffer &value)
+  : m_tlvType (tlvType), m_value (value)
+{
+  // empty
+}
+
+CCNxUnknownPerHopHeaderEntry::~CCNxUnknownPerHopHeaderEntry ()
+{
+  // empty
+}
+
+uint16_t
+CCNxUnknownPerHopHeaderEntry::GetInstanceTLVType (void) const
+{
+  return m_tlvType;
+}
+
+const Buffer &
+CCNxUnknownPerHopHeaderEntry::GetValue (void) const
+{
+  return m_value;
+}
+
+bool
+CCNxUnknownPerHopHeaderEntry::Equals (const Ptr<CCNxPerHopHeaderEntry> other) const
+{
+  if (other)
+    {
+      return Equals (*other);
+    }
+  else
+    {
+      return false;
+    }
+}
+
+bool
+CCNxUnknownPerHopHeaderEntry::Equals (CCNxPerHopHeaderEntry const &other) const
+{
+  if (other.GetInstanceTypeId () != GetTypeId () || other.GetInstanceTLVType () != m_tlvType)
+    {
+      return false;
+    }
+
+  const CCNxUnknownPerHopHeaderEntry &unknown = static_cast<const CCNxUnknownPerHopHeaderEntry &> (other);
+  uint32_t size = m_value.GetSize ();
+  if (unknown.m_value.GetSize () != size)
+    {
+      return false;
+    }
+
+  Buffer::Iterator a = m_value.Begin ();
+  Buffer::Iterator b = unknown.m_value.Begin ();
+  for (uint32_t i = 0; i < size; ++i)
+    {
+      if (a.ReadU8 () != b.ReadU8 ())
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+std::ostream &
+CCNxUnknownPerHopHeaderEntry::Print(std::ostream &os) const
+{
+  os << "{ Unknown Per Hop type " << m_tlvType << " length " << m_value.GetSize () << " }";
+  return os;
+}
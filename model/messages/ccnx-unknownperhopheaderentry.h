@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3_CCNXUNKNOWNPERHOPHEADERENTRY_H
+#define CCNS3_CCNXUNKNOWNPERHOPHEADERENTRY_H
+
+#include "ns3/object.h"
+#include "ns3/buffer.h"
+#include "ns3/ccnx-perhopheaderentry.h"
+
+namespace ns3  {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-messages
+ *
+ * A Per Hop Header Entry of a TLV type that has no codec registered.
+ *
+ * CCNxCodecFixedHeader creates one of these for each such TLV it decodes.  It keeps the
+ * type and the value bytes as they were on the wire, without interpreting them, so the
+ * entry is encoded again unchanged when the packet is forwarded.
+ */
+class CCNxUnknownPerHopHeaderEntry : public CCNxPerHopHeaderEntry {
+public:
+  static TypeId GetTypeId (void);
+
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Constructor for CCNxUnknownPerHopHeaderEntry.
+   *
+   * @param [in] tlvType The TLV type from the wire
+   * @param [in] value The TLV value from the wire
+   */
+  CCNxUnknownPerHopHeaderEntry (uint16_t tlvType, const Buffer &value);
+
+  /**
+   * Destructor for CCNxUnknownPerHopHeaderEntry
+   */
+  virtual ~CCNxUnknownPerHopHeaderEntry ();
+
+  virtual uint16_t GetInstanceTLVType (void) const;
+
+  /**
+   * Returns the TLV value, as it was on the wire
+   */
+  const Buffer & GetValue (void) const;
+
+  /**
+   * Determines if the given entry is equivalent to this entry.
+   *
+   * Two unknown entries are equivalent if the types and values are exactly equal
+   */
+  bool Equals (const Ptr<CCNxPerHopHeaderEntry> other) const;
+
+  /**
+   * Determines if the given entry is equivalent to this entry.
+   *
+   * Two unknown entries are equivalent if the types and values are exactly equal
+   */
+  bool Equals (CCNxPerHopHeaderEntry const &other) const;
+
+  /**
+   * Prints a string like this:
+   *
+   * { Unknown Per Hop type T length L }
+   *
+   * @param [in] os ostream object
+   * @return ostream object
+   */
+  virtual std::ostream & Print(std::ostream &os) const;
+
+protected:
+  uint16_t m_tlvType;
+  Buffer m_value;
+};
+
+}
+}
+
+#endif //CCNS3_CCNXUNKNOWNPERHOPHEADERENTRY_H
@@ -53,19 +53,39 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include "ns3/assert.h"
 #include "ccnx-connection-list.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
 
+const size_t CCNxConnectionList::InlineCapacity;
+uint64_t CCNxConnectionList::s_spillCount = 0;
+
 CCNxConnectionList::CCNxConnectionList ()
+  : m_data (m_inline), m_begin (0), m_end (0)
 {
   // empty
 }
 
 CCNxConnectionList::CCNxConnectionList (CCNxConnectionList &copy)
+  : m_data (m_inline), m_begin (0), m_end (0)
 {
-  m_storage = copy.m_storage;
+  *this = copy;
+}
+
+CCNxConnectionList &
+CCNxConnectionList::operator= (const CCNxConnectionList &other)
+{
+  if (this != &other)
+    {
+      clear ();
+      for (size_t i = other.m_begin; i < other.m_end; i++)
+        {
+          push_back (other.m_data[i]);
+        }
+    }
+  return *this;
 }
 
 CCNxConnectionList::~CCNxConnectionList ()
@@ -73,53 +93,126 @@ CCNxConnectionList::~CCNxConnectionList ()
   // empty
 }
 
+void *
+CCNxConnectionList::operator new (size_t size)
+{
+  return CCNxFreeList<CCNxConnectionList>::Allocate (size);
+}
+
+void
+CCNxConnectionList::operator delete (void *p, size_t size)
+{
+  CCNxFreeList<CCNxConnectionList>::Release (p, size);
+}
+
+uint64_t
+CCNxConnectionList::GetHeapFallbackCount ()
+{
+  return CCNxFreeList<CCNxConnectionList>::GetHeapFallbackCount () + s_spillCount;
+}
+
+uint64_t
+CCNxConnectionList::GetAllocationCount ()
+{
+  return CCNxFreeList<CCNxConnectionList>::GetAllocationCount ();
+}
+
 size_t
 CCNxConnectionList::size () const
 {
-  return m_storage.size ();
+  return m_end - m_begin;
+}
+
+size_t
+CCNxConnectionList::capacity () const
+{
+  return m_data == m_inline ? InlineCapacity : m_heap.size ();
 }
 
 void CCNxConnectionList::clear ()
 {
-  m_storage.clear ();
+  for (size_t i = m_begin; i < m_end; i++)
+    {
+      m_data[i] = 0;
+    }
+  m_begin = 0;
+  m_end = 0;
+}
+
+void CCNxConnectionList::grow ()
+{
+  if (m_begin > 0)
+    {
+      // there is room at the front left by pop_front()
+      for (size_t i = m_begin; i < m_end; i++)
+        {
+          m_data[i - m_begin] = m_data[i];
+          m_data[i] = 0;
+        }
+      m_end -= m_begin;
+      m_begin = 0;
+      return;
+    }
+
+  std::vector< Ptr<CCNxConnection> > larger (2 * capacity ());
+  for (size_t i = 0; i < m_end; i++)
+    {
+      larger[i] = m_data[i];
+      m_data[i] = 0;
+    }
+  m_heap.swap (larger);
+  m_data = &m_heap[0];
+  s_spillCount++;
 }
 
 void CCNxConnectionList::push_back (Ptr<CCNxConnection> connection)
 {
-  m_storage.push_back (connection);
+  if (m_end == capacity ())
+    {
+      grow ();
+    }
+  m_data[m_end++] = connection;
 }
 
 Ptr<CCNxConnection> CCNxConnectionList::front () const
 {
-  return m_storage.front ();
+  NS_ASSERT_MSG (m_begin < m_end, "front() of an empty list");
+  return m_data[m_begin];
 }
 
 void CCNxConnectionList::pop_front ()
 {
-  m_storage.pop_front ();
+  NS_ASSERT_MSG (m_begin < m_end, "pop_front() of an empty list");
+  m_data[m_begin++] = 0;
+  if (m_begin == m_end)
+    {
+      m_begin = 0;
+      m_end = 0;
+    }
 }
 
 Ptr<CCNxConnection> CCNxConnectionList::back () const
 {
-  return m_storage.back ();
+  NS_ASSERT_MSG (m_begin < m_end, "back() of an empty list");
+  return m_data[m_end - 1];
 }
 
 CCNxConnectionList::iterator
 CCNxConnectionList::begin ()
 {
-  return iterator (m_storage.begin ());
+  return iterator (m_data + m_begin);
 }
 
 CCNxConnectionList::iterator
 CCNxConnectionList::end ()
 {
-  return iterator (m_storage.end ());
+  return iterator (m_data + m_end);
 }
 
 // =============
 // Iterator
 
-CCNxConnectionList::iterator::iterator (CCNxConnectionList::StorageType::iterator iter) :
+CCNxConnectionList::iterator::iterator (CCNxConnectionList::StorageType iter) :
   m_iter (iter)
 {
   // empty
@@ -56,9 +56,10 @@
 #ifndef CCNS3SIM_MODEL_NODE_CCNX_CONNECTION_LIST_H_
 #define CCNS3SIM_MODEL_NODE_CCNX_CONNECTION_LIST_H_
 
-#include <list>
+#include <vector>
 #include "ns3/simple-ref-count.h"
 #include "ns3/ccnx-connection.h"
+#include "ns3/ccnx-free-list.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -70,6 +71,12 @@ namespace ccnx {
  * need to toss around a `std::list< Ptr<CCNxConnection> >`.
  *
  * Roughly resembles the same API as std::list<> but we do not have an iterator.
+ *
+ * A list is made for every FIB lookup and PIT satisfy, and almost always holds only a
+ * few connections, so it is a small vector: the first `InlineCapacity` connections are
+ * stored in the object itself and only a longer list spills to a heap array.  The list
+ * objects themselves come from a CCNxFreeList.  GetHeapFallbackCount() counts both kinds
+ * of heap allocation.
  */
 class CCNxConnectionList : public SimpleRefCount<CCNxConnectionList>
 {
@@ -79,6 +86,8 @@ public:
 
   CCNxConnectionList (CCNxConnectionList &copy);
 
+  CCNxConnectionList & operator= (const CCNxConnectionList &other);
+
   size_t size () const;
 
   void clear ();
@@ -91,11 +100,62 @@ public:
 
   Ptr<CCNxConnection> back () const;
 
-  typedef std::list< Ptr<CCNxConnection> > StorageType;
+  /**
+   * The number of connections stored without a heap allocation
+   */
+  static const size_t InlineCapacity = 4;
+
+  /**
+   * The number of heap allocations made by connection lists: lists made when the free
+   * list was empty plus lists that grew past `InlineCapacity`.
+   *
+   * @return The heap fallback count
+   */
+  static uint64_t GetHeapFallbackCount ();
+
+  /**
+   * @return The number of connection lists made
+   */
+  static uint64_t GetAllocationCount ();
+
+  static void *operator new (size_t size);
+  static void operator delete (void *p, size_t size);
 
+  typedef Ptr<CCNxConnection> * StorageType;
 
 private:
-  StorageType m_storage;
+  /**
+   * @return The number of slots in m_data
+   */
+  size_t capacity () const;
+
+  /**
+   * Makes room for one more connection at m_end, either by moving the list to
+   * the front of m_data or by moving it to a larger heap array.
+   */
+  void grow ();
+
+  /**
+   * The first InlineCapacity connections
+   */
+  Ptr<CCNxConnection> m_inline[InlineCapacity];
+
+  /**
+   * The storage once the list has grown past InlineCapacity
+   */
+  std::vector< Ptr<CCNxConnection> > m_heap;
+
+  /**
+   * Either m_inline or the data of m_heap.  The list is m_data[m_begin] to m_data[m_end - 1].
+   */
+  StorageType m_data;
+  size_t m_begin;
+  size_t m_end;
+
+  /**
+   * The number of lists that grew past InlineCapacity
+   */
+  static uint64_t s_spillCount;
 
 
 public:
@@ -120,7 +180,7 @@ public:
     /**
      * Construct a iterator given a pointer to the name segment
      */
-    iterator (CCNxConnectionList::StorageType::iterator iter);
+    iterator (CCNxConnectionList::StorageType iter);
 
     /**
      * Copy Constructor to copy from one iterator to another
@@ -163,11 +223,11 @@ public:
     pointer operator-> () const;
 
 protected:
-    StorageType::iterator m_iter;
+    StorageType m_iter;
   };
 
   /**
-   * Define begin/end for const iterator
+   * Define begin/end for iterator
    */
   iterator begin ();
   iterator end ();
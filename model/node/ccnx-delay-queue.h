@@ -62,6 +62,7 @@
 #include "ns3/nstime.h"
 #include "ns3/callback.h"
 #include "ns3/timer.h"
+#include "ns3/simulator.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -101,6 +102,31 @@ namespace ccnx {
  * simulation delay to wait.  Once the delay is over and the item is passed
  * to `DequeueCallback(T item)`, no further calculation is done and `item` is
  * passed to the next step in the service pipeline.
+ *
+ * @subsection Batch Service
+ *
+ * By default each item occupies a server by itself, so every item costs one
+ * scheduler event.  After `SetBatchMode(maxBatchSize, ...)` a free server instead takes
+ * up to `maxBatchSize` items from the head of the queue at once.  The whole batch
+ * finishes at the same simulated instant and is delivered by a single timer event.
+ *
+ * The batch service time comes from `GetBatchServiceTime(items)`, which lets the user
+ * model a per-batch overhead amortized over the items (e.g. constant + slope * bytes).
+ * If it is null, the batch takes as long as its slowest item.  The finished batch is
+ * passed to `BatchDequeueCallback(items)`, or if that is null, to `DequeueCallback(T item)`
+ * one item at a time in FIFO order.
+ *
+ * Items that arrive at a free server in the same simulated instant are gathered into
+ * one batch, so a burst (e.g. a fan-out) is serviced together rather than the first
+ * item starting alone.
+ *
+ * @subsection Synchronous Service
+ *
+ * A component with no delay to model can call `SetSynchronous(true)`.  Then `push_back(item)`
+ * calls `GetServiceTime(item)` (for its side effects, the time is ignored) and
+ * `DequeueCallback(item)` before it returns, with no timer.  If the dequeue callback
+ * pushes another item in to the same queue, that item is serviced after the callback
+ * returns (not recursively), so items are still serviced in FIFO order.
  */
 
 template <class T>
@@ -109,9 +135,13 @@ class CCNxDelayQueue : public SimpleRefCount< CCNxDelayQueue<T> >
 public:
   typedef Callback<Time, Ptr<T> > GetServiceTimeCallback;
   typedef Callback<void, Ptr<T> > DequeueCallback;
+  typedef std::vector< Ptr<T> > BatchType;
+  typedef Callback<Time, const BatchType &> GetBatchServiceTimeCallback;
+  typedef Callback<void, const BatchType &> BatchDequeueCallback;
 
   CCNxDelayQueue (unsigned servers, GetServiceTimeCallback getServiceTime, DequeueCallback dequeue)
-    : m_serverCount (servers), m_GetServiceTime (getServiceTime), m_DequeueCallback (dequeue), m_backlogCount (0)
+    : m_serverCount (servers), m_GetServiceTime (getServiceTime), m_DequeueCallback (dequeue), m_backlogCount (0),
+    m_maxBatchSize (1), m_batchEvents (0), m_synchronous (false), m_inSynchronousService (false)
   {
     NS_ASSERT_MSG (servers > 0, "Cannot specify 0 servers, must be positive.");
 
@@ -125,6 +155,7 @@ public:
 
   virtual ~CCNxDelayQueue ()
   {
+    Simulator::Cancel (m_gatherEvent);
     for (int i = 0; i < m_serverCount; i++)
       {
         delete m_servers[i];
@@ -143,6 +174,22 @@ public:
     m_inputQueue.push_back (item);
     m_backlogCount++;
 
+    if (m_synchronous)
+      {
+        ServiceSynchronous ();
+        return;
+      }
+
+    if (m_maxBatchSize > 1)
+      {
+        // Defer to the end of this instant so simultaneous arrivals share a batch
+        if (!m_gatherEvent.IsRunning () && HasFreeServer ())
+          {
+            m_gatherEvent = Simulator::ScheduleNow (&CCNxDelayQueue::GatherBatches, this);
+          }
+        return;
+      }
+
     if (m_backlogCount <= m_serverCount)
       {
         // find a free server
@@ -160,6 +207,46 @@ public:
       }
   }
 
+  /**
+   * Enqueues several items at once.  The result is the same as calling push_back(item)
+   * for each of them, but the free servers are only searched once for the whole batch.
+   *
+   * @param items [in] The items to enqueue, in order
+   */
+  void push_back (const BatchType &items)
+  {
+    if (items.empty ())
+      {
+        return;
+      }
+
+    m_inputQueue.insert (m_inputQueue.end (), items.begin (), items.end ());
+    m_backlogCount += items.size ();
+
+    if (m_synchronous)
+      {
+        ServiceSynchronous ();
+        return;
+      }
+
+    if (m_maxBatchSize > 1)
+      {
+        if (!m_gatherEvent.IsRunning () && HasFreeServer ())
+          {
+            m_gatherEvent = Simulator::ScheduleNow (&CCNxDelayQueue::GatherBatches, this);
+          }
+        return;
+      }
+
+    for (unsigned i = 0; i < m_serverCount && !m_inputQueue.empty (); i++)
+      {
+        if (!m_servers[i]->IsRunning ())
+          {
+            BeginService (m_servers[i]);
+          }
+      }
+  }
+
 
   /**
    * The number of items in the delay queue, including those
@@ -172,6 +259,85 @@ public:
     return m_backlogCount;
   }
 
+  /**
+   * Switch the queue to batch service.  Each free server takes up to `maxBatchSize`
+   * items from the head of the queue and services them as one unit.  A `maxBatchSize`
+   * of 1 restores the default per-item service.
+   *
+   * Must be called while the queue is empty.
+   *
+   * @param maxBatchSize [in] The maximum number of items serviced together (positive)
+   * @param getBatchServiceTime [in] The service time of a batch.  If null, the maximum
+   *                                 of the per-item service times.
+   * @param dequeueBatch [in] Receives each finished batch.  If null, each item is
+   *                          passed to the per-item DequeueCallback.
+   */
+  void SetBatchMode (unsigned maxBatchSize,
+                     GetBatchServiceTimeCallback getBatchServiceTime = GetBatchServiceTimeCallback (),
+                     BatchDequeueCallback dequeueBatch = BatchDequeueCallback ())
+  {
+    NS_ASSERT_MSG (maxBatchSize > 0, "Cannot specify 0 batch size, must be positive.");
+    NS_ASSERT_MSG (m_backlogCount == 0, "Cannot change the batch mode of a non-empty queue");
+
+    m_maxBatchSize = maxBatchSize;
+    m_GetBatchServiceTime = getBatchServiceTime;
+    m_BatchDequeueCallback = dequeueBatch;
+
+    m_batches = std::vector<BatchType> (m_maxBatchSize > 1 ? m_serverCount : 0);
+    for (unsigned i = 0; i < m_serverCount; i++)
+      {
+        if (m_maxBatchSize > 1)
+          {
+            m_servers[i]->SetFunction (&CCNxDelayQueue::BatchTimerExpired, this);
+          }
+        else
+          {
+            m_servers[i]->SetFunction (&CCNxDelayQueue::TimerExpired, this);
+          }
+      }
+  }
+
+  /**
+   * In synchronous mode, push_back() services the item before it returns and there
+   * is no delay.  This overrides batch mode.
+   *
+   * Must be called while the queue is empty.
+   *
+   * @param synchronous [in] true to service items inline, false for the delayed servers
+   */
+  void SetSynchronous (bool synchronous)
+  {
+    NS_ASSERT_MSG (m_backlogCount == 0, "Cannot change the synchronous mode of a non-empty queue");
+    m_synchronous = synchronous;
+  }
+
+  /**
+   * @return true if push_back() services items inline
+   */
+  bool IsSynchronous () const
+  {
+    return m_synchronous;
+  }
+
+  /**
+   * @return The maximum number of items serviced together (1 when not in batch mode)
+   */
+  unsigned GetMaxBatchSize () const
+  {
+    return m_maxBatchSize;
+  }
+
+  /**
+   * The number of batches that have completed service.  Comparing this to the
+   * number of items shows how many scheduler events batching saved.
+   *
+   * @return The number of completed batches (0 when not in batch mode)
+   */
+  uint64_t GetBatchEvents () const
+  {
+    return m_batchEvents;
+  }
+
 private:
   /**
    * Begin servicing the top of the input queue in the server `server`.  Will get the
@@ -214,6 +380,121 @@ private:
     BeginService (server);
   }
 
+  /**
+   * Services the queue inline until it is empty.  A push_back() from inside a
+   * dequeue callback only adds to the queue, and the outermost call services it.
+   */
+  void ServiceSynchronous ()
+  {
+    if (m_inSynchronousService)
+      {
+        return;
+      }
+
+    m_inSynchronousService = true;
+    while (!m_inputQueue.empty ())
+      {
+        Ptr<T> item = m_inputQueue.front ();
+        m_inputQueue.pop_front ();
+
+        m_GetServiceTime (item);
+        m_DequeueCallback (item);
+        m_backlogCount--;
+      }
+    m_inSynchronousService = false;
+  }
+
+  bool HasFreeServer () const
+  {
+    for (unsigned i = 0; i < m_serverCount; i++)
+      {
+        if (!m_servers[i]->IsRunning ())
+          {
+            return true;
+          }
+      }
+    return false;
+  }
+
+  /**
+   * Scheduled once per instant in batch mode.  Loads every free server with a
+   * batch from the head of the queue.
+   */
+  void GatherBatches ()
+  {
+    for (unsigned i = 0; i < m_serverCount && !m_inputQueue.empty (); i++)
+      {
+        if (!m_servers[i]->IsRunning ())
+          {
+            BeginBatchService (i);
+          }
+      }
+  }
+
+  /**
+   * Move up to m_maxBatchSize items from the head of the queue to server `index`
+   * and start its timer.
+   *
+   * @param index [in] The index of a free server
+   */
+  void BeginBatchService (unsigned index)
+  {
+    if (!m_inputQueue.empty ())
+      {
+        BatchType &batch = m_batches[index];
+        Time serviceTime;
+        while (batch.size () < m_maxBatchSize && !m_inputQueue.empty ())
+          {
+            batch.push_back (m_inputQueue.front ());
+            m_inputQueue.pop_front ();
+            if (m_GetBatchServiceTime.IsNull ())
+              {
+                serviceTime = Max (serviceTime, m_GetServiceTime (batch.back ()));
+              }
+          }
+
+        if (!m_GetBatchServiceTime.IsNull ())
+          {
+            serviceTime = m_GetBatchServiceTime (batch);
+          }
+
+        Timer *server = m_servers[index];
+        server->SetDelay (serviceTime);
+        server->SetArguments (index);
+        server->Schedule ();
+      }
+  }
+
+  /**
+   * Batch mode equivalent of TimerExpired().  Delivers the whole batch of server `index`
+   * then reloads the server from the backlog.
+   *
+   * @param index The server whose timer just expired
+   */
+  void BatchTimerExpired (unsigned index)
+  {
+    BatchType batch;
+    batch.swap (m_batches[index]);
+    NS_ASSERT_MSG (m_backlogCount >= batch.size (), "Timer expired, but backlog count is less than the batch");
+    m_batchEvents++;
+
+    // As in TimerExpired(), do not decrement the backlog until after the callbacks
+    if (!m_BatchDequeueCallback.IsNull ())
+      {
+        m_BatchDequeueCallback (batch);
+      }
+    else
+      {
+        for (typename BatchType::const_iterator i = batch.begin (); i != batch.end (); ++i)
+          {
+            m_DequeueCallback (*i);
+          }
+      }
+
+    m_backlogCount -= batch.size ();
+    BeginBatchService (index);
+  }
+
 private:
   /**
    * The number of parallel heads-of-line (i.e. the parallelism of queue processing)
@@ -255,6 +536,46 @@ private:
    * can be put in the timer.
    */
   ServerArrayType m_servers;
+
+  /**
+   * The maximum number of items a server takes at once.  1 is per-item service.
+   */
+  unsigned m_maxBatchSize;
+
+  /**
+   * In batch mode, the service time of a whole batch.  May be null.
+   */
+  GetBatchServiceTimeCallback m_GetBatchServiceTime;
+
+  /**
+   * In batch mode, receives each finished batch.  May be null.
+   */
+  BatchDequeueCallback m_BatchDequeueCallback;
+
+  /**
+   * In batch mode, the items being serviced by each server (indexed like m_servers)
+   */
+  std::vector<BatchType> m_batches;
+
+  /**
+   * The pending GatherBatches() event for the current instant
+   */
+  EventId m_gatherEvent;
+
+  /**
+   * The number of batches completed
+   */
+  uint64_t m_batchEvents;
+
+  /**
+   * If true, push_back() services items inline
+   */
+  bool m_synchronous;
+
+  /**
+   * true while ServiceSynchronous() is running
+   */
+  bool m_inSynchronousService;
 };
 
 }   /* namespace ccnx */
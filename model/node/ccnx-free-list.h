@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_NODE_CCNX_FREE_LIST_H_
+#define CCNS3SIM_MODEL_NODE_CCNX_FREE_LIST_H_
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-l3-base
+ *
+ * A free list of fixed-size memory blocks for objects of class `T`.  It backs the class-specific
+ * `operator new` and `operator delete` of small objects that the forwarder makes and destroys
+ * for every packet (e.g. `CCNxStandardForwarderWorkItem` and `CCNxConnectionList`), so they
+ * keep working with `Create<T>()` and `Ptr<T>` but stop going to the heap in steady state.
+ *
+ * N.B.: Because this is a class template, all implementation must be in the header
+ * file so the compiler can generate the template specializations from user code.
+ *
+ * A released block goes on the free list and is handed out by the next Allocate().  The heap is
+ * only used when the free list is empty (the pool grows to the peak number of live objects) or
+ * for a block that is not `sizeof(T)` (e.g. a class derived from `T`).  Those heap allocations
+ * are counted by GetHeapFallbackCount().
+ *
+ * Example:
+ * @code
+ * class Foo : public SimpleRefCount<Foo>
+ * {
+ * public:
+ *   static void *operator new (size_t size) { return CCNxFreeList<Foo>::Allocate (size); }
+ *   static void operator delete (void *p, size_t size) { CCNxFreeList<Foo>::Release (p, size); }
+ * };
+ * @endcode
+ */
+template <class T>
+class CCNxFreeList
+{
+public:
+  /**
+   * @param size [in] The number of bytes (from operator new)
+   * @return A block of at least `size` bytes
+   */
+  static void *Allocate (size_t size)
+  {
+    s_allocationCount++;
+    if (size == sizeof (T) && s_head)
+      {
+        Node *node = s_head;
+        s_head = node->next;
+        s_freeCount--;
+        return node;
+      }
+    s_heapFallbackCount++;
+    return ::operator new (size < sizeof (Node) ? sizeof (Node) : size);
+  }
+
+  /**
+   * @param p [in] A block from Allocate()
+   * @param size [in] The size passed to Allocate() (from sized operator delete)
+   */
+  static void Release (void *p, size_t size)
+  {
+    if (!p)
+      {
+        return;
+      }
+    if (size != sizeof (T))
+      {
+        ::operator delete (p);
+        return;
+      }
+    Node *node = static_cast<Node *> (p);
+    node->next = s_head;
+    s_head = node;
+    s_freeCount++;
+  }
+
+  /**
+   * Returns all the free blocks to the heap
+   */
+  static void Purge ()
+  {
+    while (s_head)
+      {
+        Node *node = s_head;
+        s_head = node->next;
+        ::operator delete (node);
+      }
+    s_freeCount = 0;
+  }
+
+  /**
+   * @return The number of Allocate() calls
+   */
+  static uint64_t GetAllocationCount ()
+  {
+    return s_allocationCount;
+  }
+
+  /**
+   * @return The number of Allocate() calls that went to the heap
+   */
+  static uint64_t GetHeapFallbackCount ()
+  {
+    return s_heapFallbackCount;
+  }
+
+  /**
+   * @return The number of blocks on the free list
+   */
+  static size_t GetFreeCount ()
+  {
+    return s_freeCount;
+  }
+
+private:
+  struct Node
+  {
+    Node *next;
+  };
+
+  static Node *s_head;
+  static size_t s_freeCount;
+  static uint64_t s_allocationCount;
+  static uint64_t s_heapFallbackCount;
+};
+
+template <class T>
+typename CCNxFreeList<T>::Node * CCNxFreeList<T>::s_head = 0;
+
+template <class T>
+size_t CCNxFreeList<T>::s_freeCount = 0;
+
+template <class T>
+uint64_t CCNxFreeList<T>::s_allocationCount = 0;
+
+template <class T>
+uint64_t CCNxFreeList<T>::s_heapFallbackCount = 0;
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_NODE_CCNX_FREE_LIST_H_ */
@@ -87,3 +87,17 @@ CCNxL3Protocol::~CCNxL3Protocol ()
   // empty
 }
 
+size_t
+CCNxL3Protocol::SendBatchFromLayer4 (const CCNxL4Protocol &protocol, const CCNxL4Protocol::PacketBatchType &packets)
+{
+  size_t sent = 0;
+  for (CCNxL4Protocol::PacketBatchType::const_iterator i = packets.begin (); i != packets.end (); ++i)
+    {
+      if (SendFromLayer4 (protocol, *i))
+        {
+          sent++;
+        }
+    }
+  return sent;
+}
+
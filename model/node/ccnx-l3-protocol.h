@@ -232,6 +232,18 @@ public:
    */
   virtual bool SendToFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPacket> ccnxPacket, uint32_t egressConnectionId) = 0;
 
+  /**
+   * Called from a Layer 4 protocol to send several packets in one call.  The packets
+   * are routed as if each were passed to SendFromLayer4(), in order.
+   *
+   * The default implementation calls SendFromLayer4() for each packet.
+   *
+   * @param [in] protocol L4 protocol to be used for sending the packets
+   * @param [in] packets The packets to send
+   * @return The number of packets forwarded
+   */
+  virtual size_t SendBatchFromLayer4 (const CCNxL4Protocol &protocol, const CCNxL4Protocol::PacketBatchType &packets);
+
   /**
    * L2 calls this based on CCNxL3Protocol registering a Protocol Number
    * callback with NS3.
@@ -365,6 +377,19 @@ public:
    * @param [in] reason The reason the packet was dropped.
    */
   typedef void (* DropTracedCallback) (const CCNxL3Protocol *ccnx, Ptr<const Packet> packet, Ptr<const CCNxPacket> ccnxPacket, uint32_t interface, DropReason reason);
+
+  /**
+   * TracedCallback signature for multi-destination sends.  There is one event per routed packet,
+   * no matter how many egress connections it goes out.
+   *
+   * @param [in] ccnx The CCNx L3 reporting the trace
+   * @param [in] packet The packet (shared by all egress connections).
+   * @param [in] ccnxPacket The CCNx Packet
+   * @param [in] egress The egress connections
+   * @param [in] sentCount The number of egress connections the packet was sent on
+   */
+  typedef void (* FanoutTracedCallback) (const CCNxL3Protocol *ccnx, Ptr<const Packet> packet, Ptr<const CCNxPacket> ccnxPacket,
+                                         Ptr<const CCNxConnectionList> egress, uint32_t sentCount);
 };
 
 } // namespace ccnx
@@ -61,7 +61,7 @@ using namespace ns3::ccnx;
 CCNxL4Protocol::CCNxL4Id CCNxL4Protocol::m_nextId = 1;
 
 CCNxL4Protocol::CCNxL4Protocol () :
-  m_id (GetNextId ()), m_sendCallback (0), m_sendToCallback (0)
+  m_id (GetNextId ()), m_sendCallback (0), m_sendToCallback (0), m_sendBatchCallback (0)
 {
 }
 
@@ -88,6 +88,12 @@ CCNxL4Protocol::SetLayer3SendToCallback (Layer3SendToCallback cb)
   m_sendToCallback = cb;
 }
 
+void
+CCNxL4Protocol::SetLayer3SendBatchCallback (Layer3SendBatchCallback cb)
+{
+  m_sendBatchCallback = cb;
+}
+
 CCNxL4Protocol::Layer3SendCallback
 CCNxL4Protocol::GetLayer3SendCallback (void) const
 {
@@ -100,6 +106,12 @@ CCNxL4Protocol::GetLayer3SendToCallback (void) const
   return m_sendToCallback;
 }
 
+CCNxL4Protocol::Layer3SendBatchCallback
+CCNxL4Protocol::GetLayer3SendBatchCallback (void) const
+{
+  return m_sendBatchCallback;
+}
+
 CCNxL4Protocol::CCNxL4Id
 CCNxL4Protocol::GetNextId (void)
 {
@@ -60,6 +60,7 @@
 #define CCNS3_CCNXL4PROTOCOL_H
 
 #include <stdint.h>
+#include <vector>
 
 #include "ns3/ccnx-connection.h"
 #include "ns3/ccnx-packet.h"
@@ -125,6 +126,17 @@ public:
    */
   typedef Callback<bool, const CCNxL4Protocol &, Ptr<CCNxPacket>, uint32_t > Layer3SendToCallback;
 
+  /**
+   * Typedef for a batch of packets sent to Layer3 in one call
+   */
+  typedef std::vector< Ptr<CCNxPacket> > PacketBatchType;
+
+  /**
+   * Typedef for the SendBatch callback used to send several packets to Layer3 at once.
+   * It returns the number of packets accepted.
+   */
+  typedef Callback<size_t, const CCNxL4Protocol &, const PacketBatchType &> Layer3SendBatchCallback;
+
   /**
    * This method allows a caller to set the current down target callback
    * set for this L4 protocol.  This is typically set by the L3 protocol to
@@ -142,6 +154,14 @@ public:
    */
   virtual void SetLayer3SendToCallback (Layer3SendToCallback cb);
 
+  /**
+   * Used to set the Layer 3 function to use to send a batch of packets down the stack
+   * in one call.
+   *
+   * @param [in] cb current Callback for the L4 protocol to send a batch of packets
+   */
+  virtual void SetLayer3SendBatchCallback (Layer3SendBatchCallback cb);
+
   /**
    * This method allows a caller to get the current down target callback
    * set for this L4 protocol
@@ -158,6 +178,14 @@ public:
    */
   virtual Layer3SendToCallback GetLayer3SendToCallback (void) const;
 
+  /**
+   * This method allows a caller to get the current batch down target callback
+   * set for this L4 protocol
+   *
+   * @return current Callback for the L4 protocol to send a batch of packets
+   */
+  virtual Layer3SendBatchCallback GetLayer3SendBatchCallback (void) const;
+
 
 protected:
   static CCNxL4Id GetNextId (void);
@@ -165,6 +193,7 @@ protected:
   CCNxL4Id m_id;
   Layer3SendCallback m_sendCallback;
   Layer3SendToCallback m_sendToCallback;
+  Layer3SendBatchCallback m_sendBatchCallback;
 };
 }
 }
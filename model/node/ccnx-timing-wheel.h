@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_NODE_CCNX_TIMING_WHEEL_H_
+#define CCNS3SIM_MODEL_NODE_CCNX_TIMING_WHEEL_H_
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/callback.h"
+#include "ns3/timer.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-l3-base
+ *
+ * A hierarchical timing wheel.  It is used to expire large numbers of soft-state items
+ * (e.g. PIT entries) without scheduling one ns-3 event per item.
+ *
+ * N.B.: Because this is a class template, all implementation must be in the header
+ * file so the compiler can generate the template specializations from user code.
+ *
+ * Time is divided in to ticks of length `tick`.  The wheel has `Levels` levels of `Slots` slots.
+ * Level 0 holds items expiring within `Slots` ticks, level 1 within `Slots^2` ticks, etc.  When
+ * level 0 wraps, the next slot of level 1 is cascaded down in to level 0 (and so on up the levels).
+ * Insert is O(1) and each item is moved at most `Levels - 1` times, so expiry is O(1) amortized.
+ *
+ * The wheel runs a single `Timer`, and only while the wheel is not empty.  It fires on the
+ * next tick that has due items or needs a cascade, so empty ticks cost nothing.  All the
+ * items due in a tick are passed to `ExpireCallback` in that one event.
+ * An item is expired at the first tick boundary at or after its expiry time, so the
+ * expiry resolution is one tick.
+ *
+ * There is no cancel operation.  A user that needs to cancel or extend an item should
+ * check, in the `ExpireCallback`, if the item is still valid and re-insert it if
+ * its expiry time moved.
+ */
+template <class T>
+class CCNxTimingWheel : public SimpleRefCount< CCNxTimingWheel<T> >
+{
+public:
+  typedef Callback<void, T> ExpireCallback;
+
+  /**
+   * @param tick [in] The tick length (the expiry resolution), must be positive
+   * @param expire [in] Called for each item once its expiry time has passed
+   */
+  CCNxTimingWheel (Time tick, ExpireCallback expire)
+    : m_tick (tick), m_expire (expire), m_currentTick (0), m_count (0),
+    m_timer (Timer::REMOVE_ON_DESTROY), m_scheduledTick (0), m_inTimer (false), m_tickEvents (0), m_expiredCount (0), m_cascadeCount (0)
+  {
+    NS_ASSERT_MSG (tick.IsStrictlyPositive (), "Timing wheel tick must be positive");
+    m_wheel = WheelType (Levels * Slots);
+    m_timer.SetFunction (&CCNxTimingWheel::TimerExpired, this);
+    m_currentTick = NowTick ();
+  }
+
+  virtual ~CCNxTimingWheel ()
+  {
+    m_timer.Cancel ();
+  }
+
+  /**
+   * Add an item to the wheel.  If `expiryTime` is not in the future, the item expires
+   * at the next tick.
+   *
+   * @param expiryTime [in] The absolute simulation time of expiry
+   * @param item [in] The item passed to the ExpireCallback
+   */
+  void Insert (Time expiryTime, const T &item)
+  {
+    if (m_count == 0)
+      {
+        // The wheel does not tick while empty, so catch up to the present
+        m_currentTick = NowTick ();
+      }
+
+    int64_t step = m_tick.GetTimeStep ();
+    int64_t tick = (expiryTime.GetTimeStep () + step - 1) / step;
+    if (tick <= (int64_t) m_currentTick)
+      {
+        tick = m_currentTick + 1;
+      }
+
+    Record record;
+    record.m_tick = tick;
+    record.m_item = item;
+    Place (record);
+    m_count++;
+
+    // While in TimerExpired() the timer is re-scheduled after all due items are processed
+    if (!m_inTimer && (!m_timer.IsRunning () || record.m_tick < m_scheduledTick))
+      {
+        m_timer.Cancel ();
+        ScheduleTick ();
+      }
+  }
+
+  /**
+   * Remove all items without expiring them.
+   */
+  void Clear ()
+  {
+    for (size_t i = 0; i < m_wheel.size (); ++i)
+      {
+        m_wheel[i].clear ();
+      }
+    m_count = 0;
+    m_timer.Cancel ();
+  }
+
+  /**
+   * @return The number of items in the wheel
+   */
+  size_t size () const
+  {
+    return m_count;
+  }
+
+  /**
+   * @return The tick length
+   */
+  Time GetTick () const
+  {
+    return m_tick;
+  }
+
+  /**
+   * @return The number of tick events the wheel has executed
+   */
+  uint64_t GetTickEventCount () const
+  {
+    return m_tickEvents;
+  }
+
+  /**
+   * @return The number of items passed to the ExpireCallback
+   */
+  uint64_t GetExpiredCount () const
+  {
+    return m_expiredCount;
+  }
+
+  /**
+   * @return The number of items moved down a level
+   */
+  uint64_t GetCascadeCount () const
+  {
+    return m_cascadeCount;
+  }
+
+private:
+  static const unsigned LevelBits = 6;
+  static const unsigned Slots = 1 << LevelBits;
+  static const unsigned SlotMask = Slots - 1;
+  static const unsigned Levels = 4;
+
+  struct Record
+  {
+    uint64_t m_tick;
+    T m_item;
+  };
+
+  typedef std::vector<Record> SlotType;
+  typedef std::vector<SlotType> WheelType;
+
+  uint64_t NowTick () const
+  {
+    return Simulator::Now ().GetTimeStep () / m_tick.GetTimeStep ();
+  }
+
+  SlotType & GetSlot (unsigned level, unsigned slot)
+  {
+    return m_wheel[level * Slots + slot];
+  }
+
+  /**
+   * Put a record in the lowest level whose span covers its distance from the current tick.
+   * Records beyond the span of the top level are parked in the furthest top-level slot and
+   * re-placed when it cascades.
+   */
+  void Place (const Record &record)
+  {
+    uint64_t delta = record.m_tick > m_currentTick ? record.m_tick - m_currentTick : 0;
+    for (unsigned level = 0; level < Levels; ++level)
+      {
+        if (delta < ((uint64_t) 1 << (LevelBits * (level + 1))))
+          {
+            GetSlot (level, (record.m_tick >> (LevelBits * level)) & SlotMask).push_back (record);
+            return;
+          }
+      }
+
+    unsigned top = Levels - 1;
+    uint64_t furthest = m_currentTick + ((uint64_t) 1 << (LevelBits * Levels)) - 1;
+    GetSlot (top, (furthest >> (LevelBits * top)) & SlotMask).push_back (record);
+  }
+
+  /**
+   * Move the wheel forward by one tick, cascading and expiring as needed.
+   */
+  void Advance ()
+  {
+    m_currentTick++;
+
+    for (unsigned level = 1; level < Levels; ++level)
+      {
+        if ((m_currentTick & (((uint64_t) 1 << (LevelBits * level)) - 1)) != 0)
+          {
+            break;
+          }
+
+        SlotType cascade;
+        cascade.swap (GetSlot (level, (m_currentTick >> (LevelBits * level)) & SlotMask));
+        for (typename SlotType::const_iterator i = cascade.begin (); i != cascade.end (); ++i)
+          {
+            Place (*i);
+          }
+        m_cascadeCount += cascade.size ();
+      }
+
+    SlotType due;
+    due.swap (GetSlot (0, m_currentTick & SlotMask));
+    m_count -= due.size ();
+    m_expiredCount += due.size ();
+
+    // The callback may Insert() new items, which is safe because `due` is no longer in the wheel
+    for (typename SlotType::const_iterator i = due.begin (); i != due.end (); ++i)
+      {
+        m_expire (i->m_item);
+      }
+  }
+
+  /**
+   * Schedule the timer for the next tick that needs work: the next non-empty level 0
+   * slot or the next level 1 cascade, whichever is first.  Ticks in between are
+   * skipped without an event.
+   */
+  void ScheduleTick ()
+  {
+    if (m_count > 0)
+      {
+        uint64_t tick = m_currentTick + 1;
+        while ((tick & SlotMask) != 0 && GetSlot (0, tick & SlotMask).empty ())
+          {
+            tick++;
+          }
+
+        m_scheduledTick = tick;
+        Time next = TimeStep (tick * m_tick.GetTimeStep ());
+        m_timer.Schedule (next - Simulator::Now ());
+      }
+  }
+
+  void TimerExpired ()
+  {
+    m_tickEvents++;
+    m_inTimer = true;
+
+    uint64_t target = NowTick ();
+    while (m_currentTick < target && m_count > 0)
+      {
+        Advance ();
+      }
+
+    if (m_count == 0)
+      {
+        m_currentTick = target;
+      }
+
+    m_inTimer = false;
+    ScheduleTick ();
+  }
+
+  /**
+   * The tick length
+   */
+  Time m_tick;
+
+  /**
+   * Called for each expired item
+   */
+  ExpireCallback m_expire;
+
+  /**
+   * The wheel storage, `Levels` x `Slots`
+   */
+  WheelType m_wheel;
+
+  /**
+   * The last tick processed (in units of m_tick since time 0)
+   */
+  uint64_t m_currentTick;
+
+  /**
+   * The number of items in the wheel
+   */
+  size_t m_count;
+
+  /**
+   * Fires on the next tick with due items or a cascade, only while the wheel is not empty
+   */
+  Timer m_timer;
+
+  /**
+   * The tick m_timer is scheduled for
+   */
+  uint64_t m_scheduledTick;
+
+  /**
+   * True while TimerExpired() is running the expire callbacks
+   */
+  bool m_inTimer;
+
+  uint64_t m_tickEvents;
+  uint64_t m_expiredCount;
+  uint64_t m_cascadeCount;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_NODE_CCNX_TIMING_WHEEL_H_ */
@@ -94,6 +94,10 @@ CCNxStandardLayer3::GetTypeId (void)
                      "Drop CCNx packet",
                      MakeTraceSourceAccessor (&CCNxStandardLayer3::m_dropTrace),
                      "ns3::ccnx::CCNxStandardLayer3::DropTracedCallback")
+    .AddTraceSource ("Fanout",
+                     "Send CCNx packet to all egress connections (one event per packet).",
+                     MakeTraceSourceAccessor (&CCNxStandardLayer3::m_fanoutTrace),
+                     "ns3::ccnx::CCNxStandardLayer3::FanoutTracedCallback")
   ;
   return tid;
 }
@@ -344,35 +348,43 @@ CCNxStandardLayer3::RouteCallback (Ptr<CCNxPacket> ccnxPacket, Ptr<CCNxConnectio
                                    enum CCNxRoutingError::RoutingErrno routingErrno, Ptr<CCNxConnectionList> egress)
 {
 
+  // Serialize once, every egress connection sends a copy-on-write view of this buffer
+  Ptr<const Packet> ns3Packet = ccnxPacket->PeekNs3Packet ();
+
   if (egress->size () == 0)
     {
       NS_LOG_WARN ("forwarder return an empty result " << *ccnxPacket->GetMessage ()->GetName ());
-      m_dropTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, ingress->GetConnectionId (), DROP_NO_ROUTE);
+      m_dropTrace (this, ns3Packet, ccnxPacket, ingress->GetConnectionId (), DROP_NO_ROUTE);
+      return;
     }
 
-  Ptr<CCNxConnection> egressFromForwarder;
+  if (routingErrno != CCNxRoutingError::CCNxRoutingError_NoError)
+    {
+      NS_LOG_WARN ("Routing Error " << *ccnxPacket->GetMessage ()->GetName ());
+      m_dropTrace (this, ns3Packet, ccnxPacket, ingress->GetConnectionId (), DROP_NO_ROUTE);
+      return;
+    }
 
+  uint32_t sentCount = 0;
   for (CCNxConnectionList::iterator it = egress->begin (); it != egress->end (); it++)
     {
-      egressFromForwarder = *it;      //TODO send to all connections not just the first
+      Ptr<CCNxConnection> egressFromForwarder = *it;
 
-      if (routingErrno == CCNxRoutingError::CCNxRoutingError_NoError)
+      NS_LOG_DEBUG ("SendCCNxPacket using egress connid " << egressFromForwarder->GetConnectionId () << " packet " << *ns3Packet);
+      m_txTrace (this, ns3Packet, ccnxPacket, egressFromForwarder->GetConnectionId ());
+      bool result = egressFromForwarder->Send (ccnxPacket, ingress);
+      if (result)
         {
-          NS_LOG_DEBUG ("SendCCNxPacket using egress connid " << egressFromForwarder->GetConnectionId () << " packet " << *ccnxPacket->CreateNs3Packet ());
-          m_txTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, egressFromForwarder->GetConnectionId ());
-          bool result = egressFromForwarder->Send (ccnxPacket, ingress);
-          if (!result)     //Send failed
-            {
-              NS_LOG_WARN ("Send failed!");
-              m_dropTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, -1, DROP_INTERFACE_DOWN);
-            }
+          sentCount++;
         }
-      else
+      else     //Send failed
         {
-          NS_LOG_WARN ("Routing Error " << *ccnxPacket->GetMessage ()->GetName ());
-          m_dropTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, ingress->GetConnectionId (), DROP_NO_ROUTE);
+          NS_LOG_WARN ("Send failed!");
+          m_dropTrace (this, ns3Packet, ccnxPacket, -1, DROP_INTERFACE_DOWN);
         }
     }
+
+  m_fanoutTrace (this, ns3Packet, ccnxPacket, egress, sentCount);
 }
 
 bool
@@ -401,7 +413,7 @@ CCNxStandardLayer3::SendFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPack
   NS_LOG_FUNCTION (this << &protocol << ccnxPacket);
 
   // serialize it
-  Ptr<Packet> ns3Packet = ccnxPacket->CreateNs3Packet ();
+  Ptr<const Packet> ns3Packet = ccnxPacket->PeekNs3Packet ();
 
   m_rxTrace (this, ns3Packet, ccnxPacket, id);
 
@@ -422,6 +434,37 @@ CCNxStandardLayer3::SendFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPack
   return result;
 }
 
+size_t
+CCNxStandardLayer3::SendBatchFromLayer4 (const CCNxL4Protocol &protocol, const CCNxL4Protocol::PacketBatchType &packets)
+{
+  CCNxL4Protocol::CCNxL4Id id = protocol.GetInstanceId ();
+  NS_LOG_FUNCTION (this << &protocol << packets.size ());
+
+  for (CCNxL4Protocol::PacketBatchType::const_iterator p = packets.begin (); p != packets.end (); ++p)
+    {
+      m_rxTrace (this, (*p)->PeekNs3Packet (), *p, id);
+    }
+
+  L4MapType::iterator i = m_protocols.find (id);
+  if (i == m_protocols.end ())
+    {
+      NS_LOG_ERROR ("SendBatchFromLayer4 l4id " << id << " : Could not find protocol id");
+      for (CCNxL4Protocol::PacketBatchType::const_iterator p = packets.begin (); p != packets.end (); ++p)
+        {
+          m_dropTrace (this, (*p)->PeekNs3Packet (), *p, id, DROP_ROUTE_ERROR);
+        }
+      NS_ASSERT_MSG (i != m_protocols.end (), "Could not find protocol id " << id);
+      return 0;
+    }
+
+  if (!packets.empty ())
+    {
+      NS_LOG_DEBUG ("Layer4RouteOut batch of " << packets.size () << " ingress connid " << i->second->GetConnectionId ());
+      m_forwarder->RouteOutputBatch (packets, i->second, Ptr<CCNxConnection> (0));
+    }
+  return packets.size ();
+}
+
 bool
 CCNxStandardLayer3::SendToFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPacket> ccnxPacket, uint32_t egressConnectionId)
 {
@@ -431,7 +474,7 @@ CCNxStandardLayer3::SendToFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPa
   NS_LOG_FUNCTION (this << &protocol << ccnxPacket);
 
   // serialize it
-  Ptr<Packet> ns3Packet = ccnxPacket->CreateNs3Packet ();
+  Ptr<const Packet> ns3Packet = ccnxPacket->PeekNs3Packet ();
 
   m_rxTrace (this, ns3Packet, ccnxPacket, id);
 
@@ -467,11 +510,9 @@ CCNxStandardLayer3::ReceiveFromLayer2 (Ptr<NetDevice> device, Ptr<const Packet>
                                        uint16_t protocol, const Address &from,
                                        const Address &to, NetDevice::PacketType packetType)
 {
-  Ptr<Packet> packet = p->Copy ();
-
-  NS_LOG_FUNCTION (this << device << packet << protocol << from << to << packetType);
+  NS_LOG_FUNCTION (this << device << p << protocol << from << to << packetType);
 
-  NS_LOG_DEBUG ("Node " << m_node->GetId () << " Packet from " << from << " size " << packet->GetSize () << " packet " << *p);
+  NS_LOG_DEBUG ("Node " << m_node->GetId () << " Packet from " << from << " size " << p->GetSize () << " packet " << *p);
 
 
   // If the L3 interface is down, drop the packet
@@ -493,9 +534,10 @@ CCNxStandardLayer3::ReceiveFromLayer2 (Ptr<NetDevice> device, Ptr<const Packet>
         }
 
       // Deserialize the packet, then grab the output from the ccnxPacket, as that
-      // will be properly trimed of any layer 3 bloat in the ns3 packet.
-      Ptr<CCNxPacket> ccnxPacket = CCNxPacket::CreateFromNs3Packet (packet);
-      packet = ccnxPacket->CreateNs3Packet ();
+      // will be properly trimed of any layer 3 bloat in the ns3 packet.  The ccnxPacket
+      // references the received packet, it is not copied unless it had to be trimmed.
+      Ptr<CCNxPacket> ccnxPacket = CCNxPacket::CreateFromNs3Packet (p);
+      Ptr<const Packet> packet = ccnxPacket->PeekNs3Packet ();
 
       NS_ASSERT_MSG (ccnxPacket->GetFixedHeader ()->GetPacketLength () == packet->GetSize (),
                      "Packet wrong size, FixedHeader = " << (uint32_t) ccnxPacket->GetFixedHeader ()->GetPacketLength () <<
@@ -245,6 +245,16 @@ public:
    */
   bool SendToFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPacket> ccnxPacket, uint32_t egressConnectionId);
 
+  /**
+   * Looks up the protocol once and passes the whole batch to the forwarder with
+   * a single CCNxForwarder::RouteOutputBatch().
+   *
+   * @param [in] protocol L4 protocol to be used for sending the packets
+   * @param [in] packets The packets to send
+   * @return The number of packets forwarded
+   */
+  size_t SendBatchFromLayer4 (const CCNxL4Protocol &protocol, const CCNxL4Protocol::PacketBatchType &packets);
+
   /**
    * L2 calls this based on CCNxL3Protocol registering a Protocol Number
    * callback with NS3.
@@ -357,6 +367,11 @@ protected:
   /**
    * Asynchronous callback from `CCNxForwarder::RouteIn()` and `CCNxForwarder::RouteOut()`.
    *
+   * The packet is sent on every egress connection.  It is serialized once and each connection
+   * sends a copy-on-write view of the same buffer, so only the headers added below layer 3
+   * are per connection.  The "Tx" trace fires per connection and the "Fanout" trace fires
+   * once with the whole egress list.
+   *
    * @param packet [in] The packet being routed
    * @param ingress [in] The ingress connection of the packet
    * @param routingErrno [in] The route error (if any)
@@ -409,6 +424,9 @@ private:
 
   /* Trace of dropped packets */
   TracedCallback<const CCNxL3Protocol *, Ptr<const Packet>, Ptr<const CCNxPacket>, uint32_t, DropReason> m_dropTrace;
+
+  /* Trace of routed packets, once per packet for all egress connections */
+  TracedCallback<const CCNxL3Protocol *, Ptr<const Packet>, Ptr<const CCNxPacket>, Ptr<const CCNxConnectionList>, uint32_t> m_fanoutTrace;
 };
 
 } // namespace ccnx
@@ -56,12 +56,112 @@
 #include "ns3/tag.h"
 #include "ns3/ccnx-packet.h"
 #include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/enum.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
 
 NS_LOG_COMPONENT_DEFINE ("CCNxPacket");
 
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-packet
+ *
+ * Decodes a whole CCNx packet (fixed header, per hop headers, and message) with one
+ * ns3::Packet::PeekHeader(), so the received ns3::Packet does not need to be copied to
+ * remove the headers one at a time.  It uses the codecs of the CCNxPacket being decoded.
+ *
+ * This is only used for decoding, it cannot be serialized.
+ */
+class CCNxCodecPacketPeek : public Header
+{
+public:
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::ccnx::CCNxCodecPacketPeek")
+      .SetParent<Header> ()
+      .SetGroupName ("CCNx");
+    return tid;
+  }
+
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+
+  /**
+   * @param lazySource [in] If not null, the packet being peeked, and the message is decoded lazily
+   */
+  CCNxCodecPacketPeek (CCNxCodecFixedHeader &fixedHeader, CCNxCodecInterest &interest, CCNxCodecContentObject &contentObject,
+                       Ptr<const Packet> lazySource)
+    : m_fixedHeader (fixedHeader), m_interest (interest), m_contentObject (contentObject), m_lazySource (lazySource)
+  {
+  }
+
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return m_fixedHeader.GetFixedHeader ()->GetPacketLength ();
+  }
+
+  virtual void Serialize (Buffer::Iterator start) const
+  {
+    NS_ASSERT_MSG (false, "CCNxCodecPacketPeek is only used to decode");
+  }
+
+  virtual uint32_t Deserialize (Buffer::Iterator start)
+  {
+    uint32_t bytes = m_fixedHeader.Deserialize (start);
+    NS_LOG_DEBUG ("Deserialize: hdrSize = " << bytes);
+    start.Next (bytes);
+
+    switch (m_fixedHeader.GetFixedHeader ()->GetPacketType ())
+      {
+      case CCNxFixedHeaderType_Interest:
+        {
+          if (m_lazySource)
+            {
+              m_interest.SetLazySource (m_lazySource, bytes);
+            }
+          uint32_t msgSize = m_interest.Deserialize (start);
+          NS_LOG_DEBUG ("Deserialize: interest = " << msgSize);
+          bytes += msgSize;
+          break;
+        }
+      case CCNxFixedHeaderType_Object:
+        {
+          if (m_lazySource)
+            {
+              m_contentObject.SetLazySource (m_lazySource, bytes);
+            }
+          uint32_t msgSize = m_contentObject.Deserialize (start);
+          NS_LOG_DEBUG ("Deserialize: content = " << msgSize);
+          bytes += msgSize;
+          break;
+        }
+      default:
+        NS_ASSERT_MSG (false, "Unsupported Packet Type");
+      }
+    return bytes;
+  }
+
+  virtual void Print (std::ostream &os) const
+  {
+    m_fixedHeader.Print (os);
+  }
+
+private:
+  CCNxCodecFixedHeader &m_fixedHeader;
+  CCNxCodecInterest &m_interest;
+  CCNxCodecContentObject &m_contentObject;
+  Ptr<const Packet> m_lazySource;
+};
+
+} // namespace ccnx
+} // namespace ns3
+
 //static inline void
 //hexdump (const char *label, size_t size, const uint8_t *data)
 //{
@@ -80,6 +180,20 @@ NS_LOG_COMPONENT_DEFINE ("CCNxPacket");
 //        }
 //}
 
+static GlobalValue g_decodeMode ("CCNxPacketDecodeMode",
+                                 "How CCNxPacket decodes received messages",
+                                 EnumValue (CCNxPacket::DecodeMode_Eager),
+                                 MakeEnumChecker (CCNxPacket::DecodeMode_Eager, "Eager",
+                                                  CCNxPacket::DecodeMode_Lazy, "Lazy"));
+
+CCNxPacket::DecodeMode
+CCNxPacket::GetDecodeMode ()
+{
+  EnumValue mode;
+  g_decodeMode.GetValue (mode);
+  return (DecodeMode) mode.Get ();
+}
+
 Ptr<CCNxPacket>
 CCNxPacket::CreateFromMessage (Ptr<CCNxMessage> message)
 {
@@ -88,6 +202,7 @@ CCNxPacket::CreateFromMessage (Ptr<CCNxMessage> message)
   packet->m_message = message;
   packet->m_codecFixedHeader.SetFixedHeader (packet->GenerateFixedHeader (message->GetMessageType ()));
   packet->m_ns3Packet = 0;
+  packet->m_hashPending = message->GetMessageType () == CCNxMessage::ContentObject;
   return packet;
 }
 
@@ -100,6 +215,7 @@ CCNxPacket::CreateFromMessage (Ptr<CCNxMessage> message, Ptr<CCNxValidation> val
   packet->m_validation = validation;
   packet->m_codecFixedHeader.SetFixedHeader (packet->GenerateFixedHeader (message->GetMessageType ()));
   packet->m_ns3Packet = 0;
+  packet->m_hashPending = message->GetMessageType () == CCNxMessage::ContentObject;
   return packet;
 }
 
@@ -108,13 +224,16 @@ CCNxPacket::CreateFromNs3Packet (Ptr<const Packet> ns3Packet)
 {
   // We cannot use Create<CCNxPacket>() because the call to the protected method needs to be here.
   Ptr<CCNxPacket> packet = Ptr<CCNxPacket> (new CCNxPacket (), false);
-  packet->m_ns3Packet = ns3Packet->Copy ();
+
+  // No copy, we only read from it.  See TrimNs3Packet() for the one case we need to change it.
+  packet->m_ns3Packet = ns3Packet;
 
   packet->Deserialize ();
   return packet;
 }
 
-CCNxPacket::CCNxPacket () : m_hash (0)
+CCNxPacket::CCNxPacket () : m_ns3PacketFixedHeaderGeneration (0), m_ns3PacketPerHopGeneration (0),
+  m_ns3PacketMessageOffset (0), m_ns3PacketMessageLength (0), m_hash (0), m_hashPending (false)
 {
   // emtpy protected method
 }
@@ -127,19 +246,47 @@ CCNxPacket::~CCNxPacket ()
 void CCNxPacket::DoDispose (void)
 {
   m_ns3Packet = 0;
+  m_lazyHash = 0;
+  m_encodedMessage = 0;
 }
 
-Ptr<Packet>
-CCNxPacket::CreateNs3Packet ()
+void
+CCNxPacket::SetNs3PacketCurrent ()
 {
-  if (m_ns3Packet == NULL)
+  m_ns3PacketFixedHeaderGeneration = GetFixedHeader ()->GetGeneration ();
+  m_ns3PacketPerHopGeneration = GetPerhopHeaders ()->GetGeneration ();
+  m_ns3PacketMessageOffset = GetFixedHeader ()->GetHeaderLength ();
+  m_ns3PacketMessageLength = GetFixedHeader ()->GetPacketLength () - m_ns3PacketMessageOffset;
+}
+
+void
+CCNxPacket::UpdateNs3Packet ()
+{
+  if (m_ns3Packet == NULL
+      || m_ns3PacketFixedHeaderGeneration != GetFixedHeader ()->GetGeneration ()
+      || m_ns3PacketPerHopGeneration != GetPerhopHeaders ()->GetGeneration ())
     {
       m_ns3Packet = GenerateNs3Packet ();
+      SetNs3PacketCurrent ();
     }
+}
 
+Ptr<Packet>
+CCNxPacket::CreateNs3Packet ()
+{
+  UpdateNs3Packet ();
+
+  // Copy-on-write, this does not copy the buffer
   return m_ns3Packet->Copy ();
 }
 
+Ptr<const Packet>
+CCNxPacket::PeekNs3Packet ()
+{
+  UpdateNs3Packet ();
+  return m_ns3Packet;
+}
+
 Ptr<CCNxFixedHeader>
 CCNxPacket::GetFixedHeader () const
 {
@@ -167,10 +314,18 @@ CCNxPacket::GetPerhopHeaders() const
 size_t
 CCNxPacket::ComputePacketSize () const
 {
-  size_t length = 0;
+  return m_codecFixedHeader.GetSerializedSize () + GetMessageLength ();
+}
 
-  length += m_codecFixedHeader.GetSerializedSize ();
+uint32_t
+CCNxPacket::GetMessageLength () const
+{
+  if (m_ns3Packet)
+    {
+      return m_ns3PacketMessageLength;
+    }
 
+  uint32_t length = 0;
   CCNxMessage::MessageType messageType = m_message->GetMessageType ();
   if ( messageType == CCNxMessage::Interest)
     {
@@ -201,14 +356,21 @@ CCNxPacket::ComputePacketSize () const
 Ptr<Packet>
 CCNxPacket::GenerateNs3Packet ()
 {
+  // GenerateFixedHeader() needs the message length of the old wire format, so make it first
   Ptr<CCNxFixedHeader> fh = GenerateFixedHeader (m_message->GetMessageType ());
-  m_codecFixedHeader.SetFixedHeader (fh);
-
-  Ptr<Packet> p = Create<Packet> ();
 
+  Ptr<Packet> p;
   CCNxMessage::MessageType messageType = m_message->GetMessageType ();
-  if ( messageType == CCNxMessage::Interest)
+  if (m_ns3Packet)
+    {
+      // Only the fixed header or per hop headers changed.  The fragment shares the buffer.
+      p = m_ns3Packet->CreateFragment (m_ns3PacketMessageOffset, m_ns3PacketMessageLength);
+      p->RemoveAllPacketTags ();
+      p->RemoveAllByteTags ();
+    }
+  else if ( messageType == CCNxMessage::Interest)
     {
+      p = Create<Packet> ();
       Ptr<CCNxInterest> interest = DynamicCast<CCNxInterest, CCNxMessage> (m_message);
       m_codecInterest.SetHeader (interest);
       p->AddHeader (m_codecInterest);
@@ -216,9 +378,24 @@ CCNxPacket::GenerateNs3Packet ()
     }
   else if (messageType == CCNxMessage::ContentObject)
     {
-      Ptr<CCNxContentObject> content = DynamicCast<CCNxContentObject, CCNxMessage> (m_message);
-      m_codecContentObject.SetHeader (content);
-      p->AddHeader (m_codecContentObject);
+      if (m_hashPending)
+        {
+          // Encodes the message into m_encodedMessage and hashes it on the way
+          GetContentObjectHash ();
+        }
+
+      if (m_encodedMessage)
+        {
+          p = m_encodedMessage;
+          m_encodedMessage = 0;
+        }
+      else
+        {
+          p = Create<Packet> ();
+          Ptr<CCNxContentObject> content = DynamicCast<CCNxContentObject, CCNxMessage> (m_message);
+          m_codecContentObject.SetHeader (content);
+          p->AddHeader (m_codecContentObject);
+        }
     }
   else
     {
@@ -226,6 +403,7 @@ CCNxPacket::GenerateNs3Packet ()
     }
 
   // The fixed header/per hop header goes outside the message header
+  m_codecFixedHeader.SetFixedHeader (fh);
   p->AddHeader (m_codecFixedHeader);
 
   size_t expectedSize = ComputePacketSize ();
@@ -271,15 +449,16 @@ CCNxPacket::GetMessageTypeAsPacketType (CCNxMessage::MessageType messageType = C
 uint8_t
 CCNxPacket::GetHopLimit (void) const
 {
-  // FIXME
-  return 0;
+  // Keep the current value when serializing again after a header change
+  Ptr<CCNxFixedHeader> fh = m_codecFixedHeader.GetFixedHeader ();
+  return fh ? fh->GetHopLimit () : 0;
 }
 
 uint8_t
 CCNxPacket::GetReturnCode (void) const
 {
-  // FIXME
-  return 0;
+  Ptr<CCNxFixedHeader> fh = m_codecFixedHeader.GetFixedHeader ();
+  return fh ? fh->GetReturnCode () : 0;
 }
 
 /**
@@ -294,7 +473,11 @@ CCNxPacket::TrimNs3Packet ()
     {
       size_t trimLength = m_ns3Packet->GetSize () - GetFixedHeader ()->GetPacketLength ();
       NS_LOG_INFO ("Trimming " << trimLength << " bytes from end of packet");
-      m_ns3Packet->RemoveAtEnd (trimLength);
+
+      // Someone else may hold the received packet, so trim a copy
+      Ptr<Packet> trimmed = m_ns3Packet->Copy ();
+      trimmed->RemoveAtEnd (trimLength);
+      m_ns3Packet = trimmed;
     }
 }
 
@@ -303,49 +486,71 @@ void
 CCNxPacket::Deserialize ()
 {
   /*
-   * We want to work on a copy so we leave the headers in m_ns3Packet.
-   * That way, we do not need to re-serialize.  The only thing that will change
+   * We peek the headers so we leave them in m_ns3Packet.
+   * That way, we do not need to re-serialize or copy.  The only thing that will change
    * here is we'll trim the packet if layer 2 added trailers.
    */
-  Ptr<Packet> copy = m_ns3Packet->Copy ();
-
-  uint32_t hdrSize = copy->RemoveHeader (m_codecFixedHeader);
-  NS_LOG_DEBUG ("Deserialize: hdrSize = " << hdrSize);
+  bool lazy = GetDecodeMode () == DecodeMode_Lazy;
+  CCNxCodecPacketPeek peek (m_codecFixedHeader, m_codecInterest, m_codecContentObject, lazy ? m_ns3Packet : Ptr<const Packet> (0));
+  m_ns3Packet->PeekHeader (peek);
 
   switch (m_codecFixedHeader.GetFixedHeader ()->GetPacketType ())
     {
     case CCNxFixedHeaderType_Interest:
-      {
-        uint32_t msgSize = copy->RemoveHeader (m_codecInterest);
-        NS_LOG_DEBUG ("Deserialize: interest = " << msgSize);
-        m_message = m_codecInterest.GetHeader ();
-        break;
-      }
+      m_message = m_codecInterest.GetHeader ();
+      break;
     case CCNxFixedHeaderType_Object:
-      {
-        uint32_t msgSize = copy->RemoveHeader (m_codecContentObject);
-        NS_LOG_DEBUG ("Deserialize: content = " << msgSize);
-        m_message = m_codecContentObject.GetHeader ();
-        break;
-      }
+      m_message = m_codecContentObject.GetHeader ();
+      if (lazy)
+        {
+          // Keep the decoder, not the codec: the codec is reused if the packet is serialized again
+          m_lazyHash = m_codecContentObject.GetLazyMessage ();
+        }
+      else
+        {
+          m_hash = m_codecContentObject.GetContentObjectHash ();
+        }
+      break;
     default:
       NS_ASSERT_MSG (false, "Unsupported Packet Type");
     }
 
+  SetNs3PacketCurrent ();
   TrimNs3Packet ();
 }
 
 void
 CCNxPacket::SetContentObjectHash (Ptr<CCNxHashValue> hash)
 {
-  m_hash = hash->GetValue();
+  m_hash = hash;
+  m_lazyHash = 0;
+  m_hashPending = false;
 }
 
 Ptr<CCNxHashValue>
 CCNxPacket::GetContentObjectHash (void) const
 {
-  Ptr<CCNxHashValue> hash = Create<CCNxHashValue> (m_hash.GetValue());
-  return hash;
+  if (m_lazyHash)
+    {
+      m_hash = m_lazyHash->HashMessage ();
+      m_lazyHash = 0;
+    }
+  else if (m_hashPending)
+    {
+      /*
+       * The packet has no wire format yet (making one clears m_hashPending), so encode the
+       * message and hash the TLVs while the codec writes them, as the receiver's decoder will.
+       * GenerateNs3Packet() uses the encoded message, so it is serialized only once.
+       */
+      CCNxCodecContentObject codec;
+      codec.SetHeader (DynamicCast<CCNxContentObject, CCNxMessage> (m_message));
+      codec.SetHashOnSerialize ();
+      m_encodedMessage = Create<Packet> ();
+      m_encodedMessage->AddHeader (codec);
+      m_hash = codec.GetContentObjectHash ();
+      m_hashPending = false;
+    }
+  return m_hash;
 }
 
 void
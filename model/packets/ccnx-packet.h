@@ -87,14 +87,36 @@ namespace ccnx {
  * to avoid using cryptographic functions in simulation.  We only use uint64_t, which the
  * user (applications) are responsible for assigning.
  *
- * The Packet carries a virtual uint64_t hash field that can be used to set the ContentObjectHash
- * value of the packet.  This is supposed to be the SHA256 of the (Message, ValidationAlg).  It is
- * carried as a PacketTag so it is not serialized as part of the packet payload.
- *
- * TODO: the virtual hash is not implemented yet.
+ * The Packet carries a ContentObjectHash.  This is supposed to be the SHA256 of the (Message, ValidationAlg).
+ * A Content Object decoded by CreateFromNs3Packet() gets the hash CCNxCodecContentObject computes while it
+ * parses the message TLVs, so the PIT, content store, and validation never hash the same object again.
+ * A Content Object packet created from a message gets the same hash, computed while the codec
+ * serializes the message, either on the first GetContentObjectHash() or when the wire format is
+ * made, whichever comes first.  Both use the same encoding, so the message is serialized once.  An
+ * application can assign a virtual hash with SetContentObjectHash() instead.  An Interest packet
+ * has no hash.
  *
  * TODO: To access the FixedHeader you have to GetNs3Packet() to serialize it.  That's very expensive.
  *
+ * Zero-copy receive: CreateFromNs3Packet() keeps a read-only reference to the received ns3::Packet
+ * and decodes the headers in place with ns3::Packet::PeekHeader(), so the buffer is not copied.
+ * The ns3::Packet is only copied when it must change: when layer 2 left trailing bytes that need
+ * to be trimmed, or when CreateNs3Packet() hands a packet to a caller that may add headers to it.
+ * Serialize once: the wire format is cached in the CCNxPacket and CreateNs3Packet() hands out
+ * ns3::Packet::Copy() of it, which is copy-on-write and shares the buffer.  The cache is only
+ * serialized again if the fixed header or per hop headers changed since it was made (e.g. via
+ * AddPerHopHeaderEntry() or CCNxFixedHeader::SetHopLimit()).  Only the fixed header and per hop
+ * headers are encoded again, the message bytes are shared with the previous wire format.  This
+ * keeps message TLVs the codecs do not decode, and does not decode a lazily decoded message.
+ *
+ * Lazy decode: with the global value "CCNxPacketDecodeMode" set to "Lazy" (e.g.
+ * `Config::SetGlobal ("CCNxPacketDecodeMode", EnumValue (CCNxPacket::DecodeMode_Lazy))` or
+ * `--CCNxPacketDecodeMode=Lazy`), CreateFromNs3Packet() decodes the fixed header and per hop
+ * headers, but only records where each message field is (see CCNxCodecLazyMessage).  The name,
+ * payload, and other fields are decoded the first time they are read, and the ContentObjectHash
+ * the first time GetContentObjectHash() is called.  A transit node that only reads the name never
+ * copies the payload.
+ *
  * You create a CCNxPacket by using one of the static CreateFromX() methods.
  * This is because there is a problem with overloading constructors in CCNxPacket because they are all flavors
  * of Ptr<foo>, which is ambiguous to the compiler.
@@ -105,6 +127,18 @@ namespace ccnx {
 class CCNxPacket : public SimpleRefCount<CCNxPacket>
 {
 public:
+  typedef enum
+  {
+    DecodeMode_Eager,
+    DecodeMode_Lazy
+  } DecodeMode;
+
+  /**
+   * How CreateFromNs3Packet() decodes messages, from the global value "CCNxPacketDecodeMode".
+   * The default is DecodeMode_Eager.
+   */
+  static DecodeMode GetDecodeMode ();
+
   static Ptr<CCNxPacket> CreateFromMessage (Ptr<CCNxMessage> message);
   static Ptr<CCNxPacket> CreateFromMessage (Ptr<CCNxMessage> message, Ptr<CCNxValidation> validation);
 
@@ -123,25 +157,39 @@ public:
 
   Ptr<CCNxPerHopHeader> GetPerhopHeaders() const;
 
+  /**
+   * Adds a per hop header entry.  This changes the wire format, so the next
+   * CreateNs3Packet() or PeekNs3Packet() serializes again.
+   */
   void AddPerHopHeaderEntry (Ptr<CCNxPerHopHeaderEntry> perHopHeaderEntry);
 
   /**
    * This serializes in to the NS3 Packet format and returns the result.
    *
    * The first call creates a Packet and caches it.  Subsequent calls return
-   * ns3::Packet::Copy() of it.
+   * ns3::Packet::Copy() of it.  Use this if you will send or otherwise change the packet.
    */
   Ptr<Packet> CreateNs3Packet ();
 
+  /**
+   * Like CreateNs3Packet(), but returns the cached ns3::Packet itself, without a copy.  Use this
+   * for read-only access, such as trace sources.
+   *
+   * For a packet from CreateFromNs3Packet(), this is the received ns3::Packet (trimmed to the
+   * fixed header's packet length).
+   */
+  Ptr<const Packet> PeekNs3Packet ();
+
   /**
    * Set a virtual ContentObjectHash on the packet.  The hash is carried along with the packet to
-   * allow "calculating" the hash without using a SHA.  It is carried in an ns3::Packet as a PacketTag.
+   * allow "calculating" the hash without using a SHA.  It replaces the hash computed at decode time.
    */
   void SetContentObjectHash (Ptr<CCNxHashValue> hash);
 
   /**
-   * Get a virtual ContentObjectHash on the packet.  The hash is carried along with the packet to
-   * allow "calculating" the hash without using a SHA.  It is carried in an ns3::Packet as a PacketTag.
+   * Get the ContentObjectHash of the packet.  This is the virtual hash from SetContentObjectHash(),
+   * the hash computed when the packet was decoded or created, or a null pointer if the packet has
+   * none.  It is cached, so only the first call may hash.
    */
   Ptr<CCNxHashValue> GetContentObjectHash (void) const;
 
@@ -166,6 +214,12 @@ protected:
 
   size_t ComputePacketSize (void) const;
 
+  /**
+   * The length of the message (and validation) TLVs.  If there is a wire format, it is the
+   * length in it, otherwise the length from the message codec.
+   */
+  uint32_t GetMessageLength (void) const;
+
   virtual void DoDispose (void);
 
   /**
@@ -174,7 +228,20 @@ protected:
   void Deserialize ();
 
   /**
-   * Trim m_ns3Packet to the length specified in the Fixed Header.
+   * Serialize in to m_ns3Packet if there is no cached wire format or the headers
+   * changed since it was made.
+   */
+  void UpdateNs3Packet ();
+
+  /**
+   * Remember the generation of the fixed header and per hop headers that m_ns3Packet
+   * was made from.
+   */
+  void SetNs3PacketCurrent ();
+
+  /**
+   * Trim m_ns3Packet to the length specified in the Fixed Header.  Only
+   * makes a copy of the packet if it must be trimmed.
    */
   void TrimNs3Packet ();
 
@@ -184,8 +251,15 @@ protected:
 
   Ptr<CCNxMessage> m_message;
   Ptr<CCNxValidation> m_validation;
-  Ptr<Packet> m_ns3Packet;
-  CCNxHashValue m_hash;                              //<! virtual PacketTag for ContentObjectHash
+  Ptr<const Packet> m_ns3Packet;                    //<! read-only, shared with the sender or receiver
+  uint32_t m_ns3PacketFixedHeaderGeneration;        //<! CCNxFixedHeader::GetGeneration() of m_ns3Packet
+  uint32_t m_ns3PacketPerHopGeneration;             //<! CCNxPerHopHeader::GetGeneration() of m_ns3Packet
+  uint32_t m_ns3PacketMessageOffset;                //<! where the message TLVs start in m_ns3Packet
+  uint32_t m_ns3PacketMessageLength;                //<! the length of the message TLVs in m_ns3Packet
+  mutable Ptr<CCNxHashValue> m_hash;                 //<! ContentObjectHash, null if the packet has none
+  mutable Ptr<CCNxCodecLazyMessage> m_lazyHash;      //<! computes m_hash on first use, after a lazy decode
+  mutable bool m_hashPending;                        //<! computes m_hash on first use, for a local Content Object
+  mutable Ptr<Packet> m_encodedMessage;              //<! message TLVs encoded with m_hash, for GenerateNs3Packet()
 };
 
 std::ostream &operator<< (std::ostream &os, CCNxPacket const &packet);
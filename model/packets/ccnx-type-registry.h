@@ -76,6 +76,13 @@ protected:
   typedef typename RegistryMapType::const_iterator ConstIteratorType;
   RegistryMapType m_registry;
 
+  /**
+   * The TLV types in use are small numbers, so they are also kept in an array indexed
+   * by type.  Lookup() of one of them does not search the map.
+   */
+  static const size_t m_directSize = 16;
+  Ptr<RegistryClass> m_direct[m_directSize];
+
 public:
   /**
    * A generic registry of TLV type to codec.
@@ -96,6 +103,10 @@ public:
   {
     NS_ASSERT_MSG(m_registry[tlvType] == 0, "Can't overwrite the registered class for type " << tlvType);
     m_registry[tlvType] = registeredClass;
+    if (tlvType < m_directSize)
+      {
+        m_direct[tlvType] = registeredClass;
+      }
   }
 
   /**
@@ -108,10 +119,19 @@ public:
   void UnRegister(TlvType tlvType)
   {
     m_registry.erase(tlvType);
+    if (tlvType < m_directSize)
+      {
+        m_direct[tlvType] = 0;
+      }
   }
 
   Ptr<RegistryClass> Lookup(TlvType tlvType)
   {
+    if (tlvType < m_directSize)
+      {
+        return m_direct[tlvType];
+      }
+
     Ptr<RegistryClass> registeredClass = Ptr<RegistryClass>(0);
     ConstIteratorType i = m_registry.find(tlvType);
     if (i != m_registry.end()) {
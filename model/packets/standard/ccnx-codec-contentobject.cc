@@ -57,6 +57,7 @@
 #include "ccnx-codec-contentobject.h"
 #include "ns3/ccnx-schema-v1.h"
 #include "ns3/ccnx-tlv.h"
+#include "ns3/ccnx-hasher-fnv1a.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -115,6 +116,8 @@ CCNxCodecContentObject::Serialize (Buffer::Iterator outputIterator) const
   uint16_t bytes = (uint16_t) GetSerializedSize ();
   NS_ASSERT_MSG (bytes >= CCNxTlv::GetTLSize (), "Serialized size must be at least 4 bytes");
 
+  Buffer::Iterator messageStart = outputIterator;
+
   // -4 because it includes the T_OBJECT TLV.
   CCNxTlv::WriteTypeLength (outputIterator, CCNxSchemaV1::T_OBJECT, bytes - CCNxTlv::GetTLSize ());
 
@@ -144,6 +147,15 @@ CCNxCodecContentObject::Serialize (Buffer::Iterator outputIterator) const
       CCNxTlv::WriteTypeLength (outputIterator, CCNxSchemaV1::T_PAYLOAD, (uint16_t) payload->GetSize ());
       outputIterator.Write (payload->Begin (), payload->End ());
     }
+
+  if (m_hashOnSerialize)
+    {
+      // The TLVs were just written, so hash them while they are still in cache
+      Ptr<CCNxHasher> hasher = GetHasher ();
+      hasher->Init ();
+      hasher->Update (messageStart, bytes);
+      m_hash = hasher->Finalize ();
+    }
 }
 
 uint32_t
@@ -155,12 +167,37 @@ CCNxCodecContentObject::Deserialize (Buffer::Iterator inputIterator)
 
   uint32_t bytesRead = 0;
 
+  m_hash = 0;
+  m_lazyMessage = 0;
+  if (m_lazyPacket)
+    {
+      m_lazyMessage = Create<CCNxCodecLazyMessage> (m_lazyPacket);
+      m_lazyPacket = 0;
+    }
+
+  Ptr<CCNxHasher> hasher;
+  if (!m_lazyMessage)
+    {
+      hasher = GetHasher ();
+      hasher->Init ();
+    }
+
   uint16_t messageType = CCNxTlv::ReadType (iterator);
   if (messageType == CCNxSchemaV1::T_OBJECT)
     {
       uint16_t messageLength = CCNxTlv::ReadLength (iterator);
       NS_LOG_DEBUG ("Message type " << messageType << " length " << messageLength);
 
+      if (m_lazyMessage)
+        {
+          m_lazyMessage->SetMessage (m_lazyOffset, messageLength);
+          uint32_t bytesIndexed = IndexFields (iterator, messageLength);
+          m_content = Create<CCNxContentObject> (m_lazyMessage);
+          return bytesIndexed + CCNxTlv::GetTLSize ();
+        }
+
+      hasher->Update (inputIterator, CCNxTlv::GetTLSize ());
+
       // Do not count the initial 4 bytes read until the very end so we can compare
       // bytesRead against messageLength (which is the inner length)
 
@@ -171,6 +208,7 @@ CCNxCodecContentObject::Deserialize (Buffer::Iterator inputIterator)
 
       while (bytesRead < messageLength)
         {
+          Buffer::Iterator tlvStart = iterator;
           uint16_t nestedType = CCNxTlv::ReadType (iterator);
           uint16_t nestedLength = CCNxTlv::ReadLength (iterator);
           bytesRead += CCNxTlv::GetTLSize ();
@@ -198,13 +236,19 @@ CCNxCodecContentObject::Deserialize (Buffer::Iterator inputIterator)
               break;
 
             default:
-              NS_ASSERT_MSG (true, "Unknown nested type " << nestedType);
+              // Skip it, the bytes stay in the received packet (see CCNxPacket::GenerateNs3Packet)
+              NS_LOG_DEBUG ("Skipping unknown nested type " << nestedType);
+              iterator.Next (nestedLength);
+              break;
             }
 
+          // The TLV was just read, so hash it while it is still in cache
+          hasher->Update (tlvStart, CCNxTlv::GetTLSize () + nestedLength);
           bytesRead += nestedLength;
         }
 
       m_content = Create<CCNxContentObject> (name, payload, payloadType, expiryTime);
+      m_hash = hasher->Finalize ();
     }
   else
     {
@@ -215,6 +259,52 @@ CCNxCodecContentObject::Deserialize (Buffer::Iterator inputIterator)
   return bytesRead + CCNxTlv::GetTLSize ();
 }
 
+uint32_t
+CCNxCodecContentObject::IndexFields (Buffer::Iterator &start, uint16_t messageLength)
+{
+  NS_LOG_FUNCTION (this << &start);
+
+  // The first nested TLV follows the T_OBJECT TL
+  uint32_t bytesRead = 0;
+  while (bytesRead < messageLength)
+    {
+      uint32_t offset = m_lazyOffset + CCNxTlv::GetTLSize () + bytesRead;
+      uint16_t nestedType = CCNxTlv::ReadType (start);
+      uint16_t nestedLength = CCNxTlv::ReadLength (start);
+      bytesRead += CCNxTlv::GetTLSize ();
+
+      NS_ASSERT_MSG (bytesRead + nestedLength <= messageLength, "length goes beyond end of messageLength");
+
+      switch (nestedType)
+        {
+        case CCNxSchemaV1::T_NAME:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::Name, offset, nestedLength);
+          break;
+
+        case CCNxSchemaV1::T_PAYLDTYPE:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::PayloadType, offset, nestedLength);
+          break;
+
+        case CCNxSchemaV1::T_EXPIRY:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::ExpiryTime, offset, nestedLength);
+          break;
+
+        case CCNxSchemaV1::T_PAYLOAD:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::Payload, offset, nestedLength);
+          break;
+
+        default:
+          // The bytes stay in the received packet, as in the eager decode
+          NS_LOG_DEBUG ("Skipping unknown nested type " << nestedType);
+          break;
+        }
+
+      start.Next (nestedLength);
+      bytesRead += nestedLength;
+    }
+  return bytesRead;
+}
+
 Ptr<const CCNxName>
 CCNxCodecContentObject::DeserializeName (Buffer::Iterator &start, uint16_t length)
 {
@@ -286,7 +376,8 @@ CCNxCodecContentObject::Print (std::ostream &os) const
     }
 }
 
-CCNxCodecContentObject::CCNxCodecContentObject () : m_content (0)
+CCNxCodecContentObject::CCNxCodecContentObject () : m_content (0), m_hasher (0), m_hash (0),
+  m_hashOnSerialize (false), m_lazyOffset (0)
 {
   // empty
 }
@@ -307,6 +398,48 @@ CCNxCodecContentObject::SetHeader (Ptr<CCNxContentObject> content)
 {
   m_content = content;
   m_nameCodec.SetHeader (m_content->GetName ());
+  m_hash = 0;
+  m_hashOnSerialize = false;
+  m_lazyMessage = 0;
+}
+
+void
+CCNxCodecContentObject::SetHashOnSerialize ()
+{
+  m_hashOnSerialize = true;
+}
+
+void
+CCNxCodecContentObject::SetLazySource (Ptr<const Packet> packet, uint32_t offset)
+{
+  m_lazyPacket = packet;
+  m_lazyOffset = offset;
+}
+
+Ptr<CCNxHashValue>
+CCNxCodecContentObject::GetContentObjectHash () const
+{
+  if (!m_hash && m_lazyMessage)
+    {
+      m_hash = m_lazyMessage->HashMessage ();
+    }
+  return m_hash;
+}
+
+Ptr<CCNxHasher>
+CCNxCodecContentObject::GetHasher () const
+{
+  if (!m_hasher)
+    {
+      m_hasher = CreateObject<CCNxHasherFnv1a> ();
+    }
+  return m_hasher;
+}
+
+Ptr<CCNxCodecLazyMessage>
+CCNxCodecContentObject::GetLazyMessage () const
+{
+  return m_lazyMessage;
 }
 
 uint8_t
@@ -59,6 +59,8 @@
 #include "ns3/header.h"
 #include "ns3/ccnx-contentobject.h"
 #include "ns3/ccnx-codec-name.h"
+#include "ns3/ccnx-hasher.h"
+#include "ns3/ccnx-codec-lazy-message.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -67,6 +69,14 @@ namespace ccnx {
  * @ingroup ccnx-packet
  *
  * Codec for reading/writing a CCNxContentObject message
+ *
+ * Deserialize() also computes the ContentObjectHash.  Each TLV is fed to a CCNxHasher
+ * right after it is parsed, so the bytes are only walked once and the hash is ready
+ * when the message is.
+ *
+ * In lazy mode (SetLazySource()), Deserialize() only records where each field is.  The
+ * Content Object decodes a field the first time it is read, and the hash is computed by
+ * the first GetContentObjectHash().
  */
 class CCNxCodecContentObject : public Header
 {
@@ -127,6 +137,35 @@ public:
    */
   void SetHeader (Ptr<CCNxContentObject> content);
 
+  /**
+   * Makes the next Deserialize() lazy.  It reads only the Type and Length of each field and
+   * creates the message with a CCNxCodecLazyMessage that decodes fields from `packet` on
+   * demand.  Applies to one Deserialize().
+   *
+   * @param packet [in] The packet being deserialized
+   * @param offset [in] The byte offset in `packet` of the iterator given to Deserialize()
+   */
+  void SetLazySource (Ptr<const Packet> packet, uint32_t offset);
+
+  /**
+   * Makes Serialize() hash the TLV bytes it writes, the same bytes Deserialize() hashes, so a
+   * Content Object has the same hash before and after it is sent.  Applies until the next
+   * SetHeader().
+   */
+  void SetHashOnSerialize ();
+
+  /**
+   * The ContentObjectHash of the bytes read by the last Deserialize(), or written by the last
+   * Serialize() after SetHashOnSerialize().  Otherwise null if the Content Object came from
+   * SetHeader().  After a lazy Deserialize(), the first call computes it.
+   */
+  Ptr<CCNxHashValue> GetContentObjectHash () const;
+
+  /**
+   * The field decoder of the last lazy Deserialize(), null otherwise.
+   */
+  Ptr<CCNxCodecLazyMessage> GetLazyMessage () const;
+
   /**
    * Maps the enum payload type to the schema value.
    */
@@ -145,6 +184,30 @@ private:
   Ptr<CCNxContentObject> m_content;
   CCNxCodecName m_nameCodec;
 
+  /**
+   * Created on first use, so codecs that only serialize without hashing do not allocate it.
+   */
+  mutable Ptr<CCNxHasher> m_hasher;
+  mutable Ptr<CCNxHashValue> m_hash;
+  bool m_hashOnSerialize;           //<! from SetHashOnSerialize(), cleared by SetHeader()
+
+  Ptr<const Packet> m_lazyPacket;   //<! from SetLazySource(), cleared by Deserialize()
+  uint32_t m_lazyOffset;
+  Ptr<CCNxCodecLazyMessage> m_lazyMessage;
+
+  /**
+   * Lazy Deserialize(): start points to the first TLV in the message.  Records the offset of
+   * each field in m_lazyMessage and skips its value.
+   *
+   * @return The number of bytes read (messageLength)
+   */
+  uint32_t IndexFields (Buffer::Iterator &start, uint16_t messageLength);
+
+  /**
+   * m_hasher, created on the first call.
+   */
+  Ptr<CCNxHasher> GetHasher () const;
+
   /**
    * The start iterator points to the T_NAME Value.  It will be rewinded 4
    * bytes and passed to m_nameCodec for processing.  Side effect is that m_nameCodec
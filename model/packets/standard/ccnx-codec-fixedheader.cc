@@ -57,6 +57,7 @@
 #include "ccnx-codec-fixedheader.h"
 #include "ns3/ccnx-tlv.h"
 #include "ccnx-codec-registry.h"
+#include "ccnx-codec-unknownperhopheaderentry.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -93,8 +94,7 @@ CCNxCodecFixedHeader::GetSerializedSize (void) const
   {
     Ptr<CCNxPerHopHeaderEntry> perhopEntry = GetPerHopHeader()->GetHeader(i);
     uint16_t type = perhopEntry->GetInstanceTLVType();
-    Ptr<CCNxCodecPerHopHeaderEntry> codec = CCNxCodecRegistry::PerHopLookupCodec(type);
-    NS_ASSERT_MSG ( (codec), "Could not find codec for type " << type);
+    Ptr<CCNxCodecPerHopHeaderEntry> codec = LookupCodec(type);
     length += codec->GetSerializedSize(perhopEntry);
   }
 
@@ -119,8 +119,7 @@ CCNxCodecFixedHeader::Serialize (Buffer::Iterator start) const
   {
       Ptr<CCNxPerHopHeaderEntry> perhopEntry = GetPerHopHeader()->GetHeader(k);
       uint16_t type = perhopEntry->GetInstanceTLVType();
-      Ptr<CCNxCodecPerHopHeaderEntry> codec = CCNxCodecRegistry::PerHopLookupCodec(type);
-      NS_ASSERT_MSG ( (codec), "Could not find codec for type " << type);
+      Ptr<CCNxCodecPerHopHeaderEntry> codec = LookupCodec(type);
       codec->Serialize(perhopEntry, &i);
   }
 }
@@ -158,8 +157,7 @@ CCNxCodecFixedHeader::Deserialize (Buffer::Iterator start)
       // backup to start of TLV
       i.Prev(CCNxTlv::GetTLSize());
 
-      Ptr<CCNxCodecPerHopHeaderEntry> codec = CCNxCodecRegistry::PerHopLookupCodec(type);
-      NS_ASSERT_MSG ( (codec), "Could not find codec for type " << type);
+      Ptr<CCNxCodecPerHopHeaderEntry> codec = LookupCodec(type);
 
       size_t bytesRead = 0;
       Ptr<CCNxPerHopHeaderEntry> perHopHeaderEntry = codec->Deserialize(&i, &bytesRead);
@@ -192,8 +190,7 @@ CCNxCodecFixedHeader::Print (std::ostream &os) const
   {
       Ptr<CCNxPerHopHeaderEntry> perhopEntry = GetPerHopHeader()->GetHeader(i);
       uint16_t type = perhopEntry->GetInstanceTLVType();
-      Ptr<CCNxCodecPerHopHeaderEntry> codec = CCNxCodecRegistry::PerHopLookupCodec(type);
-      NS_ASSERT_MSG ( (codec), "Could not find codec for type " << type);
+      Ptr<CCNxCodecPerHopHeaderEntry> codec = LookupCodec(type);
       codec->Print(perhopEntry, os);
   }
 }
@@ -226,6 +223,18 @@ CCNxCodecFixedHeader::GetPerHopHeader () const
   return m_perHopHeader;
 }
 
+Ptr<CCNxCodecPerHopHeaderEntry>
+CCNxCodecFixedHeader::LookupCodec (uint16_t type)
+{
+  Ptr<CCNxCodecPerHopHeaderEntry> codec = CCNxCodecRegistry::PerHopLookupCodec (type);
+  if (!codec)
+    {
+      static Ptr<CCNxCodecPerHopHeaderEntry> unknownCodec = CreateObject<CCNxCodecUnknownPerHopHeaderEntry> ();
+      codec = unknownCodec;
+    }
+  return codec;
+}
+
 CCNxFixedHeaderType
 CCNxCodecFixedHeader::PacketTypeEnumFromValue (uint8_t value)
 {
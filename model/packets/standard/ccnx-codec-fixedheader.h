@@ -70,6 +70,9 @@ namespace ccnx {
  * Codec for reading/writing a CCNxFixedHeader. This codec takes care of
  * reading/writing CCNx Per hop header as well.
  *
+ * A per hop header TLV whose type has no codec in CCNxCodecRegistry is kept as a
+ * CCNxUnknownPerHopHeaderEntry and written back unchanged.
+ *
  */
 class CCNxCodecFixedHeader : public Header
 {
@@ -140,6 +143,12 @@ private:
    */
   static uint8_t PacketTypeValueFromEnum (CCNxFixedHeaderType type);
 
+  /**
+   * The registered codec for the per hop header type, or CCNxCodecUnknownPerHopHeaderEntry
+   * if there is none.
+   */
+  static Ptr<CCNxCodecPerHopHeaderEntry> LookupCodec (uint16_t type);
+
   Ptr<CCNxFixedHeader> m_fixedheader;
 
   Ptr<CCNxPerHopHeader> m_perHopHeader;
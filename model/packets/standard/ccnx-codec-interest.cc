@@ -155,6 +155,7 @@ CCNxCodecInterest::Deserialize (Buffer::Iterator inputIterator)
   Buffer::Iterator iterator = inputIterator;
 
   uint32_t bytesRead = 0;
+  m_lazyMessage = 0;
 
   uint16_t messageType = CCNxTlv::ReadType (iterator);
   if (messageType == CCNxSchemaV1::T_INTEREST)
@@ -162,6 +163,16 @@ CCNxCodecInterest::Deserialize (Buffer::Iterator inputIterator)
       uint16_t messageLength = CCNxTlv::ReadLength (iterator);
       NS_LOG_DEBUG ("Message type " << messageType << " length " << messageLength);
 
+      if (m_lazyPacket)
+        {
+          m_lazyMessage = Create<CCNxCodecLazyMessage> (m_lazyPacket);
+          m_lazyPacket = 0;
+          m_lazyMessage->SetMessage (m_lazyOffset, messageLength);
+          uint32_t bytesIndexed = IndexFields (iterator, messageLength);
+          m_interest = Create<CCNxInterest> (m_lazyMessage);
+          return bytesIndexed + CCNxTlv::GetTLSize ();
+        }
+
       // Do not count the initial 4 bytes read until the very end so we can compare
       // bytesRead against messageLength (which is the inner length)
 
@@ -199,7 +210,10 @@ CCNxCodecInterest::Deserialize (Buffer::Iterator inputIterator)
               break;
 
             default:
-              NS_ASSERT_MSG (true, "Unknown nested type " << nestedType);
+              // Skip it, the bytes stay in the received packet (see CCNxPacket::GenerateNs3Packet)
+              NS_LOG_DEBUG ("Skipping unknown nested type " << nestedType);
+              iterator.Next (nestedLength);
+              break;
             }
 
           bytesRead += nestedLength;
@@ -217,6 +231,52 @@ CCNxCodecInterest::Deserialize (Buffer::Iterator inputIterator)
   return bytesRead + CCNxTlv::GetTLSize ();
 }
 
+uint32_t
+CCNxCodecInterest::IndexFields (Buffer::Iterator &start, uint16_t messageLength)
+{
+  NS_LOG_FUNCTION (this << &start);
+
+  // The first nested TLV follows the T_INTEREST TL
+  uint32_t bytesRead = 0;
+  while (bytesRead < messageLength)
+    {
+      uint32_t offset = m_lazyOffset + CCNxTlv::GetTLSize () + bytesRead;
+      uint16_t nestedType = CCNxTlv::ReadType (start);
+      uint16_t nestedLength = CCNxTlv::ReadLength (start);
+      bytesRead += CCNxTlv::GetTLSize ();
+
+      NS_ASSERT_MSG (bytesRead + nestedLength <= messageLength, "length goes beyond end of messageLength");
+
+      switch (nestedType)
+        {
+        case CCNxSchemaV1::T_NAME:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::Name, offset, nestedLength);
+          break;
+
+        case CCNxSchemaV1::T_KEYID_REST:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::KeyIdRestriction, offset, nestedLength);
+          break;
+
+        case CCNxSchemaV1::T_HASH_REST:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::HashRestriction, offset, nestedLength);
+          break;
+
+        case CCNxSchemaV1::T_PAYLOAD:
+          m_lazyMessage->SetField (CCNxMessageFieldDecoder::Payload, offset, nestedLength);
+          break;
+
+        default:
+          // The bytes stay in the received packet, as in the eager decode
+          NS_LOG_DEBUG ("Skipping unknown nested type " << nestedType);
+          break;
+        }
+
+      start.Next (nestedLength);
+      bytesRead += nestedLength;
+    }
+  return bytesRead;
+}
+
 Ptr<const CCNxName>
 CCNxCodecInterest::DeserializeName (Buffer::Iterator &start, uint16_t length)
 {
@@ -291,7 +351,7 @@ CCNxCodecInterest::Print (std::ostream &os) const
     }
 }
 
-CCNxCodecInterest::CCNxCodecInterest () : m_interest (0)
+CCNxCodecInterest::CCNxCodecInterest () : m_interest (0), m_lazyOffset (0)
 {
   // empty
 }
@@ -312,5 +372,13 @@ CCNxCodecInterest::SetHeader (Ptr<CCNxInterest> interest)
 {
   m_interest = interest;
   m_nameCodec.SetHeader (m_interest->GetName ());
+  m_lazyMessage = 0;
+}
+
+void
+CCNxCodecInterest::SetLazySource (Ptr<const Packet> packet, uint32_t offset)
+{
+  m_lazyPacket = packet;
+  m_lazyOffset = offset;
 }
 
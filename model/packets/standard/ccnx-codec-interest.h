@@ -59,6 +59,7 @@
 #include "ns3/header.h"
 #include "ns3/ccnx-interest.h"
 #include "ns3/ccnx-codec-name.h"
+#include "ns3/ccnx-codec-lazy-message.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -67,6 +68,9 @@ namespace ccnx {
  * @ingroup ccnx-packet
  *
  * Codec for reading/writing a CCNxInterest message
+ *
+ * In lazy mode (SetLazySource()), Deserialize() only records where each field is and
+ * the Interest decodes a field the first time it is read.
  */
 class CCNxCodecInterest : public Header
 {
@@ -128,6 +132,16 @@ public:
    */
   void SetHeader (Ptr<CCNxInterest> interest);
 
+  /**
+   * Makes the next Deserialize() lazy.  It reads only the Type and Length of each field and
+   * creates the message with a CCNxCodecLazyMessage that decodes fields from `packet` on
+   * demand.  Applies to one Deserialize().
+   *
+   * @param packet [in] The packet being deserialized
+   * @param offset [in] The byte offset in `packet` of the iterator given to Deserialize()
+   */
+  void SetLazySource (Ptr<const Packet> packet, uint32_t offset);
+
 private:
   /**
    * The interest to serialize (from SetHeader) or the interest we got from
@@ -136,6 +150,18 @@ private:
   Ptr<CCNxInterest> m_interest;
   CCNxCodecName m_nameCodec;
 
+  Ptr<const Packet> m_lazyPacket;   //<! from SetLazySource(), cleared by Deserialize()
+  uint32_t m_lazyOffset;
+  Ptr<CCNxCodecLazyMessage> m_lazyMessage;
+
+  /**
+   * Lazy Deserialize(): start points to the first TLV in the message.  Records the offset of
+   * each field in m_lazyMessage and skips its value.
+   *
+   * @return The number of bytes read (messageLength)
+   */
+  uint32_t IndexFields (Buffer::Iterator &start, uint16_t messageLength);
+
   /**
    * The start iterator points to the T_NAME Value.  It will be rewinded 4
    * bytes and passed to m_nameCodec for processing.  Side effect is that m_nameCodec
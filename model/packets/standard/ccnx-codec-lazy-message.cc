@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ccnx-codec-lazy-message.h"
+#include "ns3/ccnx-codec-name.h"
+#include "ns3/ccnx-codec-contentobject.h"
+#include "ns3/ccnx-tlv.h"
+#include "ns3/ccnx-hasher-fnv1a.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxCodecLazyMessage");
+
+/**
+ * Decodes one field with ns3::Packet::PeekHeader().  Deserialize() skips to the field's TLV
+ * and decodes only that.  This is only used for decoding, it cannot be serialized.
+ */
+class CCNxCodecLazyMessage::FieldPeek : public Header
+{
+public:
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::ccnx::CCNxCodecLazyMessageFieldPeek")
+      .SetParent<Header> ()
+      .SetGroupName ("CCNx");
+    return tid;
+  }
+
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+
+  FieldPeek (Field field, const Extent &extent) : m_field (field), m_extent (extent), m_number (0)
+  {
+  }
+
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return m_extent.offset + CCNxTlv::GetTLSize () + m_extent.length;
+  }
+
+  virtual void Serialize (Buffer::Iterator start) const
+  {
+    NS_ASSERT_MSG (false, "FieldPeek is only used to decode");
+  }
+
+  virtual uint32_t Deserialize (Buffer::Iterator start)
+  {
+    start.Next (m_extent.offset);
+    switch (m_field)
+      {
+      case Name:
+        // The name codec reads the T_NAME TLV itself
+        m_nameCodec.Deserialize (start);
+        break;
+
+      case Payload:
+        start.Next (CCNxTlv::GetTLSize ());
+        m_payload = Create<CCNxBuffer> (0);
+        m_payload->AddAtStart (m_extent.length);
+        start.Read (m_payload->Begin (), m_extent.length);
+        break;
+
+      case PayloadType:
+        NS_ASSERT_MSG (m_extent.length == 1, "Must be 1 byte in PayloadType");
+        start.Next (CCNxTlv::GetTLSize ());
+        m_number = CCNxCodecContentObject::DeserializeSchemaValueToPayloadType (start.ReadU8 ());
+        break;
+
+      case ExpiryTime:
+      case KeyIdRestriction:
+      case HashRestriction:
+        // The hash values are 8 bytes plus padding, see CCNxCodecInterest::DeserializeKeyIdRest()
+        NS_ASSERT_MSG (m_extent.length >= 8, "Must be at least 8 bytes in field " << m_field);
+        start.Next (CCNxTlv::GetTLSize ());
+        m_number = start.ReadNtohU64 ();
+        break;
+
+      default:
+        NS_ASSERT_MSG (false, "Unsupported field " << m_field);
+        break;
+      }
+    return GetSerializedSize ();
+  }
+
+  virtual void Print (std::ostream &os) const
+  {
+    os << "FieldPeek " << m_field;
+  }
+
+  Ptr<const CCNxName> GetName () const
+  {
+    return m_nameCodec.GetHeader ();
+  }
+
+  Ptr<CCNxBuffer> GetPayload () const
+  {
+    return m_payload;
+  }
+
+  uint64_t GetNumber () const
+  {
+    return m_number;
+  }
+
+private:
+  Field m_field;
+  Extent m_extent;
+  CCNxCodecName m_nameCodec;
+  Ptr<CCNxBuffer> m_payload;
+  uint64_t m_number;
+};
+
+/**
+ * Hashes the message TLV with ns3::Packet::PeekHeader().
+ */
+class CCNxCodecLazyMessage::HashPeek : public Header
+{
+public:
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::ccnx::CCNxCodecLazyMessageHashPeek")
+      .SetParent<Header> ()
+      .SetGroupName ("CCNx");
+    return tid;
+  }
+
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+
+  HashPeek (const Extent &extent, Ptr<CCNxHasher> hasher) : m_extent (extent), m_hasher (hasher)
+  {
+  }
+
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return m_extent.offset + CCNxTlv::GetTLSize () + m_extent.length;
+  }
+
+  virtual void Serialize (Buffer::Iterator start) const
+  {
+    NS_ASSERT_MSG (false, "HashPeek is only used to decode");
+  }
+
+  virtual uint32_t Deserialize (Buffer::Iterator start)
+  {
+    start.Next (m_extent.offset);
+    m_hasher->Update (start, CCNxTlv::GetTLSize () + m_extent.length);
+    return GetSerializedSize ();
+  }
+
+  virtual void Print (std::ostream &os) const
+  {
+    os << "HashPeek";
+  }
+
+private:
+  Extent m_extent;
+  Ptr<CCNxHasher> m_hasher;
+};
+
+CCNxCodecLazyMessage::CCNxCodecLazyMessage (Ptr<const Packet> packet) : m_packet (packet)
+{
+  for (unsigned i = 0; i < FieldCount; i++)
+    {
+      m_fields[i].offset = 0;
+      m_fields[i].length = 0;
+      m_fields[i].present = false;
+    }
+  m_message.offset = 0;
+  m_message.length = 0;
+  m_message.present = false;
+}
+
+CCNxCodecLazyMessage::~CCNxCodecLazyMessage ()
+{
+  // empty
+}
+
+void
+CCNxCodecLazyMessage::SetField (Field field, uint32_t offset, uint16_t length)
+{
+  NS_ASSERT_MSG (field < FieldCount, "Invalid field " << field);
+  m_fields[field].offset = offset;
+  m_fields[field].length = length;
+  m_fields[field].present = true;
+}
+
+void
+CCNxCodecLazyMessage::SetMessage (uint32_t offset, uint16_t length)
+{
+  m_message.offset = offset;
+  m_message.length = length;
+  m_message.present = true;
+}
+
+bool
+CCNxCodecLazyMessage::HasField (Field field) const
+{
+  return field < FieldCount && m_fields[field].present;
+}
+
+size_t
+CCNxCodecLazyMessage::GetPayloadSize () const
+{
+  return m_fields[Payload].length;
+}
+
+Ptr<const CCNxName>
+CCNxCodecLazyMessage::DecodeName () const
+{
+  NS_LOG_FUNCTION (this);
+  FieldPeek peek (Name, m_fields[Name]);
+  m_packet->PeekHeader (peek);
+  return peek.GetName ();
+}
+
+Ptr<CCNxBuffer>
+CCNxCodecLazyMessage::DecodePayload () const
+{
+  NS_LOG_FUNCTION (this);
+  FieldPeek peek (Payload, m_fields[Payload]);
+  m_packet->PeekHeader (peek);
+  return peek.GetPayload ();
+}
+
+uint64_t
+CCNxCodecLazyMessage::DecodeNumber (Field field) const
+{
+  NS_LOG_FUNCTION (this << field);
+  FieldPeek peek (field, m_fields[field]);
+  m_packet->PeekHeader (peek);
+  return peek.GetNumber ();
+}
+
+Ptr<CCNxHashValue>
+CCNxCodecLazyMessage::HashMessage () const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_message.present, "HashMessage without SetMessage");
+
+  Ptr<CCNxHasher> hasher = CreateObject<CCNxHasherFnv1a> ();
+  hasher->Init ();
+  HashPeek peek (m_message, hasher);
+  m_packet->PeekHeader (peek);
+  return hasher->Finalize ();
+}
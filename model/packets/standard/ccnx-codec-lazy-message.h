@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_CCNXCODECLAZYMESSAGE_H
+#define CCNS3SIM_CCNXCODECLAZYMESSAGE_H
+
+#include "ns3/packet.h"
+#include "ns3/ccnx-message.h"
+#include "ns3/ccnx-hash-value.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-packet
+ *
+ * The CCNxMessageFieldDecoder of a lazily decoded Interest or Content Object.
+ *
+ * CCNxCodecInterest and CCNxCodecContentObject in lazy mode walk the message TLVs once,
+ * only reading each Type and Length, and record the offset of each field's TLV in the
+ * received ns3::Packet with SetField().  Decoding a field later peeks the packet at that
+ * offset, so the bytes are not copied until someone asks for the field.  The payload is
+ * only copied by CCNxMessage::GetPayload().
+ *
+ * It holds a reference to the received ns3::Packet, which is read-only, so the offsets stay
+ * valid for the life of the message.
+ */
+class CCNxCodecLazyMessage : public CCNxMessageFieldDecoder
+{
+public:
+  /**
+   * @param packet [in] The received packet the offsets are relative to
+   */
+  CCNxCodecLazyMessage (Ptr<const Packet> packet);
+
+  virtual ~CCNxCodecLazyMessage ();
+
+  /**
+   * Records where a field is.
+   *
+   * @param field [in] The field
+   * @param offset [in] The byte offset of the field's TLV (its Type) in the packet
+   * @param length [in] The TLV Length (of the Value)
+   */
+  void SetField (Field field, uint32_t offset, uint16_t length);
+
+  /**
+   * Records where the whole message TLV is, for HashMessage().
+   *
+   * @param offset [in] The byte offset of the message TLV (e.g. T_OBJECT) in the packet
+   * @param length [in] The TLV Length (of the Value)
+   */
+  void SetMessage (uint32_t offset, uint16_t length);
+
+  /**
+   * Computes the ContentObjectHash of the message TLV, as CCNxCodecContentObject does in
+   * eager mode.  Reads, but does not copy, the bytes.
+   */
+  Ptr<CCNxHashValue> HashMessage () const;
+
+  // CCNxMessageFieldDecoder
+  virtual bool HasField (Field field) const;
+  virtual size_t GetPayloadSize () const;
+  virtual Ptr<const CCNxName> DecodeName () const;
+  virtual Ptr<CCNxBuffer> DecodePayload () const;
+  virtual uint64_t DecodeNumber (Field field) const;
+
+private:
+  class FieldPeek;
+  class HashPeek;
+
+  struct Extent
+  {
+    uint32_t offset;
+    uint16_t length;
+    bool present;
+  };
+
+  Ptr<const Packet> m_packet;
+  Extent m_fields[FieldCount];
+  Extent m_message;
+};
+
+}
+}
+
+#endif //CCNS3SIM_CCNXCODECLAZYMESSAGE_H
@@ -57,7 +57,7 @@
 #include "ns3/ccnx-codec-name.h"
 #include "ns3/ccnx-schema-v1.h"
 #include "ns3/ccnx-tlv.h"
-#include "ns3/ccnx-name-builder.h"
+#include "ns3/ccnx-name-intern-pool.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -139,7 +139,10 @@ CCNxCodecName::Deserialize (Buffer::Iterator start)
 
   m_name = 0;
 
-  CCNxNameBuilder builder;
+  // Collect the flat encoding of the name and look it up in the intern pool.  If the
+  // name was seen before, this makes no name segments.
+  std::string flat;
+  flat.reserve (outerLength);
 
   while (bytesRead < outerLength)
     {
@@ -150,19 +153,16 @@ CCNxCodecName::Deserialize (Buffer::Iterator start)
       NS_ASSERT_MSG (innerLength + bytesRead <= outerLength, "innerLength goes beyond end of Name");
       NS_ASSERT_MSG (innerLength > 0, "Empty segments not supported");
 
-      // This is very inefficient.  Need to figure out a better way of managing this memory.
       uint8_t temp[innerLength];
       start.Read (temp, innerLength);
-      std::string s ((char *) temp, innerLength);
-      Ptr<const CCNxNameSegment> segment = Create<const CCNxNameSegment> (SchemaValueToNameSegmentType (innerType), s);
-      builder.Append (segment);
+      CCNxNameInternPool::AppendFlatSegment (flat, SchemaValueToNameSegmentType (innerType), temp, innerLength);
 
       bytesRead += innerLength;
     }
 
   NS_ASSERT_MSG (bytesRead == outerLength, "Did not consume all bytes");
 
-  m_name = builder.CreateName ();
+  m_name = CCNxNameInternPool::InternFlat (flat);
 
   // Add in the initial 4 bytes from the T_NAME bytes
   return bytesRead + CCNxTlv::GetTLSize ();
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_CCNXCODECUNKNOWNPERHOPHEADERENTRY_H
+#define CCNS3SIM_CCNXCODECUNKNOWNPERHOPHEADERENTRY_H
+
+#include "ns3/ccnx-codec-perhopheaderentry.h"
+#include "ns3/ccnx-unknownperhopheaderentry.h"
+
+namespace ns3 {
+namespace ccnx {
+/**
+ * @ingroup ccnx-packet
+ *
+ * Codec for reading/writing per hop header entries of a TLV type with no registered codec.
+ *
+ * It is not in CCNxCodecRegistry, CCNxCodecFixedHeader uses it when the registry has no
+ * codec for a type.  The value bytes are copied as they are, see CCNxUnknownPerHopHeaderEntry.
+ */
+class CCNxCodecUnknownPerHopHeaderEntry : public CCNxCodecPerHopHeaderEntry
+{
+public:
+  static TypeId GetTypeId (void);
+
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Constructor for CCNxCodecUnknownPerHopHeaderEntry
+   */
+  CCNxCodecUnknownPerHopHeaderEntry ();
+
+  /**
+   * Destructor for CCNxCodecUnknownPerHopHeaderEntry
+   */
+  virtual ~CCNxCodecUnknownPerHopHeaderEntry ();
+
+  /**
+   * Deserialize a TLV of any type in to a CCNxUnknownPerHopHeaderEntry
+   */
+  Ptr<CCNxPerHopHeaderEntry> Deserialize (Buffer::Iterator *input, size_t *bytesRead);
+
+  /**
+   * @param [in] perhopEntry Must be a CCNxUnknownPerHopHeaderEntry
+   */
+  uint32_t GetSerializedSize (Ptr<CCNxPerHopHeaderEntry> perhopEntry);
+
+  /**
+   * @param [in] perhopEntry Must be a CCNxUnknownPerHopHeaderEntry
+   */
+  void Serialize (Ptr<CCNxPerHopHeaderEntry> perhopEntry, Buffer::Iterator *output);
+
+  /**
+   * Display this codec's state to the provided output stream.
+   *
+   * @param [in] perhopEntry The Entry to be printed
+   * @param [in] os The output stream to write to
+   */
+  void Print (Ptr<CCNxPerHopHeaderEntry> perhopEntry, std::ostream &os) const;
+
+private:
+  Ptr<CCNxUnknownPerHopHeaderEntry> Cast (Ptr<CCNxPerHopHeaderEntry> perhopEntry) const;
+};
+
+} // namespace ccnx
+} // namespace ns3
+
+
+#endif //CCNS3SIM_CCNXCODECUNKNOWNPERHOPHEADERENTRY_H
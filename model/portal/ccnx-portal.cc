@@ -134,4 +134,31 @@ CCNxPortal::NotifyRecv (void)
     }
 }
 
+size_t
+CCNxPortal::SendBatch (const PacketBatchType &packets)
+{
+  NS_LOG_FUNCTION (this << packets.size ());
+  size_t sent = 0;
+  for (PacketBatchType::const_iterator i = packets.begin (); i != packets.end (); ++i)
+    {
+      if (Send (*i))
+        {
+          sent++;
+        }
+    }
+  return sent;
+}
 
+size_t
+CCNxPortal::RecvBatch (PacketBatchType &packets, size_t maxPackets)
+{
+  NS_LOG_FUNCTION (this << maxPackets);
+  size_t count = 0;
+  Ptr<CCNxPacket> packet;
+  while (count < maxPackets && (packet = Recv ()))
+    {
+      packets.push_back (packet);
+      count++;
+    }
+  return count;
+}
@@ -57,6 +57,8 @@
 #ifndef CCNS3_CCNXPORTAL_H
 #define CCNS3_CCNXPORTAL_H
 
+#include <vector>
+
 #include "ns3/object.h"
 #include "ns3/ccnx-l3-protocol.h"
 #include "ns3/ccnx-connection.h"
@@ -286,6 +288,49 @@ public:
    */
   virtual Ptr<CCNxPacket> RecvFrom (Ptr<CCNxConnection> & incomingConnection) = 0;
 
+  /**
+   * Typedef for a batch of packets passed to SendBatch() and RecvBatch()
+   */
+  typedef std::vector< Ptr<CCNxPacket> > PacketBatchType;
+
+  /**
+   * Send several CCNxPackets in one call.  They are routed in order, as if each
+   * were passed to Send().
+   *
+   * The default implementation calls Send() for each packet.  A portal should override
+   * it if it can hand the whole batch to Layer 3 at once.
+   *
+   * @param [in] packets The packets to send
+   *
+   * @return The number of packets sent
+   */
+  virtual size_t SendBatch (const PacketBatchType &packets);
+
+  /**
+   * Read up to `maxPackets` packets in one call.  They are appended to `packets` in the order
+   * they were received.
+   *
+   * The default implementation calls Recv() until it returns null or `maxPackets` are read.
+   *
+   * Example:
+   * @code
+   * void ReceiveCallback(Ptr<CCNxPortal> portal)
+   * {
+   *    CCNxPortal::PacketBatchType packets;
+   *    while (portal->RecvBatch(packets, 32) > 0) {
+   *       ...
+   *       packets.clear();
+   *    }
+   * }
+   * @endcode
+   *
+   * @param [out] packets The packets read are appended here
+   * @param [in] maxPackets The most packets to read
+   *
+   * @return The number of packets appended to `packets`
+   */
+  virtual size_t RecvBatch (PacketBatchType &packets, size_t maxPackets);
+
 };
 
 }
@@ -59,6 +59,8 @@
 
 #include "ns3/object.h"
 #include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/enum.h"
 
 #include "ns3/ccnx-message-portal.h"
 
@@ -75,12 +77,23 @@ CCNxMessagePortal::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::ccnx::CCNxMessagePortal")
     .SetParent<CCNxPortal> ()
     .SetGroupName ("CCNx")
-    .AddConstructor<CCNxMessagePortal> ();
+    .AddConstructor<CCNxMessagePortal> ()
+    .AddAttribute ("RecvQueueCapacity", "The maximum number of packets waiting to be read (0 = unbounded)",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&CCNxMessagePortal::SetRecvQueueCapacity,
+                                         &CCNxMessagePortal::GetRecvQueueCapacity),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("RecvQueueOverflow", "What to drop when the receive queue is full (default = DropTail)",
+                   EnumValue (RecvQueueOverflow_DropTail),
+                   MakeEnumAccessor (&CCNxMessagePortal::m_recvQueueOverflow),
+                   MakeEnumChecker (RecvQueueOverflow_DropTail, "DropTail",
+                                    RecvQueueOverflow_DropHead, "DropHead"));
   return tid;
 
 }
 
-CCNxMessagePortal::CCNxMessagePortal (void) : m_ccnx (NULL)
+CCNxMessagePortal::CCNxMessagePortal (void) : m_ccnx (NULL), m_inputHead (0), m_inputCount (0),
+  m_recvQueueCapacity (0), m_recvQueueOverflow (RecvQueueOverflow_DropTail), m_recvQueueDrops (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -104,11 +117,91 @@ CCNxMessagePortal::ReceiveFromLayer3 (Ptr<CCNxPacket> packet, Ptr<CCNxConnection
   NS_LOG_FUNCTION (this << packet << incoming);
   NS_LOG_DEBUG ("packet " << packet << ", incoming " << incoming);
 
-  m_inputQueue.push_back (new QueueEntryType (packet, incoming));
+  if (m_recvQueueCapacity > 0 && m_inputCount >= m_recvQueueCapacity)
+    {
+      m_recvQueueDrops++;
+      if (m_recvQueueOverflow == RecvQueueOverflow_DropTail)
+        {
+          NS_LOG_DEBUG ("Receive queue full, dropping packet " << packet);
+          return false;
+        }
+
+      NS_LOG_DEBUG ("Receive queue full, dropping oldest packet");
+      PopInput ();
+    }
+
+  PushInput (packet, incoming);
   NotifyRecv ();
   return true;
 }
 
+void
+CCNxMessagePortal::PushInput (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> incoming)
+{
+  if (m_inputCount == m_inputQueue.size ())
+    {
+      // A bounded ring is allocated once at its capacity, an unbounded one doubles
+      size_t slots = m_recvQueueCapacity;
+      if (slots == 0)
+        {
+          slots = m_inputQueue.empty () ? 16 : 2 * m_inputQueue.size ();
+        }
+
+      QueueType ring (slots);
+      for (size_t i = 0; i < m_inputCount; ++i)
+        {
+          ring[i] = m_inputQueue[(m_inputHead + i) % m_inputQueue.size ()];
+        }
+      m_inputQueue.swap (ring);
+      m_inputHead = 0;
+    }
+
+  QueueEntryType &entry = m_inputQueue[(m_inputHead + m_inputCount) % m_inputQueue.size ()];
+  entry.first = packet;
+  entry.second = incoming;
+  m_inputCount++;
+}
+
+CCNxMessagePortal::QueueEntryType
+CCNxMessagePortal::PopInput ()
+{
+  NS_ASSERT_MSG (m_inputCount > 0, "PopInput called on an empty receive queue");
+
+  QueueEntryType entry;
+  std::swap (entry, m_inputQueue[m_inputHead]);
+  m_inputHead = (m_inputHead + 1) % m_inputQueue.size ();
+  m_inputCount--;
+  return entry;
+}
+
+void
+CCNxMessagePortal::SetRecvQueueCapacity (uint32_t capacity)
+{
+  NS_LOG_FUNCTION (this << capacity);
+  NS_ASSERT_MSG (m_inputCount == 0, "Cannot change the capacity of a non-empty receive queue");
+  m_recvQueueCapacity = capacity;
+  m_inputQueue = QueueType ();
+  m_inputHead = 0;
+}
+
+uint32_t
+CCNxMessagePortal::GetRecvQueueCapacity () const
+{
+  return m_recvQueueCapacity;
+}
+
+size_t
+CCNxMessagePortal::GetRecvQueueSize () const
+{
+  return m_inputCount;
+}
+
+uint64_t
+CCNxMessagePortal::GetRecvQueueDrops () const
+{
+  return m_recvQueueDrops;
+}
+
 Ptr<CCNxL3Protocol>
 CCNxMessagePortal::GetCCNx (void) const
 {
@@ -204,13 +297,9 @@ CCNxMessagePortal::Recv (void)
   NS_LOG_FUNCTION (this);
 
   Ptr<CCNxPacket> packet;
-  if (!m_inputQueue.empty ())
+  if (m_inputCount > 0)
     {
-      QueueEntryType *entry = m_inputQueue.front ();
-      m_inputQueue.pop_front ();
-
-      packet = entry->first;
-      delete entry;
+      packet = PopInput ().first;
     }
 
   return packet;
@@ -222,15 +311,45 @@ CCNxMessagePortal::RecvFrom (Ptr<CCNxConnection> &incomingConnection)
   NS_LOG_FUNCTION (this);
 
   Ptr<CCNxPacket> packet;
-  if (!m_inputQueue.empty ())
+  if (m_inputCount > 0)
     {
-      QueueEntryType *entry = m_inputQueue.front ();
-      m_inputQueue.pop_front ();
-
-      packet = entry->first;
-      incomingConnection = entry->second;
-      delete entry;
+      QueueEntryType entry = PopInput ();
+      packet = entry.first;
+      incomingConnection = entry.second;
     }
 
   return packet;
 }
+
+size_t
+CCNxMessagePortal::SendBatch (const CCNxPortal::PacketBatchType &packets)
+{
+  NS_LOG_FUNCTION (this << packets.size ());
+
+  Layer3SendBatchCallback scb = GetLayer3SendBatchCallback ();
+  if (scb.IsNull ())
+    {
+      return CCNxPortal::SendBatch (packets);
+    }
+
+  size_t sent = scb (*this, packets);
+  for (size_t i = 0; i < sent; ++i)
+    {
+      NotifyDataSent (packets[i]);
+    }
+  return sent;
+}
+
+size_t
+CCNxMessagePortal::RecvBatch (CCNxPortal::PacketBatchType &packets, size_t maxPackets)
+{
+  NS_LOG_FUNCTION (this << maxPackets);
+
+  size_t count = 0;
+  while (count < maxPackets && m_inputCount > 0)
+    {
+      packets.push_back (PopInput ().first);
+      count++;
+    }
+  return count;
+}
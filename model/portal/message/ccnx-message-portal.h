@@ -60,7 +60,7 @@
 #ifndef CCNS3_CCNXMESSAGEPORTAL_H
 #define CCNS3_CCNXMESSAGEPORTAL_H
 
-#include <deque>
+#include <vector>
 
 #include "ns3/node.h"
 #include "ns3/ccnx-l3-protocol.h"
@@ -76,6 +76,11 @@ namespace ccnx {
  *
  * A Message portal does no L4 processing on packets, it passes them one for one.
  *
+ * Packets from Layer 3 wait in a ring buffer until the application reads them.  The
+ * attribute "RecvQueueCapacity" bounds the ring (0, the default, lets it grow without
+ * bound) and "RecvQueueOverflow" selects which packet is dropped when a bounded ring
+ * is full: the arriving one (DropTail) or the oldest one (DropHead).
+ *
  * @see CCNxMessagePortalFactory
  */
 class CCNxMessagePortal : public CCNxPortal,
@@ -224,19 +229,87 @@ public:
    */
   virtual Ptr<CCNxPacket> RecvFrom (Ptr<CCNxConnection> &incomingConnection);
 
+  /**
+   * Sends the whole batch to Layer 3 with one call of the Layer3SendBatchCallback.  If
+   * that callback is not set, falls back to Send() for each packet.
+   *
+   * @copydoc CCNxPortal::SendBatch()
+   */
+  virtual size_t SendBatch (const CCNxPortal::PacketBatchType &packets);
+
+  /**
+   * Moves packets straight out of the receive ring.
+   *
+   * @copydoc CCNxPortal::RecvBatch()
+   */
+  virtual size_t RecvBatch (CCNxPortal::PacketBatchType &packets, size_t maxPackets);
+
+  /**
+   * What to drop when a packet arrives and the bounded receive queue is full,
+   * set via the attribute "RecvQueueOverflow".
+   */
+  enum RecvQueueOverflowType
+  {
+    RecvQueueOverflow_DropTail,   //!< Drop the arriving packet (default)
+    RecvQueueOverflow_DropHead    //!< Drop the oldest queued packet
+  };
+
+  /**
+   * Sets the maximum number of packets waiting to be read.  0 means unbounded.  This is
+   * the setter of the attribute "RecvQueueCapacity".
+   *
+   * Must be called while the receive queue is empty.
+   *
+   * @param [in] capacity The maximum queue length, or 0 for no limit
+   */
+  void SetRecvQueueCapacity (uint32_t capacity);
+
+  /**
+   * @return The maximum number of packets waiting to be read, 0 if unbounded
+   */
+  uint32_t GetRecvQueueCapacity () const;
+
+  /**
+   * @return The number of packets waiting to be read
+   */
+  size_t GetRecvQueueSize () const;
+
+  /**
+   * @return The number of packets dropped because the receive queue was full
+   */
+  uint64_t GetRecvQueueDrops () const;
+
 private:
   friend class CCNxMessagePortalFactory;
 
   Ptr<CCNxL3Protocol> m_ccnx;
 
   typedef std::pair< Ptr<CCNxPacket>, Ptr<CCNxConnection> > QueueEntryType;
-  typedef std::deque< QueueEntryType  * > QueueType;
+  typedef std::vector< QueueEntryType > QueueType;
+
+  /**
+   * Appends an entry at the tail of the receive ring, growing the ring if it is
+   * unbounded and full.  The caller handles overflow of a bounded ring.
+   */
+  void PushInput (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> incoming);
+
+  /**
+   * Removes the entry at the head of the receive ring.  The ring must not be empty.
+   */
+  QueueEntryType PopInput ();
 
   /**
    * The L4 protocol queues packets from L3 until the application reads them via the
-   * Recv() or RecvFrom() functions.
+   * Recv(), RecvFrom(), or RecvBatch() functions.  It is a ring of m_inputQueue.size() slots
+   * that starts at m_inputHead and holds m_inputCount entries.
    */
   QueueType m_inputQueue;
+  size_t m_inputHead;
+  size_t m_inputCount;
+
+  uint32_t m_recvQueueCapacity;
+  RecvQueueOverflowType m_recvQueueOverflow;
+  uint64_t m_recvQueueDrops;
 };
 }
 }
@@ -102,6 +102,7 @@ CCNxMessagePortalFactory::CreatePortal (void)
   mp->SetCCNx (m_ccnx);
   mp->SetLayer3SendCallback (MakeCallback (&CCNxL3Protocol::SendFromLayer4, m_ccnx));
   mp->SetLayer3SendToCallback (MakeCallback (&CCNxL3Protocol::SendToFromLayer4, m_ccnx));
+  mp->SetLayer3SendBatchCallback (MakeCallback (&CCNxL3Protocol::SendBatchFromLayer4, m_ccnx));
   m_ccnx->AddProtocol (*mp, MakeCallback (&CCNxMessagePortal::ReceiveFromLayer3, mp));
 
   return mp;
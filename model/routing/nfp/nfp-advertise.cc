@@ -58,6 +58,7 @@
 #include "nfp-advertise.h"
 #include "ns3/ccnx-tlv.h"
 #include "ns3/nfp-schema.h"
+#include "ns3/ccnx-free-list.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -97,6 +98,30 @@ NfpAdvertise::~NfpAdvertise ()
   // empty;
 }
 
+void *
+NfpAdvertise::operator new (size_t size)
+{
+  return CCNxFreeList<NfpAdvertise>::Allocate (size);
+}
+
+void
+NfpAdvertise::operator delete (void *p, size_t size)
+{
+  CCNxFreeList<NfpAdvertise>::Release (p, size);
+}
+
+uint64_t
+NfpAdvertise::GetAllocationCount ()
+{
+  return CCNxFreeList<NfpAdvertise>::GetAllocationCount ();
+}
+
+uint64_t
+NfpAdvertise::GetHeapFallbackCount ()
+{
+  return CCNxFreeList<NfpAdvertise>::GetHeapFallbackCount ();
+}
+
 Ptr<const CCNxName>
 NfpAdvertise::GetAnchorName (void) const
 {
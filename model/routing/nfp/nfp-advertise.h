@@ -70,6 +70,9 @@ namespace ccnx {
  * @ingroup nfp-routing
  *
  * An advertisement inside an NfpMessage.  See NfpSchema.h for packet format.
+ *
+ * NfpRoutingProtocol makes an advertisement for every (prefix, anchorName) it receives and every one
+ * it sends, so advertisements are allocated from a CCNxFreeList rather than the heap.
  */
 class NfpAdvertise : public NfpMessage
 {
@@ -89,6 +92,19 @@ public:
 
   virtual ~NfpAdvertise ();
 
+  static void *operator new (size_t size);
+  static void operator delete (void *p, size_t size);
+
+  /**
+   * @return The number of advertisements allocated (from the free list or the heap)
+   */
+  static uint64_t GetAllocationCount ();
+
+  /**
+   * @return The number of advertisements that had to be allocated from the heap
+   */
+  static uint64_t GetHeapFallbackCount ();
+
   Ptr<const CCNxName> GetAnchorName (void) const;
   Ptr<const CCNxName> GetPrefix (void) const;
   uint32_t GetAnchorSeqnum (void) const;
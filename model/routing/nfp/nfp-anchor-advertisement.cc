@@ -239,6 +239,24 @@ NfpAnchorAdvertisement::RemoveNexthop (Ptr<CCNxConnection> connection)
   return removeCount > 0;
 }
 
+bool
+NfpAnchorAdvertisement::RefreshNexthop (Ptr<CCNxConnection> connection, Time expiryTime)
+{
+  NS_LOG_FUNCTION (this << connection->GetConnectionId () << expiryTime);
+  PruneEqualCostPaths (Simulator::Now ());
+  ExpiryTimeMap::iterator i = m_expiryTimes.find (connection);
+  if (i == m_expiryTimes.end ())
+    {
+      return false;
+    }
+
+  if (i->second < expiryTime)
+    {
+      i->second = expiryTime;
+    }
+  return true;
+}
+
 void
 NfpAnchorAdvertisement::PruneEqualCostPaths (Time now)
 {
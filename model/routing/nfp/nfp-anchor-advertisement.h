@@ -159,6 +159,16 @@ public:
    */
   bool RemoveNexthop (Ptr<CCNxConnection> connection);
 
+  /**
+   * Extend the expiry time of a valid nexthop to `expiryTime`, as if its advertisement had been
+   * received again.  An expired nexthop is not brought back.
+   *
+   * @param connection The nexthop to refresh
+   * @param expiryTime The new expiry time (an earlier time than the current one is ignored)
+   * @return true if the nexthop is valid and was refreshed, false if it is not a nexthop
+   */
+  bool RefreshNexthop (Ptr<CCNxConnection> connection, Time expiryTime);
+
   /**
    * Returns the time of the last state change.
    *
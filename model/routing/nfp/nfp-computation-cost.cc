@@ -61,13 +61,14 @@ using namespace ns3::ccnx;
 
 
 NfpComputationCost::NfpComputationCost ()
-: m_events(0), m_loopIterations(0)
+: m_events(0), m_loopIterations(0), m_timerEvents(0), m_timerExpirations(0)
 {
   // empty
 }
 
 NfpComputationCost::NfpComputationCost (const NfpComputationCost &copy)
-  : m_events(copy.GetEvents()), m_loopIterations(copy.GetLoopIterations())
+  : m_events(copy.GetEvents()), m_loopIterations(copy.GetLoopIterations()),
+    m_timerEvents(copy.GetTimerEvents()), m_timerExpirations(copy.GetTimerExpirations())
 {
   // empty
 }
@@ -95,12 +96,32 @@ NfpComputationCost::IncrementLoopIterations(uint64_t count)
   m_loopIterations += count;
 }
 
+void
+NfpComputationCost::IncrementTimerEvents()
+{
+  m_timerEvents++;
+}
+
+void
+NfpComputationCost::IncrementTimerEvents(uint64_t count)
+{
+  m_timerEvents += count;
+}
+
+void
+NfpComputationCost::IncrementTimerExpirations()
+{
+  m_timerExpirations++;
+}
+
 NfpComputationCost
 NfpComputationCost::operator + (const NfpComputationCost &other) const
 {
   NfpComputationCost sum;
   sum.m_events = GetEvents() + other.GetEvents();
   sum.m_loopIterations = GetLoopIterations() + other.GetLoopIterations();
+  sum.m_timerEvents = GetTimerEvents() + other.GetTimerEvents();
+  sum.m_timerExpirations = GetTimerExpirations() + other.GetTimerExpirations();
   return sum;
 }
 
@@ -109,6 +130,8 @@ NfpComputationCost::operator += (const NfpComputationCost &other)
 {
   m_events += other.GetEvents();
   m_loopIterations += other.GetLoopIterations();
+  m_timerEvents += other.GetTimerEvents();
+  m_timerExpirations += other.GetTimerExpirations();
   return *this;
 }
 
@@ -117,7 +140,9 @@ NfpComputationCost::operator == (const NfpComputationCost &other) const
 {
   bool result = false;
   if (GetEvents() == other.GetEvents() &&
-      GetLoopIterations() == other.GetLoopIterations()) {
+      GetLoopIterations() == other.GetLoopIterations() &&
+      GetTimerEvents() == other.GetTimerEvents() &&
+      GetTimerExpirations() == other.GetTimerExpirations()) {
       result = true;
   }
   return result;
@@ -141,6 +166,18 @@ NfpComputationCost::GetLoopIterations() const
   return m_loopIterations;
 }
 
+uint64_t
+NfpComputationCost::GetTimerEvents() const
+{
+  return m_timerEvents;
+}
+
+uint64_t
+NfpComputationCost::GetTimerExpirations() const
+{
+  return m_timerExpirations;
+}
+
 uint64_t
 NfpComputationCost::GetTotalCost() const
 {
@@ -152,7 +189,8 @@ ns3::ccnx::operator << (std::ostream &os, const NfpComputationCost &cost)
 {
 
   os << "ComputationCost { events : " << cost.GetEvents() << ", iterations " << cost.GetLoopIterations();
-  os << ", total = " << cost.GetEvents() + cost.GetLoopIterations() << " }";
+  os << ", total = " << cost.GetEvents() + cost.GetLoopIterations();
+  os << ", timer events " << cost.GetTimerEvents() << ", timer expirations " << cost.GetTimerExpirations() << " }";
   return os;
 }
 
@@ -70,6 +70,11 @@ namespace ns3
      * Computational cost is measured in the number of events and the number of loop iterations.
      *
      * An event is something like packet received or timer callback.
+     *
+     * The timer counters show how much work the simulator scheduler does for NFP timers.  A timer
+     * event is one simulator event run for timers and a timer expiration is one timer callback.
+     * With a pass-through NfpTimingWheel they are equal.  With a real one, all the timers of a
+     * tick run from one event.
      */
     class NfpComputationCost
     {
@@ -81,6 +86,9 @@ namespace ns3
       void IncrementEvents();
       void IncrementLoopIterations();
       void IncrementLoopIterations(uint64_t count);
+      void IncrementTimerEvents();
+      void IncrementTimerEvents(uint64_t count);
+      void IncrementTimerExpirations();
 
       /**
        * Add one computation cost to this computation cost
@@ -99,7 +107,7 @@ namespace ns3
       NfpComputationCost & operator += (const NfpComputationCost &other);
 
       /**
-       * Two objects are equal if they have the same event count and loop iteration count
+       * Two objects are equal if they have the same event count, loop iteration count and timer counts
        *
        * @param other
        * @return
@@ -110,6 +118,8 @@ namespace ns3
 
       uint64_t GetEvents() const;
       uint64_t GetLoopIterations() const;
+      uint64_t GetTimerEvents() const;
+      uint64_t GetTimerExpirations() const;
       uint64_t GetTotalCost() const;
 
       friend std::ostream & operator << (std::ostream &os, const NfpComputationCost &cost);
@@ -117,6 +127,8 @@ namespace ns3
     private:
       uint64_t	m_events;		/*< The number of events its callback */
       uint64_t	m_loopIterations;	/*< The number of transit through any control loop */
+      uint64_t	m_timerEvents;		/*< The number of simulator events run for timers */
+      uint64_t	m_timerExpirations;	/*< The number of timer callbacks */
     };
 
   } /* namespace ccnx */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "nfp-digest-request.h"
+#include "ns3/ccnx-tlv.h"
+#include "ns3/nfp-schema.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("NfpDigestRequest");
+
+NfpDigestRequest::NfpDigestRequest () : m_bucketMask (0)
+{
+  // empty
+}
+
+NfpDigestRequest::NfpDigestRequest (Ptr<const CCNxName> routerName, uint32_t bucketMask)
+  : m_bucketMask (bucketMask)
+{
+  NS_LOG_FUNCTION (this << routerName << bucketMask);
+  m_routerNameCodec.SetHeader (routerName);
+}
+
+NfpDigestRequest::~NfpDigestRequest ()
+{
+  // empty
+}
+
+Ptr<const CCNxName>
+NfpDigestRequest::GetRouterName (void) const
+{
+  return m_routerNameCodec.GetHeader ();
+}
+
+uint32_t
+NfpDigestRequest::GetBucketMask (void) const
+{
+  return m_bucketMask;
+}
+
+uint32_t
+NfpDigestRequest::GetSerializedSize (void) const
+{
+  return CCNxTlv::GetTLSize () + m_routerNameCodec.GetSerializedSize () + sizeof(uint32_t);
+}
+
+void
+NfpDigestRequest::Serialize (Buffer::Iterator start) const
+{
+  NS_LOG_FUNCTION (this << &start);
+
+  uint16_t innerSize = GetSerializedSize () - CCNxTlv::GetTLSize ();
+  CCNxTlv::WriteTypeLength (start, NfpSchema::T_DIGEST_REQUEST, innerSize);
+  m_routerNameCodec.Serialize (start);
+  start.Next (m_routerNameCodec.GetSerializedSize ());
+  start.WriteHtonU32 (m_bucketMask);
+}
+
+uint32_t
+NfpDigestRequest::Deserialize (Buffer::Iterator start)
+{
+  NS_LOG_FUNCTION (this << &start);
+  NS_ASSERT_MSG (start.GetSize () >= CCNxTlv::GetTLSize (), "Must have at least 4 bytes in buffer");
+
+  uint32_t bytesRead = 0;
+  uint16_t outerType = CCNxTlv::ReadType (start);
+  uint16_t outerLength = CCNxTlv::ReadLength (start);
+
+  NS_ASSERT_MSG (outerType == NfpSchema::T_DIGEST_REQUEST, "Outer type must be T_DIGEST_REQUEST");
+
+  uint32_t nameSize = m_routerNameCodec.Deserialize (start);
+  bytesRead += nameSize;
+  start.Next (nameSize);
+
+  m_bucketMask = start.ReadNtohU32 ();
+  bytesRead += sizeof(uint32_t);
+
+  NS_ASSERT_MSG (bytesRead == outerLength, "Did not consume all bytes");
+
+  return bytesRead + CCNxTlv::GetTLSize ();
+}
+
+bool
+NfpDigestRequest::IsAdvertise (void) const
+{
+  return false;
+}
+
+bool
+NfpDigestRequest::IsWithdraw (void) const
+{
+  return false;
+}
+
+bool
+NfpDigestRequest::IsDigestRequest (void) const
+{
+  return true;
+}
+
+bool
+NfpDigestRequest::Equals (NfpDigestRequest const &other) const
+{
+  bool result = false;
+  Ptr<const CCNxName> a = m_routerNameCodec.GetHeader ();
+  Ptr<const CCNxName> b = other.m_routerNameCodec.GetHeader ();
+  if (a && b)
+    {
+      result = a->Equals (*b) && m_bucketMask == other.m_bucketMask;
+    }
+  return result;
+}
+
+bool
+NfpDigestRequest::Equals (NfpMessage const & other) const
+{
+  bool result = false;
+  if (other.IsDigestRequest ())
+    {
+      const NfpDigestRequest *a = dynamic_cast<const NfpDigestRequest *> (&other);
+      result = Equals (*a);
+    }
+  return result;
+}
+
+std::ostream &
+ns3::ccnx::operator << (std::ostream & os, NfpDigestRequest const & request)
+{
+  os << "{ DigestReq: " << *request.GetRouterName () << ", mask 0x" << std::hex << request.GetBucketMask () << std::dec << " }";
+  return os;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "nfp-digest-table.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("NfpDigestTable");
+
+/*
+ * The 64-bit finalizer of SplitMix64.  Spreads the name hashes so nearby values land in
+ * different buckets and differ in many bits.
+ */
+static uint64_t
+Mix (uint64_t x)
+{
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+NfpDigestTable::NfpDigestTable () : m_buckets (NfpDigest::BucketCount, 0)
+{
+  // empty
+}
+
+NfpDigestTable::~NfpDigestTable ()
+{
+  // empty
+}
+
+size_t
+NfpDigestTable::GetBucket (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix)
+{
+  return (size_t) (Mix (anchorName->GetHash () ^ Mix (prefix->GetHash ())) % NfpDigest::BucketCount);
+}
+
+uint64_t
+NfpDigestTable::HashEntry (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix, uint32_t anchorSeqnum, uint16_t distance)
+{
+  uint64_t state = ((uint64_t) anchorSeqnum << 16) | distance;
+  return Mix (anchorName->GetHash () ^ Mix (prefix->GetHash () ^ Mix (state)));
+}
+
+void
+NfpDigestTable::Update (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix, uint32_t anchorSeqnum, uint16_t distance)
+{
+  uint64_t hash = HashEntry (anchorName, prefix, anchorSeqnum, distance);
+  std::pair<EntryMapType::iterator, bool> result = m_entries.insert (std::make_pair (KeyType (anchorName, prefix), ValueType ()));
+  ValueType &value = result.first->second;
+  if (result.second)
+    {
+      value.bucket = (uint32_t) GetBucket (anchorName, prefix);
+    }
+  else
+    {
+      m_buckets[value.bucket] ^= value.hash;
+    }
+  value.hash = hash;
+  m_buckets[value.bucket] ^= hash;
+}
+
+void
+NfpDigestTable::Remove (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix)
+{
+  EntryMapType::iterator i = m_entries.find (KeyType (anchorName, prefix));
+  if (i != m_entries.end ())
+    {
+      m_buckets[i->second.bucket] ^= i->second.hash;
+      m_entries.erase (i);
+    }
+}
+
+void
+NfpDigestTable::RemoveBuckets (uint32_t bucketMask)
+{
+  EntryMapType::iterator i = m_entries.begin ();
+  while (i != m_entries.end ())
+    {
+      if (bucketMask & (1u << i->second.bucket))
+        {
+          i = m_entries.erase (i);
+        }
+      else
+        {
+          ++i;
+        }
+    }
+
+  for (size_t b = 0; b < NfpDigest::BucketCount; b++)
+    {
+      if (bucketMask & (1u << b))
+        {
+          m_buckets[b] = 0;
+        }
+    }
+}
+
+void
+NfpDigestTable::Clear (void)
+{
+  m_entries.clear ();
+  m_buckets.assign (NfpDigest::BucketCount, 0);
+}
+
+size_t
+NfpDigestTable::size (void) const
+{
+  return m_entries.size ();
+}
+
+Ptr<NfpDigest>
+NfpDigestTable::CreateDigest (void) const
+{
+  return Create<NfpDigest> ((uint32_t) m_entries.size (), m_buckets);
+}
+
+uint32_t
+NfpDigestTable::Compare (Ptr<const NfpDigest> digest) const
+{
+  uint32_t mask = 0;
+  for (size_t b = 0; b < NfpDigest::BucketCount; b++)
+    {
+      if (digest->GetBucket (b) != m_buckets[b])
+        {
+          mask |= 1u << b;
+        }
+    }
+  return mask;
+}
+
+void
+NfpDigestTable::GetKeys (uint32_t bucketMask, KeyVectorType &keys) const
+{
+  for (EntryMapType::const_iterator i = m_entries.cbegin (); i != m_entries.cend (); ++i)
+    {
+      if (bucketMask & (1u << i->second.bucket))
+        {
+          keys.push_back (i->first);
+        }
+    }
+}
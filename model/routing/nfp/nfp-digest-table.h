@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_DIGEST_TABLE_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_DIGEST_TABLE_H_
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+
+#include "ns3/ccnx-name.h"
+#include "ns3/nfp-digest.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * The (anchorName, prefix) -> (anchorSeqnum, distance) state that one router has advertised,
+ * with an incrementally maintained NfpDigest of it.
+ *
+ * NfpRoutingProtocol keeps one table for what it has sent and each NfpNeighbor keeps one for
+ * what it has heard from that neighbor.  If nothing was lost, the two ends of a link have
+ * equal digests.  Compare() returns the mask of buckets that differ, and only those need
+ * to be advertised again.
+ *
+ * Each entry hashes to a 64-bit value from the name hashes, seqnum, and distance.  A bucket
+ * digest is the XOR of its entry hashes, so an update is O(1) and the digest does not
+ * depend on the order of updates.
+ */
+class NfpDigestTable
+{
+public:
+  typedef std::pair< Ptr<const CCNxName>, Ptr<const CCNxName> > KeyType;
+  typedef std::vector<KeyType> KeyVectorType;
+
+  NfpDigestTable ();
+
+  virtual ~NfpDigestTable ();
+
+  /**
+   * Adds or replaces the entry for (anchorName, prefix).
+   */
+  void Update (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix, uint32_t anchorSeqnum, uint16_t distance);
+
+  /**
+   * Removes the entry for (anchorName, prefix), if any.
+   */
+  void Remove (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix);
+
+  /**
+   * Removes all entries in the buckets set in `bucketMask`.
+   */
+  void RemoveBuckets (uint32_t bucketMask);
+
+  void Clear (void);
+
+  size_t size (void) const;
+
+  /**
+   * A digest of the current table
+   */
+  Ptr<NfpDigest> CreateDigest (void) const;
+
+  /**
+   * @return The mask of buckets whose digest in `digest` is different from ours.  0 means equal.
+   */
+  uint32_t Compare (Ptr<const NfpDigest> digest) const;
+
+  /**
+   * Appends the keys of all entries in the buckets set in `bucketMask` to `keys`.
+   */
+  void GetKeys (uint32_t bucketMask, KeyVectorType &keys) const;
+
+  /**
+   * The bucket of (anchorName, prefix).  It only depends on the names, so all routers agree on it.
+   */
+  static size_t GetBucket (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix);
+
+private:
+  struct ValueType
+  {
+    uint64_t hash;
+    uint32_t bucket;
+  };
+
+  struct HashKey
+  {
+    size_t operator() (const KeyType &a) const
+    {
+      return (size_t) (a.first->GetHash () * 31 + a.second->GetHash ());
+    }
+  };
+
+  struct IsEqualKey
+  {
+    bool operator() (const KeyType &a, const KeyType &b) const
+    {
+      return a.first->Equals (*b.first) && a.second->Equals (*b.second);
+    }
+  };
+
+  typedef std::unordered_map< KeyType, ValueType, HashKey, IsEqualKey > EntryMapType;
+  EntryMapType m_entries;
+  std::vector<uint64_t> m_buckets;
+
+  static uint64_t HashEntry (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix, uint32_t anchorSeqnum, uint16_t distance);
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_DIGEST_TABLE_H_ */
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "nfp-digest.h"
+#include "ns3/ccnx-tlv.h"
+#include "ns3/nfp-schema.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("NfpDigest");
+
+NfpDigest::NfpDigest () : m_entryCount (0), m_buckets (BucketCount, 0)
+{
+  // empty
+}
+
+NfpDigest::NfpDigest (uint32_t entryCount, const std::vector<uint64_t> &buckets)
+  : m_entryCount (entryCount), m_buckets (buckets)
+{
+  NS_LOG_FUNCTION (this << entryCount);
+  NS_ASSERT_MSG (m_buckets.size () == BucketCount, "A digest must have " << BucketCount << " buckets");
+}
+
+NfpDigest::~NfpDigest ()
+{
+  // empty
+}
+
+uint32_t
+NfpDigest::GetEntryCount (void) const
+{
+  return m_entryCount;
+}
+
+uint64_t
+NfpDigest::GetBucket (size_t index) const
+{
+  NS_ASSERT_MSG (index < BucketCount, "Bucket index out of range " << index);
+  return m_buckets[index];
+}
+
+uint32_t
+NfpDigest::GetSerializedSize (void) const
+{
+  return CCNxTlv::GetTLSize () + sizeof(uint32_t) + BucketCount * sizeof(uint64_t);
+}
+
+void
+NfpDigest::Serialize (Buffer::Iterator start) const
+{
+  NS_LOG_FUNCTION (this << &start);
+
+  uint16_t innerSize = GetSerializedSize () - CCNxTlv::GetTLSize ();
+  CCNxTlv::WriteTypeLength (start, NfpSchema::T_DIGEST, innerSize);
+  start.WriteHtonU32 (m_entryCount);
+  for (size_t i = 0; i < BucketCount; i++)
+    {
+      start.WriteHtonU64 (m_buckets[i]);
+    }
+}
+
+uint32_t
+NfpDigest::Deserialize (Buffer::Iterator start)
+{
+  NS_LOG_FUNCTION (this << &start);
+  NS_ASSERT_MSG (start.GetSize () >= CCNxTlv::GetTLSize (), "Must have at least 4 bytes in buffer");
+
+  uint16_t outerType = CCNxTlv::ReadType (start);
+  uint16_t outerLength = CCNxTlv::ReadLength (start);
+
+  NS_ASSERT_MSG (outerType == NfpSchema::T_DIGEST, "Outer type must be T_DIGEST");
+  NS_ASSERT_MSG (outerLength == GetSerializedSize () - CCNxTlv::GetTLSize (), "Wrong T_DIGEST length " << outerLength);
+
+  m_entryCount = start.ReadNtohU32 ();
+  for (size_t i = 0; i < BucketCount; i++)
+    {
+      m_buckets[i] = start.ReadNtohU64 ();
+    }
+
+  return outerLength + CCNxTlv::GetTLSize ();
+}
+
+bool
+NfpDigest::IsAdvertise (void) const
+{
+  return false;
+}
+
+bool
+NfpDigest::IsWithdraw (void) const
+{
+  return false;
+}
+
+bool
+NfpDigest::IsDigest (void) const
+{
+  return true;
+}
+
+bool
+NfpDigest::Equals (NfpDigest const &other) const
+{
+  return m_entryCount == other.m_entryCount && m_buckets == other.m_buckets;
+}
+
+bool
+NfpDigest::Equals (NfpMessage const & other) const
+{
+  bool result = false;
+  if (other.IsDigest ())
+    {
+      const NfpDigest *a = dynamic_cast<const NfpDigest *> (&other);
+      result = Equals (*a);
+    }
+  return result;
+}
+
+std::ostream &
+ns3::ccnx::operator << (std::ostream & os, NfpDigest const & digest)
+{
+  os << "{ Digest: entries " << digest.GetEntryCount () << " }";
+  return os;
+}
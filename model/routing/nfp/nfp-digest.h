@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_NFPDIGEST_H
+#define CCNS3SIM_NFPDIGEST_H
+
+#include <vector>
+
+#include "ns3/nfp-message.h"
+#include "ns3/buffer.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * A compact summary of everything a router has advertised, used by the NFP anti-entropy
+ * refresh.  The advertised (anchor, prefix) pairs are split in to BucketCount buckets
+ * and each bucket carries the XOR of the hashes of its (anchor, prefix, seqnum, distance)
+ * entries.  A neighbor compares the buckets to what it heard from the sender and asks
+ * (NfpDigestRequest) for only the buckets that differ.
+ *
+ * @see NfpDigestTable, nfp-schema.h for packet formats
+ */
+class NfpDigest : public NfpMessage
+{
+public:
+  /**
+   * The number of buckets in a digest.  A bucket mask (see NfpDigestRequest) is a uint32_t.
+   */
+  static const size_t BucketCount = 32;
+
+  NfpDigest ();
+
+  /**
+   * @param entryCount The number of (anchor, prefix) pairs summarized
+   * @param buckets The bucket digests, must have BucketCount entries
+   */
+  NfpDigest (uint32_t entryCount, const std::vector<uint64_t> &buckets);
+
+  virtual ~NfpDigest ();
+
+  uint32_t GetEntryCount (void) const;
+
+  /**
+   * @param index The bucket number, less than BucketCount
+   */
+  uint64_t GetBucket (size_t index) const;
+
+  /**
+   * Return the number of bytes required to serialize this header
+   */
+  virtual uint32_t GetSerializedSize (void) const;
+
+  /**
+   * Serialize the digest in to the given Buffer.
+   */
+  virtual void Serialize (Buffer::Iterator start) const;
+
+  /**
+   * Deserialize the given buffer.
+   */
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  virtual bool IsAdvertise (void) const;
+
+  virtual bool IsWithdraw (void) const;
+
+  virtual bool IsDigest (void) const;
+
+  /**
+   * Determine if this object is equal to other.  For two objects to be equal, they
+   * must be member-wise equal.
+   */
+  bool Equals (NfpDigest const &other) const;
+
+  virtual bool Equals (NfpMessage const & other) const;
+
+protected:
+  uint32_t m_entryCount;
+  std::vector<uint64_t> m_buckets;
+};
+
+std::ostream & operator << (std::ostream & os, NfpDigest const & digest);
+
+}     // namespace ccnx
+} // namespace ns3
+
+
+#endif //CCNS3SIM_NFPDIGEST_H
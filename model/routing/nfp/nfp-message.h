@@ -67,7 +67,7 @@ namespace ccnx {
 /**
  * @ingroup nfp-routing
  *
- * The abstract base class of an Advertise or a Withdraw
+ * The abstract base class of an Advertise, a Withdraw, a Digest, or a DigestRequest
  */
 class NfpMessage : public SimpleRefCount<NfpMessage>
 {
@@ -86,6 +86,22 @@ public:
    */
   virtual bool IsWithdraw (void) const = 0;
 
+  /**
+   * True if this represents a digest of the sender's advertisements (NfpDigest)
+   */
+  virtual bool IsDigest (void) const
+  {
+    return false;
+  }
+
+  /**
+   * True if this represents a request to re-advertise digest buckets (NfpDigestRequest)
+   */
+  virtual bool IsDigestRequest (void) const
+  {
+    return false;
+  }
+
   /**
    * Return the number of bytes required to serialize this header
    */
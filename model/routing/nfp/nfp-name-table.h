@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_NAME_TABLE_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_NAME_TABLE_H_
+
+#include <map>
+#include <unordered_map>
+
+#include "ns3/assert.h"
+#include "ns3/ccnx-name.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * A table keyed by CCNxName that NFP uses for its prefix table (prefix -> NfpPrefix) and
+ * for the anchors of each prefix (anchorName -> NfpAnchorAdvertisement).
+ *
+ * By default it is a std::map sorted by name, so iteration (and thus the order of
+ * state change callbacks, work queue entries, and printed tables) is by name order.
+ * SetHashed(true) switches it to a std::unordered_map keyed by the cached name hash,
+ * which makes a lookup O(1) and avoids the segment-by-segment comparisons of a sorted map.
+ * Iteration order is then the hash table order.  NfpRoutingProtocol uses the hashed
+ * table in its "ScaleMode".
+ *
+ * The mode may only be changed while the table is empty.
+ *
+ * N.B.: Because this is a class template, all implementation must be in the header
+ * file so the compiler can generate the template specializations from user code.
+ *
+ * Example:
+ * @code
+ * {
+ *   NfpNameTable< Ptr<NfpPrefix> > table;
+ *   table.SetHashed (true);
+ *   table[prefixName] = prefixEntry;
+ *   NfpNameTable< Ptr<NfpPrefix> >::const_iterator i = table.find (prefixName);
+ *   if (i != table.end ()) { ... i->second ... }
+ * }
+ * @endcode
+ */
+template <class V>
+class NfpNameTable
+{
+public:
+  typedef std::map< Ptr<const CCNxName>, V, CCNxName::isLessPtrCCNxName > OrderedType;
+  typedef std::unordered_map< Ptr<const CCNxName>, V, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName > HashedType;
+  typedef typename OrderedType::value_type value_type;
+
+  /**
+   * Iterates over either backing table.  Both tables have the same value_type, so
+   * `i->first` and `i->second` work the same way in either mode.
+   */
+  class const_iterator
+  {
+public:
+    const_iterator () : m_hashed (false), m_ordered (), m_hash ()
+    {
+    }
+
+    const_iterator (typename OrderedType::const_iterator i) : m_hashed (false), m_ordered (i), m_hash ()
+    {
+    }
+
+    const_iterator (typename HashedType::const_iterator i) : m_hashed (true), m_ordered (), m_hash (i)
+    {
+    }
+
+    const value_type & operator* () const
+    {
+      return m_hashed ? *m_hash : *m_ordered;
+    }
+
+    const value_type * operator-> () const
+    {
+      return &(operator* ());
+    }
+
+    const_iterator & operator++ ()
+    {
+      if (m_hashed)
+        {
+          ++m_hash;
+        }
+      else
+        {
+          ++m_ordered;
+        }
+      return *this;
+    }
+
+    bool operator== (const const_iterator &other) const
+    {
+      return m_hashed ? m_hash == other.m_hash : m_ordered == other.m_ordered;
+    }
+
+    bool operator!= (const const_iterator &other) const
+    {
+      return !(*this == other);
+    }
+
+private:
+    bool m_hashed;
+    typename OrderedType::const_iterator m_ordered;
+    typename HashedType::const_iterator m_hash;
+  };
+
+  NfpNameTable () : m_hashed (false)
+  {
+  }
+
+  /**
+   * @param hashed [in] true to use a hash table, false (the default) for a sorted map
+   */
+  void SetHashed (bool hashed)
+  {
+    NS_ASSERT_MSG (empty (), "Can only change the table type while it is empty");
+    m_hashed = hashed;
+  }
+
+  bool IsHashed () const
+  {
+    return m_hashed;
+  }
+
+  /**
+   * Returns the value for `name`, inserting a default constructed value if there is none
+   */
+  V & operator[] (Ptr<const CCNxName> name)
+  {
+    return m_hashed ? m_hash[name] : m_ordered[name];
+  }
+
+  const_iterator find (Ptr<const CCNxName> name) const
+  {
+    if (m_hashed)
+      {
+        return const_iterator (m_hash.find (name));
+      }
+    return const_iterator (m_ordered.find (name));
+  }
+
+  const_iterator begin () const
+  {
+    if (m_hashed)
+      {
+        return const_iterator (m_hash.cbegin ());
+      }
+    return const_iterator (m_ordered.cbegin ());
+  }
+
+  const_iterator end () const
+  {
+    if (m_hashed)
+      {
+        return const_iterator (m_hash.cend ());
+      }
+    return const_iterator (m_ordered.cend ());
+  }
+
+  const_iterator cbegin () const
+  {
+    return begin ();
+  }
+
+  const_iterator cend () const
+  {
+    return end ();
+  }
+
+  size_t size () const
+  {
+    return m_hashed ? m_hash.size () : m_ordered.size ();
+  }
+
+  bool empty () const
+  {
+    return size () == 0;
+  }
+
+  /**
+   * Pre-sizes the hash table for `count` names.  Has no effect on a sorted table.
+   */
+  void reserve (size_t count)
+  {
+    if (m_hashed)
+      {
+        m_hash.reserve (count);
+      }
+  }
+
+private:
+  bool m_hashed;
+  OrderedType m_ordered;
+  HashedType m_hash;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_NAME_TABLE_H_ */
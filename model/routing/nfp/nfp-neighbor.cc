@@ -73,7 +73,7 @@ NfpNeighbor::GetUniqueNeighborId (void)
 }
 
 NfpNeighbor::NfpNeighbor (Ptr<const CCNxName> name, Ptr<CCNxConnection> connection, uint16_t messageSeqnum, Time neighborTimeout,
-                          Callback< void, Ptr<NfpNeighborKey> > stateChangeCallback)
+                          Callback< void, Ptr<NfpNeighborKey> > stateChangeCallback, Ptr<NfpTimingWheel> timingWheel)
   : m_neighborId (GetUniqueNeighborId ()), m_name (name), m_connection (connection)
 {
   NS_LOG_FUNCTION (this << name << messageSeqnum << connection->GetConnectionId ());
@@ -84,7 +84,7 @@ NfpNeighbor::NfpNeighbor (Ptr<const CCNxName> name, Ptr<CCNxConnection> connecti
   m_stateChangeCallback = stateChangeCallback;
   m_expiry = ComputeExpiry ();
   m_state = StateUp;
-  m_timer = Timer (Timer::REMOVE_ON_DESTROY);
+  m_timer.SetTimingWheel (timingWheel);
   m_timer.SetFunction (&NfpNeighbor::TimeoutExpired, this);
   SetTimer ();
 
@@ -299,3 +299,9 @@ NfpNeighbor::GetComputationCost() const
 {
   return m_computationCost;
 }
+
+NfpDigestTable &
+NfpNeighbor::GetDigestTable (void)
+{
+  return m_digestTable;
+}
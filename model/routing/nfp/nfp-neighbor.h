@@ -58,11 +58,12 @@
 
 #include <stdint.h>
 #include "ns3/nstime.h"
-#include "ns3/timer.h"
+#include "ns3/nfp-timer.h"
 #include "ns3/simple-ref-count.h"
 #include "ns3/ccnx-name.h"
 #include "ns3/nfp-neighbor-key.h"
 #include "ns3/nfp-computation-cost.h"
+#include "ns3/nfp-digest-table.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -78,7 +79,7 @@ namespace ccnx {
  * Hello messages are only valid if they are in-order to prior messages, as per normal
  * sequece numbers (see NfpSeqnum).
  *
- * A neighbor keeps its own timer for when it expires.  If it expires, it will call
+ * A neighbor keeps its own timer for when it expires, optionally on the NfpTimingWheel of the NfpRoutingProtocol.  If it expires, it will call
  * a user-provided callback with the name of the neighbor.  The timer is updated lazily.  That is,
  * we set it once, then receive updates, then the timer expires.  Assuming we've received updates, we'll
  * set the timer to the next timeout based on the last update.  If we've not received any updates,
@@ -126,9 +127,11 @@ public:
    * @param messageSeqnum The initial sequence number for the neighbor
    * @param neighorTimeout The timeout used to compute if the neighbor is expired
    * @param stateChangeCallback Called whenever the state of the neighbor changes with name of neighbor
+   * @param timingWheel If not null, the neighbor timer runs on this wheel (see NfpTimer)
    */
   NfpNeighbor (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> connection, uint16_t messageSeqnum,
-               Time neighborTimeout, StateChangeCallback stateChangeCallback);
+               Time neighborTimeout, StateChangeCallback stateChangeCallback,
+               Ptr<NfpTimingWheel> timingWheel = Ptr<NfpTimingWheel> ());
 
   virtual ~NfpNeighbor ();
 
@@ -242,6 +245,12 @@ public:
 
   NfpComputationCost GetComputationCost() const;
 
+  /**
+   * What this neighbor has advertised to us, for comparing against its NfpDigest.
+   * Only used in the NfpRoutingProtocol anti-entropy mode.
+   */
+  NfpDigestTable & GetDigestTable (void);
+
 protected:
   Ptr<NfpNeighborKey> m_neighborKey;
 
@@ -294,7 +303,7 @@ protected:
    * Set for our expiry time, at which point we will call the timeout callback assuming
    * we've not been updated.
    */
-  Timer m_timer;
+  NfpTimer m_timer;
 
   /**
    * Called by m_timer when it expires
@@ -338,6 +347,8 @@ protected:
   void LogState (void) const;
 
   NfpComputationCost m_computationCost;
+
+  NfpDigestTable m_digestTable;
 };
 
 }   /* namespace ccnx */
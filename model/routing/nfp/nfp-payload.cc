@@ -244,6 +244,30 @@ NfpPayload::DeserializeWithdraw (Buffer::Iterator const &start, Buffer::Iterator
   return length;
 }
 
+uint32_t
+NfpPayload::DeserializeDigest (Buffer::Iterator const &start, Buffer::Iterator &current)
+{
+  Ptr<NfpDigest> digest = Create<NfpDigest> ();
+  uint32_t length = digest->Deserialize (current);
+  m_messages.push_back (digest);
+  current.Next (length);
+  NS_LOG_DEBUG ("Digest " << *digest  << " offset " << current.GetDistanceFrom (start));
+
+  return length;
+}
+
+uint32_t
+NfpPayload::DeserializeDigestRequest (Buffer::Iterator const &start, Buffer::Iterator &current)
+{
+  Ptr<NfpDigestRequest> request = Create<NfpDigestRequest> ();
+  uint32_t length = request->Deserialize (current);
+  m_messages.push_back (request);
+  current.Next (length);
+  NS_LOG_DEBUG ("DigestRequest " << *request  << " offset " << current.GetDistanceFrom (start));
+
+  return length;
+}
+
 uint32_t
 NfpPayload::Deserialize (Buffer::Iterator start)
 {
@@ -287,6 +311,14 @@ NfpPayload::Deserialize (Buffer::Iterator start)
           readLength = DeserializeWithdraw (start, current);
           break;
 
+        case NfpSchema::T_DIGEST:
+          readLength = DeserializeDigest (start, current);
+          break;
+
+        case NfpSchema::T_DIGEST_REQUEST:
+          readLength = DeserializeDigestRequest (start, current);
+          break;
+
         default:
           NS_ASSERT_MSG (false, "Unsupported message type " << innerType << " offset " << current.GetDistanceFrom (start));
 
@@ -64,6 +64,8 @@
 
 #include "ns3/nfp-advertise.h"
 #include "ns3/nfp-withdraw.h"
+#include "ns3/nfp-digest.h"
+#include "ns3/nfp-digest-request.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -121,7 +123,7 @@ public:
   uint16_t GetMessageSeqnum (void) const;
 
   /**
-   * Appends a message (Advertise or Withdraw) to the payload.
+   * Appends a message (Advertise, Withdraw, Digest, or DigestRequest) to the payload.
    *
    * You must ensure it will fit before calling this method.  Get the
    * remaining capacity via GetCapacity() and make sure it is no smaller
@@ -198,6 +200,8 @@ protected:
   uint32_t DeserializeMessageSeqnum (Buffer::Iterator const &start, Buffer::Iterator &current);
   uint32_t DeserializeAdvertise (Buffer::Iterator const &start, Buffer::Iterator &current);
   uint32_t DeserializeWithdraw (Buffer::Iterator const &start, Buffer::Iterator &current);
+  uint32_t DeserializeDigest (Buffer::Iterator const &start, Buffer::Iterator &current);
+  uint32_t DeserializeDigestRequest (Buffer::Iterator const &start, Buffer::Iterator &current);
 
   typedef std::vector< Ptr<NfpMessage> > MessageListType;
   MessageListType m_messages;
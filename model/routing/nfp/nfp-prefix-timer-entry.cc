@@ -60,7 +60,7 @@ using namespace ns3;
 using namespace ns3::ccnx;
 
 NfpPrefixTimerEntry::NfpPrefixTimerEntry (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time expiry)
-  : m_prefix (prefix), m_anchorName (anchorName), m_expiry (expiry), m_valid (true)
+  : m_prefix (prefix), m_anchorName (anchorName), m_expiry (expiry), m_valid (true), m_heapIndex (0)
 {
 }
 
@@ -82,6 +82,24 @@ NfpPrefixTimerEntry::GetTime (void) const
   return m_expiry;
 }
 
+void
+NfpPrefixTimerEntry::SetTime (Time expiry)
+{
+  m_expiry = expiry;
+}
+
+size_t
+NfpPrefixTimerEntry::GetHeapIndex (void) const
+{
+  return m_heapIndex;
+}
+
+void
+NfpPrefixTimerEntry::SetHeapIndex (size_t index)
+{
+  m_heapIndex = index;
+}
+
 void
 NfpPrefixTimerEntry::Invalidate (void)
 {
@@ -77,6 +77,18 @@ public:
   Ptr<const CCNxName> GetAnchorName (void) const;
   Time GetTime (void) const;
 
+  /**
+   * Changes the expiry time.  Only NfpPrefixTimerHeap's indexed mode uses this, as it
+   * moves the entry in the heap after the change.
+   */
+  void SetTime (Time expiry);
+
+  /**
+   * The position of the entry in an indexed NfpPrefixTimerHeap
+   */
+  size_t GetHeapIndex (void) const;
+  void SetHeapIndex (size_t index);
+
   /**
    * Marks the entry as invalid.  The timer heap might invalidate an entry in the heap
    * so it does not need to do a search to remove it.  It will be removed when it gets to the top.
@@ -150,6 +162,7 @@ private:
   Ptr<const CCNxName> m_anchorName;
   Time m_expiry;
   bool m_valid;
+  size_t m_heapIndex;
 };
 
 
@@ -53,12 +53,15 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include <algorithm>
+
+#include "ns3/assert.h"
 #include "nfp-prefix-timer-heap.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
 
-NfpPrefixTimerHeap::NfpPrefixTimerHeap ()
+NfpPrefixTimerHeap::NfpPrefixTimerHeap () : m_indexed (false)
 {
   // empty
 }
@@ -68,9 +71,28 @@ NfpPrefixTimerHeap::~NfpPrefixTimerHeap ()
   // empty
 }
 
+void
+NfpPrefixTimerHeap::SetIndexed (bool indexed)
+{
+  NS_ASSERT_MSG (m_heap.empty () && m_keys.empty () && m_indexedHeap.empty (), "Can only change the heap type while it is empty");
+  m_indexed = indexed;
+}
+
+size_t
+NfpPrefixTimerHeap::GetSize (void) const
+{
+  return m_indexed ? m_indexedHeap.size () : m_keys.size ();
+}
+
 void
 NfpPrefixTimerHeap::Insert (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time expiry)
 {
+  if (m_indexed)
+    {
+      IndexedInsert (prefix, anchorName, expiry);
+      return;
+    }
+
   Ptr<NfpPrefixTimerEntry> key = Create<NfpPrefixTimerEntry> (prefix, anchorName, expiry);
   KeyMapType::iterator i = m_keys.find (key);
   if ( i != m_keys.end () )
@@ -87,6 +109,11 @@ NfpPrefixTimerHeap::Insert (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anch
 Ptr<const NfpPrefixTimerEntry>
 NfpPrefixTimerHeap::Peek (void)
 {
+  if (m_indexed)
+    {
+      return m_indexedHeap.empty () ? Ptr<const NfpPrefixTimerEntry> (0) : m_indexedHeap.front ();
+    }
+
   Ptr<const NfpPrefixTimerEntry> result;
   bool match = false;
   while (!m_heap.empty ())
@@ -115,5 +142,113 @@ NfpPrefixTimerHeap::Peek (void)
 void
 NfpPrefixTimerHeap::Pop (void)
 {
+  if (m_indexed)
+    {
+      IndexedPop ();
+      return;
+    }
   m_heap.pop ();
 }
+
+void
+NfpPrefixTimerHeap::IndexedInsert (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time expiry)
+{
+  std::pair<IndexedKeyMapType::iterator, bool> result =
+    m_indexedKeys.insert (std::make_pair (NamePairType (prefix, anchorName), Ptr<NfpPrefixTimerEntry> (0)));
+  if (result.second)
+    {
+      Ptr<NfpPrefixTimerEntry> entry = Create<NfpPrefixTimerEntry> (prefix, anchorName, expiry);
+      result.first->second = entry;
+      m_indexedHeap.push_back (Ptr<NfpPrefixTimerEntry> (0));
+      Place (entry, m_indexedHeap.size () - 1);
+      SiftUp (entry->GetHeapIndex ());
+    }
+  else
+    {
+      // update the key in place
+      Ptr<NfpPrefixTimerEntry> entry = result.first->second;
+      Time previous = entry->GetTime ();
+      entry->SetTime (expiry);
+      if (expiry < previous)
+        {
+          SiftUp (entry->GetHeapIndex ());
+        }
+      else
+        {
+          SiftDown (entry->GetHeapIndex ());
+        }
+    }
+}
+
+void
+NfpPrefixTimerHeap::IndexedPop (void)
+{
+  NS_ASSERT_MSG (!m_indexedHeap.empty (), "Pop on an empty heap");
+  Ptr<NfpPrefixTimerEntry> top = m_indexedHeap.front ();
+  m_indexedKeys.erase (NamePairType (top->GetPrefix (), top->GetAnchorName ()));
+
+  Ptr<NfpPrefixTimerEntry> last = m_indexedHeap.back ();
+  m_indexedHeap.pop_back ();
+  if (!m_indexedHeap.empty ())
+    {
+      Place (last, 0);
+      SiftDown (0);
+    }
+}
+
+void
+NfpPrefixTimerHeap::Place (Ptr<NfpPrefixTimerEntry> entry, size_t index)
+{
+  m_indexedHeap[index] = entry;
+  entry->SetHeapIndex (index);
+}
+
+void
+NfpPrefixTimerHeap::SiftUp (size_t index)
+{
+  Ptr<NfpPrefixTimerEntry> entry = m_indexedHeap[index];
+  while (index > 0)
+    {
+      size_t parent = (index - 1) / Arity;
+      if (!(entry->GetTime () < m_indexedHeap[parent]->GetTime ()))
+        {
+          break;
+        }
+      Place (m_indexedHeap[parent], index);
+      index = parent;
+    }
+  Place (entry, index);
+}
+
+void
+NfpPrefixTimerHeap::SiftDown (size_t index)
+{
+  Ptr<NfpPrefixTimerEntry> entry = m_indexedHeap[index];
+  size_t size = m_indexedHeap.size ();
+  while (true)
+    {
+      size_t first = index * Arity + 1;
+      if (first >= size)
+        {
+          break;
+        }
+
+      size_t last = std::min (first + Arity, size);
+      size_t earliest = first;
+      for (size_t child = first + 1; child < last; ++child)
+        {
+          if (m_indexedHeap[child]->GetTime () < m_indexedHeap[earliest]->GetTime ())
+            {
+              earliest = child;
+            }
+        }
+
+      if (!(m_indexedHeap[earliest]->GetTime () < entry->GetTime ()))
+        {
+          break;
+        }
+      Place (m_indexedHeap[earliest], index);
+      index = earliest;
+    }
+  Place (entry, index);
+}
@@ -58,6 +58,8 @@
 
 #include <queue>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "ns3/ccnx-name.h"
 #include "ns3/nfp-prefix-timer-entry.h"
@@ -81,6 +83,12 @@ namespace ccnx {
  * priority queue to find the old update.  Instead, we have a map by (prefix, anchorName) that stores a reference
  * to the prioirty queue entry and we invalidate it then insert a new entry.  This leaves some crud in the tree
  * that we prune off when it pops to the top.  It is only O(logN), not O(N logN).
+ *
+ * In indexed mode (SetIndexed(true), used by NfpRoutingProtocol's "ScaleMode"), the heap is a d-ary heap
+ * in a vector where each entry knows its own position.  An Insert for a (prefix, anchorName) already in the
+ * heap changes the entry's time and moves it up or down in place (decrease-key or increase-key), so the heap
+ * never holds more than one entry per pair and there is no crud to prune.  The keys are found through a
+ * hash table on the name hashes rather than a sorted map.
  */
 class NfpPrefixTimerHeap
 {
@@ -88,6 +96,19 @@ public:
   NfpPrefixTimerHeap ();
   virtual ~NfpPrefixTimerHeap ();
 
+  /**
+   * Selects the indexed d-ary heap (true) or the lazily invalidated priority queue (false, the default).
+   *
+   * PRECONDITION: The heap is empty.
+   */
+  void SetIndexed (bool indexed);
+
+  /**
+   * The number of valid timers in the heap.  In the default mode this is the number of distinct
+   * (prefix, anchorName) pairs ever inserted, as popped keys are not forgotten.
+   */
+  size_t GetSize (void) const;
+
   /**
    * Inserts an element in to the heap.  If the key (prefix, anchorName) already
    * exists, it is updated to the new expiry time.
@@ -150,6 +171,58 @@ private:
   typedef std::map< Ptr<NfpPrefixTimerEntry>, Ptr<NfpPrefixTimerEntry>, NfpPrefixTimerEntry::IsNameLess > KeyMapType;
   KeyMapType m_keys;
 
+  // ---- indexed mode
+
+  /**
+   * The number of children of each node in the indexed heap
+   */
+  static const size_t Arity = 4;
+
+  typedef std::pair< Ptr<const CCNxName>, Ptr<const CCNxName> > NamePairType;
+
+  struct HashNamePair
+  {
+    size_t operator() (const NamePairType &a) const
+    {
+      return (size_t) (a.first->GetHash () * 31 + a.second->GetHash ());
+    }
+  };
+
+  struct IsEqualNamePair
+  {
+    bool operator() (const NamePairType &a, const NamePairType &b) const
+    {
+      return a.first->Equals (*b.first) && a.second->Equals (*b.second);
+    }
+  };
+
+  bool m_indexed;
+
+  /**
+   * The indexed heap.  m_indexedHeap[i]->GetHeapIndex() == i.
+   */
+  std::vector< Ptr<NfpPrefixTimerEntry> > m_indexedHeap;
+
+  typedef std::unordered_map< NamePairType, Ptr<NfpPrefixTimerEntry>, HashNamePair, IsEqualNamePair > IndexedKeyMapType;
+  IndexedKeyMapType m_indexedKeys;
+
+  void IndexedInsert (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time expiry);
+  void IndexedPop (void);
+
+  /**
+   * Puts `entry` at `index` and updates its heap index
+   */
+  void Place (Ptr<NfpPrefixTimerEntry> entry, size_t index);
+
+  /**
+   * Moves the entry at `index` towards the root while it is earlier than its parent
+   */
+  void SiftUp (size_t index);
+
+  /**
+   * Moves the entry at `index` towards the leaves while it is later than its earliest child
+   */
+  void SiftDown (size_t index);
 };
 
 }   /* namespace ccnx */
@@ -64,10 +64,12 @@ using namespace ns3::ccnx;
 
 NS_LOG_COMPONENT_DEFINE ("NfpPrefix");
 
-NfpPrefix::NfpPrefix (Ptr<const CCNxName> prefix, Time advertisementTimeout, PrefixStateChangeCallback callback)
+NfpPrefix::NfpPrefix (Ptr<const CCNxName> prefix, Time advertisementTimeout, PrefixStateChangeCallback callback,
+                      bool hashedAnchors)
   : m_prefix (prefix), m_advertisementTimeout (advertisementTimeout), m_stateChangeCallback (callback)
 {
   NS_LOG_FUNCTION (this << prefix << advertisementTimeout);
+  m_anchors.SetHashed (hashedAnchors);
 }
 
 NfpPrefix::~NfpPrefix ()
@@ -94,7 +96,7 @@ NfpPrefix::ReceiveAdvertisement (Ptr<NfpAdvertise> advertisement, Ptr<CCNxConnec
 
   // table event
   m_computationCost.IncrementEvents();
-  AnchorMapType::iterator i = m_anchors.find (anchorName);
+  AnchorMapType::const_iterator i = m_anchors.find (anchorName);
   if (i == m_anchors.end ())
     {
       // create a new row
@@ -150,7 +152,7 @@ NfpPrefix::ReceiveWithdraw (Ptr<NfpWithdraw> withdraw, Ptr<CCNxConnection> ingre
   bool result = false;
   Ptr<const CCNxName> anchorName = withdraw->GetAnchorName ();
   m_computationCost.IncrementEvents();
-  AnchorMapType::iterator i = m_anchors.find (anchorName);
+  AnchorMapType::const_iterator i = m_anchors.find (anchorName);
   if (i != m_anchors.end ())
     {
       Ptr<NfpAnchorAdvertisement> aa = i->second;
@@ -167,12 +169,26 @@ NfpPrefix::ReceiveWithdraw (Ptr<NfpWithdraw> withdraw, Ptr<CCNxConnection> ingre
   return result;
 }
 
+bool
+NfpPrefix::RefreshNexthop (Ptr<const CCNxName> anchorName, Ptr<CCNxConnection> ingressConnection, Time now)
+{
+  NS_LOG_FUNCTION (this << anchorName << ingressConnection->GetConnectionId ());
+
+  m_computationCost.IncrementEvents();
+  AnchorMapType::const_iterator i = m_anchors.find (anchorName);
+  if (i == m_anchors.end ())
+    {
+      return false;
+    }
+  return i->second->RefreshNexthop (ingressConnection, now + m_advertisementTimeout);
+}
+
 void
 NfpPrefix::RemoveConnection (Ptr<CCNxConnection> connection)
 {
   NS_LOG_FUNCTION (this << connection->GetConnectionId ());
 
-  for (AnchorMapType::iterator i = m_anchors.begin (); i != m_anchors.end (); ++i)
+  for (AnchorMapType::const_iterator i = m_anchors.begin (); i != m_anchors.end (); ++i)
     {
       m_computationCost.IncrementLoopIterations();
       Ptr<NfpAnchorAdvertisement> aa = i->second;
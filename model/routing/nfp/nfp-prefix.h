@@ -69,6 +69,7 @@
 
 #include "ns3/ccnx-route.h"
 #include "ns3/nfp-computation-cost.h"
+#include "ns3/nfp-name-table.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -107,9 +108,11 @@ public:
    * @param [in] prefix The prefix of this object
    * @param [in] advertisementTimeout The timeout for an advertisement if it has not been updated
    * @param [in] stateChangeCallback The callback to notify whenever an anchor changes state
+   * @param [in] hashedAnchors If true, keep the anchors in a hash table instead of a sorted map (see NfpNameTable)
    * @return A new NfpPrefix object
    */
-  NfpPrefix (Ptr<const CCNxName> prefix, Time advertisementTimeout, PrefixStateChangeCallback stateChangeCallback);
+  NfpPrefix (Ptr<const CCNxName> prefix, Time advertisementTimeout, PrefixStateChangeCallback stateChangeCallback,
+             bool hashedAnchors = false);
 
   /**
    * Destroys an NfpPrefix, releasing all stored pointer references
@@ -159,6 +162,18 @@ public:
    */
   bool ReceiveWithdraw (Ptr<NfpWithdraw> withdraw, Ptr<CCNxConnection> ingressConnection, Time now);
 
+  /**
+   * Extends the expiry of `ingressConnection` as a nexthop to `anchorName`, as if the advertisement had
+   * been received again at `now`.  Used when an anti-entropy digest confirms that the neighbor still
+   * advertises the same route.
+   *
+   * @param anchorName The anchor of the route
+   * @param ingressConnection The nexthop connection
+   * @param now The current time
+   * @return true if the connection is a valid nexthop and was refreshed
+   */
+  bool RefreshNexthop (Ptr<const CCNxName> anchorName, Ptr<CCNxConnection> ingressConnection, Time now);
+
   /**
    * Remove a connection id from all routes.
    *
@@ -230,7 +245,7 @@ protected:
   /**
    * Map from AnchorName -> AnchorAdvertisement
    */
-  typedef std::map< Ptr<const CCNxName>, Ptr<NfpAnchorAdvertisement>, CCNxName::isLessPtrCCNxName > AnchorMapType;
+  typedef NfpNameTable< Ptr<NfpAnchorAdvertisement> > AnchorMapType;
 
   AnchorMapType m_anchors;
 
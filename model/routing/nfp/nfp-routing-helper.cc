@@ -57,6 +57,8 @@
 #include "nfp-routing-protocol.h"
 #include "ns3/node-container.h"
 #include "ns3/node-list.h"
+#include "ns3/simulator.h"
+#include "ns3/ccnx-stack-helper.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -111,6 +113,11 @@ NfpRoutingHelper::SetSteams (NodeContainer &c, int64_t stream)
   for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
     {
       node = (*i);
+      if (!CCNxStackHelper::IsLocalNode (node))
+        {
+          // simulated by another partition
+          continue;
+        }
 
       // If the routing protocol is a List, the List will handle assigning to each member
       Ptr<CCNxRoutingProtocol> routing = node->GetObject<CCNxRoutingProtocol> ();
@@ -125,7 +132,11 @@ NfpRoutingHelper::PrintComputationCostAllNodesWithDelay (Time printDelay, Ptr<Ou
 {
   for (int i = 0; i < NodeList::GetNNodes (); ++i)
     {
-      PrintComputationCostWithDelay (printDelay, stream, NodeList::GetNode (i));
+      Ptr<Node> node = NodeList::GetNode (i);
+      if (CCNxStackHelper::IsLocalNode (node))
+        {
+          PrintComputationCostWithDelay (printDelay, stream, node);
+        }
     }
 }
 
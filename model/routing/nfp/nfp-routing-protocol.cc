@@ -62,9 +62,12 @@
 #include "ns3/log.h"
 #include "nfp-routing-protocol.h"
 #include "ns3/nstime.h"
+#include "ns3/boolean.h"
 
 #include "ns3/nfp-advertise.h"
 #include "ns3/nfp-withdraw.h"
+#include "ns3/nfp-digest.h"
+#include "ns3/nfp-digest-request.h"
 #include "ns3/nfp-payload.h"
 #include "ns3/buffer.h"
 #include "ns3/ccnx-name-builder.h"
@@ -102,6 +105,18 @@ NfpRoutingProtocol::GetTypeId ()
     .AddAttribute ("NeighborTimeout", "Timeout a neighbor if not heard in this period.",
                    TimeValue (Seconds (6)),
                    MakeTimeAccessor (&NfpRoutingProtocol::m_neighborTimeout),
+                   MakeTimeChecker ())
+    .AddAttribute ("ScaleMode", "Use hash tables and an indexed timer heap for large topologies.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NfpRoutingProtocol::SetScaleMode, &NfpRoutingProtocol::GetScaleMode),
+                   MakeBooleanChecker ())
+    .AddAttribute ("AntiEntropy", "Exchange digests instead of periodically re-advertising unchanged routes.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NfpRoutingProtocol::m_antiEntropy),
+                   MakeBooleanChecker ())
+    .AddAttribute ("TimingWheelResolution", "Run the timers on a timing wheel with this tick.  Zero disables the wheel.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&NfpRoutingProtocol::SetTimingWheelResolution, &NfpRoutingProtocol::GetTimingWheelResolution),
                    MakeTimeChecker ());
   return tid;
 }
@@ -113,10 +128,9 @@ NfpRoutingProtocol::NfpRoutingProtocol ()
 {
   m_anchorSeqnum = 0;
   m_messageSeqnum = 1;
-  m_helloTimer = Timer (Timer::REMOVE_ON_DESTROY);
-  m_advertiseTimer = Timer (Timer::REMOVE_ON_DESTROY);
-  m_anchorRouteTimer = Timer (Timer::REMOVE_ON_DESTROY);
-  m_processWorkQueueTimer  = Timer (Timer::REMOVE_ON_DESTROY);
+  m_scaleMode = false;
+  m_antiEntropy = false;
+  SetTimingWheelResolution (Seconds (0));
 
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
   m_nfpPrefix = Create<CCNxName> ("ccnx:/name=nfp");
@@ -175,6 +189,12 @@ NfpRoutingProtocol::DoInitialize (void)
 
   // Set the anchor route timer to start in 1 jitter interval with 25% jitter
   SetTimer (m_anchorRouteTimer, m_jitter, m_jitter / 4);
+
+  m_digestTimer.SetFunction (&NfpRoutingProtocol::DigestTimerExpired, this);
+  if (m_antiEntropy)
+    {
+      SetTimer (m_digestTimer, m_advertiseInterval, m_jitter);
+    }
 }
 
 /**
@@ -249,6 +269,55 @@ NfpRoutingProtocol::GetAnchorPrefixIterator (void) const
 }
 
 
+void
+NfpRoutingProtocol::SetScaleMode (bool scaleMode)
+{
+  NS_LOG_FUNCTION (this << scaleMode);
+  m_scaleMode = scaleMode;
+  m_prefixes.SetHashed (scaleMode);
+  m_workQueue.SetHashed (scaleMode);
+  m_prefixTimerHeap.SetIndexed (scaleMode);
+}
+
+void
+NfpRoutingProtocol::SetTimingWheelResolution (Time resolution)
+{
+  NS_ASSERT_MSG (!m_timingWheel || m_timingWheel->GetPendingCount () == 0, "Cannot change the timing wheel with running timers");
+
+  m_timingWheel = Create<NfpTimingWheel> (resolution);
+  m_helloTimer.SetTimingWheel (m_timingWheel);
+  m_advertiseTimer.SetTimingWheel (m_timingWheel);
+  m_anchorRouteTimer.SetTimingWheel (m_timingWheel);
+  m_processWorkQueueTimer.SetTimingWheel (m_timingWheel);
+  m_digestTimer.SetTimingWheel (m_timingWheel);
+}
+
+Time
+NfpRoutingProtocol::GetTimingWheelResolution (void) const
+{
+  return m_timingWheel->GetResolution ();
+}
+
+bool
+NfpRoutingProtocol::GetScaleMode (void) const
+{
+  return m_scaleMode;
+}
+
+size_t
+NfpRoutingProtocol::GetReachablePrefixCount (void) const
+{
+  size_t count = 0;
+  for (PrefixMapType::const_iterator i = m_prefixes.cbegin (); i != m_prefixes.cend (); ++i)
+    {
+      if (i->second->IsReachable ())
+        {
+          count++;
+        }
+    }
+  return count;
+}
+
 Time
 NfpRoutingProtocol::GetHelloInterval (void) const
 {
@@ -308,8 +377,8 @@ NfpRoutingProtocol::ProcessWorkQueueTimerExpired()
 void
 NfpRoutingProtocol::SetProcessWorkQueueTimer()
 {
-  static Time interval = MilliSeconds(10);
-  static Time jitter = MilliSeconds(5);
+  static const Time interval = MilliSeconds(10);
+  static const Time jitter = MilliSeconds(5);
 
   if (!m_processWorkQueueTimer.IsRunning()) {
       SetTimer(m_processWorkQueueTimer, interval, jitter);
@@ -317,7 +386,7 @@ NfpRoutingProtocol::SetProcessWorkQueueTimer()
 }
 
 void
-NfpRoutingProtocol::SetTimer (Timer &timer, Time interval, Time jitter)
+NfpRoutingProtocol::SetTimer (NfpTimer &timer, Time interval, Time jitter)
 {
   Time final = CalculateJitteredTime (interval, jitter);
 
@@ -458,8 +527,16 @@ NfpRoutingProtocol::AdvertiseTimerExpired ()
       if (entry->GetTime () <= GetCurrentTime () + m_jitter)
         {
           // process entry
-          AddWorkQueueEntry (entry->GetAnchorName (), entry->GetPrefix ());
           m_prefixTimerHeap.Pop ();
+          if (m_antiEntropy)
+            {
+              // our neighbors will find out from the digest if they missed anything
+              SuppressRefresh (entry->GetPrefix (), entry->GetAnchorName ());
+            }
+          else
+            {
+              AddWorkQueueEntry (entry->GetAnchorName (), entry->GetPrefix ());
+            }
         }
       else
         {
@@ -487,6 +564,116 @@ NfpRoutingProtocol::AdvertiseTimerExpired ()
     }
 }
 
+void
+NfpRoutingProtocol::SuppressRefresh (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  PrefixMapType::const_iterator i = m_prefixes.find (prefix);
+  if (i != m_prefixes.end ())
+    {
+      // What ProcessWorkQueue() would have sent
+      Ptr<NfpPrefix> prefixEntry = i->second;
+      uint32_t size;
+      if (prefixEntry->IsReachable (anchorName))
+        {
+          size = prefixEntry->GetAdvertisement (anchorName)->GetSerializedSize ();
+        }
+      else
+        {
+          size = NfpWithdraw (anchorName, prefix).GetSerializedSize ();
+        }
+      m_stats.IncrementRefreshSuppressed (size * m_interfaces.size ());
+
+      m_prefixTimerHeap.Insert (prefix, anchorName, GetCurrentTime () + CalculateJitteredTime (m_routeTimeout, m_jitter));
+    }
+}
+
+void
+NfpRoutingProtocol::DigestTimerExpired ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  m_computationCost.IncrementEvents();
+
+  Ptr<NfpDigest> digest = m_advertisedDigest.CreateDigest ();
+  NS_LOG_DEBUG ("DigestTimerExpired sending " << *digest);
+  m_stats.IncrementDigestSent (digest->GetSerializedSize () * m_interfaces.size ());
+  BroadcastMessage (digest);
+
+  SetTimer (m_digestTimer, m_advertiseInterval, m_jitter);
+}
+
+void
+NfpRoutingProtocol::ReceiveDigest (Ptr<NfpDigest> digest, Ptr<NfpNeighbor> neighbor)
+{
+  NS_LOG_FUNCTION (this << digest << *neighbor);
+
+  m_computationCost.IncrementEvents();
+  NfpDigestTable &heard = neighbor->GetDigestTable ();
+  uint32_t mask = heard.Compare (digest);
+  m_stats.IncrementDigestReceived (mask == 0);
+
+  // The buckets that match say the neighbor still advertises what we heard from it, which is
+  // what a refresh advertisement would have told us.  Extend those nexthops.
+  NfpDigestTable::KeyVectorType keys;
+  heard.GetKeys (~mask, keys);
+  for (NfpDigestTable::KeyVectorType::const_iterator i = keys.begin (); i != keys.end (); ++i)
+    {
+      m_computationCost.IncrementLoopIterations();
+      PrefixMapType::const_iterator prefix = m_prefixes.find (i->second);
+      if (prefix != m_prefixes.end ())
+        {
+          prefix->second->RefreshNexthop (i->first, neighbor->GetConnection (), GetCurrentTime ());
+        }
+    }
+
+  if (mask != 0)
+    {
+      NS_LOG_INFO ("Digest from " << *neighbor->GetName () << " differs, mask 0x" << std::hex << mask << std::dec);
+
+      // Forget what we heard in those buckets.  The neighbor will advertise all of it again.
+      heard.RemoveBuckets (mask);
+
+      Ptr<NfpDigestRequest> request = Create<NfpDigestRequest> (neighbor->GetName (), mask);
+      m_stats.IncrementDigestRequestSent (request->GetSerializedSize () * m_interfaces.size ());
+      BroadcastMessage (request);
+    }
+}
+
+void
+NfpRoutingProtocol::ReceiveDigestRequest (Ptr<NfpDigestRequest> request)
+{
+  NS_LOG_FUNCTION (this << request);
+
+  if (m_routerName->Equals (*request->GetRouterName ()))
+    {
+      m_computationCost.IncrementEvents();
+      NfpDigestTable::KeyVectorType keys;
+      m_advertisedDigest.GetKeys (request->GetBucketMask (), keys);
+      for (NfpDigestTable::KeyVectorType::const_iterator i = keys.begin (); i != keys.end (); ++i)
+        {
+          m_computationCost.IncrementLoopIterations();
+          AddWorkQueueEntry (i->first, i->second);
+        }
+      m_stats.IncrementDigestRepairs (keys.size ());
+    }
+}
+
+void
+NfpRoutingProtocol::BroadcastMessage (Ptr<NfpMessage> message)
+{
+  Ptr<NfpPayload> payload = CreatePayload ();
+  payload->AppendMessage (message);
+  Broadcast (CreatePacket (payload));
+}
+
+Ptr<NfpNeighbor>
+NfpRoutingProtocol::FindNeighbor (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> connection) const
+{
+  Ptr<NfpNeighborKey> key = Create<NfpNeighborKey> (neighborName, connection);
+  NeighborMapType::const_iterator i = m_neighbors.find (key);
+  return (i == m_neighbors.end ()) ? Ptr<NfpNeighbor> () : i->second;
+}
+
 uint16_t
 NfpRoutingProtocol::GetNextMessageSeqnum (void)
 {
@@ -568,6 +755,13 @@ NfpRoutingProtocol::ReceivePayload (Ptr<NfpPayload> payload, Ptr<CCNxConnection>
       // If the message is out-of-sequence from prior messages, ignore it
       if (accept)
         {
+          // In anti-entropy mode, we record what the neighbor advertised to compare with its digest
+          Ptr<NfpNeighbor> neighbor;
+          if (m_antiEntropy)
+            {
+              neighbor = FindNeighbor (payload->GetRouterName (), ingressConnection);
+            }
+
           // The message seqnum was in-order, so we can accept the payload
           for (size_t i = 0; i < payload->GetMessageCount (); i++)
             {
@@ -576,6 +770,12 @@ NfpRoutingProtocol::ReceivePayload (Ptr<NfpPayload> payload, Ptr<CCNxConnection>
               if (message->IsAdvertise ())
                 {
                   Ptr<NfpAdvertise> advertise = DynamicCast<NfpAdvertise, NfpMessage> (message);
+                  if (neighbor)
+                    {
+                      neighbor->GetDigestTable ().Update (advertise->GetAnchorName (), advertise->GetPrefix (),
+                                                          advertise->GetAnchorSeqnum (), advertise->GetDistance ());
+                    }
+
                   if ( !m_routerName->Equals (*advertise->GetAnchorName ()))
                     {
                       ReceiveAdvertise (advertise, ingressConnection);
@@ -588,6 +788,11 @@ NfpRoutingProtocol::ReceivePayload (Ptr<NfpPayload> payload, Ptr<CCNxConnection>
               else if (message->IsWithdraw ())
                 {
                   Ptr<NfpWithdraw> withdraw = DynamicCast<NfpWithdraw, NfpMessage> (message);
+                  if (neighbor)
+                    {
+                      neighbor->GetDigestTable ().Remove (withdraw->GetAnchorName (), withdraw->GetPrefix ());
+                    }
+
         	  if ( !m_routerName->Equals (*withdraw->GetAnchorName ()))
         	    {
         	      ReceiveWithdraw (withdraw, ingressConnection);
@@ -595,6 +800,20 @@ NfpRoutingProtocol::ReceivePayload (Ptr<NfpPayload> payload, Ptr<CCNxConnection>
                         NS_LOG_DEBUG ("ReceivePayload anchor name is us, ignore withdraw");
         	    }
                 }
+              else if (message->IsDigest ())
+                {
+                  if (neighbor)
+                    {
+                      ReceiveDigest (DynamicCast<NfpDigest, NfpMessage> (message), neighbor);
+                    }
+                }
+              else if (message->IsDigestRequest ())
+                {
+                  if (m_antiEntropy)
+                    {
+                      ReceiveDigestRequest (DynamicCast<NfpDigestRequest, NfpMessage> (message));
+                    }
+                }
               else
                 {
                   NS_LOG_ERROR ("Unknown message type [" << i << "] : "  << message);
@@ -617,7 +836,8 @@ NfpRoutingProtocol::AddAdvertise (Ptr<NfpAdvertise> advertise, Ptr<CCNxConnectio
 {
   Ptr<const CCNxName> prefixName = advertise->GetPrefix ();
   Ptr<NfpPrefix> prefixEntry = Create<NfpPrefix> (prefixName, m_routeTimeout,
-                                                  MakeCallback (&NfpRoutingProtocol::PrefixStateChanged, this));
+                                                  MakeCallback (&NfpRoutingProtocol::PrefixStateChanged, this),
+                                                  m_scaleMode);
 
   // must do this before calling ReceiveAdvertisement because if that triggers the PrefixStateChagned callback,
   // we need to have it in our map first.
@@ -639,7 +859,7 @@ NfpRoutingProtocol::ReceiveAdvertise (Ptr<NfpAdvertise> advertise, Ptr<CCNxConne
   m_stats.IncrementAdvertiseReceived();
   m_computationCost.IncrementEvents();
   Ptr<const CCNxName> prefixName = advertise->GetPrefix ();
-  PrefixMapType::iterator i = m_prefixes.find (prefixName);
+  PrefixMapType::const_iterator i = m_prefixes.find (prefixName);
   if (i == m_prefixes.end ())
     {
       NS_LOG_INFO ("Adding advertisement " << *advertise << " ingress " << ingressConnection->GetConnectionId());
@@ -671,7 +891,7 @@ NfpRoutingProtocol::ReceiveWithdraw (Ptr<NfpWithdraw> withdraw, Ptr<CCNxConnecti
 
   m_computationCost.IncrementEvents();
   Ptr<const CCNxName> prefixName = withdraw->GetPrefix ();
-  PrefixMapType::iterator i = m_prefixes.find (prefixName);
+  PrefixMapType::const_iterator i = m_prefixes.find (prefixName);
   if (i != m_prefixes.end ())
     {
       Ptr<NfpPrefix> prefixEntry = i->second;
@@ -721,7 +941,8 @@ NfpRoutingProtocol::ReceiveHello (Ptr<const CCNxName> neighborName, uint16_t msg
       // not in map
       m_computationCost.IncrementEvents();
       Ptr<NfpNeighbor> neighbor = Create<NfpNeighbor> (neighborName, ingressConnection, msgSeqnum, m_neighborTimeout,
-                                                       MakeCallback (&NfpRoutingProtocol::NeighborStateChanged, this));
+                                                       MakeCallback (&NfpRoutingProtocol::NeighborStateChanged, this),
+                                                       m_timingWheel);
       m_neighbors[key] = neighbor;
       NS_LOG_DEBUG ("ReceiveHello from " << *neighborName << " ConnId " << ingressConnection->GetConnectionId () << " msgSeqnum " << msgSeqnum << " add new neighbor");
       result = true;
@@ -744,6 +965,9 @@ NfpRoutingProtocol::NeighborStateChanged (Ptr<NfpNeighborKey> neighborKey)
     {
       NS_LOG_WARN ("Removing routes for neighbor " << *neighborKey);
       RemoveNeighborRoutes (neighborKey->GetName (), neighborKey->GetConnection ());
+
+      // if it comes back, its digest will not match and we will ask for everything again
+      neighbor->GetDigestTable ().Clear ();
     }
   else if (neighbor->IsStateDead ())
     {
@@ -851,7 +1075,7 @@ NfpRoutingProtocol::RemoveNeighborRoutes (Ptr<const CCNxName> neighborName, Ptr<
 {
   NS_LOG_FUNCTION (this << *neighborName << connection->GetConnectionId ());
 
-  for (PrefixMapType::iterator i = m_prefixes.begin (); i != m_prefixes.end (); ++i)
+  for (PrefixMapType::const_iterator i = m_prefixes.begin (); i != m_prefixes.end (); ++i)
     {
       m_computationCost.IncrementLoopIterations();
       Ptr<NfpPrefix> prefix = i->second;
@@ -925,6 +1149,11 @@ NfpRoutingProtocol::ProcessWorkQueue (void)
 
                   NS_LOG_DEBUG("Append to payload " << *advertise);
                   payload->AppendMessage (advertise);
+                  if (m_antiEntropy)
+                    {
+                      m_advertisedDigest.Update (advertise->GetAnchorName (), advertise->GetPrefix (),
+                                                 advertise->GetAnchorSeqnum (), advertise->GetDistance ());
+                    }
 
                   m_stats.IncrementAdvertiseSent();
                 }
@@ -941,6 +1170,10 @@ NfpRoutingProtocol::ProcessWorkQueue (void)
 
                   NS_LOG_DEBUG("Append to payload " << *withdraw);
                   payload->AppendMessage (withdraw);
+                  if (m_antiEntropy)
+                    {
+                      m_advertisedDigest.Remove (withdraw->GetAnchorName (), withdraw->GetPrefix ());
+                    }
                   m_stats.IncrementWithdrawSent();
                 }
 
@@ -1129,6 +1362,8 @@ NfpRoutingProtocol::GetComputationCost() const
   for (NeighborMapType::const_iterator i = m_neighbors.begin(); i != m_neighbors.end(); ++i) {
       total += i->second->GetComputationCost();
   }
+
+  total += m_timingWheel->GetComputationCost();
   return total;
 }
 
@@ -69,8 +69,10 @@
 
 #include "ns3/nfp-prefix.h"
 #include "ns3/nfp-workqueue.h"
+#include "ns3/nfp-name-table.h"
+#include "ns3/nfp-digest-table.h"
 
-#include "ns3/timer.h"
+#include "ns3/nfp-timer.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/nfp-prefix-timer-heap.h"
 
@@ -196,6 +198,27 @@ namespace ccnx {
  *
  *      m_prefixTimerHeap : NfpPrefixTimerHeap
  *
+ * @section scale-mode Scale Mode
+ *      The "ScaleMode" attribute is for topologies of thousands of nodes.  It keeps m_prefixes and the anchors
+ *      of each NfpPrefix in hash tables (NfpNameTable), the work queue's uniqueness set in a hash set, and
+ *      m_prefixTimerHeap as an indexed d-ary heap that updates timers in place.  Routing results are the
+ *      same, but the tables are no longer iterated in name order, so the order of messages in a payload and of
+ *      printed tables may differ from the default mode.
+ *
+ * @section anti-entropy Anti-Entropy
+ *      With the "AntiEntropy" attribute, an expired m_prefixTimerHeap entry no longer re-advertises an
+ *      unchanged (prefix, anchorName).  Instead, every AdvertiseInterval the router broadcasts an NfpDigest
+ *      of m_advertisedDigest, the (anchorName, prefix, seqnum, distance) it has advertised.  Each NfpNeighbor
+ *      keeps an NfpDigestTable of what it heard from that neighbor.  If a received digest differs, the
+ *      listener asks (NfpDigestRequest) for the differing buckets and the sender puts their entries
+ *      in the work queue.  A digest bucket that matches refreshes the expiry of the nexthops via that
+ *      neighbor in the bucket, as the suppressed advertisements would have, so routes do not depend on
+ *      the anchor's sequence number flood arriving within RouteTimeout.  New anchor sequence numbers and
+ *      withdraws are still flooded as before.  NfpStats counts the suppressed refreshes and the digest
+ *      overhead.
+ *
+ *      m_advertisedDigest : NfpDigestTable
+ *
  * @section work-queue Work Queue
  *     The work queue tracks (anchorname, prefix) pairs.  When something is inserted into the work queue,
  *     it is a book mark for the routing protocol that it has to do something with that pair.
@@ -212,6 +235,11 @@ namespace ccnx {
  *	All timers are set via the `SetTimer()` function, which uses `CalculateJitteredTime()`.  Jittering will fire a timer
  *	in the period [interval - jitter, interval), so all timers at at most their prescribed interval.
  *
+ *	With a non-zero "TimingWheelResolution", the protocol and neighbor timers run on one NfpTimingWheel with that tick,
+ *	so the timers of one tick cost one simulator event.  A timer then fires up to one tick late.  With the default
+ *	of zero, the wheel is a pass-through and each timer is its own simulator event, as with ns3::Timer.
+ *	Either way, the timer counts are in GetComputationCost().
+ *
  * @subsection hello-timer Hello Timer
  *      All NFP messages count has 'hello' messages.  They contain our router name and our message sequence number.
  *      Only if we have not sent any other NFP messages will we send an empty 'hello' message when this timer expires.
@@ -304,6 +332,29 @@ public:
 
   NfpStats GetStats() const;
 
+  /**
+   * Selects the scale mode data structures (see "ScaleMode" attribute).
+   *
+   * PRECONDITION: No routes have been learned yet (e.g. set it as an attribute).
+   */
+  void SetScaleMode (bool scaleMode);
+
+  bool GetScaleMode (void) const;
+
+  /**
+   * Puts all our timers on a new NfpTimingWheel with this tick.  Zero makes each timer its
+   * own simulator event.  Set by the "TimingWheelResolution" attribute.  It must be set before
+   * any timers are running.
+   */
+  void SetTimingWheelResolution (Time resolution);
+
+  Time GetTimingWheelResolution (void) const;
+
+  /**
+   * The number of prefixes in the RIB that are reachable through at least one anchor.
+   */
+  size_t GetReachablePrefixCount (void) const;
+
 protected:
   /**
    * The storage type for Anchor Prefixes.
@@ -499,7 +550,7 @@ protected:
    * With each timer expiry, we increment m_anchorSeqnum and then send all the prefixes with that seqnum.
    * @see m_anchorSeqnum, AnchorRouteTimerExpired()
    */
-  Timer m_anchorRouteTimer;
+  NfpTimer m_anchorRouteTimer;
 
   /**
    * Called when m_anchorRouteTimer expires.
@@ -530,7 +581,7 @@ protected:
    *
    * @see HelloTimerExpired()
    */
-  Timer m_helloTimer;
+  NfpTimer m_helloTimer;
 
   /**
    * The time we sent our last broadcast packet.  This is used to determine if we need to send
@@ -579,7 +630,7 @@ protected:
   /**
    * Prefix routes are indexed by the prefix name, which then holds state for each anchor
    */
-  typedef std::map< Ptr<const CCNxName>, Ptr<NfpPrefix>, CCNxName::isLessPtrCCNxName > PrefixMapType;
+  typedef NfpNameTable< Ptr<NfpPrefix> > PrefixMapType;
 
   /**
    * Our routing state.  This is also known as the Route Information Base (RIB).
@@ -664,6 +715,66 @@ protected:
    */
   NfpStats m_stats;
 
+  /**
+   * Use hashed tables and an indexed timer heap (set by the "ScaleMode" attribute).
+   */
+  bool m_scaleMode;
+
+  /**
+   * All our timers and those of our neighbors (set by the "TimingWheelResolution" attribute).
+   */
+  Ptr<NfpTimingWheel> m_timingWheel;
+
+  /**
+   * Exchange digests instead of refreshing unchanged routes (set by the "AntiEntropy" attribute).
+   */
+  bool m_antiEntropy;
+
+  /**
+   * What we have advertised, for the digest we send in anti-entropy mode.
+   */
+  NfpDigestTable m_advertisedDigest;
+
+  /**
+   * In anti-entropy mode, the timer to send our digest every m_advertiseInterval.
+   */
+  NfpTimer m_digestTimer;
+
+  /**
+   * Callback of Timer when m_digestTimer expires.  Broadcasts the digest of m_advertisedDigest.
+   */
+  void DigestTimerExpired ();
+
+  /**
+   * Compare a neighbor's digest to what we heard from it.  Request the buckets that differ and
+   * refresh the expiry of the nexthops via the neighbor in the buckets that match.
+   *
+   * @param digest The digest from the neighbor
+   * @param neighbor The neighbor that sent it
+   */
+  void ReceiveDigest (Ptr<NfpDigest> digest, Ptr<NfpNeighbor> neighbor);
+
+  /**
+   * If the request is for us, put the entries of the requested buckets in the work queue.
+   */
+  void ReceiveDigestRequest (Ptr<NfpDigestRequest> request);
+
+  /**
+   * In anti-entropy mode, called instead of re-advertising an expired m_prefixTimerHeap entry.
+   * Restarts its timer and counts the refresh we did not send.
+   */
+  void SuppressRefresh (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  /**
+   * Sends a payload with the single message `message`
+   */
+  void BroadcastMessage (Ptr<NfpMessage> message);
+
+  /**
+   * @return The neighbor (neighborName, connection) or null if not in m_neighbors
+   */
+  Ptr<NfpNeighbor> FindNeighbor (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> connection) const;
+
   /**
    * Callback of Timer when m_helloTimer expires
    */
@@ -672,7 +783,7 @@ protected:
   /**
    * The timer to count down until the next Advertisement.
    */
-  Timer m_advertiseTimer;
+  NfpTimer m_advertiseTimer;
 
   /**
    * Callback of Timer when m_advertiseTimer expires.
@@ -682,7 +793,7 @@ protected:
   /**
    * Set a timer to expire in a uniform random period [0, Interval - Jitter].
    */
-  void SetTimer (Timer &timer, Time interval, Time jitter);
+  void SetTimer (NfpTimer &timer, Time interval, Time jitter);
 
   /**
    * Jitters the interval by a random time.
@@ -762,7 +873,7 @@ protected:
    * Whenever there is a change that requires a message to be sent, we queue it and start
    * (if not running) this timer so we send the messages a short delay later.
    */
-  Timer m_processWorkQueueTimer;
+  NfpTimer m_processWorkQueueTimer;
 
   /**
    * The callback from `m_processWorkQueueTimer`.
@@ -116,6 +116,35 @@ namespace ccnx {
  *   +------------------+------------------+
  *   ~ Prefix Name                         ~
  *   +------------------+------------------+
+ *
+ *   In anti-entropy mode (see NfpRoutingProtocol "AntiEntropy"), a router periodically
+ *   sends a digest of everything it has advertised.  The (anchor, prefix) pairs are
+ *   split in to NfpDigest::BucketCount buckets and each bucket digest is the XOR of the
+ *   hashes of its (anchor, prefix, seqnum, distance) entries.
+ *
+ *   +------------------+------------------+
+ *   | T_DIGEST         |     length       |
+ *   +------------------+------------------+
+ *   |    entry count (uint32)             |
+ *   +------------------+------------------+
+ *   |    bucket 0 digest (uint64)         |
+ *   |                                     |
+ *   +------------------+------------------+
+ *   ~    ... bucket N-1 digest            ~
+ *   +------------------+------------------+
+ *
+ *   A neighbor whose copy of a bucket differs asks the digest's sender to advertise
+ *   the entries in those buckets again.
+ *
+ *   +------------------+------------------+
+ *   | T_DIGEST_REQUEST |     length       |
+ *   +------------------+------------------+
+ *   | T_NAME           |     length       |
+ *   +------------------+------------------+
+ *   ~ Router Name of the digest sender    ~
+ *   +------------------+------------------+
+ *   |    bucket mask (uint32)             |
+ *   +------------------+------------------+
  */
 class NfpSchema
 {
@@ -127,6 +156,8 @@ public:
   static const uint16_t T_MSG = 0x0004;
   static const uint16_t T_MSG_SEQNUM = 0x0005;
   static const uint16_t T_ADV_DATA = 0x0006;
+  static const uint16_t T_DIGEST = 0x0007;
+  static const uint16_t T_DIGEST_REQUEST = 0x0008;
 };
 }
 }
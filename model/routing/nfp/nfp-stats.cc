@@ -65,7 +65,9 @@ NfpStats::NfpStats ()
   : m_nodeId(0),
     m_payloadsSent (0), m_bytesSent (0), m_payloadsReceived (0), m_bytesReceived (0), m_hellosSent(0),
     m_advertiseOriginated (0), m_advertiseSent (0), m_advertiseReceived (0), m_advertiseReceivedFeasible (0),
-    m_withdrawOriginated(0), m_withdrawSent (0), m_withdrawReceived (0)
+    m_withdrawOriginated(0), m_withdrawSent (0), m_withdrawReceived (0),
+    m_digestsSent (0), m_digestRequestsSent (0), m_digestsReceived (0), m_digestsMatched (0),
+    m_digestRepairs (0), m_digestBytesSent (0), m_refreshSuppressed (0), m_refreshBytesSuppressed (0)
 {
 }
 
@@ -75,7 +77,11 @@ NfpStats::NfpStats(const NfpStats &copy)
     m_bytesReceived (copy.m_bytesReceived), m_hellosSent (copy.m_hellosSent),
     m_advertiseOriginated (copy.m_advertiseOriginated), m_advertiseSent (copy.m_advertiseSent), m_advertiseReceived (copy.m_advertiseReceived),
     m_advertiseReceivedFeasible (copy.m_advertiseReceivedFeasible),
-    m_withdrawOriginated(copy.m_withdrawOriginated), m_withdrawSent (copy.m_withdrawSent), m_withdrawReceived (copy.m_withdrawReceived)
+    m_withdrawOriginated(copy.m_withdrawOriginated), m_withdrawSent (copy.m_withdrawSent), m_withdrawReceived (copy.m_withdrawReceived),
+    m_digestsSent (copy.m_digestsSent), m_digestRequestsSent (copy.m_digestRequestsSent),
+    m_digestsReceived (copy.m_digestsReceived), m_digestsMatched (copy.m_digestsMatched),
+    m_digestRepairs (copy.m_digestRepairs), m_digestBytesSent (copy.m_digestBytesSent),
+    m_refreshSuppressed (copy.m_refreshSuppressed), m_refreshBytesSuppressed (copy.m_refreshBytesSuppressed)
 {
 
 }
@@ -103,6 +109,15 @@ NfpStats::operator += (const NfpStats &other)
   m_withdrawOriginated+= other.m_withdrawOriginated;
   m_withdrawSent += other.m_withdrawSent;
   m_withdrawReceived += other.m_withdrawReceived;
+
+  m_digestsSent += other.m_digestsSent;
+  m_digestRequestsSent += other.m_digestRequestsSent;
+  m_digestsReceived += other.m_digestsReceived;
+  m_digestsMatched += other.m_digestsMatched;
+  m_digestRepairs += other.m_digestRepairs;
+  m_digestBytesSent += other.m_digestBytesSent;
+  m_refreshSuppressed += other.m_refreshSuppressed;
+  m_refreshBytesSuppressed += other.m_refreshBytesSuppressed;
   return *this;
 }
 
@@ -232,6 +247,83 @@ NfpStats::GetHellosSent() const
   return m_hellosSent;
 }
 
+void NfpStats::IncrementDigestSent(uint64_t bytes)
+{
+  m_digestsSent++;
+  m_digestBytesSent += bytes;
+}
+
+void NfpStats::IncrementDigestRequestSent(uint64_t bytes)
+{
+  m_digestRequestsSent++;
+  m_digestBytesSent += bytes;
+}
+
+void NfpStats::IncrementDigestReceived(bool matched)
+{
+  m_digestsReceived++;
+  if (matched)
+    {
+      m_digestsMatched++;
+    }
+}
+
+void NfpStats::IncrementDigestRepairs(uint64_t count)
+{
+  m_digestRepairs += count;
+}
+
+void NfpStats::IncrementRefreshSuppressed(uint64_t bytes)
+{
+  m_refreshSuppressed++;
+  m_refreshBytesSuppressed += bytes;
+}
+
+uint64_t NfpStats::GetDigestsSent() const
+{
+  return m_digestsSent;
+}
+
+uint64_t NfpStats::GetDigestRequestsSent() const
+{
+  return m_digestRequestsSent;
+}
+
+uint64_t NfpStats::GetDigestsReceived() const
+{
+  return m_digestsReceived;
+}
+
+uint64_t NfpStats::GetDigestsMatched() const
+{
+  return m_digestsMatched;
+}
+
+uint64_t NfpStats::GetDigestRepairs() const
+{
+  return m_digestRepairs;
+}
+
+uint64_t NfpStats::GetDigestBytesSent() const
+{
+  return m_digestBytesSent;
+}
+
+uint64_t NfpStats::GetRefreshSuppressed() const
+{
+  return m_refreshSuppressed;
+}
+
+uint64_t NfpStats::GetRefreshBytesSuppressed() const
+{
+  return m_refreshBytesSuppressed;
+}
+
+int64_t NfpStats::GetRefreshBytesSaved() const
+{
+  return (int64_t) m_refreshBytesSuppressed - (int64_t) m_digestBytesSent;
+}
+
 std::ostream &
 ns3::ccnx::operator << (std::ostream &os, const NfpStats &stats)
 {
@@ -258,6 +350,21 @@ ns3::ccnx::operator << (std::ostream &os, const NfpStats &stats)
   os << " recv " << stats.m_withdrawReceived;
   os << " sent " << stats.m_withdrawSent << std::endl;
 
+  // only in anti-entropy mode, so the default output is unchanged
+  if (stats.m_digestsSent > 0 || stats.m_digestsReceived > 0)
+    {
+      (*timePrinter)(os);
+      os << std::setw (5) << stats.m_nodeId;
+      os << " Routing stats";
+      os << " digest sent " << stats.m_digestsSent;
+      os << " recv " << stats.m_digestsReceived;
+      os << " matched " << stats.m_digestsMatched;
+      os << " requests " << stats.m_digestRequestsSent;
+      os << " repairs " << stats.m_digestRepairs;
+      os << " refresh suppressed " << stats.m_refreshSuppressed;
+      os << " bytes saved " << stats.GetRefreshBytesSaved () << std::endl;
+    }
+
   return os;
 }
 
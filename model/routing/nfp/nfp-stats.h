@@ -111,6 +111,42 @@ namespace ns3
       uint64_t GetWithdrawSent() const;
       uint64_t GetWithdrawReceived() const;
 
+      /**
+       * Anti-entropy mode: a digest (or digest request) of `bytes` was sent on all interfaces
+       */
+      void IncrementDigestSent(uint64_t bytes);
+      void IncrementDigestRequestSent(uint64_t bytes);
+
+      /**
+       * Anti-entropy mode: a neighbor's digest was received, `matched` if it was equal to what we heard
+       */
+      void IncrementDigestReceived(bool matched);
+
+      /**
+       * Anti-entropy mode: entries advertised again because a neighbor asked for them
+       */
+      void IncrementDigestRepairs(uint64_t count);
+
+      /**
+       * Anti-entropy mode: a periodic refresh of `bytes` (on all interfaces) was not sent
+       */
+      void IncrementRefreshSuppressed(uint64_t bytes);
+
+      uint64_t GetDigestsSent() const;
+      uint64_t GetDigestRequestsSent() const;
+      uint64_t GetDigestsReceived() const;
+      uint64_t GetDigestsMatched() const;
+      uint64_t GetDigestRepairs() const;
+      uint64_t GetDigestBytesSent() const;
+      uint64_t GetRefreshSuppressed() const;
+      uint64_t GetRefreshBytesSuppressed() const;
+
+      /**
+       * The refresh bytes not sent less the digest and digest request bytes sent.
+       * Negative if the anti-entropy overhead was larger than what it saved.
+       */
+      int64_t GetRefreshBytesSaved() const;
+
       friend std::ostream & operator << (std::ostream &os, const NfpStats &stats);
 
     protected:
@@ -130,6 +166,15 @@ namespace ns3
       uint64_t    m_withdrawOriginated;            //<! Withdraws we originated
       uint64_t    m_withdrawSent;
       uint64_t    m_withdrawReceived;
+
+      uint64_t    m_digestsSent;                //<! Digests we sent
+      uint64_t    m_digestRequestsSent;         //<! Digest requests we sent
+      uint64_t    m_digestsReceived;            //<! Digests we received
+      uint64_t    m_digestsMatched;             //<! Digests we received that matched what we heard
+      uint64_t    m_digestRepairs;              //<! Entries advertised again due to digest requests
+      uint64_t    m_digestBytesSent;            //<! Bytes of digests and digest requests (over all interfaces)
+      uint64_t    m_refreshSuppressed;          //<! Periodic refreshes replaced by the digest
+      uint64_t    m_refreshBytesSuppressed;     //<! Bytes of those refreshes (over all interfaces)
       };
 
 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_H_
+
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+#include "ns3/nfp-timing-wheel.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * A timer with the parts of the ns3::Timer API that NFP uses, which runs on an NfpTimingWheel.
+ * Without a wheel, it schedules its own simulator event like an ns3::Timer.
+ *
+ * A pending timer is cancelled when the NfpTimer is destroyed.
+ */
+class NfpTimer
+{
+public:
+  NfpTimer ();
+
+  virtual ~NfpTimer ();
+
+  /**
+   * Use `wheel` for all later calls to Schedule().  A null wheel uses the simulator directly.
+   */
+  void SetTimingWheel (Ptr<NfpTimingWheel> wheel);
+
+  /**
+   * @param memPtr The member function to call on expiry
+   * @param objPtr The object to call it on
+   */
+  template <typename MEM_PTR, typename OBJ_PTR>
+  void SetFunction (MEM_PTR memPtr, OBJ_PTR objPtr)
+  {
+    m_function = MakeCallback (memPtr, objPtr);
+  }
+
+  void SetDelay (const Time &delay);
+
+  Time GetDelay (void) const;
+
+  /**
+   * Schedules the timer to expire after GetDelay().  The timer must not be running.
+   */
+  void Schedule (void);
+
+  void Cancel (void);
+
+  bool IsRunning (void) const;
+
+private:
+  /* Timers are owned by one object, which the callback points to */
+  NfpTimer (const NfpTimer &);
+  NfpTimer & operator = (const NfpTimer &);
+
+  void Expire (void);
+
+  Ptr<NfpTimingWheel> m_wheel;
+  Callback<void> m_function;
+  Time m_delay;
+
+  /**
+   * Used without a wheel
+   */
+  EventId m_event;
+
+  /**
+   * Used with a wheel, 0 if not running
+   */
+  NfpTimingWheel::TimerId m_timerId;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_H_ */
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/simulator.h"
+#include "nfp-timing-wheel.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("NfpTimingWheel");
+
+NfpTimingWheel::NfpTimingWheel (Time resolution) : m_resolution (resolution), m_nextId (1)
+{
+  NS_ASSERT_MSG (!resolution.IsNegative (), "Resolution must not be negative");
+  if (resolution.IsStrictlyPositive ())
+    {
+      m_wheel = Create< CCNxTimingWheel<TimerId> > (resolution, MakeCallback (&NfpTimingWheel::Expire, this));
+    }
+}
+
+NfpTimingWheel::~NfpTimingWheel ()
+{
+  for (EntryMapType::iterator i = m_entries.begin (); i != m_entries.end (); ++i)
+    {
+      i->second.event.Cancel ();
+    }
+}
+
+Time
+NfpTimingWheel::GetResolution (void) const
+{
+  return m_resolution;
+}
+
+NfpTimingWheel::TimerId
+NfpTimingWheel::Schedule (Time delay, Callback<void> callback)
+{
+  NS_ASSERT_MSG (!delay.IsNegative (), "Timer delay must not be negative");
+
+  TimerId id = m_nextId++;
+  Entry &entry = m_entries[id];
+  entry.callback = callback;
+
+  if (m_wheel)
+    {
+      m_wheel->Insert (Simulator::Now () + delay, id);
+    }
+  else
+    {
+      entry.event = Simulator::Schedule (delay, &NfpTimingWheel::Expire, this, id);
+    }
+
+  return id;
+}
+
+bool
+NfpTimingWheel::Cancel (TimerId id)
+{
+  EntryMapType::iterator i = m_entries.find (id);
+  if (i == m_entries.end ())
+    {
+      return false;
+    }
+
+  i->second.event.Cancel ();
+  m_entries.erase (i);
+
+  if (m_entries.empty () && m_wheel)
+    {
+      // Only cancelled ids are left, so do not let them keep the wheel ticking
+      m_wheel->Clear ();
+    }
+  return true;
+}
+
+bool
+NfpTimingWheel::IsPending (TimerId id) const
+{
+  return m_entries.find (id) != m_entries.end ();
+}
+
+size_t
+NfpTimingWheel::GetPendingCount (void) const
+{
+  return m_entries.size ();
+}
+
+NfpComputationCost
+NfpTimingWheel::GetComputationCost (void) const
+{
+  NfpComputationCost cost (m_computationCost);
+  if (m_wheel)
+    {
+      cost.IncrementTimerEvents (m_wheel->GetTickEventCount ());
+      cost.IncrementLoopIterations (m_wheel->GetExpiredCount () + m_wheel->GetCascadeCount ());
+    }
+  return cost;
+}
+
+void
+NfpTimingWheel::Expire (TimerId id)
+{
+  EntryMapType::iterator i = m_entries.find (id);
+  if (i == m_entries.end ())
+    {
+      // cancelled
+      return;
+    }
+
+  Callback<void> callback = i->second.callback;
+  m_entries.erase (i);
+
+  if (!m_wheel)
+    {
+      m_computationCost.IncrementTimerEvents ();
+    }
+  m_computationCost.IncrementTimerExpirations ();
+
+  // may schedule or cancel other timers
+  callback ();
+}
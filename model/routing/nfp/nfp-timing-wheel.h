@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMING_WHEEL_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMING_WHEEL_H_
+
+#include <stdint.h>
+#include <unordered_map>
+
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/ccnx-timing-wheel.h"
+#include "ns3/nfp-computation-cost.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * The timers of one NfpRoutingProtocol and its NfpNeighbors (see NfpTimer), on one
+ * CCNxTimingWheel.  All the timers due in a tick run from one simulator event, and
+ * scheduling or cancelling a timer does not touch the simulator scheduler.  A timer
+ * expires at the first tick boundary at or after its time, so it may fire up to one
+ * `resolution` late, but never early.
+ *
+ * CCNxTimingWheel has no cancel, so the wheel holds timer ids and we keep the callbacks
+ * in a map.  Cancel removes the map entry, and the id is ignored when it comes out of the wheel.
+ *
+ * With a zero resolution, there is no wheel: every timer is its own simulator event at
+ * its exact time, the same as an ns3::Timer.  The timer counts in GetComputationCost() are
+ * kept the same way in both modes, so they show how many simulator events the wheel saved.
+ */
+class NfpTimingWheel : public SimpleRefCount<NfpTimingWheel>
+{
+public:
+  /**
+   * Identifies a scheduled timer.  0 is never a valid id.
+   */
+  typedef uint64_t TimerId;
+
+  /**
+   * @param resolution The tick length.  Zero makes every timer its own simulator event.
+   */
+  NfpTimingWheel (Time resolution);
+
+  virtual ~NfpTimingWheel ();
+
+  Time GetResolution (void) const;
+
+  /**
+   * Calls `callback` after `delay`.
+   *
+   * @return The id to use with Cancel() and IsPending()
+   */
+  TimerId Schedule (Time delay, Callback<void> callback);
+
+  /**
+   * @return true if the timer was pending and is now cancelled.
+   */
+  bool Cancel (TimerId id);
+
+  bool IsPending (TimerId id) const;
+
+  /**
+   * The number of timers scheduled and not yet expired or cancelled.
+   */
+  size_t GetPendingCount (void) const;
+
+  /**
+   * The simulator events and timer expirations of this wheel (see NfpComputationCost::GetTimerEvents()).
+   * Cascades in the wheel count as loop iterations.
+   */
+  NfpComputationCost GetComputationCost (void) const;
+
+private:
+  struct Entry
+  {
+    Callback<void> callback;
+    EventId event;
+  };
+
+  typedef std::unordered_map<TimerId, Entry> EntryMapType;
+
+  Time m_resolution;
+  TimerId m_nextId;
+  EntryMapType m_entries;
+
+  /**
+   * Null if m_resolution is zero
+   */
+  Ptr< CCNxTimingWheel<TimerId> > m_wheel;
+
+  /**
+   * Only counts the events and expirations without a wheel.  The wheel counts its own ticks.
+   */
+  NfpComputationCost m_computationCost;
+
+  /**
+   * Runs the callback of `id`, if it was not cancelled.
+   */
+  void Expire (TimerId id);
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMING_WHEEL_H_ */
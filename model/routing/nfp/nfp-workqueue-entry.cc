@@ -54,6 +54,7 @@
  */
 
 #include "nfp-workqueue-entry.h"
+#include "ns3/ccnx-free-list.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -69,6 +70,18 @@ NfpWorkQueueEntry::~NfpWorkQueueEntry ()
   // empty
 }
 
+void *
+NfpWorkQueueEntry::operator new (size_t size)
+{
+  return CCNxFreeList<NfpWorkQueueEntry>::Allocate (size);
+}
+
+void
+NfpWorkQueueEntry::operator delete (void *p, size_t size)
+{
+  CCNxFreeList<NfpWorkQueueEntry>::Release (p, size);
+}
+
 Ptr<const CCNxName>
 NfpWorkQueueEntry::GetAnchorName (void) const
 {
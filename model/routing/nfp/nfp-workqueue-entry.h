@@ -64,6 +64,9 @@ namespace ccnx {
 
 /**
  * @ingroup nfp-routing
+ *
+ * An entry is made every time NFP queues a (anchorName, prefix) pair, even if it is already
+ * queued, so entries are allocated from a CCNxFreeList rather than the heap.
  */
 
 class NfpWorkQueueEntry : public SimpleRefCount<NfpWorkQueueEntry>
@@ -72,6 +75,9 @@ public:
   NfpWorkQueueEntry (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix);
   virtual ~NfpWorkQueueEntry ();
 
+  static void *operator new (size_t size);
+  static void operator delete (void *p, size_t size);
+
   Ptr<const CCNxName> GetAnchorName (void) const;
   Ptr<const CCNxName> GetPrefix (void) const;
 
@@ -116,6 +122,31 @@ public:
     }
   };
 
+  /**
+   * Hash of the pair (anchorName, prefix).  Used with `isEqualPtrWorkQueueEntry` in an unordered container.
+   */
+  struct hashPtrWorkQueueEntry
+  {
+    size_t
+    operator() (const Ptr<NfpWorkQueueEntry> a) const
+    {
+      return (size_t) (a->GetAnchorName ()->GetHash () * 31 + a->GetPrefix ()->GetHash ());
+    }
+  };
+
+  /**
+   * True if both entries have equal anchorName and prefix.
+   */
+  struct isEqualPtrWorkQueueEntry
+  {
+    bool
+    operator() (const Ptr<NfpWorkQueueEntry> a,
+                const Ptr<NfpWorkQueueEntry> b) const
+    {
+      return a->GetAnchorName ()->Equals (*b->GetAnchorName ()) && a->GetPrefix ()->Equals (*b->GetPrefix ());
+    }
+  };
+
 protected:
   Ptr<const CCNxName> m_anchorName;
   Ptr<const CCNxName> m_prefix;
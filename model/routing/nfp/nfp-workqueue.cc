@@ -61,7 +61,7 @@ using namespace ns3::ccnx;
 
 NS_LOG_COMPONENT_DEFINE ("NfpWorkQueue");
 
-NfpWorkQueue::NfpWorkQueue ()
+NfpWorkQueue::NfpWorkQueue () : m_hashed (false)
 {
   // empty
 }
@@ -71,12 +71,25 @@ NfpWorkQueue::~NfpWorkQueue ()
   // empty
 }
 
+void
+NfpWorkQueue::SetHashed (bool hashed)
+{
+  NS_ASSERT_MSG (empty (), "Can only change the set type while the queue is empty");
+  m_hashed = hashed;
+}
+
+size_t
+NfpWorkQueue::size (void) const
+{
+  return m_queue.size ();
+}
+
 void
 NfpWorkQueue::push_back (Ptr<NfpWorkQueueEntry> entry)
 {
   NS_LOG_FUNCTION (this << entry);
-  std::pair<WorkQueueSetType::iterator,bool> result = m_queueSet.insert (entry);
-  if (result.second)
+  bool inserted = m_hashed ? m_queueHashSet.insert (entry).second : m_queueSet.insert (entry).second;
+  if (inserted)
     {
       // it was inserted, add it to the FIFO ordering
       m_queue.push_back (entry);
@@ -99,7 +112,14 @@ NfpWorkQueue::pop_front (void)
   NS_LOG_INFO ("Pop entry: " << *entry);
 
   m_queue.pop_front ();
-  m_queueSet.erase (entry);
+  if (m_hashed)
+    {
+      m_queueHashSet.erase (entry);
+    }
+  else
+    {
+      m_queueSet.erase (entry);
+    }
 
   AssertInvariants ();
   return entry;
@@ -114,5 +134,5 @@ NfpWorkQueue::empty (void) const
 void
 NfpWorkQueue::AssertInvariants (void) const
 {
-  NS_ASSERT_MSG (m_queue.size () == m_queueSet.size (), "queue and queueSet different sizes");
+  NS_ASSERT_MSG (m_queue.size () == (m_hashed ? m_queueHashSet.size () : m_queueSet.size ()), "queue and queueSet different sizes");
 }
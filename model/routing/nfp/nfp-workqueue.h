@@ -57,6 +57,7 @@
 #define CCNX_MODEL_ROUTING_NFP_NFP_WORKQUEUE_H_
 
 #include <set>
+#include <unordered_set>
 #include <deque>
 
 #include "ns3/simple-ref-count.h"
@@ -75,6 +76,9 @@ namespace ccnx {
  * The work queue stores entries in FIFO order and a given (anchorName, prefix) pair can only
  * be in the queue once.  If it is added multiple times, only the first one stays (and stays at its original place
  * in the queue).
+ *
+ * Uniqueness is kept with a sorted set by default.  SetHashed(true) uses a hash set on the
+ * name hashes instead.  The FIFO order is the same either way.
  */
 class NfpWorkQueue : public SimpleRefCount<NfpWorkQueue>
 {
@@ -84,6 +88,18 @@ public:
    */
   NfpWorkQueue ();
 
+  /**
+   * Selects a hash set (true) or a sorted set (false, the default) to keep entries unique.
+   *
+   * PRECONDITION: The queue is empty.
+   */
+  void SetHashed (bool hashed);
+
+  /**
+   * The number of entries in the queue
+   */
+  size_t size (void) const;
+
   /**
    *
    */
@@ -120,6 +136,14 @@ protected:
   typedef std::set< Ptr<NfpWorkQueueEntry>, NfpWorkQueueEntry::islessPtrWorkQueueEntry > WorkQueueSetType;
   WorkQueueSetType m_queueSet;
 
+  /**
+   * Used instead of m_queueSet when m_hashed is set
+   */
+  typedef std::unordered_set< Ptr<NfpWorkQueueEntry>, NfpWorkQueueEntry::hashPtrWorkQueueEntry, NfpWorkQueueEntry::isEqualPtrWorkQueueEntry > WorkQueueHashSetType;
+  WorkQueueHashSetType m_queueHashSet;
+
+  bool m_hashed;
+
   /**
    * The work queue dequeue maintains the FIFO order
    */
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "ns3/ccnx-consumer-window.h"
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxConsumerWindow {
+
+BeginTest (Constructor)
+{
+  printf ("TestSuiteCCNxConsumerWindow Constructor DoRun\n");
+  Ptr<CCNxConsumerWindow> window = Create<CCNxConsumerWindow> (CCNxConsumerWindow::WindowControl_Aimd, 4, 100);
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindowControl (), CCNxConsumerWindow::WindowControl_Aimd, "wrong window control");
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 4, "wrong initial window");
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindowInPackets (), 4, "wrong initial window in packets");
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), Seconds (1), "initial RTO should be 1 second");
+  NS_TEST_EXPECT_MSG_EQ (window->GetDecreaseCount (), 0, "wrong decrease count");
+}
+EndTest ()
+
+BeginTest (Fixed)
+{
+  printf ("TestSuiteCCNxConsumerWindow Fixed DoRun\n");
+  Ptr<CCNxConsumerWindow> window = Create<CCNxConsumerWindow> (CCNxConsumerWindow::WindowControl_Fixed, 8, 100);
+  window->OnResponse (Seconds (1), MilliSeconds (100), true);
+  window->OnResponse (Seconds (1), MilliSeconds (100), true);
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 8, "fixed window should not grow");
+  window->OnTimeout (Seconds (2), Seconds (1));
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 8, "fixed window should not shrink");
+  NS_TEST_EXPECT_MSG_EQ (window->GetDecreaseCount (), 0, "wrong decrease count");
+}
+EndTest ()
+
+BeginTest (Aimd)
+{
+  printf ("TestSuiteCCNxConsumerWindow Aimd DoRun\n");
+  Ptr<CCNxConsumerWindow> window = Create<CCNxConsumerWindow> (CCNxConsumerWindow::WindowControl_Aimd, 1, 100);
+
+  // slow start
+  window->OnResponse (MilliSeconds (100), MilliSeconds (100), true);
+  window->OnResponse (MilliSeconds (200), MilliSeconds (100), true);
+  window->OnResponse (MilliSeconds (300), MilliSeconds (100), true);
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 4, "slow start should add 1 per response");
+
+  // multiplicative decrease
+  window->OnTimeout (Seconds (1), MilliSeconds (500));
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 2, "timeout should halve the window");
+  NS_TEST_EXPECT_MSG_EQ (window->GetSlowStartThreshold (), 2, "wrong slow start threshold");
+  NS_TEST_EXPECT_MSG_EQ (window->GetDecreaseCount (), 1, "wrong decrease count");
+
+  // an Interest sent before the decrease is part of the same loss event
+  window->OnTimeout (MilliSeconds (1100), MilliSeconds (900));
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 2, "same loss event should not decrease again");
+  NS_TEST_EXPECT_MSG_EQ (window->GetDecreaseCount (), 1, "wrong decrease count");
+
+  // additive increase
+  window->OnResponse (MilliSeconds (1200), MilliSeconds (100), false);
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 2.5, "congestion avoidance should add 1/window per response");
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindowInPackets (), 2, "window in packets should round down");
+
+  // never below 1
+  window->OnTimeout (Seconds (2), Seconds (2));
+  window->OnTimeout (Seconds (3), Seconds (3));
+  window->OnTimeout (Seconds (4), Seconds (4));
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 1, "window should not go below 1");
+}
+EndTest ()
+
+BeginTest (Cubic)
+{
+  printf ("TestSuiteCCNxConsumerWindow Cubic DoRun\n");
+  Ptr<CCNxConsumerWindow> window = Create<CCNxConsumerWindow> (CCNxConsumerWindow::WindowControl_Cubic, 10, 100);
+  window->OnResponse (Seconds (0), MilliSeconds (100), true);
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), 11, "slow start should add 1 per response");
+
+  window->OnTimeout (Seconds (1), Seconds (1));
+  NS_TEST_EXPECT_MSG_EQ_TOL (window->GetWindow (), 7.7, 1e-9, "timeout should multiply the window by 0.7");
+
+  // K = cbrt (11 * 0.3 / 0.4) is about 2.02 seconds.  Before K the window grows towards 11,
+  // after K it grows past it.
+  double last = window->GetWindow ();
+  Time now = Seconds (1);
+  for (int i = 0; i < 10; i++)
+    {
+      now += MilliSeconds (100);
+      window->OnResponse (now, MilliSeconds (100), true);
+      NS_TEST_EXPECT_MSG_GT (window->GetWindow (), last, "window should grow");
+      last = window->GetWindow ();
+    }
+  NS_TEST_EXPECT_MSG_LT (window->GetWindow (), 11, "window should be below the last maximum before K");
+
+  for (int i = 0; i < 200; i++)
+    {
+      now += MilliSeconds (20);
+      window->OnResponse (now, MilliSeconds (100), true);
+    }
+  NS_TEST_EXPECT_MSG_GT (window->GetWindow (), 11, "window should pass the last maximum after K");
+  NS_TEST_EXPECT_MSG_EQ (window->GetDecreaseCount (), 1, "wrong decrease count");
+}
+EndTest ()
+
+BeginTest (Rto)
+{
+  printf ("TestSuiteCCNxConsumerWindow Rto DoRun\n");
+  Ptr<CCNxConsumerWindow> window = Create<CCNxConsumerWindow> (CCNxConsumerWindow::WindowControl_Aimd, 1, 100,
+                                                               MilliSeconds (200), Seconds (2));
+
+  // first sample: SRTT = R, RTTVAR = R/2, RTO = SRTT + 4 RTTVAR
+  window->OnResponse (Seconds (1), MilliSeconds (100), true);
+  NS_TEST_EXPECT_MSG_EQ (window->GetSmoothedRtt (), MilliSeconds (100), "wrong srtt");
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), MilliSeconds (300), "wrong rto");
+
+  // RTTVAR = 3/4 * 50 + 1/4 * 0
+  window->OnResponse (Seconds (1), MilliSeconds (100), true);
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), MicroSeconds (250000), "wrong rto");
+
+  // a retransmitted Interest is not sampled
+  window->OnResponse (Seconds (1), Seconds (5), false);
+  NS_TEST_EXPECT_MSG_EQ (window->GetSmoothedRtt (), MilliSeconds (100), "retransmission should not be sampled");
+
+  // exponential backoff up to the maximum
+  window->OnTimeout (Seconds (2), Seconds (1));
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), MilliSeconds (500), "timeout should double the rto");
+  window->OnTimeout (Seconds (3), Seconds (2));
+  window->OnTimeout (Seconds (4), Seconds (3));
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), Seconds (2), "rto should stop at the maximum");
+
+  // the minimum
+  for (int i = 0; i < 20; i++)
+    {
+      window->OnResponse (Seconds (5), MilliSeconds (1), true);
+    }
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), MilliSeconds (200), "rto should stop at the minimum");
+}
+EndTest ()
+
+BeginTest (WindowLossBacksOffOnce)
+{
+  printf ("TestSuiteCCNxConsumerWindow WindowLossBacksOffOnce DoRun\n");
+  Ptr<CCNxConsumerWindow> window = Create<CCNxConsumerWindow> (CCNxConsumerWindow::WindowControl_Aimd, 10, 100,
+                                                               MilliSeconds (200), Seconds (60));
+  window->OnResponse (Seconds (1), MilliSeconds (100), true);
+  Time rto = window->GetRto ();
+  double before = window->GetWindow ();
+
+  // a whole window sent at about the same time, then every timer expires
+  for (int i = 0; i < 10; i++)
+    {
+      window->OnTimeout (Seconds (2) + MilliSeconds (i), Seconds (1) + MilliSeconds (i));
+    }
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), rto + rto, "one loss event should double the rto once");
+  NS_TEST_EXPECT_MSG_EQ (window->GetWindow (), before / 2, "one loss event should halve the window once");
+  NS_TEST_EXPECT_MSG_EQ (window->GetDecreaseCount (), 1, "wrong decrease count");
+
+  // the retransmissions are sent after the loss event, so losing them backs off again
+  window->OnTimeout (Seconds (3), MilliSeconds (2500));
+  NS_TEST_EXPECT_MSG_EQ (window->GetRto (), rto + rto + rto + rto, "a new loss event should double the rto again");
+
+  // a fixed window still backs off once per loss event
+  Ptr<CCNxConsumerWindow> fixed = Create<CCNxConsumerWindow> (CCNxConsumerWindow::WindowControl_Fixed, 10, 100);
+  for (int i = 0; i < 10; i++)
+    {
+      fixed->OnTimeout (Seconds (2) + MilliSeconds (i), Seconds (1) + MilliSeconds (i));
+    }
+  NS_TEST_EXPECT_MSG_EQ (fixed->GetRto (), Seconds (2), "one loss event should double the rto once");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxConsumerWindow
+ */
+static class TestSuiteCCNxConsumerWindow : public TestSuite
+{
+public:
+  TestSuiteCCNxConsumerWindow () : TestSuite ("ccnx-consumer-window", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new Fixed (), TestCase::QUICK);
+    AddTestCase (new Aimd (), TestCase::QUICK);
+    AddTestCase (new Cubic (), TestCase::QUICK);
+    AddTestCase (new Rto (), TestCase::QUICK);
+    AddTestCase (new WindowLossBacksOffOnce (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxConsumerWindow;
+
+} // namespace TestSuiteCCNxConsumerWindow
@@ -189,6 +189,97 @@ BeginTest (Test_GetContentObject)
 EndTest ()
 
 
+BeginTest (Test_GetContentObjectIndexed)
+{
+  printf ("TestSuiteCCNxContentRepository Test_GetContentObjectIndexed DoRun\n");
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=producer");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix, 10, 100);
+
+  for (uint32_t i = 0; i < 100; i += 33)
+    {
+      Ptr <const CCNxName> name = repository->GetNameAtIndex (i);
+      Ptr <CCNxContentObject> content = repository->GetContentObject (name);
+      bool exists = (content);
+      NS_TEST_EXPECT_MSG_EQ (exists, true, "Failed to get content object " << i);
+      NS_TEST_EXPECT_MSG_EQ (name->Equals (*content->GetName ()), true, "Wrong content object " << i);
+    }
+
+  Ptr <const CCNxName> outOfRange = Create <CCNxName> ("ccnx:/name=test/name=producer/chunk=100");
+  bool exists = (repository->GetContentObject (outOfRange));
+  NS_TEST_EXPECT_MSG_EQ (exists, false, "Chunk past the end should not be found");
+
+  Ptr <const CCNxName> otherPrefix = Create <CCNxName> ("ccnx:/name=test/name=other/chunk=1");
+  exists = (repository->GetContentObject (otherPrefix));
+  NS_TEST_EXPECT_MSG_EQ (exists, false, "Other prefix should not be found");
+
+  Ptr <const CCNxName> extraSegment = Create <CCNxName> ("ccnx:/name=test/name=producer/chunk=1/name=extra");
+  exists = (repository->GetContentObject (extraSegment));
+  NS_TEST_EXPECT_MSG_EQ (exists, false, "Name with an extra segment should not be found");
+
+  Ptr <const CCNxName> notChunk = Create <CCNxName> ("ccnx:/name=test/name=producer/name=1");
+  exists = (repository->GetContentObject (notChunk));
+  NS_TEST_EXPECT_MSG_EQ (exists, false, "Non-chunk segment should not be found");
+}
+EndTest ()
+
+BeginTest (Test_GetZipfAlpha)
+{
+  printf ("TestSuiteCCNxContentRepository Test_GetZipfAlpha DoRun\n");
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=producer");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix, 10, 10);
+  NS_TEST_EXPECT_MSG_EQ (repository->GetZipfAlpha (), 2.5, "Wrong default alpha");
+
+  repository = Create <CCNxContentRepository> (prefix, 10, 10, 0.8);
+  NS_TEST_EXPECT_MSG_EQ (repository->GetZipfAlpha (), 0.8, "Wrong explicit alpha");
+}
+EndTest ()
+
+/*
+ * Draws many names and returns how often each index came up, as a fraction of the draws.
+ */
+static std::vector<double>
+SampleFrequencies (Ptr <CCNxContentRepository> repository, uint32_t draws)
+{
+  std::vector<double> frequency (repository->GetContentObjectCount (), 0.0);
+  for (uint32_t i = 0; i < draws; i++)
+    {
+      Ptr <const CCNxName> name = repository->GetRandomName ();
+      for (uint32_t j = 0; j < frequency.size (); j++)
+        {
+          if (name->Equals (*repository->GetNameAtIndex (j)))
+            {
+              frequency[j] += 1.0 / draws;
+              break;
+            }
+        }
+    }
+  return frequency;
+}
+
+BeginTest (Test_GetRandomNameDistribution)
+{
+  printf ("TestSuiteCCNxContentRepository Test_GetRandomNameDistribution DoRun\n");
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=producer");
+
+  // With alpha 1 the weights are 4:3:2:1
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix, 10, 4, 1.0);
+  std::vector<double> frequency = SampleFrequencies (repository, 40000);
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      double expected = (4.0 - i) / 10.0;
+      NS_TEST_EXPECT_MSG_EQ_TOL (frequency[i], expected, 0.02, "Wrong frequency for index " << i);
+    }
+
+  // With alpha 0 every object is equally likely
+  repository = Create <CCNxContentRepository> (prefix, 10, 5, 0.0);
+  frequency = SampleFrequencies (repository, 40000);
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ_TOL (frequency[i], 0.2, 0.02, "Wrong frequency for index " << i);
+    }
+}
+EndTest ()
+
 
 /*
  *
@@ -211,6 +302,9 @@ public:
     AddTestCase (new Test_GetRandomName (), TestCase::QUICK);
     AddTestCase (new Test_GetRepositoryPrefix, TestCase::QUICK);
     AddTestCase (new Test_GetContentObject, TestCase::QUICK);
+    AddTestCase (new Test_GetContentObjectIndexed (), TestCase::QUICK);
+    AddTestCase (new Test_GetZipfAlpha (), TestCase::QUICK);
+    AddTestCase (new Test_GetRandomNameDistribution (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxContentRepository;
 
@@ -68,6 +68,27 @@ BeginTest (Constructor)
 }
 EndTest ()
 
+BeginTest (UpdateLength)
+{
+  const uint8_t bytes[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  Buffer buffer (0);
+  buffer.AddAtStart (sizeof(bytes));
+  buffer.Begin ().Write (bytes, sizeof(bytes));
+
+  Ptr<CCNxHasherFnv1a> expected = CreateObject<CCNxHasherFnv1a> ();
+  expected->Update (bytes, 5);
+
+  // Hash the first 5 bytes in two pieces
+  Ptr<CCNxHasherFnv1a> hasher = CreateObject<CCNxHasherFnv1a> ();
+  Buffer::Iterator i = buffer.Begin ();
+  NS_TEST_EXPECT_MSG_EQ (hasher->Update (i, 2), 2, "Wrong length");
+  i.Next (2);
+  NS_TEST_EXPECT_MSG_EQ (hasher->Update (i, 3), 3, "Wrong length");
+
+  NS_TEST_EXPECT_MSG_EQ (*hasher->Finalize () == *expected->Finalize (), true, "Wrong hash");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -79,6 +100,7 @@ public:
   TestSuiteCCNxHasherFnv1a () : TestSuite ("ccnx-hasher-fnv1a", UNIT)
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new UpdateLength (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxHasherFnv1a;
 
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+#include "ns3/test.h"
+#include "ns3/ccnx-hasher-sha256.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxHasherSha256 {
+
+static std::string
+ToHex (Ptr<CCNxHashValue> hash)
+{
+  std::ostringstream os;
+  Ptr<const CCNxByteArray> bytes = hash->GetValue ();
+  for (size_t i = 0; i < bytes->size (); i++)
+    {
+      os << std::hex << std::setw (2) << std::setfill ('0') << (int) (*bytes)[i];
+    }
+  return os.str ();
+}
+
+static std::vector<uint8_t>
+CreateMessage (size_t length)
+{
+  std::vector<uint8_t> message (length);
+  for (size_t i = 0; i < length; i++)
+    {
+      message[i] = (uint8_t) i;
+    }
+  return message;
+}
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxHasherSha256> hasher = CreateObject<CCNxHasherSha256> ();
+  NS_TEST_EXPECT_MSG_EQ (hasher->Finalize ()->size (), 32, "Wrong digest length");
+}
+EndTest ()
+
+/**
+ * FIPS 180-4 test vectors, plus 1024 bytes so the multi-block path runs.
+ */
+BeginTest (KnownValues)
+{
+  Ptr<CCNxHasherSha256> hasher = CreateObject<CCNxHasherSha256> ();
+  NS_TEST_EXPECT_MSG_EQ (ToHex (hasher->Finalize ()),
+                         "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", "Wrong empty digest");
+
+  hasher->Init ();
+  hasher->Update ((const uint8_t *) "abc", 3);
+  NS_TEST_EXPECT_MSG_EQ (ToHex (hasher->Finalize ()),
+                         "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "Wrong abc digest");
+
+  const char *twoBlocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  hasher->Init ();
+  hasher->Update ((const uint8_t *) twoBlocks, strlen (twoBlocks));
+  NS_TEST_EXPECT_MSG_EQ (ToHex (hasher->Finalize ()),
+                         "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", "Wrong 448 bit digest");
+
+  std::vector<uint8_t> message = CreateMessage (1024);
+  hasher->Init ();
+  hasher->Update (&message[0], message.size ());
+  NS_TEST_EXPECT_MSG_EQ (ToHex (hasher->Finalize ()),
+                         "785b0751fc2c53dc14a4ce3d800e69ef9ce1009eb327ccf458afe09c242c26c9", "Wrong 1024 byte digest");
+}
+EndTest ()
+
+/**
+ * Updates that do not line up with the 64 byte blocks give the same digest.
+ */
+BeginTest (Streaming)
+{
+  std::vector<uint8_t> message = CreateMessage (1024);
+  Ptr<CCNxHasherSha256> hasher = CreateObject<CCNxHasherSha256> ();
+  hasher->Update (&message[0], message.size ());
+  Ptr<CCNxHashValue> expected = hasher->Finalize ();
+
+  hasher->Init ();
+  size_t offset = 0;
+  size_t chunk = 1;
+  while (offset < message.size ())
+    {
+      size_t length = std::min (chunk, message.size () - offset);
+      hasher->Update (&message[offset], length);
+      offset += length;
+      chunk = chunk * 3 + 1;
+    }
+  NS_TEST_EXPECT_MSG_EQ (*hasher->Finalize () == *expected, true, "Chunked digest is different");
+
+  Buffer buffer (0);
+  buffer.AddAtStart (message.size ());
+  buffer.Begin ().Write (&message[0], message.size ());
+  hasher->Init ();
+  NS_TEST_EXPECT_MSG_EQ (hasher->Update (buffer.Begin ()), message.size (), "Wrong length");
+  NS_TEST_EXPECT_MSG_EQ (*hasher->Finalize () == *expected, true, "Buffer::Iterator digest is different");
+}
+EndTest ()
+
+/**
+ * The multi-buffer digests equal one digest per message, for lengths around the padding
+ * boundaries and more messages than lanes.
+ */
+BeginTest (MultiBuffer)
+{
+  NS_TEST_EXPECT_MSG_GT (CCNxHasherSha256::GetMultiBufferLanes (), 0, "Need at least one lane");
+
+  std::vector<std::vector<uint8_t> > messages;
+  const size_t lengths[] = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 200, 1000, 3, 4096 };
+  for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+    {
+      messages.push_back (CreateMessage (lengths[i]));
+    }
+
+  std::vector<const uint8_t *> pointers;
+  std::vector<size_t> sizes;
+  for (size_t i = 0; i < messages.size (); i++)
+    {
+      pointers.push_back (messages[i].empty () ? 0 : &messages[i][0]);
+      sizes.push_back (messages[i].size ());
+    }
+
+  std::vector<Ptr<CCNxHashValue> > digests;
+  CCNxHasherSha256::DigestMultiBuffer (pointers, sizes, digests);
+  NS_TEST_EXPECT_MSG_EQ (digests.size (), messages.size (), "Wrong number of digests");
+
+  Ptr<CCNxHasherSha256> hasher = CreateObject<CCNxHasherSha256> ();
+  for (size_t i = 0; i < messages.size (); i++)
+    {
+      hasher->Init ();
+      hasher->Update (pointers[i], sizes[i]);
+      NS_TEST_EXPECT_MSG_EQ (*digests[i] == *hasher->Finalize (), true, "Wrong digest for length " << sizes[i]);
+    }
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxHasherSha256
+ */
+static class TestSuiteCCNxHasherSha256 : public TestSuite
+{
+public:
+  TestSuiteCCNxHasherSha256 () : TestSuite ("ccnx-hasher-sha256", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new KnownValues (), TestCase::QUICK);
+    AddTestCase (new Streaming (), TestCase::QUICK);
+    AddTestCase (new MultiBuffer (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxHasherSha256;
+
+} // namespace TestSuiteCCNxHasherSha256
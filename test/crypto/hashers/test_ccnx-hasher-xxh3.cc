@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include <algorithm>
+#include "ns3/test.h"
+#include "ns3/ccnx-hasher-xxh3.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxHasherXxh3 {
+
+static std::vector<uint8_t>
+CreateMessage (size_t length)
+{
+  std::vector<uint8_t> message (length);
+  for (size_t i = 0; i < length; i++)
+    {
+      message[i] = (uint8_t) i;
+    }
+  return message;
+}
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxHasherXxh3> hasher = CreateObject<CCNxHasherXxh3> ();
+  NS_TEST_EXPECT_MSG_EQ (hasher->Finalize ()->size (), 8, "Wrong hash length");
+}
+EndTest ()
+
+/**
+ * Values from the reference XXH3_64bits()
+ */
+BeginTest (KnownValues)
+{
+  NS_TEST_EXPECT_MSG_EQ (CCNxHasherXxh3::Hash (0, 0), 0x2d06800538d394c2ULL, "Wrong empty hash");
+  NS_TEST_EXPECT_MSG_EQ (CCNxHasherXxh3::Hash ((const uint8_t *) "abc", 3), 0x78af5f94892f3950ULL, "Wrong abc hash");
+
+  std::vector<uint8_t> message = CreateMessage (1024);
+  NS_TEST_EXPECT_MSG_EQ (CCNxHasherXxh3::Hash (&message[0], message.size ()), 0xa870f92984398d22ULL, "Wrong 1024 byte hash");
+
+  Ptr<CCNxHasherXxh3> hasher = CreateObject<CCNxHasherXxh3> ();
+  hasher->Update (&message[0], message.size ());
+  Ptr<CCNxHashValue> expected = Create<CCNxHashValue> (0xa870f92984398d22ULL, 8);
+  NS_TEST_EXPECT_MSG_EQ (*hasher->Finalize () == *expected, true, "Wrong streaming hash");
+}
+EndTest ()
+
+/**
+ * Streaming in odd sized pieces matches the one shot hash for every length range:
+ * short inputs, the 240 byte boundary, and inputs longer than the 256 byte buffer.
+ */
+BeginTest (Streaming)
+{
+  const size_t lengths[] = { 1, 3, 4, 8, 9, 16, 17, 128, 129, 240, 241, 255, 256, 257, 1023, 1024, 1025, 5000 };
+  Ptr<CCNxHasherXxh3> hasher = CreateObject<CCNxHasherXxh3> ();
+  for (size_t n = 0; n < sizeof(lengths) / sizeof(lengths[0]); n++)
+    {
+      std::vector<uint8_t> message = CreateMessage (lengths[n]);
+      Ptr<CCNxHashValue> expected = Create<CCNxHashValue> (CCNxHasherXxh3::Hash (&message[0], message.size ()), 8);
+
+      hasher->Init ();
+      size_t offset = 0;
+      size_t chunk = 1;
+      while (offset < message.size ())
+        {
+          size_t length = std::min (chunk, message.size () - offset);
+          hasher->Update (&message[offset], length);
+          offset += length;
+          chunk = chunk * 3 + 1;
+        }
+      NS_TEST_EXPECT_MSG_EQ (*hasher->Finalize () == *expected, true, "Wrong streaming hash for length " << lengths[n]);
+
+      Buffer buffer (0);
+      buffer.AddAtStart (message.size ());
+      buffer.Begin ().Write (&message[0], message.size ());
+      hasher->Init ();
+      hasher->Update (buffer.Begin ());
+      NS_TEST_EXPECT_MSG_EQ (*hasher->Finalize () == *expected, true, "Wrong Buffer::Iterator hash for length " << lengths[n]);
+    }
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxHasherXxh3
+ */
+static class TestSuiteCCNxHasherXxh3 : public TestSuite
+{
+public:
+  TestSuiteCCNxHasherXxh3 () : TestSuite ("ccnx-hasher-xxh3", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new KnownValues (), TestCase::QUICK);
+    AddTestCase (new Streaming (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxHasherXxh3;
+
+} // namespace TestSuiteCCNxHasherXxh3
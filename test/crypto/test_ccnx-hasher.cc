@@ -55,6 +55,9 @@
 
 #include "ns3/test.h"
 #include "ns3/ccnx-hasher.h"
+#include "ns3/ccnx-hasher-sha256.h"
+#include "ns3/ccnx-hasher-xxh3.h"
+#include "ns3/ccnx-hasher-fnv1a.h"
 
 #include "../TestMacros.h"
 
@@ -68,6 +71,24 @@ BeginTest (Constructor)
 }
 EndTest ()
 
+BeginTest (CreateHasher)
+{
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (DynamicCast<CCNxHasherSha256> (CCNxHasher::CreateHasher (CCNxHashingAlgorithm_SHA256))) != 0,
+                         true, "SHA256 should create CCNxHasherSha256");
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (DynamicCast<CCNxHasherFnv1a> (CCNxHasher::CreateHasher (CCNxHashingAlgorithm_FNV1a))) != 0,
+                         true, "FNV1a should create CCNxHasherFnv1a");
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (DynamicCast<CCNxHasherXxh3> (CCNxHasher::CreateHasher (CCNxHashingAlgorithm_XXH3))) != 0,
+                         true, "XXH3 should create CCNxHasherXxh3");
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (CCNxHasher::CreateHasher (CCNxHashingAlgorithm_None)) == 0,
+                         true, "None should not create a hasher");
+
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (DynamicCast<CCNxHasherSha256> (CCNxHasher::CreateHasher (CCNxCryptoSuite_RsaSha256))) != 0,
+                         true, "RsaSha256 should use SHA256");
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (CCNxHasher::CreateHasher (CCNxCryptoSuite_CRC32C)) == 0,
+                         true, "CRC32C does not use a hasher");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -79,6 +100,7 @@ public:
   TestSuiteCCNxHasher () : TestSuite ("ccnx-hasher", UNIT)
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new CreateHasher (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxHasher;
 
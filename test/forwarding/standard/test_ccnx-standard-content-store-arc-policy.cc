@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/ccnx-standard-content-store-arc-policy.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxStandardContentStoreArcPolicy {
+
+typedef CCNxStandardContentStorePolicy::EntryVectorType EntryVectorType;
+
+static Ptr<CCNxStandardContentStoreEntry>
+CreateEntry (int i)
+{
+  std::ostringstream nameString; nameString << "ccnx:/name=policy/name=" << i;
+  Ptr<CCNxName> name = Create<CCNxName> (nameString.str ());
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, Create<CCNxBuffer> (0));
+  return Create<CCNxStandardContentStoreEntry> (CCNxPacket::CreateFromMessage (content));
+}
+
+BeginTest (Constructor)
+{
+  printf ("TestCCNxStandardContentStoreArcPolicyConstructor DoRun\n");
+  Ptr<CCNxStandardContentStoreArcPolicy> dut = Create<CCNxStandardContentStoreArcPolicy> ();
+  NS_TEST_EXPECT_MSG_EQ (dut->GetName (), "Arc", "wrong name");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetTarget (), 0, "wrong target");
+}
+EndTest ()
+
+BeginTest (GhostHits)
+{
+  printf ("TestCCNxStandardContentStoreArcPolicy_GhostHits DoRun\n");
+
+  Ptr<CCNxStandardContentStoreArcPolicy> dut = Create<CCNxStandardContentStoreArcPolicy> ();
+  EntryVectorType evicted;
+
+  Ptr<CCNxStandardContentStoreEntry> a = CreateEntry (0);
+  Ptr<CCNxStandardContentStoreEntry> b = CreateEntry (1);
+  Ptr<CCNxStandardContentStoreEntry> c = CreateEntry (2);
+
+  dut->AddEntry (a, 0, 2, evicted);
+  dut->AddEntry (b, 1, 2, evicted);
+  dut->Hit (a);
+  NS_TEST_EXPECT_MSG_EQ (dut->GetRecentSize (), 1, "b should be in T1");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetFrequentSize (), 1, "a should be in T2");
+
+  // T1 is over target, so b goes to the B1 ghost list
+  dut->AddEntry (c, 2, 2, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 1, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[0], b, "b should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetRecentGhostSize (), 1, "b should be in B1");
+
+  // b comes back: a B1 hit grows the T1 target and b goes straight to T2, pushing a to B2
+  Ptr<CCNxStandardContentStoreEntry> b2 = CreateEntry (1);
+  dut->AddEntry (b2, 1, 2, evicted);
+  NS_TEST_EXPECT_MSG_EQ (dut->GetTarget (), 1, "B1 hit should grow the target");
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 2, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[1], a, "a should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetRecentGhostSize (), 0, "B1 should be empty");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetFrequentGhostSize (), 1, "a should be in B2");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetFrequentSize (), 1, "b should be in T2");
+
+  // a comes back: a B2 hit shrinks the T1 target and c goes to B1
+  Ptr<CCNxStandardContentStoreEntry> a2 = CreateEntry (0);
+  dut->AddEntry (a2, 0, 2, evicted);
+  NS_TEST_EXPECT_MSG_EQ (dut->GetTarget (), 0, "B2 hit should shrink the target");
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 3, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[2], c, "c should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetFrequentSize (), 2, "a and b should be in T2");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 2, "wrong size");
+
+  NS_TEST_EXPECT_MSG_EQ (dut->DeleteEntry (a2), true, "delete should succeed");
+  NS_TEST_EXPECT_MSG_EQ (dut->DeleteEntry (a2), false, "entry already deleted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 1, "wrong size");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxStandardContentStoreArcPolicy
+ */
+static class TestSuiteCCNxStandardContentStoreArcPolicy : public TestSuite
+{
+public:
+  TestSuiteCCNxStandardContentStoreArcPolicy () : TestSuite ("ccnx-standard-content-store-arc-policy", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new GhostHits (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxStandardContentStoreArcPolicy;
+
+} // namespace TestSuiteCCNxStandardContentStoreArcPolicy
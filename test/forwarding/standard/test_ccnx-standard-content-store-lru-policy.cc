@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/ccnx-standard-content-store-lru-policy.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxStandardContentStoreLruPolicy {
+
+typedef CCNxStandardContentStorePolicy::EntryVectorType EntryVectorType;
+
+static Ptr<CCNxStandardContentStoreEntry>
+CreateEntry (int i)
+{
+  std::ostringstream nameString; nameString << "ccnx:/name=policy/name=" << i;
+  Ptr<CCNxName> name = Create<CCNxName> (nameString.str ());
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, Create<CCNxBuffer> (0));
+  return Create<CCNxStandardContentStoreEntry> (CCNxPacket::CreateFromMessage (content));
+}
+
+BeginTest (Constructor)
+{
+  printf ("TestCCNxStandardContentStoreLruPolicyConstructor DoRun\n");
+  Ptr<CCNxStandardContentStoreLruPolicy> dut = Create<CCNxStandardContentStoreLruPolicy> ();
+  NS_TEST_EXPECT_MSG_EQ (dut->GetName (), "Lru", "wrong name");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 0, "wrong size");
+}
+EndTest ()
+
+BeginTest (EvictLeastRecent)
+{
+  printf ("TestCCNxStandardContentStoreLruPolicy_EvictLeastRecent DoRun\n");
+
+  Ptr<CCNxStandardContentStoreLruPolicy> dut = Create<CCNxStandardContentStoreLruPolicy> ();
+  std::vector<Ptr<CCNxStandardContentStoreEntry> > entries;
+  EntryVectorType evicted;
+  for (int i = 0; i < 4; i++)
+    {
+      entries.push_back (CreateEntry (i));
+    }
+
+  dut->AddEntry (entries[0], 0, 3, evicted);
+  dut->AddEntry (entries[1], 1, 3, evicted);
+  dut->AddEntry (entries[2], 2, 3, evicted);
+  dut->Hit (entries[0]);
+
+  dut->AddEntry (entries[3], 3, 3, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 1, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[0], entries[1], "should evict the least recently used");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 3, "wrong size");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetBackEntry (), entries[2], "wrong back entry");
+
+  NS_TEST_EXPECT_MSG_EQ (dut->DeleteEntry (entries[2]), true, "delete should succeed");
+  NS_TEST_EXPECT_MSG_EQ (dut->DeleteEntry (entries[1]), false, "entry was already evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 2, "wrong size");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetEvictionCount (), 1, "delete is not an eviction");
+}
+EndTest ()
+
+BeginTest (ZeroCapacity)
+{
+  printf ("TestCCNxStandardContentStoreLruPolicy_ZeroCapacity DoRun\n");
+
+  Ptr<CCNxStandardContentStoreLruPolicy> dut = Create<CCNxStandardContentStoreLruPolicy> ();
+  Ptr<CCNxStandardContentStoreEntry> entry = CreateEntry (0);
+  EntryVectorType evicted;
+  dut->AddEntry (entry, 0, 0, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 1, "entry should not be admitted");
+  NS_TEST_EXPECT_MSG_EQ (evicted[0], entry, "entry should not be admitted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 0, "wrong size");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxStandardContentStoreLruPolicy
+ */
+static class TestSuiteCCNxStandardContentStoreLruPolicy : public TestSuite
+{
+public:
+  TestSuiteCCNxStandardContentStoreLruPolicy () : TestSuite ("ccnx-standard-content-store-lru-policy", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new EvictLeastRecent (), TestCase::QUICK);
+    AddTestCase (new ZeroCapacity (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxStandardContentStoreLruPolicy;
+
+} // namespace TestSuiteCCNxStandardContentStoreLruPolicy
@@ -282,6 +282,101 @@ BeginTest (ScaleTest)
 }
 EndTest ()
 
+BeginTest (EmptyList)
+{
+  // empty list returns null entries and refuses to delete
+  printf ("TestCCNxStandardContentStoreLruList_EmptyList DoRun\n");
+
+  CreateEntries (1);
+
+  Ptr<CCNxStandardContentStoreLruList> dut = CreateLruList ();
+
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize(), 0, "wrong LRU list size !");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetBackEntry(), Ptr<CCNxStandardContentStoreEntry> (0), "back entry should be null !");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetFrontEntry(), Ptr<CCNxStandardContentStoreEntry> (0), "front entry should be null !");
+  NS_TEST_EXPECT_MSG_EQ (dut->DeleteEntry(CCNxEntryVector[0]), false, "delete from empty list should fail !");
+
+  dut->AddEntry(CCNxEntryVector[0]);
+  dut->DeleteEntry(CCNxEntryVector[0]);
+  NS_TEST_EXPECT_MSG_EQ (dut->GetBackEntry(), Ptr<CCNxStandardContentStoreEntry> (0), "back entry should be null !");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetFrontEntry(), Ptr<CCNxStandardContentStoreEntry> (0), "front entry should be null !");
+}
+EndTest ()
+
+BeginTest (RefreshBackEntry)
+{
+  // refresh the tail and the head, see that the ends move correctly
+  printf ("TestCCNxStandardContentStoreLruList_RefreshBackEntry DoRun\n");
+
+  int entryCount = 3;
+
+  CreateEntries (entryCount);
+
+  Ptr<CCNxStandardContentStoreLruList> dut = CreateLruList ();
+
+  for (int i=0; i<entryCount; i++)
+    {
+      dut->AddEntry(CCNxEntryVector[i]);
+    }
+
+  // refreshing the head is a no-op
+  dut->AddEntry(CCNxEntryVector[2]);
+  NS_TEST_EXPECT_MSG_EQ (dut->GetFrontEntry(), CCNxEntryVector[2], "front entry incorrect !");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetBackEntry(), CCNxEntryVector[0], "back entry incorrect !");
+
+  // walk every entry from the tail to the head
+  for (int i=0; i<entryCount; i++)
+    {
+      Ptr<CCNxStandardContentStoreEntry> back = dut->GetBackEntry();
+      NS_TEST_EXPECT_MSG_EQ (back, CCNxEntryVector[i], "back entry incorrect !");
+      dut->AddEntry(back);
+      NS_TEST_EXPECT_MSG_EQ (dut->GetFrontEntry(), CCNxEntryVector[i], "front entry incorrect !");
+    }
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize(), entryCount, "wrong LRU list size !");
+}
+EndTest ()
+
+BeginTest (ReferenceCount)
+{
+  // the list holds one reference per linked entry and releases it on delete and destruction
+  printf ("TestCCNxStandardContentStoreLruList_ReferenceCount DoRun\n");
+
+  int entryCount = 3;
+
+  CreateEntries (entryCount);
+
+  uint32_t baseline = CCNxEntryVector[0]->GetReferenceCount ();
+
+  {
+    Ptr<CCNxStandardContentStoreLruList> dut = CreateLruList ();
+    for (int i=0; i<entryCount; i++)
+      {
+        dut->AddEntry(CCNxEntryVector[i]);
+      }
+    dut->AddEntry(CCNxEntryVector[0]);
+
+    NS_TEST_EXPECT_MSG_EQ (CCNxEntryVector[0]->GetReferenceCount (), baseline + 1, "list should hold one reference !");
+    NS_TEST_EXPECT_MSG_EQ (CCNxEntryVector[0]->IsInLruList (), true, "entry should be linked !");
+
+    dut->DeleteEntry(CCNxEntryVector[0]);
+    NS_TEST_EXPECT_MSG_EQ (CCNxEntryVector[0]->GetReferenceCount (), baseline, "delete should release the reference !");
+    NS_TEST_EXPECT_MSG_EQ (CCNxEntryVector[0]->IsInLruList (), false, "entry should be unlinked !");
+
+    // an entry may only be in one list at a time
+    Ptr<CCNxStandardContentStoreLruList> other = CreateLruList ();
+    NS_TEST_EXPECT_MSG_EQ (other->AddEntry(CCNxEntryVector[1]), false, "entry is already in another list !");
+    NS_TEST_EXPECT_MSG_EQ (other->DeleteEntry(CCNxEntryVector[1]), false, "entry is not in this list !");
+    NS_TEST_EXPECT_MSG_EQ (other->GetSize(), 0, "wrong LRU list size !");
+  }
+
+  for (int i=0; i<entryCount; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (CCNxEntryVector[i]->GetReferenceCount (), baseline, "destructor should release references !");
+      NS_TEST_EXPECT_MSG_EQ (CCNxEntryVector[i]->IsInLruList (), false, "entry should be unlinked !");
+    }
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -298,6 +393,9 @@ public:
     AddTestCase (new DeleteEntry (), TestCase::QUICK);
     AddTestCase (new DeleteNonExistentEntry (), TestCase::QUICK);
     AddTestCase (new ScaleTest (), TestCase::QUICK);
+    AddTestCase (new EmptyList (), TestCase::QUICK);
+    AddTestCase (new RefreshBackEntry (), TestCase::QUICK);
+    AddTestCase (new ReferenceCount (), TestCase::QUICK);
 
   }
 } g_TestSuiteCCNxStandardContentStoreLruList;
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/ccnx-standard-content-store-policy.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxStandardContentStorePolicy {
+
+typedef CCNxStandardContentStorePolicy::EntryVectorType EntryVectorType;
+
+static Ptr<CCNxStandardContentStoreEntry>
+CreateEntry (int i)
+{
+  std::ostringstream nameString; nameString << "ccnx:/name=policy/name=" << i;
+  Ptr<CCNxName> name = Create<CCNxName> (nameString.str ());
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, Create<CCNxBuffer> (0));
+  return Create<CCNxStandardContentStoreEntry> (CCNxPacket::CreateFromMessage (content));
+}
+
+/*
+ * A minimal policy that exposes the protected ghost list for testing
+ */
+class TestPolicy : public CCNxStandardContentStorePolicy
+{
+public:
+  typedef CCNxStandardContentStorePolicy::GhostList Ghost;
+
+  TestPolicy () : m_size (0) {}
+  virtual std::string GetName () const { return "Test"; }
+  virtual uint64_t GetSize () const { return m_size; }
+
+protected:
+  virtual void DoAddEntry (Ptr<CCNxStandardContentStoreEntry> entry, uint64_t capacity, EntryVectorType &evicted)
+  {
+    m_size++;
+    if (m_size > capacity)
+      {
+        m_size--;
+        evicted.push_back (entry);
+      }
+  }
+  virtual void DoHit (Ptr<CCNxStandardContentStoreEntry> entry) {}
+  virtual bool DoDeleteEntry (Ptr<CCNxStandardContentStoreEntry> entry) { m_size--; return true; }
+
+private:
+  uint64_t m_size;
+};
+
+BeginTest (Constructor)
+{
+  printf ("TestCCNxStandardContentStorePolicyConstructor DoRun\n");
+  LogComponentEnable ("CCNxStandardContentStorePolicy", LOG_LEVEL_DEBUG);
+
+  Ptr<TestPolicy> dut = Create<TestPolicy> ();
+  NS_TEST_EXPECT_MSG_EQ (dut->GetHitCount (), 0, "wrong hit count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetMissCount (), 0, "wrong miss count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetHitRatio (), 0.0, "wrong hit ratio");
+}
+EndTest ()
+
+BeginTest (Counters)
+{
+  printf ("TestCCNxStandardContentStorePolicy_Counters DoRun\n");
+
+  Ptr<TestPolicy> dut = Create<TestPolicy> ();
+  Ptr<CCNxStandardContentStoreEntry> a = CreateEntry (1);
+  Ptr<CCNxStandardContentStoreEntry> b = CreateEntry (2);
+
+  EntryVectorType evicted;
+  dut->AddEntry (a, 1, 1, evicted);
+  dut->AddEntry (b, 2, 1, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 1, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetInsertCount (), 2, "wrong insert count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetEvictionCount (), 1, "wrong eviction count");
+
+  dut->Hit (a);
+  dut->Hit (a);
+  dut->Hit (a);
+  dut->Miss (2);
+  NS_TEST_EXPECT_MSG_EQ (dut->GetHitCount (), 3, "wrong hit count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetMissCount (), 1, "wrong miss count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetHitRatio (), 0.75, "wrong hit ratio");
+
+  dut->ResetCounters ();
+  NS_TEST_EXPECT_MSG_EQ (dut->GetHitCount (), 0, "wrong hit count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetEvictionCount (), 0, "wrong eviction count");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 1, "reset should not touch the entries");
+}
+EndTest ()
+
+BeginTest (GhostList)
+{
+  printf ("TestCCNxStandardContentStorePolicy_GhostList DoRun\n");
+
+  TestPolicy::Ghost ghost;
+  for (uint64_t key = 0; key < 5; key++)
+    {
+      ghost.Insert (key, 3);
+    }
+  NS_TEST_EXPECT_MSG_EQ (ghost.GetSize (), 3, "ghost list should be bounded");
+  NS_TEST_EXPECT_MSG_EQ (ghost.Contains (1), false, "oldest keys should be dropped");
+  NS_TEST_EXPECT_MSG_EQ (ghost.Contains (4), true, "newest key should be present");
+
+  NS_TEST_EXPECT_MSG_EQ (ghost.Erase (3), true, "should erase key 3");
+  NS_TEST_EXPECT_MSG_EQ (ghost.Erase (3), false, "key 3 already erased");
+  NS_TEST_EXPECT_MSG_EQ (ghost.PopBack (), true, "should drop key 2");
+  NS_TEST_EXPECT_MSG_EQ (ghost.Contains (2), false, "key 2 should be gone");
+  ghost.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (ghost.PopBack (), false, "empty ghost list");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxStandardContentStorePolicy
+ */
+static class TestSuiteCCNxStandardContentStorePolicy : public TestSuite
+{
+public:
+  TestSuiteCCNxStandardContentStorePolicy () : TestSuite ("ccnx-standard-content-store-policy", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new Counters (), TestCase::QUICK);
+    AddTestCase (new GhostList (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxStandardContentStorePolicy;
+
+} // namespace TestSuiteCCNxStandardContentStorePolicy
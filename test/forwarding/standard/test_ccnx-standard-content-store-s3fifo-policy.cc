@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/ccnx-standard-content-store-s3fifo-policy.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxStandardContentStoreS3FifoPolicy {
+
+typedef CCNxStandardContentStorePolicy::EntryVectorType EntryVectorType;
+
+static Ptr<CCNxStandardContentStoreEntry>
+CreateEntry (int i)
+{
+  std::ostringstream nameString; nameString << "ccnx:/name=policy/name=" << i;
+  Ptr<CCNxName> name = Create<CCNxName> (nameString.str ());
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, Create<CCNxBuffer> (0));
+  return Create<CCNxStandardContentStoreEntry> (CCNxPacket::CreateFromMessage (content));
+}
+
+BeginTest (Constructor)
+{
+  printf ("TestCCNxStandardContentStoreS3FifoPolicyConstructor DoRun\n");
+  Ptr<CCNxStandardContentStoreS3FifoPolicy> dut = Create<CCNxStandardContentStoreS3FifoPolicy> ();
+  NS_TEST_EXPECT_MSG_EQ (dut->GetName (), "S3Fifo", "wrong name");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 0, "wrong size");
+}
+EndTest ()
+
+BeginTest (QuickDemotion)
+{
+  printf ("TestCCNxStandardContentStoreS3FifoPolicy_QuickDemotion DoRun\n");
+
+  Ptr<CCNxStandardContentStoreS3FifoPolicy> dut = Create<CCNxStandardContentStoreS3FifoPolicy> ();
+  std::vector<Ptr<CCNxStandardContentStoreEntry> > entries;
+  EntryVectorType evicted;
+  for (int i = 0; i < 11; i++)
+    {
+      entries.push_back (CreateEntry (i));
+    }
+
+  for (int i = 0; i < 10; i++)
+    {
+      dut->AddEntry (entries[i], i, 10, evicted);
+    }
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSmallSize (), 10, "new entries go to the small FIFO");
+  dut->Hit (entries[0]);
+
+  // entry 0 was hit so it moves to main, entry 1 was not so it is evicted to the ghost
+  dut->AddEntry (entries[10], 10, 10, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 1, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[0], entries[1], "entry 1 should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetMainSize (), 1, "entry 0 should be in main");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSmallSize (), 9, "wrong small size");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetGhostSize (), 1, "entry 1 should be in the ghost FIFO");
+
+  // entry 1 comes back and goes straight to main
+  Ptr<CCNxStandardContentStoreEntry> again = CreateEntry (1);
+  dut->AddEntry (again, 1, 10, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 2, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[1], entries[2], "entry 2 should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetMainSize (), 2, "entry 1 should be in main");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSmallSize (), 8, "wrong small size");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 10, "wrong size");
+
+  NS_TEST_EXPECT_MSG_EQ (dut->DeleteEntry (again), true, "delete should succeed");
+  NS_TEST_EXPECT_MSG_EQ (dut->DeleteEntry (entries[1]), false, "entry already evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetMainSize (), 1, "wrong main size");
+}
+EndTest ()
+
+BeginTest (SecondChance)
+{
+  printf ("TestCCNxStandardContentStoreS3FifoPolicy_SecondChance DoRun\n");
+
+  // With capacity 2 the small FIFO target is 0, so once main has entries it is main that evicts
+  Ptr<CCNxStandardContentStoreS3FifoPolicy> dut = Create<CCNxStandardContentStoreS3FifoPolicy> ();
+  std::vector<Ptr<CCNxStandardContentStoreEntry> > entries;
+  EntryVectorType evicted;
+  for (int i = 0; i < 4; i++)
+    {
+      entries.push_back (CreateEntry (i));
+    }
+
+  dut->AddEntry (entries[0], 0, 2, evicted);
+  dut->AddEntry (entries[1], 1, 2, evicted);
+  dut->Hit (entries[0]);
+  dut->Hit (entries[1]);
+
+  // both move to main with their counters cleared, then main evicts its oldest, entry 0
+  dut->AddEntry (entries[2], 2, 2, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 1, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[0], entries[0], "entry 0 should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetMainSize (), 1, "wrong main size");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSmallSize (), 1, "wrong small size");
+
+  // entry 2 moves to main; entry 1 is older but was hit in main, so it gets a second chance
+  dut->Hit (entries[1]);
+  dut->Hit (entries[2]);
+  dut->AddEntry (entries[3], 3, 2, evicted);
+  NS_TEST_EXPECT_MSG_EQ (evicted.size (), 2, "wrong evicted count");
+  NS_TEST_EXPECT_MSG_EQ (evicted[1], entries[2], "entry 2 should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetMainSize (), 1, "wrong main size");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSmallSize (), 1, "wrong small size");
+  NS_TEST_EXPECT_MSG_EQ (dut->GetSize (), 2, "wrong size");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxStandardContentStoreS3FifoPolicy
+ */
+static class TestSuiteCCNxStandardContentStoreS3FifoPolicy : public TestSuite
+{
+public:
+  TestSuiteCCNxStandardContentStoreS3FifoPolicy () : TestSuite ("ccnx-standard-content-store-s3fifo-policy", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new QuickDemotion (), TestCase::QUICK);
+    AddTestCase (new SecondChance (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxStandardContentStoreS3FifoPolicy;
+
+} // namespace TestSuiteCCNxStandardContentStoreS3FifoPolicy
@@ -60,6 +60,7 @@
 #include "../../mockups/mockup_ccnx-virtual-connection.h"
 #include "../../mockups/ccnx-standard-content-store-with-test-methods.h"
 #include "ns3/integer.h"
+#include "ns3/enum.h"
 #include "../../TestMacros.h"
 #include "ns3/ccnx-cachetime.h"
 #include "ns3/nstime.h"
@@ -467,6 +468,28 @@ BeginTest (AddContentObject)
 }
 EndTest ()
 
+BeginTest (AddContentObjectNoNameNoHash)
+{
+  printf ("TestCCNxStandardContentStore_AddContentObjectNoNameNoHash DoRun\n");
+  //AddContentObject that no map can hold, verify it is not in the Lrulist either
+  TestData data = CreateTestData ();
+
+  Ptr<CCNxStandardContentStoreWithTestMethods> a = CreateContentStore ();
+
+  Ptr<CCNxPacket> cPacket = CCNxPacket::CreateFromMessage (Create<CCNxContentObject> (Create<CCNxName> ("ccnx:/")));
+  cPacket->SetContentObjectHash (Create<CCNxHashValue> (0));
+  Ptr<CCNxStandardForwarderWorkItem> workItem = CreateWorkItem (cPacket, data.ingress0);
+
+  a->AddContentObject(workItem,data.eConnList1);  StepSimulatorAddContentObject();
+
+  NS_TEST_EXPECT_MSG_EQ(workItem->GetContentAddedFlag(),false,"content object should not be added");
+  NS_TEST_EXPECT_MSG_EQ(a->GetObjectCount(),0,"Lru list length wrong");
+  NS_TEST_EXPECT_MSG_EQ(a->GetMapByHashCount(),0,"map by hash size wrong");
+  NS_TEST_EXPECT_MSG_EQ(a->GetMapByNameCount(),0,"map by name size wrong");
+
+}
+EndTest ()
+
 BeginTest (AddContentObject2x)
 {
   printf ("TestCCNxStandardContentStore_AddContentObject DoRun\n");
@@ -721,6 +744,62 @@ EndTest ()
 
 
 
+BeginTest (ReplacementPolicy)
+{
+  printf ("TestCCNxStandardContentStore_ReplacementPolicy DoRun\n");
+  // select a policy by attribute, see that lookups are counted by it
+
+  TestData data = CreateTestData ();
+  Ptr<CCNxStandardContentStoreWithTestMethods> a = CreateContentStore ();
+  NS_TEST_EXPECT_MSG_EQ(a->GetReplacementPolicy()->GetName(), "Lru", "default policy should be LRU");
+
+  a->SetAttribute("ReplacementPolicy", EnumValue (CCNxStandardContentStore::ReplacementPolicy_S3Fifo));
+  NS_TEST_EXPECT_MSG_EQ(a->GetReplacementPolicyType(), CCNxStandardContentStore::ReplacementPolicy_S3Fifo, "wrong policy type");
+  NS_TEST_EXPECT_MSG_EQ(a->GetReplacementPolicy()->GetName(), "S3Fifo", "wrong policy");
+
+  a->MatchInterest(data.iWorkItem1); StepSimulatorMatchInterest ();
+  a->AddContentObject(data.cWorkItem1,data.eConnList1); StepSimulatorAddContentObject();
+  a->MatchInterest(data.iWorkItem1); StepSimulatorMatchInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupMatchInterestCallbackPacket, data.cPacket1, "wrong Packet returned !");
+
+  Ptr<const CCNxStandardContentStorePolicy> policy = a->GetReplacementPolicy();
+  NS_TEST_EXPECT_MSG_EQ(policy->GetHitCount(), 1, "wrong hit count");
+  NS_TEST_EXPECT_MSG_EQ(policy->GetMissCount(), 1, "wrong miss count");
+  NS_TEST_EXPECT_MSG_EQ(policy->GetHitRatio(), 0.5, "wrong hit ratio");
+  NS_TEST_EXPECT_MSG_EQ(a->GetObjectCount(), 1, "wrong number of objects in content store!");
+}
+EndTest ()
+
+BeginTest (ReplacementPolicyEviction)
+{
+  printf ("TestCCNxStandardContentStore_ReplacementPolicyEviction DoRun\n");
+  // every policy must keep the maps in step with what it evicts
+
+  const CCNxStandardContentStore::ReplacementPolicyType types[] = {
+    CCNxStandardContentStore::ReplacementPolicy_Lru, CCNxStandardContentStore::ReplacementPolicy_Lfu,
+    CCNxStandardContentStore::ReplacementPolicy_Arc, CCNxStandardContentStore::ReplacementPolicy_S3Fifo,
+    CCNxStandardContentStore::ReplacementPolicy_WTinyLfu
+  };
+
+  for (size_t i = 0; i < sizeof (types) / sizeof (types[0]); i++)
+    {
+      TestData data = CreateTestData ();
+      Ptr<CCNxStandardContentStoreWithTestMethods> a = CreateContentStore ();
+      a->SetAttribute("ReplacementPolicy", EnumValue (types[i]));
+      a->SetAttribute("ObjectCapacity",IntegerValue (2));
+
+      a->AddContentObject(data.cWorkItem1,data.eConnList1); StepSimulatorAddContentObject();
+      a->AddContentObject(data.cWorkItem2,data.eConnList1); StepSimulatorAddContentObject();
+      a->AddContentObject(data.cWorkItem3,data.eConnList1); StepSimulatorAddContentObject();
+
+      NS_TEST_EXPECT_MSG_EQ(a->GetObjectCount(), 2, "wrong object count for " << a->GetReplacementPolicy()->GetName());
+      NS_TEST_EXPECT_MSG_EQ(a->GetMapByHashCount(), 2, "map by hash size wrong for " << a->GetReplacementPolicy()->GetName());
+      NS_TEST_EXPECT_MSG_EQ(a->GetMapByNameCount(), 2, "map by name size wrong for " << a->GetReplacementPolicy()->GetName());
+      NS_TEST_EXPECT_MSG_EQ(a->GetReplacementPolicy()->GetEvictionCount(), 1, "wrong eviction count");
+    }
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -740,7 +819,10 @@ public:
     AddTestCase (new MatchInterestKeyid (), TestCase::QUICK);
 
     AddTestCase (new AddContentObject (), TestCase::QUICK);
+    AddTestCase (new AddContentObjectNoNameNoHash (), TestCase::QUICK);
     AddTestCase (new AddContentObject_ObjectCapacity (), TestCase::QUICK);
+    AddTestCase (new ReplacementPolicy (), TestCase::QUICK);
+    AddTestCase (new ReplacementPolicyEviction (), TestCase::QUICK);
     AddTestCase (new MatchInterestTwoObjects (), TestCase::QUICK);
     AddTestCase (new AddContentObject2x (), TestCase::QUICK);
     AddTestCase (new FindEntryInHashMap (), TestCase::QUICK);
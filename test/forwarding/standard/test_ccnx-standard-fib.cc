@@ -60,6 +60,7 @@
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/ccnx-forwarder-message.h"
+#include "ns3/integer.h"
 
 #include "../../TestMacros.h"
 
@@ -235,6 +236,85 @@ BeginTest (LookupBestMatch)
 }
 EndTest ()
 
+BeginTest (LookupSkipsMissingPrefix)
+{
+  /* routes for /a and /a/b/c but not /a/b.  A lookup of /a/b/c/d must return /a/b/c.
+   * Then delete /a/b/c and the same lookup must fall back to /a.
+   */
+  printf ("TestCCNxStandardLookupSkipsMissingPrefix DoRun\n");
+
+  Ptr<CCNxStandardFib> fib = CreateFib ();
+
+  Ptr<CCNxVirtualConnection> nextHop0 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> nextHop1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> ingress = Create<CCNxVirtualConnection> ();
+
+  Ptr<const CCNxName>  name0 = Create<CCNxName> ("ccnx:/name=a");
+  Ptr<const CCNxName>  name1 = Create<CCNxName> ("ccnx:/name=a/name=b/name=c");
+  Ptr<const CCNxName>  name2 = Create<CCNxName> ("ccnx:/name=a/name=b/name=c/name=d");
+
+  fib->AddRoute (name0, nextHop0);
+  fib->AddRoute (name1, nextHop1);
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name2), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->front (), nextHop1, "lookup did not return longest match !");
+
+  fib->DeleteRoute (name1, nextHop1);
+  NS_TEST_EXPECT_MSG_EQ (fib->CountEntries (), 1, "wrong number of fib entries !");
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name2), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->front (), nextHop0, "lookup did not fall back to shorter prefix !");
+
+  fib->DeleteRoute (name0, nextHop0);
+  NS_TEST_EXPECT_MSG_EQ (fib->CountEntries (), 0, "wrong number of fib entries !");
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name2), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 0, "lookup did not return empty list!");
+
+  printf ("TestCCNxStandardLookupSkipsMissingPrefix End\n");
+}
+EndTest ()
+
+BeginTest (LookupIgnoresRootRoute)
+{
+  /* a route on the root prefix is not a default route.  A lookup of /a/b must
+   * not match it, but must still match a route for /a.
+   */
+  printf ("TestCCNxStandardLookupIgnoresRootRoute DoRun\n");
+
+  Ptr<CCNxStandardFib> fib = CreateFib ();
+
+  Ptr<CCNxVirtualConnection> nextHop0 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> nextHop1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> ingress = Create<CCNxVirtualConnection> ();
+
+  Ptr<const CCNxName>  root = Create<CCNxName> ("ccnx:/");
+  Ptr<const CCNxName>  name0 = Create<CCNxName> ("ccnx:/name=a");
+  Ptr<const CCNxName>  name1 = Create<CCNxName> ("ccnx:/name=a/name=b");
+
+  fib->AddRoute (root, nextHop0);
+  NS_TEST_EXPECT_MSG_EQ (fib->CountEntries (), 1, "wrong number of fib entries !");
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name1), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 0, "root route should not match !");
+
+  fib->AddRoute (name0, nextHop1);
+  fib->Lookup (CreateWorkItem (PacketFromName (name1), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 1, "wrong number of connections !");
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->front (), nextHop1, "lookup did not return /a !");
+
+  fib->DeleteRoute (root, nextHop0);
+  NS_TEST_EXPECT_MSG_EQ (fib->CountEntries (), 1, "wrong number of fib entries !");
+
+  printf ("TestCCNxStandardLookupIgnoresRootRoute End\n");
+}
+EndTest ()
+
 BeginTest (DeleteRoute)
 {
   /* add 2 routes. delete one. lookup existing and nonexisting routes.
@@ -493,6 +573,50 @@ EndTest ()
  *
  * \brief Test Suite for CCNxStandardFib
  */
+static std::vector<Time> _batchCallbackTimes;
+
+static void
+BatchLookupCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egress)
+{
+  _batchCallbackTimes.push_back (Simulator::Now ());
+}
+
+/*
+ * With "LayerDelayBatchSize", lookups that arrive together are serviced as one batch:
+ * they finish at the same time and pay the layer delay constant once.
+ */
+BeginTest (BatchLookup)
+{
+  Time constant = MicroSeconds (1);
+  Ptr<CCNxStandardFib> fib = CreateObject<CCNxStandardFib> ();
+  fib->SetAttribute ("LayerDelayConstant", TimeValue (constant));
+  fib->SetAttribute ("LayerDelayBatchSize", IntegerValue (4));
+  fib->SetLookupCallback (MakeCallback (&BatchLookupCallback));
+  fib->Initialize ();
+
+  Ptr<CCNxConnection> connection = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> ingress = Create<CCNxVirtualConnection> ();
+  fib->AddRoute (Create<CCNxName> ("ccnx:/name=batch"), connection);
+
+  _batchCallbackTimes.clear ();
+  Time start = Simulator::Now ();
+  fib->Lookup (CreateWorkItem (PacketFromName (Create<CCNxName> ("ccnx:/name=batch/name=a")), ingress));
+  fib->Lookup (CreateWorkItem (PacketFromName (Create<CCNxName> ("ccnx:/name=batch/name=b")), ingress));
+  fib->Lookup (CreateWorkItem (PacketFromName (Create<CCNxName> ("ccnx:/name=batch/name=c")), ingress));
+
+  Simulator::Stop (_layerDelay);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (_batchCallbackTimes.size (), 3, "Wrong number of lookup callbacks");
+  if (_batchCallbackTimes.size () == 3)
+    {
+      NS_TEST_EXPECT_MSG_EQ (_batchCallbackTimes[0], _batchCallbackTimes[2], "Batch did not finish together");
+      NS_TEST_EXPECT_MSG_GT (_batchCallbackTimes[0] - start, constant, "Batch should pay the constant and slope");
+      NS_TEST_EXPECT_MSG_LT (_batchCallbackTimes[0] - start, constant * 2, "Batch paid the constant more than once");
+    }
+}
+EndTest ()
+
 static class TestSuiteCCNxStandardFib : public TestSuite
 {
 public:
@@ -506,6 +630,9 @@ public:
     AddTestCase (new DeleteNonExistentRoute (), TestCase::QUICK );
     AddTestCase (new DeleteAllRoutes (), TestCase::QUICK );
     AddTestCase (new LookupBestMatch (), TestCase::QUICK );
+    AddTestCase (new LookupSkipsMissingPrefix (), TestCase::QUICK );
+    AddTestCase (new LookupIgnoresRootRoute (), TestCase::QUICK );
+    AddTestCase (new BatchLookup (), TestCase::QUICK );
   }
 } g_TestSuiteCCNxStandardFib;
 
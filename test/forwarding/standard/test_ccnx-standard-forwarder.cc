@@ -62,8 +62,11 @@
 #include "ns3/node-container.h"
 #include "ns3/assert.h"
 #include "ns3/integer.h"
+#include "ns3/boolean.h"
 #include "ns3/object-factory.h"
 #include "ns3/ccnx-standard-content-store-factory.h"
+#include "ns3/ccnx-standard-pit-factory.h"
+#include "ns3/ccnx-standard-fib-factory.h"
 #include "ns3/ccnx-standard-forwarder-helper.h"
 #include "ns3/ccnx-stack-helper.h"
 #include "ns3/trace-helper.h"
@@ -509,6 +512,53 @@ BeginTest (RouteOutputOneInterestOneContent)
 }
 EndTest ()
 
+/*
+ * RouteOutputBatch() enqueues all the packets at once and each gets its own RouteCallback, in order
+ */
+BeginTest (RouteOutputBatchInOrder)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  TestData data = CreateTestData ();
+  SetupRoutes (forwarder, data);
+  forwarder->SetRouteCallback (MakeCallback (&RouteOutputBatchInOrder::RouteCallback, this));
+
+  CCNxForwarder::PacketBatchType packets;
+  packets.push_back (data.iPacket1);
+  packets.push_back (data.iPacket2);
+  packets.push_back (data.iPacket3);
+  forwarder->RouteOutputBatch (packets, data.ingress1, Ptr<CCNxConnection> (0));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_packets.size (), 3, "wrong number of route callbacks");
+  NS_TEST_EXPECT_MSG_EQ (m_nextHops.size (), 3, "wrong number of next hops");
+  if (m_packets.size () == 3 && m_nextHops.size () == 3)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_packets[0], data.iPacket1, "wrong first packet");
+      NS_TEST_EXPECT_MSG_EQ (m_packets[1], data.iPacket2, "wrong second packet");
+      NS_TEST_EXPECT_MSG_EQ (m_packets[2], data.iPacket3, "wrong third packet");
+      NS_TEST_EXPECT_MSG_EQ (m_nextHops[0], data.nextHop1->GetConnectionId (), "wrong first next hop");
+      NS_TEST_EXPECT_MSG_EQ (m_nextHops[1], data.nextHop2->GetConnectionId (), "wrong second next hop");
+      NS_TEST_EXPECT_MSG_EQ (m_nextHops[2], data.nextHop3->GetConnectionId (), "wrong third next hop");
+    }
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 3, "wrong number of pit entries");
+}
+
+std::vector< Ptr<CCNxPacket> > m_packets;
+std::vector<uint32_t> m_nextHops;
+
+void RouteCallback (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> ingress, enum CCNxRoutingError::RoutingErrno routingErrno,
+                    Ptr<CCNxConnectionList> connectionList)
+{
+  m_packets.push_back (packet);
+  if (!connectionList->empty ())
+    {
+      m_nextHops.push_back (connectionList->front ()->GetConnectionId ());
+    }
+}
+EndTest ()
+
 BeginTest (RouteExactName)
 {
   Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
@@ -703,10 +753,159 @@ BeginTest (PrintForwardingTable)
     }
   NS_TEST_EXPECT_MSG_EQ (match,true, "could not find test line in PrintForwardingStatistics output!");
 
+  // The process-wide pool counters are not part of each forwarder's statistics
+  fr =fopen(TEMPFILE2,"rt");
+  match = false;
+  while(fgets(line,150,fr) != NULL)
+    {
+      if (strstr(line, "Pools") != NULL)
+	{
+	  match = true;
+	  break;
+	}
+    }
+  NS_TEST_EXPECT_MSG_EQ (match,false, "PrintForwardingStatistics should not print the pool counters!");
+
+#define TEMPFILE3 "PrintPoolStatistics.txt"
+  Ptr<OutputStreamWrapper> trace3 = asciiTraceHelper.CreateFileStream (TEMPFILE3);
+  CCNxStandardForwarder::PrintPoolStatistics(trace3);
+  char cmpline3[100] = "4e-06s   all StandardForwarder      Pools process-wide WorkItems ";
+  fr =fopen(TEMPFILE3,"rt");
+  match = false;
+  while(fgets(line,150,fr) != NULL)
+    {
+      if (strncmp(line, cmpline3, strlen(cmpline3) ) == 0)
+	{
+	  match = true;
+	  break;
+	}
+    }
+  NS_TEST_EXPECT_MSG_EQ (match,true, "could not find test line in PrintPoolStatistics output!");
+
   Simulator::Destroy ();
 }
 EndTest ()
 
+/*
+ * Creates a forwarder where the forwarder, PIT, content store, and FIB all have a
+ * layer delay of `delay`.  With a zero delay and `inlineZeroDelay`, the whole pipeline runs inline.
+ */
+static Ptr<CCNxStandardForwarder>
+CreatePipelineForwarder (Time delay, bool inlineZeroDelay)
+{
+  CCNxStandardPitFactory pitFactory;
+  pitFactory.SetLayerDelayConstant (delay);
+  pitFactory.SetLayerDelaySlope (Seconds (0));
+  pitFactory.SetInlineZeroDelay (inlineZeroDelay);
+
+  CCNxStandardFibFactory fibFactory;
+  fibFactory.SetLayerDelayConstant (delay);
+  fibFactory.SetLayerDelaySlope (Seconds (0));
+  fibFactory.SetInlineZeroDelay (inlineZeroDelay);
+
+  CCNxStandardContentStoreFactory contentStoreFactory;
+  contentStoreFactory.SetLayerDelayConstant (delay);
+  contentStoreFactory.SetLayerDelaySlope (Seconds (0));
+  contentStoreFactory.SetInlineZeroDelay (inlineZeroDelay);
+
+  Ptr<CCNxStandardForwarder> forwarder = CreateObject<CCNxStandardForwarder> ();
+  forwarder->SetAttribute ("PitFactory", ObjectFactoryValue (pitFactory));
+  forwarder->SetAttribute ("FibFactory", ObjectFactoryValue (fibFactory));
+  forwarder->SetAttribute ("ContentStoreFactory", ObjectFactoryValue (contentStoreFactory));
+  forwarder->SetAttribute ("LayerDelayConstant", TimeValue (delay));
+  forwarder->SetAttribute ("LayerDelaySlope", TimeValue (Seconds (0)));
+  forwarder->SetAttribute ("InlineZeroDelay", BooleanValue (inlineZeroDelay));
+  forwarder->SetRouteCallback (MakeCallback (&MockupRouteCallback));
+  forwarder->Initialize ();
+  return forwarder;
+}
+
+/*
+ * Routes a fixed sequence of packets and describes each forwarding decision as a string
+ * (error, packet, and the sorted egress connection ids).  If `mustBeInline` is true, each
+ * forwarded packet must reach the route callback before RouteInput() returns.
+ */
+static std::vector<std::string>
+RunPipelineScenario (Ptr<CCNxStandardForwarder> forwarder, TestData &data, bool mustBeInline)
+{
+  SetupRoutes (forwarder, data);
+
+  struct
+  {
+    Ptr<CCNxPacket> packet;
+    Ptr<CCNxConnection> ingress;
+  } steps[] = {
+    { data.iPacket1, data.ingress1 },   // forwarded to nextHop1
+    { data.iPacket1, data.ingress2 },   // aggregated
+    { data.cPacket1, data.nextHop1 },   // satisfies both, added to content store
+    { data.iPacket1, data.ingress2 },   // content store hit
+    { data.iPacket3, data.ingress1 },   // forwarded to nextHop3
+    { data.cPacket2, data.nextHop2 },   // no PIT entry
+    { data.cPacket3, data.nextHop3 },   // satisfies ingress1
+  };
+
+  std::vector<std::string> decisions;
+  for (unsigned i = 0; i < sizeof (steps) / sizeof (steps[0]); i++)
+    {
+      _routeCallbackFired = false;
+      forwarder->RouteInput (steps[i].packet, steps[i].ingress);
+      if (mustBeInline)
+        {
+          NS_ASSERT_MSG (_routeCallbackFired || steps[i].packet == data.cPacket2, "Fused pipeline did not route inline");
+        }
+      Simulator::Stop (MilliSeconds (1));
+      Simulator::Run ();
+
+      std::ostringstream decision;
+      if (_routeCallbackFired)
+        {
+          std::set<CCNxConnection::ConnIdType> ids;
+          for (CCNxConnectionList::iterator c = _routeCallbackConnections->begin (); c != _routeCallbackConnections->end (); ++c)
+            {
+              ids.insert ((*c)->GetConnectionId ());
+            }
+          decision << _routeCallbackErrno << " " << PeekPointer (_routeCallbackPacket);
+          for (std::set<CCNxConnection::ConnIdType>::const_iterator id = ids.begin (); id != ids.end (); ++id)
+            {
+              decision << " " << *id;
+            }
+        }
+      else
+        {
+          decision << "none";
+        }
+      decisions.push_back (decision.str ());
+    }
+
+  Simulator::Destroy ();
+  return decisions;
+}
+
+BeginTest (FusedPipeline)
+{
+  printf ("TestCCNxStandardForwarderFusedPipeline DoRun\n");
+  TestData data = CreateTestData ();
+
+  std::vector<std::string> staged = RunPipelineScenario (CreatePipelineForwarder (MicroSeconds (1), false), data, false);
+  std::vector<std::string> zeroDelay = RunPipelineScenario (CreatePipelineForwarder (Seconds (0), false), data, false);
+  std::vector<std::string> fused = RunPipelineScenario (CreatePipelineForwarder (Seconds (0), true), data, true);
+
+  NS_TEST_EXPECT_MSG_EQ (staged.size (), zeroDelay.size (), "wrong number of decisions");
+  for (unsigned i = 0; i < staged.size () && i < zeroDelay.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (zeroDelay[i], staged[i], "zero delay and staged pipelines differ at step " << i);
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (staged.size (), fused.size (), "wrong number of decisions");
+  for (unsigned i = 0; i < staged.size () && i < fused.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (fused[i], staged[i], "fused and staged pipelines differ at step " << i);
+    }
+  NS_TEST_EXPECT_MSG_NE (staged[0], "none", "first interest should be forwarded");
+  NS_TEST_EXPECT_MSG_EQ (staged[5], "none", "content without a PIT entry should be dropped");
+}
+EndTest ()
+
 //#TODO CCN test forwarder stats
 //#TODO CCN test no content store option set by attribute
 //#TODO CCN fix delay model for content store
@@ -732,10 +931,12 @@ public:
     AddTestCase (new InterestToTwo (), TestCase::QUICK);
     AddTestCase (new DuplicateRoutes (), TestCase::QUICK);
     AddTestCase (new RouteOutputOneInterestOneContent (), TestCase::QUICK);
+    AddTestCase (new RouteOutputBatchInOrder (), TestCase::QUICK);
     AddTestCase (new RouteExactName (), TestCase::QUICK);
     AddTestCase (new ContentStore (), TestCase::QUICK);
     AddTestCase (new NoContentStore (), TestCase::QUICK);
     AddTestCase (new PrintForwardingTable (), TestCase::QUICK);
+    AddTestCase (new FusedPipeline (), TestCase::QUICK);
 
   }
 } g_TestSuiteCCNxStandardForwarder;
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <map>
+#include "ns3/test.h"
+#include "ns3/ccnx-open-hash-table.h"
+#include "../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxOpenHashTable {
+
+struct isEqualInt
+{
+  bool operator() (int a, int b) const
+  {
+    return a == b;
+  }
+};
+
+typedef CCNxOpenHashTable<int, int, isEqualInt> TableType;
+
+BeginTest (InsertFind)
+{
+  TableType table (8);
+  NS_TEST_EXPECT_MSG_EQ (table.Insert (1, 10, 100), true, "First insert should use a new slot");
+  NS_TEST_EXPECT_MSG_EQ (table.Insert (1, 10, 101), false, "Second insert should replace");
+  NS_TEST_EXPECT_MSG_EQ (table.Find (1, 10), 101, "Wrong value");
+  NS_TEST_EXPECT_MSG_EQ (table.Find (1, 11), 0, "Missing key should return default value");
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 1, "Wrong size");
+}
+EndTest ()
+
+BeginTest (Collisions)
+{
+  // every key has the same hash, so they all share one probe sequence
+  TableType table (8);
+  for (int i = 1; i <= 5; ++i)
+    {
+      table.Insert (7, i, i * 10);
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (table.Erase (7, 2), true, "Erase should find key");
+  NS_TEST_EXPECT_MSG_EQ (table.Erase (7, 2), false, "Second erase should not find key");
+
+  for (int i = 1; i <= 5; ++i)
+    {
+      int expected = (i == 2) ? 0 : i * 10;
+      NS_TEST_EXPECT_MSG_EQ (table.Find (7, i), expected, "Wrong value after erase in cluster");
+    }
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 4, "Wrong size");
+}
+EndTest ()
+
+BeginTest (GrowAndCompare)
+{
+  // Random insert/erase/find against std::map, with a weak hash to force clustering
+  TableType table (8);
+  std::map<int, int> reference;
+
+  uint32_t seed = 1;
+  for (int op = 0; op < 50000; ++op)
+    {
+      seed = seed * 1103515245 + 12345;
+      int key = (seed >> 8) % 2000;
+      uint64_t hash = (key % 61) * 2654435761ULL;
+      switch ((seed >> 4) % 3)
+        {
+        case 0:
+          table.Insert (hash, key, op + 1);
+          reference[key] = op + 1;
+          break;
+        case 1:
+          NS_TEST_ASSERT_MSG_EQ (table.Erase (hash, key), reference.erase (key) == 1, "Erase mismatch");
+          break;
+        default:
+          {
+            int expected = reference.count (key) ? reference[key] : 0;
+            NS_TEST_ASSERT_MSG_EQ (table.Find (hash, key), expected, "Find mismatch");
+          }
+        }
+      NS_TEST_ASSERT_MSG_EQ (table.size (), reference.size (), "Size mismatch");
+    }
+
+  NS_TEST_EXPECT_MSG_EQ ((table.capacity () * 3 >= table.size () * 4), true, "Load factor exceeded");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxOpenHashTable
+ */
+static class TestSuiteCCNxOpenHashTable : public TestSuite
+{
+public:
+  TestSuiteCCNxOpenHashTable () : TestSuite ("ccnx-open-hash-table", UNIT)
+  {
+    AddTestCase (new InsertFind (), TestCase::QUICK);
+    AddTestCase (new Collisions (), TestCase::QUICK);
+    AddTestCase (new GrowAndCompare (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxOpenHashTable;
+
+} // namespace TestSuiteCCNxOpenHashTable
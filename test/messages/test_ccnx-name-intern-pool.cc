@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/ccnx-name.h"
+#include "ns3/ccnx-name-intern-pool.h"
+
+#include "../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxNameInternPool {
+
+BeginTest (Intern)
+{
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/name=intern/name=apple");
+  Ptr<const CCNxName> b = Create<CCNxName> ("ccnx:/name=intern/name=apple");
+  Ptr<const CCNxName> x = Create<CCNxName> ("ccnx:/name=intern/name=pear");
+
+  Ptr<const CCNxName> ia = CCNxNameInternPool::Intern (a);
+  Ptr<const CCNxName> ib = CCNxNameInternPool::Intern (b);
+  Ptr<const CCNxName> ix = CCNxNameInternPool::Intern (x);
+
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (ia), PeekPointer (ib), "Equal names not interned to the same object");
+  NS_TEST_EXPECT_MSG_NE (PeekPointer (ia), PeekPointer (ix), "Different names interned to the same object");
+  NS_TEST_EXPECT_MSG_EQ (ia->IsInterned (), true, "Interned name not marked");
+  NS_TEST_EXPECT_MSG_EQ (a->IsInterned (), false, "Original name should not be marked");
+  NS_TEST_EXPECT_MSG_EQ (ia->Equals (*a), true, "Interned name not equal to original");
+  NS_TEST_EXPECT_MSG_EQ (ia->Equals (*ix), false, "Interned names should not be equal");
+  NS_TEST_EXPECT_MSG_EQ (ia->GetHash (), a->GetHash (), "Interned name has a different hash");
+
+  Ptr<const CCNxName> again = CCNxNameInternPool::Intern (ia);
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (again), PeekPointer (ia), "Interning an interned name should return it");
+}
+EndTest ()
+
+BeginTest (InternFlat)
+{
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/name=flat/ver=1");
+  Ptr<const CCNxName> ia = CCNxNameInternPool::Intern (a);
+
+  std::string flat;
+  CCNxNameInternPool::AppendFlatSegment (flat, CCNxNameSegment_Name, (const uint8_t *) "flat", 4);
+  CCNxNameInternPool::AppendFlatSegment (flat, CCNxNameSegment_Version, (const uint8_t *) "1", 1);
+  NS_TEST_EXPECT_MSG_EQ (flat, CCNxNameInternPool::GetFlat (*a), "Wrong flat encoding");
+
+  Ptr<const CCNxName> fromFlat = CCNxNameInternPool::InternFlat (flat);
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (fromFlat), PeekPointer (ia), "Flat name not found in pool");
+
+  std::string other;
+  CCNxNameInternPool::AppendFlatSegment (other, CCNxNameSegment_Name, (const uint8_t *) "flat", 4);
+  CCNxNameInternPool::AppendFlatSegment (other, CCNxNameSegment_Version, (const uint8_t *) "2", 1);
+  Ptr<const CCNxName> fromOther = CCNxNameInternPool::InternFlat (other);
+  NS_TEST_EXPECT_MSG_EQ (fromOther->Equals (*Create<CCNxName> ("ccnx:/name=flat/ver=2")), true, "Wrong name from flat encoding");
+}
+EndTest ()
+
+BeginTest (Purge)
+{
+  CCNxNameInternPool::Purge ();
+  size_t before = CCNxNameInternPool::GetSize ();
+
+  Ptr<const CCNxName> keep = CCNxNameInternPool::Intern (Create<CCNxName> ("ccnx:/name=purge/name=keep"));
+  CCNxNameInternPool::Intern (Create<CCNxName> ("ccnx:/name=purge/name=drop"));
+  NS_TEST_EXPECT_MSG_EQ (CCNxNameInternPool::GetSize (), before + 2, "Wrong pool size");
+
+  CCNxNameInternPool::Purge ();
+  NS_TEST_EXPECT_MSG_EQ (CCNxNameInternPool::GetSize (), before + 1, "Purge should only release unreferenced names");
+
+  Ptr<const CCNxName> again = CCNxNameInternPool::Intern (Create<CCNxName> ("ccnx:/name=purge/name=keep"));
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (again), PeekPointer (keep), "Referenced name was released");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxNameInternPool
+ */
+static class TestSuiteCCNxNameInternPool : public TestSuite
+{
+public:
+  TestSuiteCCNxNameInternPool () : TestSuite ("ccnx-name-intern-pool", UNIT)
+  {
+    AddTestCase (new Intern (), TestCase::QUICK);
+    AddTestCase (new InternFlat (), TestCase::QUICK);
+    AddTestCase (new Purge (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxNameInternPool;
+
+} // namespace TestSuiteCCNxNameInternPool
@@ -57,6 +57,8 @@
 #include "ns3/ccnx-name.h"
 #include "ns3/ccnx-name-builder.h"
 
+#include <unordered_map>
+
 #include "../TestMacros.h"
 
 using namespace ns3;
@@ -170,6 +172,55 @@ BeginTest (LessThan)
 }
 EndTest ()
 
+BeginTest (Hash)
+{
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/NAME=foor/VER=bar/CHUNK=333");
+  Ptr<const CCNxName> b = Create<CCNxName> ("ccnx:/NAME=foor/VER=bar/CHUNK=333");
+  Ptr<const CCNxName> x = Create<CCNxName> ("ccnx:/NAME=foor/VER=bar/CHUNK=444");
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/NAME=foor/VER=bar");
+
+  NS_TEST_EXPECT_MSG_EQ (a->GetHash (), b->GetHash (), "Equal names have different hashes");
+  NS_TEST_EXPECT_MSG_NE (a->GetHash (), x->GetHash (), "Different names have the same hash");
+  NS_TEST_EXPECT_MSG_EQ (a->GetHash (), a->GetPrefixHash (3), "Full prefix hash is not the name hash");
+  NS_TEST_EXPECT_MSG_EQ (a->GetPrefixHash (2), prefix->GetHash (), "Prefix hash is not the hash of the prefix");
+
+  // A copy keeps the hash
+  CCNxName copy (*a);
+  NS_TEST_EXPECT_MSG_EQ (copy.GetHash (), a->GetHash (), "Copy has a different hash");
+
+  // Appending a segment after the hash is computed must update it
+  Ptr<CCNxName> grow = Create<CCNxName> ("ccnx:/NAME=foor/VER=bar");
+  NS_TEST_EXPECT_MSG_EQ (grow->GetHash (), prefix->GetHash (), "Equal names have different hashes");
+  grow->AppendSegment (Create<const CCNxNameSegment> (CCNxNameSegment_Chunk, "333"));
+  NS_TEST_EXPECT_MSG_EQ (grow->GetHash (), a->GetHash (), "Appended name has wrong hash");
+  NS_TEST_EXPECT_MSG_EQ (grow->Equals (*a), true, "Appended name not equal");
+
+  std::hash<CCNxName> hasher;
+  NS_TEST_EXPECT_MSG_EQ (hasher (*a), hasher (*b), "std::hash differs for equal names");
+}
+EndTest ()
+
+BeginTest (UnorderedMap)
+{
+  typedef std::unordered_map< Ptr<const CCNxName>, int, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName > MapType;
+  MapType map;
+
+  map[Create<CCNxName> ("ccnx:/name=pear")] = 1;
+  map[Create<CCNxName> ("ccnx:/name=pear/name=tart")] = 2;
+
+  MapType::iterator it = map.find (Create<CCNxName> ("ccnx:/name=pear/name=tart"));
+  bool found = (it != map.end ());
+  NS_TEST_EXPECT_MSG_EQ (found, true, "Did not find name");
+  if (found)
+    {
+      NS_TEST_EXPECT_MSG_EQ (it->second, 2, "Wrong value");
+    }
+
+  found = (map.find (Create<CCNxName> ("ccnx:/name=apple")) != map.end ());
+  NS_TEST_EXPECT_MSG_EQ (found, false, "Found name not in map");
+}
+EndTest ()
+
 BeginTest (PrintName)
 {
   std::string s ("ccnx:/NAME=foor/VER=bar");
@@ -195,6 +246,8 @@ public:
     AddTestCase (new IsPrefixOf (), TestCase::QUICK);
     AddTestCase (new LessThan (), TestCase::QUICK);
     AddTestCase (new PrintName (), TestCase::QUICK);
+    AddTestCase (new Hash (), TestCase::QUICK);
+    AddTestCase (new UnorderedMap (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxName;
 
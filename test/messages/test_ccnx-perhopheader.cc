@@ -56,6 +56,8 @@
 #include "ns3/test.h"
 #include "ns3/ccnx-perhopheader.h"
 #include "ns3/ccnx-interestlifetime.h"
+#include "ns3/ccnx-cachetime.h"
+#include "ns3/ccnx-unknownperhopheaderentry.h"
 
 #include "../TestMacros.h"
 
@@ -125,6 +127,38 @@ BeginTest (GetHeader)
 }
 EndTest ()
 
+BeginTest (GetHeaderByType)
+{
+  Ptr<CCNxPerHopHeader> perHopHeader = Create<CCNxPerHopHeader>();
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(CCNxInterestLifetime::GetTLVType()), Ptr<CCNxPerHopHeaderEntry> (0), "Empty list should not match");
+
+  Ptr<CCNxCachetime> cachetime = Create<CCNxCachetime> (Create<CCNxTime>(3600));
+  Ptr<CCNxInterestLifetime> interestLifetime1 = Create<CCNxInterestLifetime> (Create<CCNxTime>(1200));
+  Ptr<CCNxInterestLifetime> interestLifetime2 = Create<CCNxInterestLifetime> (Create<CCNxTime>(2400));
+  Ptr<CCNxUnknownPerHopHeaderEntry> unknown = Create<CCNxUnknownPerHopHeaderEntry> (0x1234, Buffer (4));
+  perHopHeader->AddHeader(cachetime);
+  perHopHeader->AddHeader(interestLifetime1);
+  perHopHeader->AddHeader(interestLifetime2);
+  perHopHeader->AddHeader(unknown);
+
+  // The first entry of each type, types past the index are found by a scan
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(CCNxCachetime::GetTLVType()), cachetime, "Wrong cache time");
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(CCNxInterestLifetime::GetTLVType()), interestLifetime1, "Wrong lifetime");
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(0x1234), unknown, "Wrong unknown entry");
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(3), Ptr<CCNxPerHopHeaderEntry> (0), "Type 3 should not match");
+
+  // Removing an entry moves the others
+  perHopHeader->RemoveHeader(1);
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(CCNxInterestLifetime::GetTLVType()), interestLifetime2, "Wrong lifetime after remove");
+  perHopHeader->RemoveHeader(0);
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(CCNxCachetime::GetTLVType()), Ptr<CCNxPerHopHeaderEntry> (0), "Cache time was removed");
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(CCNxInterestLifetime::GetTLVType()), interestLifetime2, "Wrong lifetime after remove");
+
+  perHopHeader->clear();
+  NS_TEST_EXPECT_MSG_EQ (perHopHeader->GetHeaderByType(CCNxInterestLifetime::GetTLVType()), Ptr<CCNxPerHopHeaderEntry> (0), "Cleared list should not match");
+}
+EndTest ()
+
 BeginTest (Clear)
 {
   Ptr<CCNxPerHopHeader> perHopHeader = Create<CCNxPerHopHeader>();
@@ -208,6 +242,7 @@ public:
     AddTestCase (new AddHeader (), TestCase::QUICK);
     AddTestCase (new RemoveHeader (), TestCase::QUICK);
     AddTestCase (new GetHeader (), TestCase::QUICK);
+    AddTestCase (new GetHeaderByType (), TestCase::QUICK);
     AddTestCase (new Clear (), TestCase::QUICK);
     AddTestCase (new Equals (), TestCase::QUICK);
   }
@@ -356,6 +356,163 @@ BeginTest (ReceiveFromLayer2)
 }
 EndTest ()
 
+/**
+ * Makes RouteCallback() public, so a test can route a packet without a forwarder.
+ */
+class RoutingLayer3 : public CCNxStandardLayer3
+{
+public:
+  using CCNxStandardLayer3::RouteCallback;
+};
+
+/**
+ * Records the wire format of each packet sent on it.  A connection that is down fails every send.
+ */
+class RecordingConnection : public CCNxConnection
+{
+public:
+  RecordingConnection (CCNxConnection::ConnIdType connId, bool up) : m_up (up)
+  {
+    m_id = connId;
+  }
+
+  virtual bool Send (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> ingress)
+  {
+    if (m_up)
+      {
+        m_sent.push_back (packet->CreateNs3Packet ());
+      }
+    return m_up;
+  }
+
+  bool m_up;
+  std::vector< Ptr<Packet> > m_sent;
+};
+
+static uint32_t g_fanoutCount;
+static uint32_t g_fanoutSent;
+static size_t g_fanoutEgress;
+static uint32_t g_dropCount;
+static CCNxL3Protocol::DropReason g_dropReason;
+
+static void
+FanoutTrace (const CCNxL3Protocol *ccnx, Ptr<const Packet> packet, Ptr<const CCNxPacket> ccnxPacket,
+             Ptr<const CCNxConnectionList> egress, uint32_t sentCount)
+{
+  g_fanoutCount++;
+  g_fanoutSent = sentCount;
+  g_fanoutEgress = egress->size ();
+}
+
+static void
+DropTrace (const CCNxL3Protocol *ccnx, Ptr<const Packet> packet, Ptr<const CCNxPacket> ccnxPacket,
+           uint32_t interface, CCNxL3Protocol::DropReason reason)
+{
+  g_dropCount++;
+  g_dropReason = reason;
+}
+
+static Ptr<RoutingLayer3>
+CreateTracedLayer3 ()
+{
+  g_fanoutCount = 0;
+  g_fanoutSent = 0;
+  g_fanoutEgress = 0;
+  g_dropCount = 0;
+
+  Ptr<RoutingLayer3> layer3 = CreateObject<RoutingLayer3> ();
+  layer3->TraceConnectWithoutContext ("Fanout", MakeCallback (&FanoutTrace));
+  layer3->TraceConnectWithoutContext ("Drop", MakeCallback (&DropTrace));
+  return layer3;
+}
+
+static Ptr<CCNxPacket>
+CreateRoutedPacket ()
+{
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (Create<CCNxName> ("ccnx:/name=foo/name=fanout"),
+                                                     Create<CCNxBuffer> (100, true));
+  return CCNxPacket::CreateFromMessage (interest);
+}
+
+/**
+ * One routed packet goes out every egress connection with the same bytes, and the "Fanout"
+ * trace fires once with the number of successful sends.
+ */
+BeginTest (RouteCallbackFanout)
+{
+  Ptr<RoutingLayer3> layer3 = CreateTracedLayer3 ();
+  Ptr<RecordingConnection> ingress = Create<RecordingConnection> (1, true);
+  Ptr<CCNxPacket> packet = CreateRoutedPacket ();
+
+  std::vector< Ptr<RecordingConnection> > connections;
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  for (CCNxConnection::ConnIdType id = 10; id < 13; id++)
+    {
+      connections.push_back (Create<RecordingConnection> (id, true));
+      egress->push_back (connections.back ());
+    }
+
+  layer3->RouteCallback (packet, ingress, CCNxRoutingError::CCNxRoutingError_NoError, egress);
+
+  NS_TEST_EXPECT_MSG_EQ (g_fanoutCount, 1, "Fanout should fire once per routed packet");
+  NS_TEST_EXPECT_MSG_EQ (g_fanoutSent, connections.size (), "Wrong sent count");
+  NS_TEST_EXPECT_MSG_EQ (g_fanoutEgress, connections.size (), "Wrong egress list");
+  NS_TEST_EXPECT_MSG_EQ (g_dropCount, 0, "Nothing should be dropped");
+  NS_TEST_EXPECT_MSG_EQ (ingress->m_sent.size (), 0, "Sent back on the ingress");
+
+  Ptr<const Packet> wire = packet->PeekNs3Packet ();
+  std::vector<uint8_t> expected (wire->GetSize ());
+  wire->CopyData (&expected[0], expected.size ());
+  for (size_t i = 0; i < connections.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (connections[i]->m_sent.size (), 1, "Each connection should send once");
+      if (connections[i]->m_sent.size () == 1)
+        {
+          Ptr<Packet> sent = connections[i]->m_sent.front ();
+          std::vector<uint8_t> actual (sent->GetSize ());
+          sent->CopyData (&actual[0], actual.size ());
+          NS_TEST_EXPECT_MSG_EQ ((actual == expected), true, "Connection " << i << " sent different bytes");
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (packet->PeekNs3Packet ()), PeekPointer (wire), "Packet was serialized again");
+
+  // A connection that is down is a drop, and is not counted as sent
+  connections.front ()->m_up = false;
+  layer3->RouteCallback (packet, ingress, CCNxRoutingError::CCNxRoutingError_NoError, egress);
+  NS_TEST_EXPECT_MSG_EQ (g_fanoutCount, 2, "Fanout should fire once per routed packet");
+  NS_TEST_EXPECT_MSG_EQ (g_fanoutSent, connections.size () - 1, "Failed send was counted");
+  NS_TEST_EXPECT_MSG_EQ (g_dropCount, 1, "Failed send should be one drop");
+  NS_TEST_EXPECT_MSG_EQ (g_dropReason, CCNxL3Protocol::DROP_INTERFACE_DOWN, "Wrong drop reason");
+}
+EndTest ()
+
+/**
+ * An empty egress list or a routing error is one drop, with no send and no "Fanout".
+ */
+BeginTest (RouteCallbackDrop)
+{
+  Ptr<RoutingLayer3> layer3 = CreateTracedLayer3 ();
+  Ptr<RecordingConnection> ingress = Create<RecordingConnection> (1, true);
+  Ptr<CCNxPacket> packet = CreateRoutedPacket ();
+
+  layer3->RouteCallback (packet, ingress, CCNxRoutingError::CCNxRoutingError_NoError, Create<CCNxConnectionList> ());
+  NS_TEST_EXPECT_MSG_EQ (g_dropCount, 1, "Empty egress list should be one drop");
+  NS_TEST_EXPECT_MSG_EQ (g_dropReason, CCNxL3Protocol::DROP_NO_ROUTE, "Wrong drop reason");
+  NS_TEST_EXPECT_MSG_EQ (g_fanoutCount, 0, "Fanout should not fire for a drop");
+
+  Ptr<RecordingConnection> connection = Create<RecordingConnection> (10, true);
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  egress->push_back (connection);
+  egress->push_back (Create<RecordingConnection> (11, true));
+
+  layer3->RouteCallback (packet, ingress, CCNxRoutingError::CCNxRoutingError_NoRoute, egress);
+  NS_TEST_EXPECT_MSG_EQ (g_dropCount, 2, "Routing error should be one drop");
+  NS_TEST_EXPECT_MSG_EQ (g_dropReason, CCNxL3Protocol::DROP_NO_ROUTE, "Wrong drop reason");
+  NS_TEST_EXPECT_MSG_EQ (g_fanoutCount, 0, "Fanout should not fire for a drop");
+  NS_TEST_EXPECT_MSG_EQ (connection->m_sent.size (), 0, "Routing error should not send");
+  NS_TEST_EXPECT_MSG_EQ (ingress->m_sent.size (), 0, "Routing error should not send");
+}
+EndTest ()
 
 /**
  * @ingroup ccnx-test
@@ -379,6 +536,8 @@ public:
     AddTestCase (new GetInterfaceNonexistent (), TestCase::QUICK);
     AddTestCase (new GetNInterfaces (), TestCase::QUICK);
     AddTestCase (new ReceiveFromLayer2 (), TestCase::QUICK);
+    AddTestCase (new RouteCallbackFanout (), TestCase::QUICK);
+    AddTestCase (new RouteCallbackDrop (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxStandardLayer3;
 
@@ -54,6 +54,123 @@
  */
 
 
-/*
- * TESTS NOT IMPLEMENTED
+#include "ns3/test.h"
+#include "ns3/ccnx-connection-list.h"
+#include "../mockups/mockup_ccnx-virtual-connection.h"
+
+#include "../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxConnectionList {
+
+static void
+FillList (Ptr<CCNxConnectionList> list, unsigned first, unsigned count)
+{
+  for (unsigned i = first; i < first + count; i++)
+    {
+      list->push_back (Create<CCNxVirtualConnection> (i));
+    }
+}
+
+static bool
+ListEquals (Ptr<CCNxConnectionList> list, unsigned first, unsigned count)
+{
+  if (list->size () != count)
+    {
+      return false;
+    }
+  unsigned id = first;
+  for (CCNxConnectionList::iterator i = list->begin (); i != list->end (); ++i)
+    {
+      if ((*i)->GetConnectionId () != id++)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxConnectionList> list = Create<CCNxConnectionList> ();
+  bool exists = (list);
+  NS_TEST_EXPECT_MSG_EQ (exists, true, "Got null pointer");
+  NS_TEST_EXPECT_MSG_EQ (list->size (), 0, "New list should be empty");
+  NS_TEST_EXPECT_MSG_EQ ((list->begin () == list->end ()), true, "New list should have begin == end");
+}
+EndTest ()
+
+BeginTest (PushPop)
+{
+  Ptr<CCNxConnectionList> list = Create<CCNxConnectionList> ();
+  FillList (list, 1, 3);
+  NS_TEST_EXPECT_MSG_EQ (ListEquals (list, 1, 3), true, "Wrong list contents");
+  NS_TEST_EXPECT_MSG_EQ (list->front ()->GetConnectionId (), 1, "Wrong front");
+  NS_TEST_EXPECT_MSG_EQ (list->back ()->GetConnectionId (), 3, "Wrong back");
+
+  list->pop_front ();
+  NS_TEST_EXPECT_MSG_EQ (ListEquals (list, 2, 2), true, "Wrong list contents after pop_front");
+
+  // fills the slot left by pop_front without spilling to the heap
+  uint64_t before = CCNxConnectionList::GetHeapFallbackCount ();
+  FillList (list, 4, 2);
+  NS_TEST_EXPECT_MSG_EQ (ListEquals (list, 2, 4), true, "Wrong list contents after refill");
+  NS_TEST_EXPECT_MSG_EQ (CCNxConnectionList::GetHeapFallbackCount (), before, "Inline list should not use the heap");
+
+  list->clear ();
+  NS_TEST_EXPECT_MSG_EQ (list->size (), 0, "Cleared list should be empty");
+}
+EndTest ()
+
+BeginTest (Spill)
+{
+  Ptr<CCNxConnectionList> list = Create<CCNxConnectionList> ();
+  uint64_t before = CCNxConnectionList::GetHeapFallbackCount ();
+  FillList (list, 1, CCNxConnectionList::InlineCapacity);
+  NS_TEST_EXPECT_MSG_EQ (CCNxConnectionList::GetHeapFallbackCount (), before, "Inline list should not use the heap");
+
+  FillList (list, CCNxConnectionList::InlineCapacity + 1, 10);
+  NS_TEST_EXPECT_MSG_EQ (ListEquals (list, 1, CCNxConnectionList::InlineCapacity + 10), true, "Wrong list contents after spill");
+  NS_TEST_EXPECT_MSG_GT (CCNxConnectionList::GetHeapFallbackCount (), before, "Spill should count a heap fallback");
+
+  Ptr<CCNxConnectionList> copy = Create<CCNxConnectionList> (*list);
+  NS_TEST_EXPECT_MSG_EQ (ListEquals (copy, 1, CCNxConnectionList::InlineCapacity + 10), true, "Wrong contents of copy");
+}
+EndTest ()
+
+BeginTest (Pooled)
+{
+  // Warm up the free list, then making and releasing a list should not use the heap
+  Ptr<CCNxConnectionList> list = Create<CCNxConnectionList> ();
+  list = 0;
+
+  uint64_t before = CCNxConnectionList::GetHeapFallbackCount ();
+  for (int i = 0; i < 100; i++)
+    {
+      Ptr<CCNxConnectionList> temp = Create<CCNxConnectionList> ();
+      FillList (temp, 1, 2);
+    }
+  NS_TEST_EXPECT_MSG_EQ (CCNxConnectionList::GetHeapFallbackCount (), before, "Steady state should not use the heap");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxConnectionList
  */
+static class TestSuiteCCNxConnectionList : public TestSuite
+{
+public:
+  TestSuiteCCNxConnectionList () : TestSuite ("ccnx-connection-list", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new PushPop (), TestCase::QUICK);
+    AddTestCase (new Spill (), TestCase::QUICK);
+    AddTestCase (new Pooled (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxConnectionList;
+
+} // namespace TestSuiteCCNxConnectionList
@@ -192,6 +192,248 @@ void Service (Ptr<MockQueueItem> item)
 }
 EndTest ()
 
+/**
+ * This test will create a 2-server queue with a batch size of 3.  Each batch costs
+ * 1 second plus 1 second per item.  Five items arrive together at time 1 and three
+ * more at time 2.
+ *
+ * Time  Ids     Action
+ *  1.0  1-5     enqueue
+ *  1.0  1,2,3   begin service on server 0 (4 seconds)
+ *  1.0  4,5     begin service on server 1 (3 seconds)
+ *  2.0  6,7,8   enqueue
+ *  4.0  4,5     end service
+ *  4.0  6,7,8   begin service on server 1
+ *  5.0  1,2,3   end service
+ *  8.0  6,7,8   end service
+ */
+BeginTest (BatchTiming)
+{
+  unsigned servers = 2;
+  QueueType::GetServiceTimeCallback getTime = MakeCallback (&BatchTiming::GetServiceTime, this);
+  QueueType::DequeueCallback service = MakeCallback (&BatchTiming::Service, this);
+
+  m_queue = Create< QueueType > (servers, getTime, service);
+  m_queue->SetBatchMode (3, MakeCallback (&BatchTiming::GetBatchServiceTime, this),
+                         MakeCallback (&BatchTiming::ServiceBatch, this));
+  NS_TEST_EXPECT_MSG_EQ (m_queue->GetMaxBatchSize (), 3, "Wrong batch size");
+
+  struct
+  {
+    Time arrival;
+    Time end;
+  } testVectors[] = {
+    { Seconds (1.0f), Seconds (5.0f) },
+    { Seconds (1.0f), Seconds (5.0f) },
+    { Seconds (1.0f), Seconds (5.0f) },
+    { Seconds (1.0f), Seconds (4.0f) },
+    { Seconds (1.0f), Seconds (4.0f) },
+    { Seconds (2.0f), Seconds (8.0f) },
+    { Seconds (2.0f), Seconds (8.0f) },
+    { Seconds (2.0f), Seconds (8.0f) },
+  };
+
+  for (int i = 0; i < 8; i++)
+    {
+      Ptr<MockQueueItem> item = Create<MockQueueItem> (i + 1, testVectors[i].end);
+      Simulator::Schedule (testVectors[i].arrival, &BatchTiming::GenerateTraffic, this, item);
+    }
+
+  m_completedItems = 0;
+  m_completedBatches = 0;
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_completedItems, 8, "Incorrect number of completed items");
+  NS_TEST_EXPECT_MSG_EQ (m_completedBatches, 3, "Incorrect number of completed batches");
+  NS_TEST_EXPECT_MSG_EQ (m_queue->GetBatchEvents (), 3, "Incorrect number of batch events");
+  NS_TEST_EXPECT_MSG_EQ (m_queue->size (), 0, "Queue should be empty");
+}
+
+Ptr<QueueType> m_queue;
+unsigned m_completedItems;
+unsigned m_completedBatches;
+
+void GenerateTraffic (Ptr<MockQueueItem> item)
+{
+  m_queue->push_back (item);
+}
+
+Time GetServiceTime (Ptr<MockQueueItem> item)
+{
+  return Seconds (3);
+}
+
+Time GetBatchServiceTime (const QueueType::BatchType &items)
+{
+  return Seconds (1) + Seconds (items.size ());
+}
+
+void Service (Ptr<MockQueueItem> item)
+{
+  NS_TEST_EXPECT_MSG_EQ (true, false, "Per-item callback used in batch mode");
+}
+
+void ServiceBatch (const QueueType::BatchType &items)
+{
+  printf ("%6.3f ServiceBatch size %zu\n", Simulator::Now ().GetSeconds (), items.size ());
+  for (QueueType::BatchType::const_iterator i = items.begin (); i != items.end (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), (*i)->GetFinishTime (), "Incorrect finish time for " << (*i)->GetId ());
+      m_completedItems++;
+    }
+  m_completedBatches++;
+}
+EndTest ()
+
+/**
+ * In batch mode without batch callbacks, a batch takes as long as its slowest item
+ * and the items are passed to the per-item callback in FIFO order.
+ */
+BeginTest (BatchDefaultCallbacks)
+{
+  unsigned servers = 1;
+  QueueType::GetServiceTimeCallback getTime = MakeCallback (&BatchDefaultCallbacks::GetServiceTime, this);
+  QueueType::DequeueCallback service = MakeCallback (&BatchDefaultCallbacks::Service, this);
+
+  m_queue = Create< QueueType > (servers, getTime, service);
+  m_queue->SetBatchMode (4);
+
+  for (unsigned i = 1; i <= 4; i++)
+    {
+      Ptr<MockQueueItem> item = Create<MockQueueItem> (i, Seconds (4.0f));
+      Simulator::Schedule (Seconds (1.0f), &BatchDefaultCallbacks::GenerateTraffic, this, item);
+    }
+
+  m_lastId = 0;
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_lastId, 4, "Incorrect number of completed items");
+  NS_TEST_EXPECT_MSG_EQ (m_queue->GetBatchEvents (), 1, "Incorrect number of batch events");
+}
+
+Ptr<QueueType> m_queue;
+unsigned m_lastId;
+
+void GenerateTraffic (Ptr<MockQueueItem> item)
+{
+  m_queue->push_back (item);
+}
+
+Time GetServiceTime (Ptr<MockQueueItem> item)
+{
+  return Seconds (item->GetId () < 3 ? 1 : 3);
+}
+
+void Service (Ptr<MockQueueItem> item)
+{
+  NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), item->GetFinishTime (), "Incorrect finish time for " << item->GetId ());
+  NS_TEST_EXPECT_MSG_EQ (item->GetId (), m_lastId + 1, "Items out of order");
+  m_lastId = item->GetId ();
+}
+EndTest ()
+
+/**
+ * In synchronous mode push_back() services the item before it returns.  An item pushed
+ * from inside the dequeue callback is serviced after the callback returns.
+ */
+BeginTest (Synchronous)
+{
+  unsigned servers = 1;
+  QueueType::GetServiceTimeCallback getTime = MakeCallback (&Synchronous::GetServiceTime, this);
+  QueueType::DequeueCallback service = MakeCallback (&Synchronous::Service, this);
+
+  m_queue = Create< QueueType > (servers, getTime, service);
+  m_queue->SetSynchronous (true);
+  NS_TEST_EXPECT_MSG_EQ (m_queue->IsSynchronous (), true, "Queue should be synchronous");
+
+  m_serviceTimeCalls = 0;
+  m_lastId = 0;
+  m_depth = 0;
+  m_queue->push_back (Create<MockQueueItem> (1, Seconds (0)));
+  NS_TEST_EXPECT_MSG_EQ (m_lastId, 1, "Item should be serviced inline");
+
+  // item 2 pushes item 3 from its callback
+  m_queue->push_back (Create<MockQueueItem> (2, Seconds (0)));
+  NS_TEST_EXPECT_MSG_EQ (m_lastId, 3, "Both items should be serviced inline");
+  NS_TEST_EXPECT_MSG_EQ (m_serviceTimeCalls, 3, "GetServiceTime should be called for each item");
+  NS_TEST_EXPECT_MSG_EQ (m_queue->size (), 0, "Queue should be empty");
+}
+
+Ptr<QueueType> m_queue;
+unsigned m_serviceTimeCalls;
+unsigned m_lastId;
+unsigned m_depth;
+
+Time GetServiceTime (Ptr<MockQueueItem> item)
+{
+  m_serviceTimeCalls++;
+  return Seconds (1);
+}
+
+void Service (Ptr<MockQueueItem> item)
+{
+  NS_TEST_EXPECT_MSG_EQ (m_depth, 0, "Dequeue callback should not be re-entered");
+  NS_TEST_EXPECT_MSG_EQ (item->GetId (), m_lastId + 1, "Items out of order");
+  m_lastId = item->GetId ();
+
+  m_depth++;
+  if (item->GetId () == 2)
+    {
+      m_queue->push_back (Create<MockQueueItem> (3, Seconds (0)));
+      NS_TEST_EXPECT_MSG_EQ (m_lastId, 2, "Re-entrant push should wait for the callback to return");
+    }
+  m_depth--;
+}
+EndTest ()
+
+/**
+ * push_back() of a vector loads every free server in one pass.  With 2 servers and a
+ * 3 second service time, three items enqueued together at time 1 finish at 4, 4, and 7.
+ */
+BeginTest (PushBackVector)
+{
+  unsigned servers = 2;
+  QueueType::GetServiceTimeCallback getTime = MakeCallback (&PushBackVector::GetServiceTime, this);
+  QueueType::DequeueCallback service = MakeCallback (&PushBackVector::Service, this);
+
+  m_queue = Create< QueueType > (servers, getTime, service);
+
+  QueueType::BatchType items;
+  items.push_back (Create<MockQueueItem> (1, Seconds (4)));
+  items.push_back (Create<MockQueueItem> (2, Seconds (4)));
+  items.push_back (Create<MockQueueItem> (3, Seconds (7)));
+  Simulator::Schedule (Seconds (1), &PushBackVector::GenerateTraffic, this, items);
+
+  m_completedItems = 0;
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_completedItems, 3, "Incorrect number of completed items");
+}
+
+Ptr<QueueType> m_queue;
+unsigned m_completedItems;
+
+void GenerateTraffic (QueueType::BatchType items)
+{
+  m_queue->push_back (items);
+  NS_TEST_EXPECT_MSG_EQ (m_queue->size (), 3, "Wrong backlog after push_back");
+}
+
+Time GetServiceTime (Ptr<MockQueueItem> item)
+{
+  return Seconds (3);
+}
+
+void Service (Ptr<MockQueueItem> item)
+{
+  NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), item->GetFinishTime (), "Incorrect finish time for " << item->GetId ());
+  m_completedItems++;
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -204,6 +446,10 @@ public:
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
     AddTestCase (new Timing (), TestCase::QUICK);
+    AddTestCase (new BatchTiming (), TestCase::QUICK);
+    AddTestCase (new BatchDefaultCallbacks (), TestCase::QUICK);
+    AddTestCase (new Synchronous (), TestCase::QUICK);
+    AddTestCase (new PushBackVector (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxDelayQueue;
 
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../TestMacros.h"
+#include "ns3/ccnx-free-list.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/ptr.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxFreeList {
+
+class PooledItem : public SimpleRefCount<PooledItem>
+{
+public:
+  PooledItem (int value) : m_value (value)
+  {
+  }
+  virtual ~PooledItem ()
+  {
+  }
+  static void *operator new (size_t size)
+  {
+    return CCNxFreeList<PooledItem>::Allocate (size);
+  }
+  static void operator delete (void *p, size_t size)
+  {
+    CCNxFreeList<PooledItem>::Release (p, size);
+  }
+  int m_value;
+};
+
+class DerivedItem : public PooledItem
+{
+public:
+  DerivedItem () : PooledItem (0)
+  {
+  }
+  double m_extra[4];
+};
+
+typedef CCNxFreeList<PooledItem> FreeListType;
+
+BeginTest (Reuse)
+{
+  FreeListType::Purge ();
+  uint64_t allocations = FreeListType::GetAllocationCount ();
+  uint64_t fallbacks = FreeListType::GetHeapFallbackCount ();
+
+  Ptr<PooledItem> a = Create<PooledItem> (1);
+  Ptr<PooledItem> b = Create<PooledItem> (2);
+  NS_TEST_EXPECT_MSG_EQ (FreeListType::GetHeapFallbackCount (), fallbacks + 2, "Empty free list should use the heap");
+
+  PooledItem *address = PeekPointer (a);
+  a = 0;
+  b = 0;
+  NS_TEST_EXPECT_MSG_EQ (FreeListType::GetFreeCount (), 2, "Released items should be on the free list");
+
+  Ptr<PooledItem> c = Create<PooledItem> (3);
+  Ptr<PooledItem> d = Create<PooledItem> (4);
+  NS_TEST_EXPECT_MSG_EQ (FreeListType::GetHeapFallbackCount (), fallbacks + 2, "Free list should be reused");
+  NS_TEST_EXPECT_MSG_EQ (FreeListType::GetAllocationCount (), allocations + 4, "Wrong allocation count");
+  NS_TEST_EXPECT_MSG_EQ ((PeekPointer (c) == address || PeekPointer (d) == address), true, "Block should be reused");
+  NS_TEST_EXPECT_MSG_EQ (c->m_value + d->m_value, 7, "Wrong values");
+  NS_TEST_EXPECT_MSG_EQ (FreeListType::GetFreeCount (), 0, "Free list should be empty");
+}
+EndTest ()
+
+BeginTest (Derived)
+{
+  FreeListType::Purge ();
+  uint64_t fallbacks = FreeListType::GetHeapFallbackCount ();
+
+  // A derived class is a different size, so it always uses the heap and never goes on the free list
+  Ptr<PooledItem> item = Create<DerivedItem> ();
+  NS_TEST_EXPECT_MSG_EQ (FreeListType::GetHeapFallbackCount (), fallbacks + 1, "Derived class should use the heap");
+  item = 0;
+  NS_TEST_EXPECT_MSG_EQ (FreeListType::GetFreeCount (), 0, "Derived class should not go on the free list");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxFreeList
+ */
+static class TestSuiteCCNxFreeList : public TestSuite
+{
+public:
+  TestSuiteCCNxFreeList () : TestSuite ("ccnx-free-list", UNIT)
+  {
+    AddTestCase (new Reuse (), TestCase::QUICK);
+    AddTestCase (new Derived (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxFreeList;
+
+} // namespace TestSuiteCCNxFreeList
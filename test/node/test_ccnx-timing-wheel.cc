@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../TestMacros.h"
+#include "ns3/ccnx-timing-wheel.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxTimingWheel {
+
+typedef CCNxTimingWheel<unsigned> WheelType;
+
+BeginTest (Constructor)
+{
+  Ptr<WheelType> wheel = Create<WheelType> (MilliSeconds (10), MakeCallback (&Constructor::Expire, this));
+
+  bool exists = (wheel);
+  NS_TEST_EXPECT_MSG_EQ (exists, true, "Got null pointer");
+  NS_TEST_EXPECT_MSG_EQ (wheel->size (), 0, "New wheel should be empty");
+  NS_TEST_EXPECT_MSG_EQ (wheel->GetTick (), MilliSeconds (10), "Wrong tick");
+}
+
+void Expire (unsigned item)
+{
+
+}
+EndTest ()
+
+/**
+ * Insert items with expiry times that span all levels of the wheel.  Each item must
+ * expire no earlier than its expiry time and no later than one tick after it.
+ */
+BeginTest (Timing)
+{
+  m_wheel = Create<WheelType> (MilliSeconds (10), MakeCallback (&Timing::Expire, this));
+
+  Time expiryTimes[] = {
+    MilliSeconds (5), MilliSeconds (10), MilliSeconds (15), MilliSeconds (630), MilliSeconds (640),
+    Seconds (2), Seconds (41), Seconds (42), Seconds (2700), Seconds (0)
+  };
+
+  m_count = 0;
+  for (unsigned i = 0; !expiryTimes[i].IsZero (); i++)
+    {
+      m_expiryTimes.push_back (expiryTimes[i]);
+      m_wheel->Insert (expiryTimes[i], i);
+      m_count++;
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (m_wheel->size (), m_count, "Wrong wheel size");
+
+  m_completedItems = 0;
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_completedItems, m_count, "Incorrect number of expired items");
+  NS_TEST_EXPECT_MSG_EQ (m_wheel->size (), 0, "Wheel should be empty");
+  NS_TEST_EXPECT_MSG_EQ (m_wheel->GetExpiredCount (), m_count, "Wrong expired count");
+}
+
+Ptr<WheelType> m_wheel;
+std::vector<Time> m_expiryTimes;
+unsigned m_count;
+unsigned m_completedItems;
+
+void Expire (unsigned item)
+{
+  Time now = Simulator::Now ();
+  Time expiry = m_expiryTimes[item];
+  NS_TEST_EXPECT_MSG_EQ ((now >= expiry), true, "Item " << item << " expired early at " << now);
+  NS_TEST_EXPECT_MSG_EQ ((now <= expiry + m_wheel->GetTick ()), true, "Item " << item << " expired late at " << now);
+  m_completedItems++;
+}
+EndTest ()
+
+/**
+ * Many items in the same tick should take one simulator event, and re-inserting
+ * from the expire callback must work.
+ */
+BeginTest (Reinsert)
+{
+  m_wheel = Create<WheelType> (MilliSeconds (10), MakeCallback (&Reinsert::Expire, this));
+
+  for (unsigned i = 0; i < 100; i++)
+    {
+      m_wheel->Insert (MilliSeconds (100), i);
+    }
+
+  m_completedItems = 0;
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  // Each item is inserted once more from the callback
+  NS_TEST_EXPECT_MSG_EQ (m_completedItems, 200, "Incorrect number of expired items");
+  NS_TEST_EXPECT_MSG_EQ ((m_wheel->GetTickEventCount () < 100), true, "Too many tick events");
+}
+
+Ptr<WheelType> m_wheel;
+unsigned m_completedItems;
+
+void Expire (unsigned item)
+{
+  m_completedItems++;
+  if (item < 100)
+    {
+      m_wheel->Insert (Simulator::Now () + Seconds (1), item + 100);
+    }
+}
+EndTest ()
+
+/**
+ * Clear() removes all pending items and nothing fires.
+ */
+BeginTest (Clear)
+{
+  m_wheel = Create<WheelType> (MilliSeconds (10), MakeCallback (&Clear::Expire, this));
+
+  for (unsigned i = 0; i < 10; i++)
+    {
+      m_wheel->Insert (Seconds (i + 1), i);
+    }
+  m_wheel->Clear ();
+  NS_TEST_EXPECT_MSG_EQ (m_wheel->size (), 0, "Wheel should be empty");
+
+  m_completedItems = 0;
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_completedItems, 0, "Nothing should expire after Clear");
+}
+
+Ptr<WheelType> m_wheel;
+unsigned m_completedItems;
+
+void Expire (unsigned item)
+{
+  m_completedItems++;
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxTimingWheel
+ */
+static class TestSuiteCCNxTimingWheel : public TestSuite
+{
+public:
+  TestSuiteCCNxTimingWheel () : TestSuite ("ccnx-timing-wheel", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new Timing (), TestCase::QUICK);
+    AddTestCase (new Reinsert (), TestCase::QUICK);
+    AddTestCase (new Clear (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxTimingWheel;
+
+} // namespace TestSuiteCCNxTimingWheel
@@ -56,6 +56,7 @@
 #include "ns3/test.h"
 #include "ns3/ccnx-codec-contentobject.h"
 #include "ns3/ccnx-schema-v1.h"
+#include "ns3/ccnx-hasher-fnv1a.h"
 #include "../../TestMacros.h"
 
 using namespace ns3;
@@ -252,6 +253,43 @@ BeginTest (TestDeserializeWithNonDataPayloadType)
 }
 EndTest ()
 
+BeginTest (TestDeserialize_ContentObjectHash)
+{
+  printf ("TestDeserialize_ContentObjectHash DoRun\n");
+
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=apple/ver=pie/chunk=crust");
+  Ptr<CCNxBuffer> payload = CreatePayload (sizeof(payloadBytes), payloadBytes);
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, payload);
+
+  CCNxCodecContentObject ci;
+  ci.SetHeader (content);
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (ci.GetContentObjectHash ()) == 0, true, "Serializing should not compute a hash");
+
+  Buffer buffer (0);
+  buffer.AddAtStart (ci.GetSerializedSize ());
+  ci.Serialize (buffer.Begin ());
+
+  CCNxCodecContentObject citest;
+  citest.Deserialize (buffer.Begin ());
+  Ptr<CCNxHashValue> hash = citest.GetContentObjectHash ();
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (hash) != 0, true, "Deserialize should compute a hash");
+
+  // Same as hashing the whole message in one go
+  Ptr<CCNxHasherFnv1a> hasher = CreateObject<CCNxHasherFnv1a> ();
+  hasher->Update (buffer.Begin ());
+  NS_TEST_EXPECT_MSG_EQ (*hash == *hasher->Finalize (), true, "Wrong hash");
+
+  // Decoding again resets the hash
+  CCNxCodecContentObject other;
+  other.SetHeader (Create<CCNxContentObject> (Create<CCNxName> ("ccnx:/name=apple/ver=tart"), payload));
+  Buffer otherBuffer (0);
+  otherBuffer.AddAtStart (other.GetSerializedSize ());
+  other.Serialize (otherBuffer.Begin ());
+  citest.Deserialize (otherBuffer.Begin ());
+  NS_TEST_EXPECT_MSG_EQ (*hash == *citest.GetContentObjectHash (), false, "Different objects have the same hash");
+}
+EndTest ()
+
 BeginTest (TestSerialize_PayloadType)
 {
   printf ("TestSerialize_PayloadType DoRun\n");
@@ -304,6 +342,7 @@ public:
     AddTestCase (new TestCCNxCodecContentObject::TestSerializeWithNonDataPayloadType (), TestCase::QUICK);
     AddTestCase (new TestCCNxCodecContentObject::TestDeserializeWithDataPayloadType (), TestCase::QUICK);
     AddTestCase (new TestCCNxCodecContentObject::TestDeserializeWithNonDataPayloadType (), TestCase::QUICK);
+    AddTestCase (new TestCCNxCodecContentObject::TestDeserialize_ContentObjectHash (), TestCase::QUICK);
     AddTestCase (new TestCCNxCodecContentObject::TestSerialize_PayloadType (), TestCase::QUICK);
     AddTestCase (new TestCCNxCodecContentObject::TestDeserialize_PayloadType (), TestCase::QUICK);
   }
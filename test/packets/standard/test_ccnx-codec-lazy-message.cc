@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "ns3/config.h"
+#include "ns3/enum.h"
+#include "ns3/ccnx-packet.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-contentobject.h"
+#include "ns3/ccnx-codec-lazy-message.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxCodecLazyMessage {
+
+typedef CCNxMessageFieldDecoder Decoder;
+
+/**
+ * Encodes the message and decodes it again in the given mode.  The mode is set back to
+ * eager before returning, so a failed test does not leak lazy mode into other suites.
+ */
+static Ptr<CCNxPacket>
+RoundTrip (Ptr<CCNxMessage> message, CCNxPacket::DecodeMode mode)
+{
+  Ptr<Packet> wire = CCNxPacket::CreateFromMessage (message)->CreateNs3Packet ();
+  Config::SetGlobal ("CCNxPacketDecodeMode", EnumValue (mode));
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromNs3Packet (wire);
+  Config::SetGlobal ("CCNxPacketDecodeMode", EnumValue (CCNxPacket::DecodeMode_Eager));
+  return packet;
+}
+
+static Ptr<CCNxContentObject>
+CreateContentObject ()
+{
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=lazy/name=content");
+  Ptr<CCNxBuffer> payload = Create<CCNxBuffer> (5, "apple");
+  return Create<CCNxContentObject> (name, payload, CCNxContentObjectPayloadType_Key, Create<CCNxTime> (123456));
+}
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxCodecLazyMessage> lazy = Create<CCNxCodecLazyMessage> (Create<Packet> (10));
+  NS_TEST_EXPECT_MSG_EQ (lazy->HasField (Decoder::Name), false, "No field should be set");
+  NS_TEST_EXPECT_MSG_EQ (lazy->GetPayloadSize (), 0, "Wrong payload size");
+  NS_TEST_EXPECT_MSG_EQ (lazy->HasField (Decoder::Payload), false, "No field should be set");
+}
+EndTest ()
+
+/**
+ * Fields are decoded on first access and equal the eager decode.
+ */
+BeginTest (ContentObject)
+{
+  Ptr<CCNxContentObject> content = CreateContentObject ();
+  Ptr<CCNxPacket> eager = RoundTrip (content, CCNxPacket::DecodeMode_Eager);
+  Ptr<CCNxPacket> lazy = RoundTrip (content, CCNxPacket::DecodeMode_Lazy);
+
+  Ptr<CCNxContentObject> message = DynamicCast<CCNxContentObject, CCNxMessage> (lazy->GetMessage ());
+  NS_TEST_EXPECT_MSG_EQ (message->IsDecoded (Decoder::Name), false, "Name should not be decoded yet");
+
+  NS_TEST_EXPECT_MSG_EQ (message->GetName ()->Equals (*content->GetName ()), true, "Wrong name");
+  NS_TEST_EXPECT_MSG_EQ (message->IsDecoded (Decoder::Name), true, "Name should be decoded");
+  NS_TEST_EXPECT_MSG_EQ (message->IsDecoded (Decoder::Payload), false, "Payload should not be decoded yet");
+
+  // The size comes from the TLV length, it does not copy the payload
+  NS_TEST_EXPECT_MSG_EQ (message->HasPayload (), true, "Should have a payload");
+  NS_TEST_EXPECT_MSG_EQ (message->GetPayloadSize (), 5, "Wrong payload size");
+  NS_TEST_EXPECT_MSG_EQ (message->IsDecoded (Decoder::Payload), false, "Payload should not be decoded yet");
+
+  NS_TEST_EXPECT_MSG_EQ (message->GetPayload ()->Equals (content->GetPayload ()), true, "Wrong payload");
+  NS_TEST_EXPECT_MSG_EQ (message->GetPayloadType (), CCNxContentObjectPayloadType_Key, "Wrong payload type");
+  NS_TEST_EXPECT_MSG_EQ (message->GetExpiryTime ()->Equals (content->GetExpiryTime ()), true, "Wrong expiry time");
+
+  NS_TEST_EXPECT_MSG_EQ (message->Equals (*content), true, "Lazy decode differs from original");
+  NS_TEST_EXPECT_MSG_EQ (message->Equals (DynamicCast<CCNxContentObject, CCNxMessage> (eager->GetMessage ())), true, "Lazy decode differs from eager");
+}
+EndTest ()
+
+/**
+ * A Content Object without a payload or expiry time decodes the same as in eager mode.
+ */
+BeginTest (ContentObjectNoPayload)
+{
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (Create<CCNxName> ("ccnx:/name=lazy/name=empty"));
+  Ptr<CCNxPacket> eager = RoundTrip (content, CCNxPacket::DecodeMode_Eager);
+  Ptr<CCNxPacket> lazy = RoundTrip (content, CCNxPacket::DecodeMode_Lazy);
+
+  Ptr<CCNxContentObject> message = DynamicCast<CCNxContentObject, CCNxMessage> (lazy->GetMessage ());
+  NS_TEST_EXPECT_MSG_EQ (message->HasPayload (), false, "Should not have a payload");
+  NS_TEST_EXPECT_MSG_EQ (message->GetPayload (), Ptr<CCNxBuffer> (0), "Payload should be null");
+  NS_TEST_EXPECT_MSG_EQ (message->GetExpiryTime (), Ptr<CCNxTime> (0), "Expiry time should be null");
+  NS_TEST_EXPECT_MSG_EQ (message->GetPayloadType (), CCNxContentObjectPayloadType_Data, "Wrong payload type");
+  NS_TEST_EXPECT_MSG_EQ (message->GetName ()->Equals (*eager->GetMessage ()->GetName ()), true, "Lazy decode differs from eager");
+}
+EndTest ()
+
+BeginTest (Interest)
+{
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=lazy/name=interest");
+  Ptr<CCNxHashValue> keyid = Create<CCNxHashValue> (0x1234);
+  Ptr<CCNxHashValue> hash = Create<CCNxHashValue> (0x5678);
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (name, Create<CCNxBuffer> (0), keyid, hash);
+
+  Ptr<CCNxPacket> eager = RoundTrip (interest, CCNxPacket::DecodeMode_Eager);
+  Ptr<CCNxPacket> lazy = RoundTrip (interest, CCNxPacket::DecodeMode_Lazy);
+
+  Ptr<CCNxInterest> message = DynamicCast<CCNxInterest, CCNxMessage> (lazy->GetMessage ());
+  NS_TEST_EXPECT_MSG_EQ (message->IsDecoded (Decoder::KeyIdRestriction), false, "KeyId should not be decoded yet");
+  NS_TEST_EXPECT_MSG_EQ (message->HasKeyidRestriction (), true, "Should have a keyid restriction");
+  NS_TEST_EXPECT_MSG_EQ (*message->GetKeyidRestriction () == *keyid, true, "Wrong keyid restriction");
+  NS_TEST_EXPECT_MSG_EQ (*message->GetHashRestriction () == *hash, true, "Wrong hash restriction");
+  NS_TEST_EXPECT_MSG_EQ (message->GetName ()->Equals (*name), true, "Wrong name");
+  NS_TEST_EXPECT_MSG_EQ (message->Equals (DynamicCast<CCNxInterest, CCNxMessage> (eager->GetMessage ())), true, "Lazy decode differs from eager");
+}
+EndTest ()
+
+/**
+ * The ContentObjectHash is computed on first use and equals the eager one.
+ */
+BeginTest (ContentObjectHash)
+{
+  Ptr<CCNxContentObject> content = CreateContentObject ();
+  Ptr<CCNxPacket> eager = RoundTrip (content, CCNxPacket::DecodeMode_Eager);
+  Ptr<CCNxPacket> lazy = RoundTrip (content, CCNxPacket::DecodeMode_Lazy);
+
+  Ptr<CCNxHashValue> hash = lazy->GetContentObjectHash ();
+  NS_TEST_EXPECT_MSG_EQ (*hash == *eager->GetContentObjectHash (), true, "Lazy hash differs from eager");
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (lazy->GetContentObjectHash ()), PeekPointer (hash), "Hash should be cached");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxCodecLazyMessage
+ */
+static class TestSuiteCCNxCodecLazyMessage : public TestSuite
+{
+public:
+  TestSuiteCCNxCodecLazyMessage () : TestSuite ("ccnx-codec-lazy-message", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new ContentObject (), TestCase::QUICK);
+    AddTestCase (new ContentObjectNoPayload (), TestCase::QUICK);
+    AddTestCase (new Interest (), TestCase::QUICK);
+    AddTestCase (new ContentObjectHash (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxCodecLazyMessage;
+
+} // namespace TestSuiteCCNxCodecLazyMessage
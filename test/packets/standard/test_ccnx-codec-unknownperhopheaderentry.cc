@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "ns3/ccnx-codec-unknownperhopheaderentry.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxCodecUnknownPerHopHeaderEntry {
+
+static const uint8_t truth[] = {
+  // an unregistered type
+  0x12, 0x34, 0, 5,
+  'a', 'p', 'p', 'l', 'e'
+};
+
+BeginTest (Deserialize)
+{
+  Buffer buffer (0);
+  buffer.AddAtStart (sizeof(truth));
+  buffer.Begin ().Write (truth, sizeof(truth));
+
+  CCNxCodecUnknownPerHopHeaderEntry codec;
+  size_t bytesRead = 0;
+  Buffer::Iterator iterator = buffer.Begin ();
+  Ptr<CCNxPerHopHeaderEntry> entry = codec.Deserialize (&iterator, &bytesRead);
+
+  NS_TEST_EXPECT_MSG_EQ (bytesRead, sizeof(truth), "Wrong bytes read");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetInstanceTLVType (), 0x1234, "Wrong type");
+  NS_TEST_EXPECT_MSG_EQ (codec.GetSerializedSize (entry), sizeof(truth), "Wrong size");
+  codec.Print (entry, std::cout);
+}
+EndTest ()
+
+/**
+ * The bytes are written back as they were read.
+ */
+BeginTest (Serialize)
+{
+  Buffer input (0);
+  input.AddAtStart (sizeof(truth));
+  input.Begin ().Write (truth, sizeof(truth));
+
+  CCNxCodecUnknownPerHopHeaderEntry codec;
+  size_t bytesRead = 0;
+  Buffer::Iterator iterator = input.Begin ();
+  Ptr<CCNxPerHopHeaderEntry> entry = codec.Deserialize (&iterator, &bytesRead);
+
+  Buffer buffer (0);
+  buffer.AddAtStart (codec.GetSerializedSize (entry));
+  Buffer::Iterator output = buffer.Begin ();
+  codec.Serialize (entry, &output);
+
+  uint8_t test[sizeof(truth)];
+  buffer.CopyData (test, sizeof(truth));
+
+  hexdump ("truth", sizeof(truth), truth);
+  hexdump ("test ", sizeof(test), test);
+
+  NS_TEST_EXPECT_MSG_EQ (memcmp (truth, test, sizeof(truth)), 0, "Data in buffer wrong");
+}
+EndTest ()
+
+BeginTest (PrintEmpty)
+{
+  CCNxCodecUnknownPerHopHeaderEntry codec;
+  codec.Print (0, std::cout);
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxCodecUnknownPerHopHeaderEntry
+ */
+static class TestSuiteCCNxCodecUnknownPerHopHeaderEntry : public TestSuite
+{
+public:
+  TestSuiteCCNxCodecUnknownPerHopHeaderEntry () : TestSuite ("ccnx-codec-unknownperhopheaderentry", UNIT)
+  {
+    AddTestCase (new Deserialize (), TestCase::QUICK);
+    AddTestCase (new Serialize (), TestCase::QUICK);
+    AddTestCase (new PrintEmpty (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxCodecUnknownPerHopHeaderEntry;
+
+} // namespace TestSuiteCCNxCodecUnknownPerHopHeaderEntry
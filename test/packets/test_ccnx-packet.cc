@@ -55,6 +55,9 @@
 
 #include "ns3/test.h"
 #include "ns3/ccnx-packet.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-interestlifetime.h"
+#include "ns3/ccnx-contentobject.h"
 
 #include "../TestMacros.h"
 
@@ -68,6 +71,147 @@ BeginTest (Constructor)
 }
 EndTest ()
 
+/**
+ * A packet created from an ns3::Packet references it and does not copy it.
+ */
+BeginTest (ZeroCopyReceive)
+{
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=zero/name=copy");
+  Ptr<CCNxPacket> sent = CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name));
+  Ptr<Packet> wire = sent->CreateNs3Packet ();
+
+  Ptr<CCNxPacket> received = CCNxPacket::CreateFromNs3Packet (wire);
+  NS_TEST_EXPECT_MSG_EQ (received->GetMessage ()->GetName ()->Equals (*name), true, "Wrong name");
+
+  const Packet *peek = PeekPointer (received->PeekNs3Packet ());
+  const Packet *original = PeekPointer (wire);
+  NS_TEST_EXPECT_MSG_EQ (peek, original, "Received packet was copied");
+
+  Ptr<Packet> copy = received->CreateNs3Packet ();
+  NS_TEST_EXPECT_MSG_EQ (copy->GetSize (), wire->GetSize (), "Wrong size of copy");
+}
+EndTest ()
+
+/**
+ * Layer 2 padding is trimmed on a copy, the received ns3::Packet is not changed.
+ */
+BeginTest (TrimOnCopy)
+{
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=trim");
+  Ptr<CCNxPacket> sent = CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name));
+  Ptr<Packet> wire = sent->CreateNs3Packet ();
+  uint32_t packetLength = wire->GetSize ();
+  wire->AddPaddingAtEnd (16);
+
+  Ptr<CCNxPacket> received = CCNxPacket::CreateFromNs3Packet (wire);
+  NS_TEST_EXPECT_MSG_EQ (received->PeekNs3Packet ()->GetSize (), packetLength, "Packet not trimmed");
+  NS_TEST_EXPECT_MSG_EQ (wire->GetSize (), packetLength + 16, "Received packet was changed");
+}
+EndTest ()
+
+/**
+ * The wire format is made once and shared until a header changes.
+ */
+BeginTest (SerializeOnce)
+{
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=serialize/name=once");
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name));
+
+  const Packet *first = PeekPointer (packet->PeekNs3Packet ());
+  Ptr<Packet> a = packet->CreateNs3Packet ();
+  Ptr<Packet> b = packet->CreateNs3Packet ();
+  const Packet *second = PeekPointer (packet->PeekNs3Packet ());
+
+  NS_TEST_EXPECT_MSG_EQ (first, second, "Packet was serialized again without a change");
+  NS_TEST_EXPECT_MSG_EQ (a->GetSize (), b->GetSize (), "Copies have different sizes");
+  uint32_t size = a->GetSize ();
+
+  packet->AddPerHopHeaderEntry (Create<CCNxInterestLifetime> (Create<CCNxTime> (3600)));
+  Ptr<Packet> c = packet->CreateNs3Packet ();
+  NS_TEST_EXPECT_MSG_GT (c->GetSize (), size, "Per hop header change not serialized");
+  NS_TEST_EXPECT_MSG_EQ (packet->GetFixedHeader ()->GetPacketLength (), c->GetSize (), "Wrong packet length");
+
+  packet->GetFixedHeader ()->SetHopLimit (7);
+  Ptr<CCNxPacket> decoded = CCNxPacket::CreateFromNs3Packet (packet->CreateNs3Packet ());
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) decoded->GetFixedHeader ()->GetHopLimit (), 7, "Hop limit change not serialized");
+  NS_TEST_EXPECT_MSG_EQ (decoded->GetPerhopHeaders ()->size (), 1, "Per hop header not serialized");
+}
+EndTest ()
+
+/**
+ * A decoded Content Object carries the hash computed by the codec, and a new one gets the same hash.
+ */
+BeginTest (ContentObjectHash)
+{
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=content/name=hash");
+  Ptr<CCNxPacket> sent = CCNxPacket::CreateFromMessage (Create<CCNxContentObject> (name));
+  Ptr<CCNxHashValue> nullHash = Create<CCNxHashValue> (0);
+  Ptr<CCNxHashValue> sentHash = sent->GetContentObjectHash ();
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (sentHash) == 0, false, "New packet should have a hash");
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (sent->GetContentObjectHash ()), PeekPointer (sentHash), "Hash should be cached");
+
+  Ptr<CCNxPacket> received = CCNxPacket::CreateFromNs3Packet (sent->CreateNs3Packet ());
+  Ptr<CCNxHashValue> hash = received->GetContentObjectHash ();
+  NS_TEST_EXPECT_MSG_EQ (*hash == *nullHash, false, "Decoded packet should have a hash");
+  NS_TEST_EXPECT_MSG_EQ (*hash == *sentHash, true, "Decoded and new packets should have the same hash");
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (received->GetContentObjectHash ()), PeekPointer (hash), "Hash should be cached");
+
+  // Per hop headers are not part of the hash
+  sent->AddPerHopHeaderEntry (Create<CCNxInterestLifetime> (Create<CCNxTime> (3600)));
+  Ptr<CCNxPacket> again = CCNxPacket::CreateFromNs3Packet (sent->CreateNs3Packet ());
+  NS_TEST_EXPECT_MSG_EQ (*again->GetContentObjectHash () == *hash, true, "Per hop header changed the hash");
+
+  // Serializing before asking for the hash computes it on the way, with the same value
+  Ptr<CCNxPacket> serializedFirst = CCNxPacket::CreateFromMessage (Create<CCNxContentObject> (name));
+  serializedFirst->CreateNs3Packet ();
+  NS_TEST_EXPECT_MSG_EQ (*serializedFirst->GetContentObjectHash () == *hash, true, "Hash made while serializing differs");
+
+  Ptr<CCNxHashValue> virtualHash = Create<CCNxHashValue> (7);
+  received->SetContentObjectHash (virtualHash);
+  NS_TEST_EXPECT_MSG_EQ (*received->GetContentObjectHash () == *virtualHash, true, "Virtual hash not set");
+
+  Ptr<CCNxPacket> interest = CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name));
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (interest->GetContentObjectHash ()) == 0, true, "Interest should have no hash");
+}
+EndTest ()
+
+/**
+ * TLVs without a codec are kept, and a header change does not encode the message again.
+ */
+BeginTest (UnknownTlvs)
+{
+  const uint8_t truth[] = {
+    // fixed header, hop limit 5
+    1, 1, 0, 34, 5, 0, 0, 14,
+    // an unknown per hop header
+    0, 0x99, 0, 2, 'x', 'y',
+    // T_INTEREST
+    0, 1, 0, 16,
+    // T_NAME ccnx:/name=a
+    0, 0, 0, 5, 0, 1, 0, 1, 'a',
+    // an unknown message TLV
+    0, 0x77, 0, 3, 'u', 'v', 'w',
+  };
+
+  Ptr<Packet> wire = Create<Packet> (truth, sizeof(truth));
+  Ptr<CCNxPacket> received = CCNxPacket::CreateFromNs3Packet (wire);
+  NS_TEST_EXPECT_MSG_EQ (received->GetPerhopHeaders ()->size (), 1, "Wrong per hop header count");
+  NS_TEST_EXPECT_MSG_EQ (received->GetPerhopHeaders ()->GetHeader (0)->GetInstanceTLVType (), 0x99, "Wrong per hop type");
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=a");
+  NS_TEST_EXPECT_MSG_EQ (received->GetMessage ()->GetName ()->Equals (*name), true, "Wrong name");
+
+  received->GetFixedHeader ()->SetHopLimit (4);
+  Ptr<Packet> forwarded = received->CreateNs3Packet ();
+  NS_TEST_EXPECT_MSG_EQ (forwarded->GetSize (), sizeof(truth), "Wrong size");
+
+  uint8_t test[sizeof(truth)];
+  forwarded->CopyData (test, sizeof(truth));
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) test[4], 4, "Hop limit not changed");
+  test[4] = truth[4];
+  NS_TEST_EXPECT_MSG_EQ (memcmp (truth, test, sizeof(truth)), 0, "TLVs were not kept");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -79,6 +223,11 @@ public:
   TestSuiteCCNxPacket () : TestSuite ("ccnx-packet", UNIT)
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new ZeroCopyReceive (), TestCase::QUICK);
+    AddTestCase (new TrimOnCopy (), TestCase::QUICK);
+    AddTestCase (new SerializeOnce (), TestCase::QUICK);
+    AddTestCase (new ContentObjectHash (), TestCase::QUICK);
+    AddTestCase (new UnknownTlvs (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxPacket;
 
@@ -56,6 +56,8 @@
 #include "ns3/test.h"
 #include "ns3/ccnx-message-portal.h"
 #include "ns3/ccns3Sim-module.h"
+#include "ns3/uinteger.h"
+#include "ns3/enum.h"
 
 #include "../../TestMacros.h"
 
@@ -211,6 +213,178 @@ BeginTest (SendRecv)
 }
 EndTest ()
 
+static Ptr<CCNxPacket>
+CreateInterestPacket (int i)
+{
+  std::ostringstream nameString; nameString << "ccnx:/name=foo/name=sink/chunk=" << i;
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (Create<CCNxName> (nameString.str ()));
+  return CCNxPacket::CreateFromMessage (interest);
+}
+
+BeginTest (RecvQueueDropTail)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+
+  CCNxStackHelper ccnx;
+  ccnx.Install (node);
+
+  TypeId tid = TypeId::LookupByName ("ns3::ccnx::CCNxMessagePortalFactory");
+  Ptr<CCNxMessagePortal> portal = DynamicCast<CCNxMessagePortal> (CCNxPortal::CreatePortal (node, tid));
+  portal->SetAttribute ("RecvQueueCapacity", UintegerValue (2));
+
+  Ptr<CCNxPacket> p0 = CreateInterestPacket (0);
+  Ptr<CCNxPacket> p1 = CreateInterestPacket (1);
+  Ptr<CCNxPacket> p2 = CreateInterestPacket (2);
+  NS_TEST_EXPECT_MSG_EQ (portal->ReceiveFromLayer3 (p0, Ptr<CCNxConnection> ()), true, "p0 should be queued");
+  NS_TEST_EXPECT_MSG_EQ (portal->ReceiveFromLayer3 (p1, Ptr<CCNxConnection> ()), true, "p1 should be queued");
+  NS_TEST_EXPECT_MSG_EQ (portal->ReceiveFromLayer3 (p2, Ptr<CCNxConnection> ()), false, "p2 should be dropped");
+  NS_TEST_EXPECT_MSG_EQ (portal->GetRecvQueueSize (), 2, "wrong queue size");
+  NS_TEST_EXPECT_MSG_EQ (portal->GetRecvQueueDrops (), 1, "wrong drop count");
+
+  NS_TEST_EXPECT_MSG_EQ (portal->Recv (), p0, "wrong first packet");
+  NS_TEST_EXPECT_MSG_EQ (portal->Recv (), p1, "wrong second packet");
+  bool empty = !portal->Recv ();
+  NS_TEST_EXPECT_MSG_EQ (empty, true, "queue should be empty");
+
+  portal->Close ();
+  portal = 0;
+  node = 0;
+}
+EndTest ()
+
+BeginTest (RecvQueueDropHead)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+
+  CCNxStackHelper ccnx;
+  ccnx.Install (node);
+
+  TypeId tid = TypeId::LookupByName ("ns3::ccnx::CCNxMessagePortalFactory");
+  Ptr<CCNxMessagePortal> portal = DynamicCast<CCNxMessagePortal> (CCNxPortal::CreatePortal (node, tid));
+  portal->SetAttribute ("RecvQueueCapacity", UintegerValue (2));
+  portal->SetAttribute ("RecvQueueOverflow", EnumValue (CCNxMessagePortal::RecvQueueOverflow_DropHead));
+
+  Ptr<CCNxPacket> p0 = CreateInterestPacket (0);
+  Ptr<CCNxPacket> p1 = CreateInterestPacket (1);
+  Ptr<CCNxPacket> p2 = CreateInterestPacket (2);
+  portal->ReceiveFromLayer3 (p0, Ptr<CCNxConnection> ());
+  portal->ReceiveFromLayer3 (p1, Ptr<CCNxConnection> ());
+  NS_TEST_EXPECT_MSG_EQ (portal->ReceiveFromLayer3 (p2, Ptr<CCNxConnection> ()), true, "p2 should be queued");
+  NS_TEST_EXPECT_MSG_EQ (portal->GetRecvQueueSize (), 2, "wrong queue size");
+  NS_TEST_EXPECT_MSG_EQ (portal->GetRecvQueueDrops (), 1, "wrong drop count");
+
+  NS_TEST_EXPECT_MSG_EQ (portal->Recv (), p1, "p0 should have been dropped");
+  NS_TEST_EXPECT_MSG_EQ (portal->Recv (), p2, "wrong second packet");
+
+  portal->Close ();
+  portal = 0;
+  node = 0;
+}
+EndTest ()
+
+/**
+ * An unbounded queue grows while wrapped around the end of the ring, and RecvBatch()
+ * returns the packets in order.
+ */
+BeginTest (RecvBatchInOrder)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+
+  CCNxStackHelper ccnx;
+  ccnx.Install (node);
+
+  TypeId tid = TypeId::LookupByName ("ns3::ccnx::CCNxMessagePortalFactory");
+  Ptr<CCNxMessagePortal> portal = DynamicCast<CCNxMessagePortal> (CCNxPortal::CreatePortal (node, tid));
+
+  std::vector< Ptr<CCNxPacket> > sent;
+  for (int i = 0; i < 40; i++)
+    {
+      sent.push_back (CreateInterestPacket (i));
+    }
+
+  // Move the head of the ring off of slot 0 before it grows
+  for (int i = 0; i < 10; i++)
+    {
+      portal->ReceiveFromLayer3 (sent[i], Ptr<CCNxConnection> ());
+    }
+  CCNxPortal::PacketBatchType packets;
+  NS_TEST_EXPECT_MSG_EQ (portal->RecvBatch (packets, 5), 5, "wrong batch size");
+  for (int i = 10; i < 40; i++)
+    {
+      portal->ReceiveFromLayer3 (sent[i], Ptr<CCNxConnection> ());
+    }
+  NS_TEST_EXPECT_MSG_EQ (portal->GetRecvQueueSize (), 35, "wrong queue size");
+
+  NS_TEST_EXPECT_MSG_EQ (portal->RecvBatch (packets, 100), 35, "wrong batch size");
+  NS_TEST_EXPECT_MSG_EQ (packets.size (), 40, "wrong total");
+  for (int i = 0; i < 40; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (packets[i], sent[i], "wrong packet at " << i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (portal->RecvBatch (packets, 100), 0, "queue should be empty");
+  NS_TEST_EXPECT_MSG_EQ (portal->GetRecvQueueDrops (), 0, "unbounded queue should not drop");
+
+  portal->Close ();
+  portal = 0;
+  node = 0;
+}
+EndTest ()
+
+BeginTest (SendBatchToPrefix)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+
+  CCNxStackHelper ccnx;
+  ccnx.Install (node);
+
+  TypeId tid = TypeId::LookupByName ("ns3::ccnx::CCNxMessagePortalFactory");
+
+  Ptr<CCNxPortal> sendPortal = CCNxPortal::CreatePortal (node, tid);
+  Ptr<CCNxPortal> recvPortal = CCNxPortal::CreatePortal (node, tid);
+  recvPortal->SetRecvCallback (MakeCallback (&SendBatchToPrefix::ReceiveBatch, this));
+  sendPortal->SetDataSentCallback (MakeCallback (&SendBatchToPrefix::DataSent, this));
+  Ptr<CCNxName> recvName = Create<CCNxName> ("ccnx:/name=foo/name=sink");
+  recvPortal->RegisterPrefix (recvName);
+
+  CCNxPortal::PacketBatchType packets;
+  for (int i = 0; i < 3; i++)
+    {
+      packets.push_back (CreateInterestPacket (i));
+    }
+
+  m_received = 0;
+  m_dataSent = 0;
+  NS_TEST_EXPECT_MSG_EQ (sendPortal->SendBatch (packets), 3, "wrong sent count");
+  NS_TEST_EXPECT_MSG_EQ (m_dataSent, 3, "wrong data sent callbacks");
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_received, 3, "wrong received count");
+
+  recvPortal->UnregisterPrefix (recvName);
+  sendPortal->Close ();
+  recvPortal->Close ();
+  sendPortal = 0;
+  recvPortal = 0;
+  node = 0;
+}
+
+unsigned m_received;
+unsigned m_dataSent;
+
+void ReceiveBatch (Ptr<CCNxPortal> portal)
+{
+  CCNxPortal::PacketBatchType packets;
+  m_received += portal->RecvBatch (packets, 16);
+}
+
+void DataSent (Ptr<CCNxPortal> portal, Ptr<CCNxPacket> packet)
+{
+  m_dataSent++;
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -225,6 +399,10 @@ public:
     AddTestCase (new GetCCNx (), TestCase::QUICK);
     AddTestCase (new SendRecv (), TestCase::QUICK);
     AddTestCase (new SendToRecvFrom (), TestCase::QUICK);
+    AddTestCase (new RecvQueueDropTail (), TestCase::QUICK);
+    AddTestCase (new RecvQueueDropHead (), TestCase::QUICK);
+    AddTestCase (new RecvBatchInOrder (), TestCase::QUICK);
+    AddTestCase (new SendBatchToPrefix (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxMessagePortal;
 
@@ -112,7 +112,7 @@ public:
   }
 
   void
-  SetTimer (ns3::Timer &timer, ns3::Time interval, ns3::Time jitter)
+  SetTimer (ns3::ccnx::NfpTimer &timer, ns3::Time interval, ns3::Time jitter)
   {
     m_nfp->SetTimer (timer, interval, jitter);
   }
@@ -123,7 +123,7 @@ public:
     m_nfp->DoInitialize ();
   }
 
-  ns3::Timer *
+  ns3::ccnx::NfpTimer *
   GetHelloTimer ()
   {
     return &m_nfp->m_helloTimer;
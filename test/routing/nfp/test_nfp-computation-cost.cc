@@ -117,6 +117,23 @@ BeginTest (IncrementLoopIterationsCount)
 }
 EndTest ()
 
+BeginTest (IncrementTimerCounts)
+{
+  NfpComputationCost a;
+  a.IncrementTimerEvents();
+  a.IncrementTimerEvents(4);
+  a.IncrementTimerExpirations();
+  NS_TEST_ASSERT_MSG_EQ(a.GetTimerEvents(), 5, "Wrong timer event count");
+  NS_TEST_ASSERT_MSG_EQ(a.GetTimerExpirations(), 1, "Wrong timer expiration count");
+  NS_TEST_ASSERT_MSG_EQ(a.GetTotalCost(), 0, "Timer counts are not part of the total");
+
+  NfpComputationCost b(a);
+  b += a;
+  NS_TEST_ASSERT_MSG_EQ(b.GetTimerEvents(), 10, "Wrong summed timer event count");
+  NS_TEST_ASSERT_MSG_NE(a, b, "a should not equal b");
+}
+EndTest ()
+
 BeginTest (OperatorPlus)
 {
 }
@@ -169,6 +186,7 @@ public:
     AddTestCase (new IncrementEvents (), TestCase::QUICK);
     AddTestCase (new IncrementLoopIterations (), TestCase::QUICK);
     AddTestCase (new IncrementLoopIterationsCount (), TestCase::QUICK);
+    AddTestCase (new IncrementTimerCounts (), TestCase::QUICK);
     AddTestCase (new OperatorPlus (), TestCase::QUICK);
     AddTestCase (new OperatorPlusEquals (), TestCase::QUICK);
     AddTestCase (new OperatorEqualEqual (), TestCase::QUICK);
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-digest-request.h"
+#include "ns3/ccnx-codec-name.h"
+#include "ns3/ccnx-tlv.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace NfpDigestRequestTests {
+
+BeginTest (TestConstructor_NoArg)
+{
+  Ptr<NfpDigestRequest> request = Create<NfpDigestRequest> ();
+  bool success = (request);
+  NS_TEST_ASSERT_MSG_EQ (success, true, "Got null NfpDigestRequest");
+  NS_TEST_EXPECT_MSG_EQ (request->IsDigestRequest (), true, "Should be a digest request");
+  NS_TEST_EXPECT_MSG_EQ (request->IsDigest (), false, "Should not be a digest");
+}
+EndTest ()
+
+BeginTest (TestConstructor_Args)
+{
+  Ptr<const CCNxName> routerName = Create<CCNxName> ("ccnx:/name=router");
+  Ptr<NfpDigestRequest> request = Create<NfpDigestRequest> (routerName, 0x80000001);
+  NS_TEST_EXPECT_MSG_EQ (request->GetRouterName (), routerName, "Wrong router name");
+  NS_TEST_EXPECT_MSG_EQ (request->GetBucketMask (), 0x80000001, "Wrong bucket mask");
+}
+EndTest ()
+
+BeginTest (TestGetSerializedSize)
+{
+  Ptr<const CCNxName> routerName = Create<CCNxName> ("ccnx:/name=router");
+  CCNxCodecName codec;
+  codec.SetHeader (routerName);
+
+  uint32_t expected = CCNxTlv::GetTLSize () + codec.GetSerializedSize () + 4;
+  Ptr<NfpDigestRequest> request = Create<NfpDigestRequest> (routerName, 1);
+  NS_TEST_EXPECT_MSG_EQ (request->GetSerializedSize (), expected, "GetSerializedSize() incorrect");
+}
+EndTest ()
+
+BeginTest (TestSerialize)
+{
+  Ptr<const CCNxName> routerName = Create<CCNxName> ("ccnx:/name=router");
+  Ptr<NfpDigestRequest> request = Create<NfpDigestRequest> (routerName, 0x01020304);
+
+  uint8_t expected[] = {
+    0, 8, 0, 18,
+    0, 0, 0, 10,
+    0, 1, 0, 6, 'r', 'o', 'u', 't', 'e', 'r',
+    1, 2, 3, 4
+  };
+
+  Buffer actual (0);
+  actual.AddAtStart (request->GetSerializedSize ());
+  request->Serialize (actual.Begin ());
+
+  int result = memcmp (expected, actual.PeekData (), sizeof (expected));
+  if (result != 0)
+    {
+      hexdump ("expected", sizeof(expected), expected);
+      hexdump ("actual", actual.GetSize (), actual.PeekData ());
+    }
+  NS_TEST_ASSERT_MSG_EQ (result, 0, "Incorrect serialized form");
+}
+EndTest ()
+
+BeginTest (TestDeserialize)
+{
+  Ptr<const CCNxName> routerName = Create<CCNxName> ("ccnx:/name=router");
+  Ptr<NfpDigestRequest> request = Create<NfpDigestRequest> (routerName, 0xF00F);
+
+  Buffer truth (0);
+  truth.AddAtStart (request->GetSerializedSize ());
+  request->Serialize (truth.Begin ());
+
+  Ptr<NfpDigestRequest> test = Create<NfpDigestRequest> ();
+  uint32_t length = test->Deserialize (truth.Begin ());
+
+  NS_TEST_EXPECT_MSG_EQ (length, request->GetSerializedSize (), "Wrong deserialized length");
+  NS_TEST_ASSERT_MSG_EQ (request->Equals (*test), true, "Incorrect deserialize");
+}
+EndTest ()
+
+BeginTest (TestEquals)
+{
+  Ptr<NfpDigestRequest> base = Create<NfpDigestRequest> (Create<CCNxName> ("ccnx:/name=a"), 3);
+
+  struct
+  {
+    const char *routerName;
+    uint32_t mask;
+    bool result;
+  } testVectors[] = {
+    { "ccnx:/name=a", 3, true},
+    { "ccnx:/name=a", 2, false},
+    { "ccnx:/name=b", 3, false},
+    { NULL, 0, false}
+  };
+
+  for (int i = 0; testVectors[i].routerName != NULL; i++)
+    {
+      Ptr<NfpDigestRequest> other = Create<NfpDigestRequest> (Create<CCNxName> (testVectors[i].routerName), testVectors[i].mask);
+      bool test = (base->Equals (*other));
+      NS_TEST_ASSERT_MSG_EQ (testVectors[i].result, test, "Incorrect result");
+    }
+}
+EndTest ()
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for NfpDigestRequest
+ */
+static class TestSuiteNfpDigestRequest : public TestSuite
+{
+public:
+  TestSuiteNfpDigestRequest () : TestSuite ("nfp-digest-request", UNIT)
+  {
+    AddTestCase (new TestConstructor_NoArg (), TestCase::QUICK);
+    AddTestCase (new TestConstructor_Args (), TestCase::QUICK);
+    AddTestCase (new TestGetSerializedSize (), TestCase::QUICK);
+    AddTestCase (new TestSerialize (), TestCase::QUICK);
+    AddTestCase (new TestDeserialize (), TestCase::QUICK);
+    AddTestCase (new TestEquals (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpDigestRequest;
+}
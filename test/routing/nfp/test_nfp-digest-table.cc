@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-digest-table.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace NfpDigestTableTests {
+
+static Ptr<const CCNxName>
+CreatePrefix (int i)
+{
+  std::ostringstream nameString; nameString << "ccnx:/name=prefix/name=" << i;
+  return Create<CCNxName> (nameString.str ());
+}
+
+BeginTest (TestEmpty)
+{
+  NfpDigestTable table;
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 0, "Should be empty");
+
+  Ptr<NfpDigest> digest = table.CreateDigest ();
+  NS_TEST_EXPECT_MSG_EQ (digest->GetEntryCount (), 0, "Wrong entry count");
+  NS_TEST_EXPECT_MSG_EQ (table.Compare (digest), 0, "Table should match its own digest");
+}
+EndTest ()
+
+BeginTest (TestUpdateOrder)
+{
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+  NfpDigestTable a;
+  NfpDigestTable b;
+
+  for (int i = 0; i < 100; i++)
+    {
+      a.Update (anchor, CreatePrefix (i), 5, 1);
+    }
+
+  // same state, reverse order, with an old seqnum that is later replaced
+  for (int i = 99; i >= 0; i--)
+    {
+      b.Update (anchor, CreatePrefix (i), 4, 2);
+      b.Update (anchor, CreatePrefix (i), 5, 1);
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (a.size (), 100, "Wrong size");
+  NS_TEST_EXPECT_MSG_EQ (b.size (), 100, "Wrong size");
+  NS_TEST_EXPECT_MSG_EQ (a.Compare (b.CreateDigest ()), 0, "Digests should be equal");
+  NS_TEST_EXPECT_MSG_EQ (a.CreateDigest ()->Equals (*b.CreateDigest ()), true, "Digests should be equal");
+}
+EndTest ()
+
+BeginTest (TestCompare)
+{
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+  NfpDigestTable a;
+  NfpDigestTable b;
+
+  for (int i = 0; i < 100; i++)
+    {
+      a.Update (anchor, CreatePrefix (i), 5, 1);
+      b.Update (anchor, CreatePrefix (i), 5, 1);
+    }
+
+  // one changed seqnum only differs in its own bucket
+  b.Update (anchor, CreatePrefix (17), 6, 1);
+  uint32_t expected = 1u << NfpDigestTable::GetBucket (anchor, CreatePrefix (17));
+  NS_TEST_EXPECT_MSG_EQ (a.Compare (b.CreateDigest ()), expected, "Wrong mask for changed seqnum");
+
+  // a missing entry too
+  b.Update (anchor, CreatePrefix (17), 5, 1);
+  b.Remove (anchor, CreatePrefix (42));
+  expected = 1u << NfpDigestTable::GetBucket (anchor, CreatePrefix (42));
+  NS_TEST_EXPECT_MSG_EQ (a.Compare (b.CreateDigest ()), expected, "Wrong mask for removed entry");
+
+  b.Update (anchor, CreatePrefix (42), 5, 1);
+  NS_TEST_EXPECT_MSG_EQ (a.Compare (b.CreateDigest ()), 0, "Digests should be equal again");
+}
+EndTest ()
+
+BeginTest (TestBuckets)
+{
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+  NfpDigestTable table;
+  NfpDigestTable empty;
+
+  for (int i = 0; i < 100; i++)
+    {
+      table.Update (anchor, CreatePrefix (i), 5, 1);
+    }
+
+  uint32_t mask = 0x0000FFFF;
+  size_t expectedCount = 0;
+  for (int i = 0; i < 100; i++)
+    {
+      if (mask & (1u << NfpDigestTable::GetBucket (anchor, CreatePrefix (i))))
+        {
+          expectedCount++;
+        }
+    }
+
+  NfpDigestTable::KeyVectorType keys;
+  table.GetKeys (mask, keys);
+  NS_TEST_EXPECT_MSG_EQ (keys.size (), expectedCount, "Wrong key count");
+  for (size_t i = 0; i < keys.size (); i++)
+    {
+      bool inMask = mask & (1u << NfpDigestTable::GetBucket (keys[i].first, keys[i].second));
+      NS_TEST_EXPECT_MSG_EQ (inMask, true, "Key not in the requested buckets");
+    }
+
+  table.RemoveBuckets (mask);
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 100 - expectedCount, "Wrong size after RemoveBuckets");
+  NS_TEST_EXPECT_MSG_EQ (empty.Compare (table.CreateDigest ()) & mask, 0, "Removed buckets should be empty");
+
+  table.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 0, "Should be empty");
+  NS_TEST_EXPECT_MSG_EQ (empty.Compare (table.CreateDigest ()), 0, "Clear should empty all buckets");
+}
+EndTest ()
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for NfpDigestTable
+ */
+static class TestSuiteNfpDigestTable : public TestSuite
+{
+public:
+  TestSuiteNfpDigestTable () : TestSuite ("nfp-digest-table", UNIT)
+  {
+    AddTestCase (new TestEmpty (), TestCase::QUICK);
+    AddTestCase (new TestUpdateOrder (), TestCase::QUICK);
+    AddTestCase (new TestCompare (), TestCase::QUICK);
+    AddTestCase (new TestBuckets (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpDigestTable;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-digest.h"
+#include "ns3/ccnx-tlv.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace NfpDigestTests {
+
+static std::vector<uint64_t>
+CreateBuckets (uint64_t seed)
+{
+  std::vector<uint64_t> buckets;
+  for (size_t i = 0; i < NfpDigest::BucketCount; i++)
+    {
+      buckets.push_back (seed * (i + 1));
+    }
+  return buckets;
+}
+
+BeginTest (TestConstructor_NoArg)
+{
+  Ptr<NfpDigest> digest = Create<NfpDigest> ();
+  bool success = (digest);
+  NS_TEST_ASSERT_MSG_EQ (success, true, "Got null NfpDigest");
+  NS_TEST_EXPECT_MSG_EQ (digest->GetEntryCount (), 0, "Wrong entry count");
+  NS_TEST_EXPECT_MSG_EQ (digest->GetBucket (0), 0, "Wrong bucket");
+  NS_TEST_EXPECT_MSG_EQ (digest->IsDigest (), true, "Should be a digest");
+  NS_TEST_EXPECT_MSG_EQ (digest->IsAdvertise (), false, "Should not be an advertise");
+}
+EndTest ()
+
+BeginTest (TestConstructor_Args)
+{
+  std::vector<uint64_t> buckets = CreateBuckets (7);
+  Ptr<NfpDigest> digest = Create<NfpDigest> (12, buckets);
+  NS_TEST_EXPECT_MSG_EQ (digest->GetEntryCount (), 12, "Wrong entry count");
+  for (size_t i = 0; i < NfpDigest::BucketCount; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (digest->GetBucket (i), buckets[i], "Wrong bucket");
+    }
+}
+EndTest ()
+
+BeginTest (TestGetSerializedSize)
+{
+  uint32_t expected = CCNxTlv::GetTLSize () + 4 + NfpDigest::BucketCount * 8;
+  Ptr<NfpDigest> digest = Create<NfpDigest> (12, CreateBuckets (7));
+  NS_TEST_EXPECT_MSG_EQ (digest->GetSerializedSize (), expected, "GetSerializedSize() incorrect");
+}
+EndTest ()
+
+BeginTest (TestSerialize)
+{
+  Ptr<NfpDigest> digest = Create<NfpDigest> (0x01020304, CreateBuckets (0x0102030405060708ULL));
+
+  uint8_t expected[] = {
+    0, 7, 1, 4,
+    1, 2, 3, 4,
+    1, 2, 3, 4, 5, 6, 7, 8
+  };
+
+  Buffer actual (0);
+  actual.AddAtStart (digest->GetSerializedSize ());
+  digest->Serialize (actual.Begin ());
+
+  int result = memcmp (expected, actual.PeekData (), sizeof (expected));
+  if (result != 0)
+    {
+      hexdump ("expected", sizeof(expected), expected);
+      hexdump ("actual", actual.GetSize (), actual.PeekData ());
+    }
+  NS_TEST_ASSERT_MSG_EQ (result, 0, "Incorrect serialized form");
+}
+EndTest ()
+
+BeginTest (TestDeserialize)
+{
+  Ptr<NfpDigest> digest = Create<NfpDigest> (12, CreateBuckets (0x1234567890ULL));
+
+  Buffer truth (0);
+  truth.AddAtStart (digest->GetSerializedSize ());
+  digest->Serialize (truth.Begin ());
+
+  Ptr<NfpDigest> test = Create<NfpDigest> ();
+  uint32_t length = test->Deserialize (truth.Begin ());
+
+  NS_TEST_EXPECT_MSG_EQ (length, digest->GetSerializedSize (), "Wrong deserialized length");
+  NS_TEST_ASSERT_MSG_EQ (digest->Equals (*test), true, "Incorrect deserialize");
+}
+EndTest ()
+
+BeginTest (TestEquals)
+{
+  Ptr<NfpDigest> base = Create<NfpDigest> (12, CreateBuckets (7));
+
+  Ptr<NfpDigest> same = Create<NfpDigest> (12, CreateBuckets (7));
+  NS_TEST_EXPECT_MSG_EQ (base->Equals (*same), true, "Should be equal");
+
+  Ptr<NfpDigest> otherCount = Create<NfpDigest> (13, CreateBuckets (7));
+  NS_TEST_EXPECT_MSG_EQ (base->Equals (*otherCount), false, "Different count should not be equal");
+
+  std::vector<uint64_t> buckets = CreateBuckets (7);
+  buckets[NfpDigest::BucketCount - 1]++;
+  Ptr<NfpDigest> otherBucket = Create<NfpDigest> (12, buckets);
+  NS_TEST_EXPECT_MSG_EQ (base->Equals (*otherBucket), false, "Different bucket should not be equal");
+}
+EndTest ()
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for NfpDigest
+ */
+static class TestSuiteNfpDigest : public TestSuite
+{
+public:
+  TestSuiteNfpDigest () : TestSuite ("nfp-digest", UNIT)
+  {
+    AddTestCase (new TestConstructor_NoArg (), TestCase::QUICK);
+    AddTestCase (new TestConstructor_Args (), TestCase::QUICK);
+    AddTestCase (new TestGetSerializedSize (), TestCase::QUICK);
+    AddTestCase (new TestSerialize (), TestCase::QUICK);
+    AddTestCase (new TestDeserialize (), TestCase::QUICK);
+    AddTestCase (new TestEquals (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpDigest;
+}
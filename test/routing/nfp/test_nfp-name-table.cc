@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-name-table.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpNameTable {
+
+typedef NfpNameTable<int> TableType;
+
+static void
+FillTable (TableType &table)
+{
+  table[Create<CCNxName> ("ccnx:/name=ccc")] = 3;
+  table[Create<CCNxName> ("ccnx:/name=aaa")] = 1;
+  table[Create<CCNxName> ("ccnx:/name=bbb")] = 2;
+}
+
+BeginTest (Ordered)
+{
+  TableType table;
+  NS_TEST_EXPECT_MSG_EQ (table.IsHashed (), false, "Default should be ordered");
+  FillTable (table);
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 3, "Wrong size");
+
+  // a different name object with the same value finds the entry
+  TableType::const_iterator i = table.find (Create<CCNxName> ("ccnx:/name=bbb"));
+  NS_TEST_ASSERT_MSG_EQ ((i != table.end ()), true, "Did not find bbb");
+  NS_TEST_EXPECT_MSG_EQ (i->second, 2, "Wrong value");
+
+  // iteration is in name order
+  int expected = 1;
+  for (i = table.begin (); i != table.end (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (i->second, expected, "Wrong iteration order");
+      expected++;
+    }
+
+  bool missing = (table.find (Create<CCNxName> ("ccnx:/name=ddd")) == table.end ());
+  NS_TEST_EXPECT_MSG_EQ (missing, true, "Should not find ddd");
+}
+EndTest ()
+
+BeginTest (Hashed)
+{
+  TableType table;
+  table.SetHashed (true);
+  table.reserve (16);
+  NS_TEST_EXPECT_MSG_EQ (table.IsHashed (), true, "Should be hashed");
+  FillTable (table);
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 3, "Wrong size");
+
+  // updating an existing name does not add an entry
+  table[Create<CCNxName> ("ccnx:/name=bbb")] = 20;
+  NS_TEST_EXPECT_MSG_EQ (table.size (), 3, "Wrong size after update");
+
+  TableType::const_iterator i = table.find (Create<CCNxName> ("ccnx:/name=bbb"));
+  NS_TEST_ASSERT_MSG_EQ ((i != table.cend ()), true, "Did not find bbb");
+  NS_TEST_EXPECT_MSG_EQ (i->second, 20, "Wrong value");
+
+  // every entry is visited once, in no particular order
+  int sum = 0;
+  size_t count = 0;
+  for (i = table.cbegin (); i != table.cend (); ++i)
+    {
+      sum += (*i).second;
+      count++;
+    }
+  NS_TEST_EXPECT_MSG_EQ (count, 3, "Wrong iteration count");
+  NS_TEST_EXPECT_MSG_EQ (sum, 24, "Wrong iteration sum");
+
+  bool missing = (table.find (Create<CCNxName> ("ccnx:/name=ddd")) == table.end ());
+  NS_TEST_EXPECT_MSG_EQ (missing, true, "Should not find ddd");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpNameTable
+ */
+static class TestSuiteNfpNameTable : public TestSuite
+{
+public:
+  TestSuiteNfpNameTable () : TestSuite ("nfp-name-table", UNIT)
+  {
+    AddTestCase (new Ordered (), TestCase::QUICK);
+    AddTestCase (new Hashed (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpNameTable;
+
+} // namespace TestSuiteNfpNameTable
@@ -58,6 +58,8 @@
 
 #include "ns3/log.h"
 #include "ns3/nfp-payload.h"
+#include "ns3/nfp-digest.h"
+#include "ns3/nfp-digest-request.h"
 #include "ns3/ccnx-name.h"
 #include "ns3/ccnx-codec-name.h"
 #include "ns3/ccnx-tlv.h"
@@ -265,6 +267,26 @@ BeginTest (TestDeserialize)
 }
 EndTest ()
 
+BeginTest (TestDeserializeDigest)
+{
+  TestState state;
+  Ptr<NfpPayload> payload = Create<NfpPayload> (1000, state.routerName, state.messageSeqnum);
+  payload->AppendMessage (Create<NfpDigest> (2, std::vector<uint64_t> (NfpDigest::BucketCount, 0x0102030405060708ULL)));
+  payload->AppendMessage (Create<NfpDigestRequest> (state.anchorName, 0x00000005));
+
+  Buffer truth (0);
+  truth.AddAtStart (payload->GetSerializedSize ());
+  payload->Serialize (truth.Begin ());
+
+  Ptr<NfpPayload> test = Create<NfpPayload> ();
+  test->Deserialize (truth.Begin ());
+
+  NS_TEST_ASSERT_MSG_EQ (payload->Equals (*test), true, "Incorrect deserialize");
+  NS_TEST_EXPECT_MSG_EQ (test->GetMessage (0)->IsDigest (), true, "Message 0 should be a digest");
+  NS_TEST_EXPECT_MSG_EQ (test->GetMessage (1)->IsDigestRequest (), true, "Message 1 should be a digest request");
+}
+EndTest ()
+
 /**
  * \ingroup ccnx-test
  *
@@ -285,6 +307,7 @@ public:
     AddTestCase (new TestGetSerializedSize (), TestCase::QUICK);
     AddTestCase (new TestSerialize (), TestCase::QUICK);
     AddTestCase (new TestDeserialize (), TestCase::QUICK);
+    AddTestCase (new TestDeserializeDigest (), TestCase::QUICK);
   }
 } g_TestSuiteNfpPayload;
 }
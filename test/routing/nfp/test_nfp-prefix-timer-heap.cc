@@ -201,6 +201,50 @@ BeginTest (Duplicates)
 
 }
 EndTest ()
+
+BeginTest (IndexedUpdateInPlace)
+{
+  // In indexed mode a duplicate (prefix, anchor) moves the existing entry instead of
+  // adding a second one, so the heap size is the number of distinct keys.
+  NfpPrefixTimerHeap heap;
+  heap.SetIndexed (true);
+
+  Ptr<CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+  heap.Insert (Create<CCNxName> ("ccnx:/name=aaa"), anchor, Seconds (1700));
+  heap.Insert (Create<CCNxName> ("ccnx:/name=bbb"), anchor, Seconds (1500));
+  heap.Insert (Create<CCNxName> ("ccnx:/name=ccc"), anchor, Seconds (1600));
+  heap.Insert (Create<CCNxName> ("ccnx:/name=ddd"), anchor, Seconds (1400));
+  heap.Insert (Create<CCNxName> ("ccnx:/name=eee"), anchor, Seconds (1300));
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 5, "Wrong heap size");
+
+  // decrease key: aaa moves to the top
+  heap.Insert (Create<CCNxName> ("ccnx:/name=aaa"), anchor, Seconds (1000));
+  // increase key: eee moves to the bottom
+  heap.Insert (Create<CCNxName> ("ccnx:/name=eee"), anchor, Seconds (2000));
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 5, "Duplicates should not change the heap size");
+
+  const char *order[] = { "ccnx:/name=aaa", "ccnx:/name=ddd", "ccnx:/name=bbb", "ccnx:/name=ccc", "ccnx:/name=eee", NULL };
+  Time expiry[] = { Seconds (1000), Seconds (1400), Seconds (1500), Seconds (1600), Seconds (2000) };
+  for (int i = 0; order[i] != NULL; i++)
+    {
+      Ptr<const NfpPrefixTimerEntry> entry = heap.Peek ();
+      bool found = (entry);
+      NS_TEST_ASSERT_MSG_EQ (found, true, "Heap empty at index " << i);
+      NS_TEST_EXPECT_MSG_EQ (Create<CCNxName> (order[i])->Equals (*entry->GetPrefix ()), true, "Prefix wrong order " << i);
+      NS_TEST_EXPECT_MSG_EQ (entry->GetTime (), expiry[i], "Time wrong order " << i);
+      heap.Pop ();
+    }
+
+  bool empty = !heap.Peek ();
+  NS_TEST_EXPECT_MSG_EQ (empty, true, "Heap should be empty");
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 0, "Heap should be empty");
+
+  // A popped key can be inserted again
+  heap.Insert (Create<CCNxName> ("ccnx:/name=aaa"), anchor, Seconds (3000));
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 1, "Wrong heap size after re-insert");
+}
+EndTest ()
+
 /**
  * \ingroup ccnx-test
  *
@@ -213,6 +257,7 @@ public:
   {
     AddTestCase (new NoDuplicates (), TestCase::QUICK);
     AddTestCase (new Duplicates (), TestCase::QUICK);
+    AddTestCase (new IndexedUpdateInPlace (), TestCase::QUICK);
   }
 } g_TestSuiteNfpPrefixTimerHeap;
 }
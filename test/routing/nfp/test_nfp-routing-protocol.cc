@@ -57,6 +57,7 @@
 #include <map>
 #include "ns3/log.h"
 #include "ns3/test.h"
+#include "ns3/boolean.h"
 #include "ns3/type-id.h"
 #include "ns3/ccnx-stack-helper.h"
 #include "ns3/ccnx-packet.h"
@@ -230,7 +231,7 @@ BeginTest (TestSetTimer_NoJitter)
 
   Time jitter (0);
   Time interval (Seconds (1));
-  Timer timer;
+  NfpTimer timer;
   timer.SetFunction (&TestSetTimer_NoJitter::TimerExpire, this);
   theFriend.SetTimer (timer, interval, jitter);
 
@@ -255,7 +256,7 @@ BeginTest (TestSetTimer_WithJitter)
 
   Time jitter (MilliSeconds (50));
   Time interval (Seconds (1));
-  Timer timer;
+  NfpTimer timer;
   timer.SetFunction (&TestSetTimer_WithJitter::TimerExpire, this);
   theFriend.SetTimer (timer, interval, jitter);
 
@@ -637,6 +638,101 @@ SendCallback (Ptr<Packet> packet, const Address& source,
 }
 EndTest ()
 
+/**
+ * The send callback of a tap device that is connected to `peer`: deliver the packet to `peer`
+ * after 100 microseconds.
+ */
+static bool
+DeliverToPeer (Ptr<VirtualNetDevice> peer, Ptr<Packet> packet, const Address& source,
+               const Address& dest, uint16_t protocolNumber)
+{
+  Simulator::ScheduleWithContext (peer->GetNode ()->GetId (), MicroSeconds (100),
+                                  &VirtualNetDevice::Receive, peer, packet->Copy (),
+                                  protocolNumber, source, dest,
+                                  NetDevice::PACKET_BROADCAST);
+  return true;
+}
+
+static bool
+DiscardPacket (Ptr<Packet> packet, const Address& source,
+               const Address& dest, uint16_t protocolNumber)
+{
+  return true;
+}
+
+/**
+ * Make a point-to-point link out of two tap devices
+ */
+static void
+ConnectTapDevices (Ptr<VirtualNetDevice> a, Ptr<VirtualNetDevice> b)
+{
+  a->SetSendCallback (MakeBoundCallback (&DeliverToPeer, b));
+  b->SetSendCallback (MakeBoundCallback (&DeliverToPeer, a));
+}
+
+BeginTest (TestAntiEntropy_RoutesDoNotExpire)
+{
+  std::cout << GetName() << ".DoRun()" << std::endl;
+
+  // A line of three routers: anchor - middle - edge
+  Ptr<Node> anchorNode = Create<Node> ();
+  Ptr<Node> middleNode = Create<Node> ();
+  Ptr<Node> edgeNode = Create<Node> ();
+  Ptr<NfpRoutingProtocol> anchor = CreateProtocol (anchorNode);
+  Ptr<NfpRoutingProtocol> middle = CreateProtocol (middleNode);
+  Ptr<NfpRoutingProtocol> edge = CreateProtocol (edgeNode);
+
+  Time routeTimeout = Seconds (15);
+  anchor->SetAttribute ("AntiEntropy", BooleanValue (true));
+  middle->SetAttribute ("AntiEntropy", BooleanValue (true));
+  edge->SetAttribute ("AntiEntropy", BooleanValue (true));
+  middle->SetAttribute ("RouteTimeout", TimeValue (routeTimeout));
+  edge->SetAttribute ("RouteTimeout", TimeValue (routeTimeout));
+
+  // The anchor floods a new sequence number only every two route timeouts, so a route that is
+  // only refreshed by that flood would expire in between.  The digests must keep it up.
+  anchor->SetAttribute ("RouteTimeout", TimeValue (routeTimeout + routeTimeout));
+
+  ConnectTapDevices (SetupTapDevice (anchorNode, 1, MakeCallback (&DiscardPacket)),
+                     SetupTapDevice (middleNode, 2, MakeCallback (&DiscardPacket)));
+  ConnectTapDevices (SetupTapDevice (middleNode, 3, MakeCallback (&DiscardPacket)),
+                     SetupTapDevice (edgeNode, 4, MakeCallback (&DiscardPacket)));
+
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=apple/name=pie");
+  Simulator::ScheduleWithContext (anchorNode->GetId (), Seconds (1), &NfpRoutingProtocol::AddAnchorPrefix, anchor, prefix);
+
+  // Check once a second from convergence through six route timeouts
+  m_checks = 0;
+  m_unreachable = 0;
+  for (int64_t t = 10; t < 100; t++)
+    {
+      Simulator::Schedule (Seconds (t), &TestAntiEntropy_RoutesDoNotExpire::CheckReachable, this, middle, edge);
+    }
+
+  Simulator::Stop (Seconds (100));
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_checks, 90, "Wrong number of checks");
+  NS_TEST_EXPECT_MSG_EQ (m_unreachable, 0, "Routes expired in anti-entropy mode");
+
+  Simulator::Destroy ();
+}
+
+void
+CheckReachable (Ptr<NfpRoutingProtocol> middle, Ptr<NfpRoutingProtocol> edge)
+{
+  m_checks++;
+  if (middle->GetReachablePrefixCount () != 1 || edge->GetReachablePrefixCount () != 1)
+    {
+      std::cout << "Prefix unreachable at " << Simulator::Now ().GetSeconds () << " seconds" << std::endl;
+      m_unreachable++;
+    }
+}
+
+int m_checks;
+int m_unreachable;
+EndTest ()
+
 // =================================
 // Finally, define the TestSuite
 
@@ -670,6 +766,7 @@ public:
     AddTestCase (new TestReceiveHello_Update (), TestCase::QUICK);
     AddTestCase (new TestReceiveNotify_Hello (), TestCase::QUICK);
     AddTestCase (new TestHelloExpired (), TestCase::QUICK);
+    AddTestCase (new TestAntiEntropy_RoutesDoNotExpire (), TestCase::QUICK);
 
     //      AddTestCase (new TestReceivePayload_ForSelf (), TestCase::QUICK);
   }
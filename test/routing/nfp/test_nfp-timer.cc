@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-timer.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace NfpTimerTests {
+
+BeginTest (TestSchedule_NoWheel)
+{
+  NfpTimer timer;
+  timer.SetFunction (&TestSchedule_NoWheel::Expire, this);
+  timer.SetDelay (Seconds (1));
+  NS_TEST_EXPECT_MSG_EQ (timer.GetDelay (), Seconds (1), "Wrong delay");
+  NS_TEST_EXPECT_MSG_EQ (timer.IsRunning (), false, "Timer should not be running");
+
+  m_count = 0;
+  timer.Schedule ();
+  NS_TEST_EXPECT_MSG_EQ (timer.IsRunning (), true, "Timer should be running");
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_count, 1, "Timer should fire once");
+  NS_TEST_EXPECT_MSG_EQ (m_fired, Seconds (1), "Timer fired at the wrong time");
+  NS_TEST_EXPECT_MSG_EQ (timer.IsRunning (), false, "Timer should not be running");
+}
+
+int m_count;
+Time m_fired;
+
+void Expire (void)
+{
+  m_count++;
+  m_fired = Simulator::Now ();
+}
+EndTest ()
+
+BeginTest (TestSchedule_Wheel)
+{
+  Ptr<NfpTimingWheel> wheel = Create<NfpTimingWheel> (MilliSeconds (10));
+  NfpTimer timer;
+  timer.SetTimingWheel (wheel);
+  timer.SetFunction (&TestSchedule_Wheel::Expire, this);
+  timer.SetDelay (MilliSeconds (15));
+
+  m_count = 0;
+  timer.Schedule ();
+  NS_TEST_EXPECT_MSG_EQ (timer.IsRunning (), true, "Timer should be running");
+  NS_TEST_EXPECT_MSG_EQ (wheel->GetPendingCount (), 1, "Timer should be in the wheel");
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_count, 1, "Timer should fire once");
+  NS_TEST_EXPECT_MSG_EQ (m_fired, MilliSeconds (20), "Timer should fire at the next tick");
+  NS_TEST_EXPECT_MSG_EQ (timer.IsRunning (), false, "Timer should not be running");
+}
+
+int m_count;
+Time m_fired;
+
+void Expire (void)
+{
+  m_count++;
+  m_fired = Simulator::Now ();
+}
+EndTest ()
+
+BeginTest (TestCancel)
+{
+  Ptr<NfpTimingWheel> wheels[] = { Ptr<NfpTimingWheel> (), Create<NfpTimingWheel> (MilliSeconds (10)) };
+  for (int w = 0; w < 2; w++)
+    {
+      NfpTimer timer;
+      timer.SetTimingWheel (wheels[w]);
+      timer.SetFunction (&TestCancel::Expire, this);
+      timer.SetDelay (Seconds (1));
+
+      m_count = 0;
+      timer.Schedule ();
+      timer.Cancel ();
+      NS_TEST_EXPECT_MSG_EQ (timer.IsRunning (), false, "Timer should not be running");
+
+      // can be scheduled again after a cancel
+      timer.Schedule ();
+      timer.Cancel ();
+
+      Simulator::Run ();
+      Simulator::Destroy ();
+
+      NS_TEST_EXPECT_MSG_EQ (m_count, 0, "Cancelled timer should not fire");
+    }
+}
+
+int m_count;
+
+void Expire (void)
+{
+  m_count++;
+}
+EndTest ()
+
+BeginTest (TestDestroy)
+{
+  Ptr<NfpTimingWheel> wheel = Create<NfpTimingWheel> (MilliSeconds (10));
+  NfpTimer *timer = new NfpTimer ();
+  timer->SetTimingWheel (wheel);
+  timer->SetFunction (&TestDestroy::Expire, this);
+  timer->SetDelay (Seconds (1));
+  timer->Schedule ();
+  delete timer;
+
+  NS_TEST_EXPECT_MSG_EQ (wheel->GetPendingCount (), 0, "Destroyed timer should be cancelled");
+
+  m_count = 0;
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_count, 0, "Destroyed timer should not fire");
+}
+
+int m_count;
+
+void Expire (void)
+{
+  m_count++;
+}
+EndTest ()
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for NfpTimer
+ */
+static class TestSuiteNfpTimer : public TestSuite
+{
+public:
+  TestSuiteNfpTimer () : TestSuite ("nfp-timer", UNIT)
+  {
+    AddTestCase (new TestSchedule_NoWheel (), TestCase::QUICK);
+    AddTestCase (new TestSchedule_Wheel (), TestCase::QUICK);
+    AddTestCase (new TestCancel (), TestCase::QUICK);
+    AddTestCase (new TestDestroy (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpTimer;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-timing-wheel.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace NfpTimingWheelTests {
+
+/**
+ * Without a resolution, each timer is its own simulator event at its exact time.
+ */
+BeginTest (TestPassThrough)
+{
+  Ptr<NfpTimingWheel> wheel = Create<NfpTimingWheel> (Time (0));
+  m_count = 0;
+  for (int i = 1; i <= 5; i++)
+    {
+      wheel->Schedule (MilliSeconds (i), MakeCallback (&TestPassThrough::Expire, this));
+    }
+  NS_TEST_EXPECT_MSG_EQ (wheel->GetPendingCount (), 5, "Wrong pending count");
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_count, 5, "Wrong expired count");
+  NS_TEST_EXPECT_MSG_EQ (wheel->GetPendingCount (), 0, "Wheel should be empty");
+  NS_TEST_EXPECT_MSG_EQ (wheel->GetComputationCost ().GetTimerEvents (), 5, "Wrong timer events");
+  NS_TEST_EXPECT_MSG_EQ (wheel->GetComputationCost ().GetTimerExpirations (), 5, "Wrong timer expirations");
+}
+
+int m_count;
+
+void Expire (void)
+{
+  m_count++;
+  NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), MilliSeconds (m_count), "Pass-through timer at the wrong time");
+}
+EndTest ()
+
+/**
+ * With a resolution, timers fire no earlier than their time and at most one tick late, and
+ * all the timers of one tick share one simulator event.
+ */
+BeginTest (TestBatching)
+{
+  Ptr<NfpTimingWheel> wheel = Create<NfpTimingWheel> (MilliSeconds (10));
+  for (int i = 1; i <= 100; i++)
+    {
+      wheel->Schedule (MilliSeconds (i), MakeCallback (&TestBatching::Expire, this));
+    }
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  // Timers in the same tick fire in the order they were scheduled
+  NS_TEST_ASSERT_MSG_EQ (m_times.size (), 100, "Wrong expired count");
+  for (int i = 1; i <= 100; i++)
+    {
+      Time expiry = MilliSeconds (i);
+      Time fired = m_times[i - 1];
+      NS_TEST_EXPECT_MSG_EQ ((fired >= expiry), true, "Timer " << i << " expired early at " << fired);
+      NS_TEST_EXPECT_MSG_EQ ((fired <= expiry + wheel->GetResolution ()), true, "Timer " << i << " expired late at " << fired);
+    }
+
+  NfpComputationCost cost = wheel->GetComputationCost ();
+  NS_TEST_EXPECT_MSG_EQ (cost.GetTimerExpirations (), 100, "Wrong timer expirations");
+  NS_TEST_EXPECT_MSG_EQ (cost.GetTimerEvents (), 10, "Expected one event per tick");
+}
+
+std::vector<Time> m_times;
+
+void Expire (void)
+{
+  m_times.push_back (Simulator::Now ());
+}
+EndTest ()
+
+/**
+ * A cancelled timer does not fire, in either mode.
+ */
+BeginTest (TestCancel)
+{
+  Time resolutions[] = { Time (0), MilliSeconds (10) };
+  for (int r = 0; r < 2; r++)
+    {
+      Ptr<NfpTimingWheel> wheel = Create<NfpTimingWheel> (resolutions[r]);
+      m_count = 0;
+      NfpTimingWheel::TimerId a = wheel->Schedule (Seconds (1), MakeCallback (&TestCancel::Expire, this));
+      NfpTimingWheel::TimerId b = wheel->Schedule (Seconds (2), MakeCallback (&TestCancel::Expire, this));
+      NS_TEST_EXPECT_MSG_EQ (wheel->IsPending (a), true, "a should be pending");
+
+      NS_TEST_EXPECT_MSG_EQ (wheel->Cancel (a), true, "Cancel should succeed");
+      NS_TEST_EXPECT_MSG_EQ (wheel->Cancel (a), false, "a is already cancelled");
+      NS_TEST_EXPECT_MSG_EQ (wheel->IsPending (a), false, "a should not be pending");
+
+      Simulator::Run ();
+      Simulator::Destroy ();
+
+      NS_TEST_EXPECT_MSG_EQ (m_count, 1, "Only b should fire");
+      NS_TEST_EXPECT_MSG_EQ (wheel->IsPending (b), false, "b should have fired");
+    }
+}
+
+int m_count;
+
+void Expire (void)
+{
+  m_count++;
+}
+EndTest ()
+
+/**
+ * A timer callback can schedule the next timer, as the protocol timers do.
+ */
+BeginTest (TestReschedule)
+{
+  m_wheel = Create<NfpTimingWheel> (MilliSeconds (1));
+  m_count = 0;
+  m_wheel->Schedule (Seconds (1), MakeCallback (&TestReschedule::Expire, this));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_count, 10, "Wrong expired count");
+  NS_TEST_EXPECT_MSG_EQ (m_wheel->GetPendingCount (), 0, "Wheel should be empty");
+}
+
+Ptr<NfpTimingWheel> m_wheel;
+int m_count;
+
+void Expire (void)
+{
+  m_count++;
+  NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), Seconds (m_count), "Timer at the wrong time");
+  if (m_count < 10)
+    {
+      m_wheel->Schedule (Seconds (1), MakeCallback (&TestReschedule::Expire, this));
+    }
+}
+EndTest ()
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for NfpTimingWheel
+ */
+static class TestSuiteNfpTimingWheel : public TestSuite
+{
+public:
+  TestSuiteNfpTimingWheel () : TestSuite ("nfp-timing-wheel", UNIT)
+  {
+    AddTestCase (new TestPassThrough (), TestCase::QUICK);
+    AddTestCase (new TestBatching (), TestCase::QUICK);
+    AddTestCase (new TestCancel (), TestCase::QUICK);
+    AddTestCase (new TestReschedule (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpTimingWheel;
+}
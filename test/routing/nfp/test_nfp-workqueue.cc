@@ -155,6 +155,27 @@ BeginTest (TestAddDuplicate)
 }
 EndTest ()
 
+BeginTest (TestHashedAddDuplicate)
+{
+  Ptr<NfpWorkQueue> queue = Create<NfpWorkQueue> ();
+  queue->SetHashed (true);
+
+  Ptr<CCNxName> a = Create<CCNxName> ("ccnx:/name=foo");
+  Ptr<CCNxName> p = Create<CCNxName> ("ccnx:/name=car");
+  queue->push_back (Create<NfpWorkQueueEntry> (a, p));
+  queue->push_back (Create<NfpWorkQueueEntry> (Create<CCNxName> ("ccnx:/name=foo"), Create<CCNxName> ("ccnx:/name=car")));
+  queue->push_back (Create<NfpWorkQueueEntry> (a, Create<CCNxName> ("ccnx:/name=bar")));
+  NS_TEST_EXPECT_MSG_EQ (queue->size (), 2, "Duplicate should not be added");
+
+  Ptr<NfpWorkQueueEntry> entry = queue->pop_front ();
+  NS_TEST_EXPECT_MSG_EQ (entry->GetPrefix ()->Equals (*p), true, "Wrong order");
+
+  // once popped, the same entry may be queued again
+  queue->push_back (Create<NfpWorkQueueEntry> (a, p));
+  NS_TEST_EXPECT_MSG_EQ (queue->size (), 2, "Entry should be added after pop");
+}
+EndTest ()
+
 /**
  * \ingroup ccnx-test
  *
@@ -168,6 +189,7 @@ public:
     AddTestCase (new TestConstructor (), TestCase::QUICK);
     AddTestCase (new TestAddUnique (), TestCase::QUICK);
     AddTestCase (new TestAddDuplicate (), TestCase::QUICK);
+    AddTestCase (new TestHashedAddDuplicate (), TestCase::QUICK);
   }
 } g_TestSuiteNfpWorkQueue;
 }